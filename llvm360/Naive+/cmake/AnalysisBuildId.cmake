@@ -0,0 +1,28 @@
+# Writes ANALYSIS_BUILD_ID, the SHA-1 of the sources that decide what the analysis cache holds
+# (decoder, flow passes, bounds, CFG, jump tables). A cache written by a build that decodes or
+# splits functions differently has another id and is rebuilt.
+# Runs at every build, the header is only rewritten when the id changes.
+#
+#   cmake -DSOURCE_DIR=<Naive+/src> -DOUTPUT=<header> -P AnalysisBuildId.cmake
+
+file(GLOB ANALYSIS_SOURCES
+    ${SOURCE_DIR}/Decoder/*
+    ${SOURCE_DIR}/Flow/*
+    ${SOURCE_DIR}/IR/FunctionBounds.*
+    ${SOURCE_DIR}/IR/FunctionCFG.*
+    ${SOURCE_DIR}/IR/JumpTable*
+    ${SOURCE_DIR}/Util.h
+    ${SOURCE_DIR}/LLVM360.cpp
+)
+list(SORT ANALYSIS_SOURCES)
+
+set(SOURCE_HASHES "")
+foreach(SOURCE ${ANALYSIS_SOURCES})
+    file(SHA1 ${SOURCE} SOURCE_HASH)
+    string(APPEND SOURCE_HASHES ${SOURCE_HASH})
+endforeach()
+string(SHA1 BUILD_ID "${SOURCE_HASHES}")
+
+file(WRITE ${OUTPUT}.tmp "#pragma once\n#define ANALYSIS_BUILD_ID \"${BUILD_ID}\"\n")
+configure_file(${OUTPUT}.tmp ${OUTPUT} COPYONLY)
+file(REMOVE ${OUTPUT}.tmp)
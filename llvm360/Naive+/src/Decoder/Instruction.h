@@ -1,16 +1,28 @@
 #pragma once
 #include <cstdint>
 #include <string>
-#include <vector>
+#include <type_traits>
+#include "Opcodes.h"
 
+// widest forms (rlwinm, vpkd3d128...) use 5 operands
+#define INSTR_MAX_OPS 5
+
+// decoded instruction, kept POD so storing millions of them is just a memcpy
 struct Instruction {
-  uint32_t address;
-  uint32_t instrWord;
-  std::string opcName;
+  uint32_t address = 0;
+  uint32_t instrWord = 0;
+  PPCOpcode opcode = OP_invalid;
+  uint8_t opsCount = 0;
+
+  uint32_t ops[INSTR_MAX_OPS] = {};
 
-  std::vector<uint32_t> ops;
+  inline const char *GetName() const {
+    return GetOpcodeName(opcode);
+  }
 
   inline operator std::string() {
-    return opcName;
+    return GetName();
   }
 };
+
+static_assert(std::is_trivially_copyable_v<Instruction>, "Instruction must stay trivially copyable");
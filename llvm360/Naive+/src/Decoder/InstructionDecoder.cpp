@@ -1,52 +1,8 @@
 #include "InstructionDecoder.h"
-
-// Instruction Bit Field
-class IBF {
-public:
-  IBF(const uint32_t instr)
-    : m_instr(instr) {
-  }
-
-  uint32_t GetAt(uint32_t bestart,
-    const uint32_t length,
-    const bool signExtend = false,
-    const int shift = 0) {
-    uint32_t start = (32 - bestart) - length;
-    const uint32_t mask = ((1 << length) - 1);
-    uint32_t bitSize = length;
-    uint32_t ext = (m_instr >> start) & mask;
-
-    // additional left shift
-    if (shift > 0) {
-      ext <<= shift;
-      bitSize += shift;
-    }
-
-    // if signed expand copy the sign bit
-    if (signExtend) {
-      const uint32_t signBitValue = ext & (1 << (bitSize - 1));
-      if (signBitValue != 0) {
-        const uint32_t signMask = ((uint32_t)-1) << bitSize;
-        ext |= signMask;
-      }
-    }
-
-    // right shift (always do that after sign conversion)
-    if (shift < 0) {
-      ext >>= (-shift);
-    }
-
-    // save value
-    return ext;
-  }
-
-  inline const uint32_t GetInstr() const {
-    return m_instr;
-  }
-
-private:
-  uint32_t m_instr = 0;
-};
+#include "misc/Platform.h"
+#include <cassert>
+#include <array>
+#include <initializer_list>
 
 InstructionDecoder::InstructionDecoder(const Section *imageSection) {
   m_imageSection = imageSection;
@@ -56,7 +12,7 @@ InstructionDecoder::InstructionDecoder(const Section *imageSection) {
                    (m_imageBaseAddress - imageSection->GetImage()->GetBaseAddress());
 }
 
-uint32_t InstructionDecoder::GetInstructionAt(uint32_t address, Instruction &instruction) {
+uint32_t InstructionDecoder::GetInstructionAt(uint32_t address, Instruction &instruction) const {
   // build input stream
   const uint64_t offset = address - m_imageBaseAddress;
   const uint8_t *stride = m_imageDataPtr + offset;
@@ -65,1308 +21,751 @@ uint32_t InstructionDecoder::GetInstructionAt(uint32_t address, Instruction &ins
 }
 
 static inline void SetInstr(Instruction &inst,
-  std::string name,
-  const std::vector<uint32_t> &operands) {
-  inst.opcName = name;
-  inst.ops = operands; // Use the raw pointer if required
+  const PPCOpcode opcode,
+  const std::initializer_list<uint32_t> operands) {
+  assert(operands.size() <= INSTR_MAX_OPS);
+  inst.opcode = opcode;
+  inst.opsCount = (uint8_t)operands.size();
+
+  // unused slots are zeroed so two decodes of the same word are byte identical
+  uint32_t i = 0;
+  for (const uint32_t op : operands)
+    inst.ops[i++] = op;
+  for (; i < INSTR_MAX_OPS; i++)
+    inst.ops[i] = 0;
 }
 
-#define INST(name, ...)                                                                            \
-  {                                                                                                \
-    SetInstr(instruction, name, std::vector<uint32_t>{__VA_ARGS__});                               \
-    return 4;                                                                                      \
-  }
-
+//
+// Table driven decoder
+// The opcode spec below lists every form we know as data, lookup tables keyed on the
+// primary opcode and on the extended opcode bits are built from it at compile time.
+// Decoding a word is one or two table loads and a call to the form handler, the handler
+// only extracts the fields that form actually uses.
 // https://www.nxp.com/docs/en/user-guide/MPCFPE_AD_R1.pdf
 //
-// *Stride* pointer to start of the 4 bytes of the instruction in memory
-// [out] instruction - the decoded instruction
-uint32_t InstructionDecoder::DecodeInstruction(const uint8_t *stride, Instruction &instruction) {
-    // Xenons PowerPC instructions are always 4 bytes long,
-    // this helps us to avoid instruction length decoding since
-    // we already know the length
-    // we can store it in a uint32 and use bitfields to extract the opcode and operands
-
-    // cause how it is stored in the stride we have to swap endians
-  uint32_t instr = SwapInstrBytes(*(uint32_t *)stride);
-    instruction.address = m_imageBaseAddress + (stride - m_imageDataPtr);
-    instruction.instrWord = instr;
-  IBF *ibf = new IBF(instr);
-
-    uint32_t opcode = ibf->GetAt(0, 6);
-    uint32_t ext21_10 = ibf->GetAt(21, 10);
-    uint32_t ext27_3 = ibf->GetAt(27, 3);
-    uint32_t ext22_9 = ibf->GetAt(22, 9);
-    uint32_t S = ibf->GetAt(6, 5);
-    uint32_t aa = ibf->GetAt(30, 1);
-    uint32_t b31_1 = ibf->GetAt(31, 1);
-    uint32_t b11_10 = ibf->GetAt(11, 10);
-    uint32_t spr5 = ibf->GetAt(11, 5);
-    uint32_t li = ibf->GetAt(6, 24, true, 2);
-    uint32_t ext26_5 = ibf->GetAt(26, 5);
-
-    uint32_t b11_5 = ibf->GetAt(11, 5);
-    uint32_t b9_2 = ibf->GetAt(9, 2);
-    uint32_t b6_5 = ibf->GetAt(6, 5);
-    uint32_t b12_8 = ibf->GetAt(12, 8);
-    uint32_t b7_8 = ibf->GetAt(7, 8);
-    uint32_t b11_1 = ibf->GetAt(11, 1);
-    uint32_t b16_16 = ibf->GetAt(16, 16);
-    uint32_t b16_14 = ibf->GetAt(16, 14);
-    uint32_t b16_5 = ibf->GetAt(16, 5);
-    uint32_t b6_3 = ibf->GetAt(6, 3);
-    uint32_t b10_1 = ibf->GetAt(10, 1);
-    uint32_t b21_5 = ibf->GetAt(21, 5);
-    uint32_t b26_1 = ibf->GetAt(26, 1);
-    uint32_t b21_1 = ibf->GetAt(21, 1);
-    uint32_t b26_5 = ibf->GetAt(26, 5);
-
-    uint32_t vshift28 = ibf->GetAt(28, 2, false, 5);
-    uint32_t vshift30 = ibf->GetAt(30, 2, false, 5);
-    uint32_t vshift26a = ibf->GetAt(21, 1, false, 6);
-    uint32_t vshift26b = ibf->GetAt(26, 1, false, 5);
-
-    // extended regs (full 128 regs)
-    uint32_t vreg6 = vshift28 + b6_5;
-    uint32_t vreg11 = vshift26a + vshift26b + b11_5;
-    uint32_t vreg16 = vshift30 + b16_5;
-
-    // The funny giant switch statement instruction decoder
-    switch (opcode) {
-
-    case 0:
-        INST("nop")
-
-    case 2:
-        INST("tdi", b6_5, b11_5, b16_16); // tdi TO,rA,SIMM
-    case 3:
-        INST("twi", b6_5, b11_5, b16_16); // twi TO,rA,SIMM
-
-        // VMX fun
-    case 4: {
-        uint32_t v21_11 = ibf->GetAt(21, 11);
-        uint32_t v26_6 = ibf->GetAt(26, 6);
-        uint32_t v21_7 = ibf->GetAt(21, 7);
-        uint32_t v21_1 = ibf->GetAt(21, 1);
-        uint32_t v22_4 = ibf->GetAt(22, 4);
-
-        switch (v21_11) {
-        case 199:
-            INST("stvewx", S, b11_5, b16_5) // stvewx vS,rA,rB
-
-        case 1156: {
-                if (b11_5 == b16_5) {
-                    INST("mr", b6_5, b11_5);
-                }
-                else {
-                    INST("vor", b6_5, b11_5, b16_5);
-                }
-            }
-        }
-
-        // extended
-        switch (v21_7) {
-            // 128 ?!?!?!!?!?
-
-        case 64:
-            INST("lvlx", vreg6, b11_5, b16_5)
-        case 96:
-            INST("lvlxl", vreg6, b11_5, b16_5)
-        case 68:
-            INST("lvrx", vreg6, b11_5, b16_5)
-        case 100:
-            INST("lvrxl", vreg6, b11_5, b16_5)
-        case 12:
-            INST("lvx", vreg6, b11_5, b16_5)
-        case 44:
-            INST("lvxl", vreg6, b11_5, b16_5)
-
-        case 24:
-            INST("stvewx", vreg6, b11_5, b16_5)
-        case 80:
-            INST("stvlx", vreg6, b11_5, b16_5)
-        case 112:
-            INST("stvlxl", vreg6, b11_5, b16_5)
-        case 84:
-            INST("stvrx", vreg6, b11_5, b16_5)
-
-                // stvx vS,rA,rB
-        case 28:
-            INST("stvx128", S, b11_5, b16_5) // stvx128 vS,rA,rB
-        }
-
-        switch (v26_6) {
-        case 46:
-            INST("vmaddfp", b6_5, b11_5, b21_5, b16_5);
-        case 47:
-            INST("vnmsubfp", b6_5, b11_5, b16_5, b21_5);
-        }
-
-        switch (v21_1) {
-            //// vsldoi128
-        case 0:
-            INST("vsldoi", vreg6, vreg11, vreg16, v22_4);
-        }
-
-        printf("VMX OPS NOT IMPLEMENTED V21=%d, V26=%d, V21_7=%d opcode: %d\n",
-            v21_11,
-            v26_6,
-            v21_7,
-            opcode);
-        return 0;
-    }
-
-          // EXT VMX
-    case 5: {
-        uint32_t v22_4 = ibf->GetAt(22, 4);
-        uint32_t v27_1 = ibf->GetAt(27, 1);
-
-        if (v27_1 == 0) {
-
-            switch (v22_4) {
-            case 0:
-                INST("vperm", vreg6, vreg11, vreg16, 0);
-            case 1:
-                INST("vperm", vreg6, vreg11, vreg16, 1);
-            case 2:
-                INST("vperm", vreg6, vreg11, vreg16, 2);
-            case 3:
-                INST("vperm", vreg6, vreg11, vreg16, 3);
-            case 4:
-                INST("vperm", vreg6, vreg11, vreg16, 4);
-            case 5:
-                INST("vperm", vreg6, vreg11, vreg16, 5);
-            case 6:
-                INST("vperm", vreg6, vreg11, vreg16, 6);
-            case 7:
-                INST("vperm", vreg6, vreg11, vreg16, 7);
-
-            case 8:
-                INST("vpkshss", vreg6, vreg11, vreg16);
-            case 9:
-                INST("vpkshus", vreg6, vreg11, vreg16);
-            case 10:
-                INST("vpkswss", vreg6, vreg11, vreg16);
-            case 11:
-                INST("vpkswus", vreg6, vreg11, vreg16);
-            case 12:
-                INST("vpkuhum", vreg6, vreg11, vreg16);
-            case 13:
-                INST("vpkuhus", vreg6, vreg11, vreg16);
-            case 14:
-                INST("vpkuwum", vreg6, vreg11, vreg16);
-            case 15:
-                INST("vpkuwus", vreg6, vreg11, vreg16);
-            }
-        }
-        else {
-
-            switch (v22_4) {
-
-            case 0:
-                INST("vaddfp", vreg6, vreg11, vreg16);
-            case 1:
-                INST("vsubfp", vreg6, vreg11, vreg16);
-            case 2:
-                INST("vmulfp128", vreg6, vreg11, vreg16);
-
-            case 3:
-                INST("vmaddfp", vreg6, vreg11, vreg16, vreg6);
-            case 4:
-                INST("vmaddfp", vreg6, vreg11, vreg6, vreg16); // addc
-
-            case 5:
-                INST("vnmsubfp", vreg6, vreg11, vreg16, vreg6);
-
-            case 6:
-                INST("vdot3fp", vreg6, vreg11, vreg16);
-            case 7:
-                INST("vdot4fp", vreg6, vreg11, vreg16);
-
-            case 8:
-                INST("vand", vreg6, vreg11, vreg16);
-            case 9:
-                INST("vandc", vreg6, vreg11, vreg16);
-            case 10:
-                INST("vnor", vreg6, vreg11, vreg16);
-            case 12:
-                INST("vxor", vreg6, vreg11, vreg16);
-            case 13:
-                INST("vsel", vreg6, vreg11, vreg16, vreg6); // arg3 == arg0
-            case 11: {
-                if (vreg11 == vreg16) {
-                    INST("mr", vreg6, vreg11);
-                }
-                else {
-
-                    INST("vor", vreg6, vreg11, vreg16);
-                }
-            }
-            }
-        }
-
-        printf("VMX OPS NOT IMPLEMENTED V22=%d, V27=%d, opcode: %d\n", v22_4, v27_1, opcode);
-        return 0;
-    }
-
-          // EXT VMX
-    case 6: {
-        uint32_t v21_11 = ibf->GetAt(21, 11);
-        uint32_t v26_6 = ibf->GetAt(26, 6);
-        uint32_t v21_7 = ibf->GetAt(21, 7);
-        uint32_t v22_4 = ibf->GetAt(22, 4);
-        uint32_t v27_1 = ibf->GetAt(27, 1);
-
-        switch (v21_7) {
 
-        case (33 + (0 * 4)):
-            INST("vpermwi128", vreg6, vreg16, b11_5 + 0 * 32);
-        case (33 + (1 * 4)):
-            INST("vpermwi128", vreg6, vreg16, b11_5 + 1 * 32);
-        case (33 + (2 * 4)):
-            INST("vpermwi128", vreg6, vreg16, b11_5 + 2 * 32);
-        case (33 + (3 * 4)):
-            INST("vpermwi128", vreg6, vreg16, b11_5 + 3 * 32);
-        case (33 + (4 * 4)):
-            INST("vpermwi128", vreg6, vreg16, b11_5 + 4 * 32);
-        case (33 + (5 * 4)):
-            INST("vpermwi128", vreg6, vreg16, b11_5 + 5 * 32);
-        case (33 + (6 * 4)):
-            INST("vpermwi128", vreg6, vreg16, b11_5 + 6 * 32);
-        case (33 + (7 * 4)):
-            INST("vpermwi128", vreg6, vreg16, b11_5 + 7 * 32);
-
-            // PACKED
-        case 97:
-            INST("vpkd3d128", vreg6, vreg16, (uint32_t)(b11_5 / 4), (uint32_t)(b11_5 & 3), (uint32_t)(0))
-        case 101:
-            INST("vpkd3d128", vreg6, vreg16, (uint32_t)(b11_5 / 4), (uint32_t)(b11_5 & 3), (uint32_t)(1))
-        case 105:
-            INST("vpkd3d128", vreg6, vreg16, (uint32_t)(b11_5 / 4), (uint32_t)(b11_5 & 3), (uint32_t)(2))
-        case 109:
-            INST("vpkd3d128", vreg6, vreg16, (uint32_t)(b11_5 / 4), (uint32_t)(b11_5 & 3), (uint32_t)(3))
-
-        case 111:
-            INST("vlogefp", vreg6, vreg16)
-        case 107:
-            INST("vexptefp", vreg6, vreg16)
-
-        case 35:
-            INST("vcfpsxws", vreg6, vreg16, b11_5);
-        case 39:
-            INST("vcfpuxws", vreg6, vreg16, b11_5);
-
-            // TODO, make those right
-            // vspltisw128
-        case 119:
-            INST("vspltisw", vreg6, b11_5) // 128?
-        case 43:
-            INST("vcsxwfp", vreg6, vreg16, b11_5)
-
-        case 103:
-            INST("vrsqrtefp", vreg6, vreg16)
-        }
-
-        if (v27_1 == 0) {
-            switch (v22_4) {
-            case 0:
-                INST("vcmpeqfp", vreg6, vreg11, vreg16)
-            case 1:
-                INST("vcmpeqfpRC", vreg6, vreg11, vreg16)
-            case 2:
-                INST("vcmpgefp", vreg6, vreg11, vreg16)
-            case 3:
-                INST("vcmpgefpRC", vreg6, vreg11, vreg16)
-            case 4:
-                INST("vcmpgtfp", vreg6, vreg11, vreg16)
-            case 5:
-                INST("vcmpgtfpRC", vreg6, vreg11, vreg16)
-            case 6:
-                INST("vcmpbfp", vreg6, vreg11, vreg16)
-            case 7:
-                INST("vcmpbfpRC", vreg6, vreg11, vreg16)
-            case 8:
-                INST("vcmpequw", vreg6, vreg11, vreg16)
-            case 9:
-                INST("vcmpequwRC", vreg6, vreg11, vreg16)
-            case 10:
-                INST("vmaxfp", vreg6, vreg11, vreg16)
-            case 11:
-                INST("vminfp", vreg6, vreg11, vreg16)
-            case 12:
-                INST("vmrghw", vreg6, vreg11, vreg16)
-            case 13:
-                INST("vmrglw", vreg6, vreg11, vreg16)
-            }
-        }
-        else {
-            switch (v22_4) {
-            case 1:
-                INST("vrlw", vreg6, vreg11, vreg16);
-
-            case 3:
-                INST("vslw", vreg6, vreg11, vreg16);
-
-            case 5:
-                INST("vsraw", vreg6, vreg11, vreg16);
-
-            case 7:
-                INST("vsrw", vreg6, vreg11, vreg16);
-
-            case 12:
-                INST("vrfim", vreg6, vreg16);
-            case 13:
-                INST("vrfin", vreg6, vreg16);
-            case 14:
-                INST("vrfip", vreg6, vreg16);
-            case 15:
-                INST("vrfiz", vreg6, vreg16);
-            }
-        }
-
-        printf("VMX OPS NOT IMPLEMENTED V22_4=%d, V27_1=%d, V21_7=%d opcode: %d\n",
-            v22_4,
-            v27_1,
-            v21_7,
-            opcode);
-        return 0;
-    }
-
-          // muli (multiply with immediate)
-    case 7:
-        INST("mulli", S, b11_5, b16_16);
+// big endian bit numbering like the IBM docs, bit 0 is the MSB
+static constexpr uint32_t Bits(const uint32_t instr, const uint32_t bestart, const uint32_t length) {
+  return (instr >> (32 - bestart - length)) & ((1u << length) - 1);
+}
 
-        // subf( subtract from)
-    case 8:
-        INST("subfic", S, b11_5, b16_16);
+// operand fields, a form is just the list of fields it outputs
+enum Field {
+  F_S,            // rD/rS/frD/vD/TO/BO   bits 6-10
+  F_A,            // rA/BI                bits 11-15
+  F_B,            // rB/SH                bits 16-20
+  F_C,            // frC/MB               bits 21-25
+  F_ME,           // ME                   bits 26-30
+  F_CRFD,         // crfD                 bits 6-8
+  F_L,            // L                    bit 10
+  F_D,            // SIMM/UIMM/d (raw)    bits 16-31
+  F_DS,           // BD/ds                bits 16-29
+  F_LI,           // LI sign extended and shifted by 2
+  F_SPR,          // spr/tbr (raw)        bits 11-20
+  F_CRM,          // CRM                  bits 12-19
+  F_FM,           // FM                   bits 7-14
+  F_SH64,         // rld* 6 bit SH
+  F_MB64,         // rld* 6 bit MB/ME
+  F_VD128,        // VMX128 registers
+  F_VA128,
+  F_VB128,
+  F_V22_4,        // bits 22-25
+  F_ARG,          // literal from the table entry
+  F_A_PLUS_ARG32, // rA + arg * 32 (vpermwi128)
+  F_A_DIV4,       // rA / 4 (vpkd3d128)
+  F_A_AND3,       // rA & 3 (vpkd3d128)
+};
 
-    case 10: {
-        uint32_t l = ibf->GetAt(10, 1);
-        if (!l)
-            INST("cmplwi", b6_3, 0, b11_5, b16_16)
-            INST("cmpldi", b6_3, 1, b11_5, b16_16)
-    }
+// how the final opcode is picked between the variants of an entry
+enum Select {
+  SEL_ONE,    // opc[0]
+  SEL_RC,     // opc[Rc]
+  SEL_OE_RC,  // opc[OE * 2 + Rc]
+  SEL_AA_LK,  // opc[AA * 2 + LK]
+  SEL_L,      // opc[L]
+  SEL_A_ZERO, // opc[rA == 0], addi/li addis/lis
+  SEL_B11,    // opc[bit 11], mtcrf/mtocrf
+};
 
-           // cmpi (cmpdi, cmpwi)
-    case 11: {
-        uint32_t l = ibf->GetAt(10, 1);
-        if (!l)
-            INST("cmpwi", b6_3, b10_1, b11_5, b16_16)
-            INST("cmpdi", b6_3, b10_1, b11_5, b16_16)
-    }
-    case 12:
-        INST("addic", S, b11_5, b16_16); // addic rD,rA,SIMM
-    case 13:
-        INST("addicRC", S, b11_5, b16_16); // addic. rD,rA,SIMM
+struct DecodeEntry;
+typedef uint32_t (*DecodeFn)(const uint32_t instr, const DecodeEntry &entry, Instruction &out);
 
+struct DecodeEntry {
+  DecodeFn fn = nullptr;
+  PPCOpcode opc[4] = {};
+  uint32_t arg = 0;
+};
 
-    // li and lis are just addi and addis instructions
-	// i'm adding simplified mnemonics just for the sake of it
-    case 14: {
-        if (b11_5 == 0){
-            INST("li", S, 0, b16_16)        // addi rD,0,SIMM
-        }  
-        INST("addi", S, b11_5, b16_16) // addi rD,rA,SIMM
-    }
+// extended opcode value -> entry
+struct XOEntry {
+  uint32_t xo;
+  DecodeEntry entry;
+};
 
-    case 15: {
-        if (b11_5 == 0) {
-            INST("lis", S, 0, b16_16)        // addis rD,0,SIMM
-        }
-        INST("addis", S, b11_5, b16_16) // addis rD,rA,SIMM
-    }
+template <Field field>
+static inline uint32_t Extract(const uint32_t instr, const uint32_t arg) {
+  if constexpr (field == F_S)
+    return Bits(instr, 6, 5);
+  else if constexpr (field == F_A)
+    return Bits(instr, 11, 5);
+  else if constexpr (field == F_B)
+    return Bits(instr, 16, 5);
+  else if constexpr (field == F_C)
+    return Bits(instr, 21, 5);
+  else if constexpr (field == F_ME)
+    return Bits(instr, 26, 5);
+  else if constexpr (field == F_CRFD)
+    return Bits(instr, 6, 3);
+  else if constexpr (field == F_L)
+    return Bits(instr, 10, 1);
+  else if constexpr (field == F_D)
+    return Bits(instr, 16, 16);
+  else if constexpr (field == F_DS)
+    return Bits(instr, 16, 14);
+  else if constexpr (field == F_LI) {
+    const uint32_t li = Bits(instr, 6, 24) << 2;
+    return (li & (1u << 25)) ? (li | (~0u << 26)) : li;
+  } else if constexpr (field == F_SPR)
+    return Bits(instr, 11, 10);
+  else if constexpr (field == F_CRM)
+    return Bits(instr, 12, 8);
+  else if constexpr (field == F_FM)
+    return Bits(instr, 7, 8);
+  else if constexpr (field == F_SH64)
+    return Bits(instr, 16, 5) + (Bits(instr, 30, 1) ? 32 : 0);
+  else if constexpr (field == F_MB64)
+    return Bits(instr, 21, 5) + (Bits(instr, 26, 1) ? 32 : 0);
+  else if constexpr (field == F_VD128)
+    return (Bits(instr, 28, 2) << 5) + Bits(instr, 6, 5);
+  else if constexpr (field == F_VA128)
+    return (Bits(instr, 21, 1) << 6) + (Bits(instr, 26, 1) << 5) + Bits(instr, 11, 5);
+  else if constexpr (field == F_VB128)
+    return (Bits(instr, 30, 2) << 5) + Bits(instr, 16, 5);
+  else if constexpr (field == F_V22_4)
+    return Bits(instr, 22, 4);
+  else if constexpr (field == F_ARG)
+    return arg;
+  else if constexpr (field == F_A_PLUS_ARG32)
+    return Bits(instr, 11, 5) + arg * 32;
+  else if constexpr (field == F_A_DIV4)
+    return Bits(instr, 11, 5) / 4;
+  else
+    return Bits(instr, 11, 5) & 3;
+}
 
-           // bc, bca, bcl, bcla (BO,BI,target_addr)
-    case 16:
-        if (!aa && !b31_1)
-            INST("bc", S, b11_5, b16_14);
-        if (!aa && b31_1)
-            INST("bcl", S, b11_5, b16_14);
-        if (aa && !b31_1)
-            INST("bca", S, b11_5, b16_14);
-        INST("bcla", S, b11_5, b16_14);
+template <Select sel>
+static inline uint32_t Variant(const uint32_t instr) {
+  if constexpr (sel == SEL_ONE)
+    return 0;
+  else if constexpr (sel == SEL_RC)
+    return Bits(instr, 31, 1);
+  else if constexpr (sel == SEL_OE_RC)
+    return (Bits(instr, 21, 1) << 1) | Bits(instr, 31, 1);
+  else if constexpr (sel == SEL_AA_LK)
+    return (Bits(instr, 30, 1) << 1) | Bits(instr, 31, 1);
+  else if constexpr (sel == SEL_L)
+    return Bits(instr, 10, 1);
+  else if constexpr (sel == SEL_A_ZERO)
+    return Bits(instr, 11, 5) == 0;
+  else
+    return Bits(instr, 11, 1);
+}
 
-        // b,ba,bl,bla
-    case 18:
-        if (!aa && !b31_1)
-            INST("b", li);
-        if (!aa && b31_1)
-            INST("bl", li)
-            if (aa && !b31_1)
-                INST("ba", li);
-        INST("bla", li)
+template <Select sel, Field... fields>
+static uint32_t DecodeForm(const uint32_t instr, const DecodeEntry &entry, Instruction &out) {
+  SetInstr(out, entry.opc[Variant<sel>(instr)], {Extract<fields>(instr, entry.arg)...});
+  return 4;
+}
 
-    case 19: {
-            switch (ext21_10) {
-            case 16:
-                if (b31_1)
-                    INST("bclrl", b6_5, b11_5)
-                    INST("bclr", b6_5, b11_5)
+// vor with both sources equal is a plain register move
+template <Field d, Field a, Field b>
+static uint32_t DecodeVorMr(const uint32_t instr, const DecodeEntry &, Instruction &out) {
+  const uint32_t va = Extract<a>(instr, 0);
+  const uint32_t vb = Extract<b>(instr, 0);
+  if (va == vb)
+    SetInstr(out, OP_mr, {Extract<d>(instr, 0), va});
+  else
+    SetInstr(out, OP_vor, {Extract<d>(instr, 0), va, vb});
+  return 4;
+}
 
-            case 528:
-                if (b31_1)
-                    INST("bcctrl", b6_5, b11_5)
-                    INST("bcctr", b6_5, b11_5)
-            }
+static uint32_t DecodeMfcr(const uint32_t instr, const DecodeEntry &, Instruction &out) {
+  if (Bits(instr, 11, 1) == 0)
+    SetInstr(out, OP_mfcr, {Bits(instr, 6, 5)});
+  else
+    SetInstr(out, OP_mfocrf, {Bits(instr, 12, 8), Bits(instr, 6, 5)});
+  return 4;
+}
 
-            printf("EXTENDED OPS NOT IMPLEMENTED EXTOC21: %i EXTOC21_9: %i OP: %i\n",
-                ext21_10,
-                ext22_9,
-                opcode);
-            return 0;
-        }
+static uint32_t DecodeSync(const uint32_t instr, const DecodeEntry &, Instruction &out) {
+  static constexpr PPCOpcode syncs[] = {OP_sync, OP_lwsync, OP_ptesync};
+  const uint32_t type = Bits(instr, 9, 2);
+  if (type < 3) {
+    SetInstr(out, syncs[type], {});
+    return 4;
+  }
+  // the old switch fell through to eieio here, keep it
+  printf("Decode: Invalid sync instruction type\n");
+  SetInstr(out, OP_eieio, {});
+  return 4;
+}
 
-        // rlwimi, rlwimi., rlwinm, rlwinm., rlwnm, rlwnm.
-    case 20:
-        if (b31_1)
-            INST("rlwimiRC", b11_5, S, b16_5, b21_5, b26_5)
-            INST("rlwimi", b11_5, S, b16_5, b21_5, b26_5)
+// named forms, keeps the spec tables readable
+#define FORM(name, ...) static constexpr DecodeFn name = &DecodeForm<__VA_ARGS__>;
+FORM(X_NONE, SEL_ONE)
+FORM(X_S_A_D, SEL_ONE, F_S, F_A, F_D)
+FORM(X_S_A_D_LI, SEL_A_ZERO, F_S, F_A, F_D)
+FORM(X_A_S_D, SEL_ONE, F_A, F_S, F_D)
+FORM(X_S_D_A, SEL_ONE, F_S, F_D, F_A)
+FORM(X_S_DS_A, SEL_ONE, F_S, F_DS, F_A)
+FORM(X_CMPI, SEL_L, F_CRFD, F_L, F_A, F_D)
+FORM(X_CMP, SEL_L, F_CRFD, F_L, F_A, F_B)
+FORM(X_BC, SEL_AA_LK, F_S, F_A, F_DS)
+FORM(X_B, SEL_AA_LK, F_LI)
+FORM(X_BCLR, SEL_RC, F_S, F_A)
+FORM(X_RLW, SEL_RC, F_A, F_S, F_B, F_C, F_ME)
+FORM(X_RLDI, SEL_RC, F_A, F_S, F_SH64, F_MB64)
+FORM(X_RLD, SEL_RC, F_A, F_S, F_B, F_MB64)
+FORM(X_S_A_B, SEL_ONE, F_S, F_A, F_B)
+FORM(X_S_A, SEL_ONE, F_S, F_A)
+FORM(X_S, SEL_ONE, F_S)
+FORM(X_A_B, SEL_ONE, F_A, F_B)
+FORM(X_A_S_S, SEL_ONE, F_A, F_S, F_S)
+FORM(X_A_S_S_RC, SEL_RC, F_A, F_S, F_S)
+FORM(X_A_S_B_RC, SEL_RC, F_A, F_S, F_B)
+FORM(X_S_SPR, SEL_ONE, F_S, F_SPR)
+FORM(X_SPR_S, SEL_ONE, F_SPR, F_S)
+FORM(X_MTCRF, SEL_B11, F_CRM, F_S)
+FORM(X_OE_S_A_B, SEL_OE_RC, F_S, F_A, F_B)
+FORM(X_OE_S_A, SEL_OE_RC, F_S, F_A)
+FORM(X_F_S_A_B, SEL_RC, F_S, F_A, F_B)
+FORM(X_F_S_A_C, SEL_RC, F_S, F_A, F_C)
+FORM(X_F_S_A_C_B, SEL_RC, F_S, F_A, F_C, F_B)
+FORM(X_F_S_B, SEL_RC, F_S, F_B)
+FORM(X_F_S, SEL_RC, F_S)
+FORM(X_F_CMP, SEL_ONE, F_CRFD, F_A, F_B)
+FORM(X_MTFSF, SEL_RC, F_FM, F_B)
+FORM(X_V_S_A_C_B, SEL_ONE, F_S, F_A, F_C, F_B)
+FORM(X_V_S_A_B_C, SEL_ONE, F_S, F_A, F_B, F_C)
+FORM(X_V128_D_A_B, SEL_ONE, F_VD128, F_A, F_B)
+FORM(X_V128_D_VA_VB, SEL_ONE, F_VD128, F_VA128, F_VB128)
+FORM(X_V128_D_VA_VB_D, SEL_ONE, F_VD128, F_VA128, F_VB128, F_VD128)
+FORM(X_V128_D_VA_D_VB, SEL_ONE, F_VD128, F_VA128, F_VD128, F_VB128)
+FORM(X_V128_SLDOI, SEL_ONE, F_VD128, F_VA128, F_VB128, F_V22_4)
+FORM(X_V128_D_VB, SEL_ONE, F_VD128, F_VB128)
+FORM(X_V128_D_VB_A, SEL_ONE, F_VD128, F_VB128, F_A)
+FORM(X_V128_D_A, SEL_ONE, F_VD128, F_A)
+FORM(X_V128_PERMWI, SEL_ONE, F_VD128, F_VB128, F_A_PLUS_ARG32)
+FORM(X_V128_PKD3D, SEL_ONE, F_VD128, F_VB128, F_A_DIV4, F_A_AND3, F_ARG)
+#undef FORM
 
-    case 21:
-        if (b31_1)
-            INST("rlwinmRC", b11_5, S, b16_5, b21_5, b26_5)
-            INST("rlwinm", b11_5, S, b16_5, b21_5, b26_5)
+//
+// Opcode spec
+// When more than one list matches the same bits the first list listed for that
+// primary opcode wins, same precedence the old switch chain had.
+//
 
-    case 23:
-        if (b31_1)
-            INST("rlwnmRC", b11_5, S, b16_5, b21_5, b26_5)
-            INST("rlwnm", b11_5, S, b16_5, b21_5, b26_5)
+// primary 4, VMX
+static constexpr XOEntry s_op4_xo21_11[] = {
+  {199, {X_S_A_B, {OP_stvewx}}},
+  {1156, {&DecodeVorMr<F_S, F_A, F_B>}},
+};
+static constexpr XOEntry s_op4_xo21_7[] = {
+  {64, {X_V128_D_A_B, {OP_lvlx}}},
+  {96, {X_V128_D_A_B, {OP_lvlxl}}},
+  {68, {X_V128_D_A_B, {OP_lvrx}}},
+  {100, {X_V128_D_A_B, {OP_lvrxl}}},
+  {12, {X_V128_D_A_B, {OP_lvx}}},
+  {44, {X_V128_D_A_B, {OP_lvxl}}},
+  {24, {X_V128_D_A_B, {OP_stvewx}}},
+  {80, {X_V128_D_A_B, {OP_stvlx}}},
+  {112, {X_V128_D_A_B, {OP_stvlxl}}},
+  {84, {X_V128_D_A_B, {OP_stvrx}}},
+  {28, {X_S_A_B, {OP_stvx128}}},
+};
+static constexpr XOEntry s_op4_xo26_6[] = {
+  {46, {X_V_S_A_C_B, {OP_vmaddfp}}},
+  {47, {X_V_S_A_B_C, {OP_vnmsubfp}}},
+};
+static constexpr XOEntry s_op4_xo21_1[] = {
+  {0, {X_V128_SLDOI, {OP_vsldoi}}},
+};
 
-    case 25:
-        INST("oris", b11_5, S, b16_16);
-    case 26:
-        INST("xori", b11_5, S, b16_16);
-    case 27:
-        INST("xoris", b11_5, S, b16_16);
-    case 28:
-        INST("andiRC", b11_5, S, b16_16);
-    case 29:
-        INST("andisRC", b11_5, S, b16_16);
+// primary 5, VMX128, keyed on (bit 27 << 4) | bits 22-25
+static constexpr XOEntry s_op5_xo[] = {
+  {0, {X_V128_SLDOI, {OP_vperm}}},
+  {1, {X_V128_SLDOI, {OP_vperm}}},
+  {2, {X_V128_SLDOI, {OP_vperm}}},
+  {3, {X_V128_SLDOI, {OP_vperm}}},
+  {4, {X_V128_SLDOI, {OP_vperm}}},
+  {5, {X_V128_SLDOI, {OP_vperm}}},
+  {6, {X_V128_SLDOI, {OP_vperm}}},
+  {7, {X_V128_SLDOI, {OP_vperm}}},
+  {8, {X_V128_D_VA_VB, {OP_vpkshss}}},
+  {9, {X_V128_D_VA_VB, {OP_vpkshus}}},
+  {10, {X_V128_D_VA_VB, {OP_vpkswss}}},
+  {11, {X_V128_D_VA_VB, {OP_vpkswus}}},
+  {12, {X_V128_D_VA_VB, {OP_vpkuhum}}},
+  {13, {X_V128_D_VA_VB, {OP_vpkuhus}}},
+  {14, {X_V128_D_VA_VB, {OP_vpkuwum}}},
+  {15, {X_V128_D_VA_VB, {OP_vpkuwus}}},
+  {16 + 0, {X_V128_D_VA_VB, {OP_vaddfp}}},
+  {16 + 1, {X_V128_D_VA_VB, {OP_vsubfp}}},
+  {16 + 2, {X_V128_D_VA_VB, {OP_vmulfp128}}},
+  {16 + 3, {X_V128_D_VA_VB_D, {OP_vmaddfp}}},
+  {16 + 4, {X_V128_D_VA_D_VB, {OP_vmaddfp}}}, // addc
+  {16 + 5, {X_V128_D_VA_VB_D, {OP_vnmsubfp}}},
+  {16 + 6, {X_V128_D_VA_VB, {OP_vdot3fp}}},
+  {16 + 7, {X_V128_D_VA_VB, {OP_vdot4fp}}},
+  {16 + 8, {X_V128_D_VA_VB, {OP_vand}}},
+  {16 + 9, {X_V128_D_VA_VB, {OP_vandc}}},
+  {16 + 10, {X_V128_D_VA_VB, {OP_vnor}}},
+  {16 + 11, {&DecodeVorMr<F_VD128, F_VA128, F_VB128>}},
+  {16 + 12, {X_V128_D_VA_VB, {OP_vxor}}},
+  {16 + 13, {X_V128_D_VA_VB_D, {OP_vsel}}}, // arg3 == arg0
+};
 
-        // ori rA,rS,UIMM
-    case 24:
-        INST("ori", b11_5, b6_5, b16_16);
+// primary 6, VMX128
+static constexpr XOEntry s_op6_xo21_7[] = {
+  {33 + 0 * 4, {X_V128_PERMWI, {OP_vpermwi128}, 0}},
+  {33 + 1 * 4, {X_V128_PERMWI, {OP_vpermwi128}, 1}},
+  {33 + 2 * 4, {X_V128_PERMWI, {OP_vpermwi128}, 2}},
+  {33 + 3 * 4, {X_V128_PERMWI, {OP_vpermwi128}, 3}},
+  {33 + 4 * 4, {X_V128_PERMWI, {OP_vpermwi128}, 4}},
+  {33 + 5 * 4, {X_V128_PERMWI, {OP_vpermwi128}, 5}},
+  {33 + 6 * 4, {X_V128_PERMWI, {OP_vpermwi128}, 6}},
+  {33 + 7 * 4, {X_V128_PERMWI, {OP_vpermwi128}, 7}},
+  {97, {X_V128_PKD3D, {OP_vpkd3d128}, 0}},
+  {101, {X_V128_PKD3D, {OP_vpkd3d128}, 1}},
+  {105, {X_V128_PKD3D, {OP_vpkd3d128}, 2}},
+  {109, {X_V128_PKD3D, {OP_vpkd3d128}, 3}},
+  {111, {X_V128_D_VB, {OP_vlogefp}}},
+  {107, {X_V128_D_VB, {OP_vexptefp}}},
+  {35, {X_V128_D_VB_A, {OP_vcfpsxws}}},
+  {39, {X_V128_D_VB_A, {OP_vcfpuxws}}},
+  {119, {X_V128_D_A, {OP_vspltisw}}}, // TODO: 128?
+  {43, {X_V128_D_VB_A, {OP_vcsxwfp}}},
+  {103, {X_V128_D_VB, {OP_vrsqrtefp}}},
+};
+// keyed on (bit 27 << 4) | bits 22-25
+static constexpr XOEntry s_op6_xo[] = {
+  {0, {X_V128_D_VA_VB, {OP_vcmpeqfp}}},
+  {1, {X_V128_D_VA_VB, {OP_vcmpeqfpRC}}},
+  {2, {X_V128_D_VA_VB, {OP_vcmpgefp}}},
+  {3, {X_V128_D_VA_VB, {OP_vcmpgefpRC}}},
+  {4, {X_V128_D_VA_VB, {OP_vcmpgtfp}}},
+  {5, {X_V128_D_VA_VB, {OP_vcmpgtfpRC}}},
+  {6, {X_V128_D_VA_VB, {OP_vcmpbfp}}},
+  {7, {X_V128_D_VA_VB, {OP_vcmpbfpRC}}},
+  {8, {X_V128_D_VA_VB, {OP_vcmpequw}}},
+  {9, {X_V128_D_VA_VB, {OP_vcmpequwRC}}},
+  {10, {X_V128_D_VA_VB, {OP_vmaxfp}}},
+  {11, {X_V128_D_VA_VB, {OP_vminfp}}},
+  {12, {X_V128_D_VA_VB, {OP_vmrghw}}},
+  {13, {X_V128_D_VA_VB, {OP_vmrglw}}},
+  {16 + 1, {X_V128_D_VA_VB, {OP_vrlw}}},
+  {16 + 3, {X_V128_D_VA_VB, {OP_vslw}}},
+  {16 + 5, {X_V128_D_VA_VB, {OP_vsraw}}},
+  {16 + 7, {X_V128_D_VA_VB, {OP_vsrw}}},
+  {16 + 12, {X_V128_D_VB, {OP_vrfim}}},
+  {16 + 13, {X_V128_D_VB, {OP_vrfin}}},
+  {16 + 14, {X_V128_D_VB, {OP_vrfip}}},
+  {16 + 15, {X_V128_D_VB, {OP_vrfiz}}},
+};
 
-        // Shift Stuff
-    case 30: {
+// primary 19, branch to LR/CTR
+static constexpr XOEntry s_op19_xo21_10[] = {
+  {16, {X_BCLR, {OP_bclr, OP_bclrl}}},
+  {528, {X_BCLR, {OP_bcctr, OP_bcctrl}}},
+};
 
-        switch (ext27_3) {
-            // rldicl, rldicl., rldicr, rldicr., rldic, rldic., rldimi, rldimi.
-        case 0:
-            if (b31_1)
-                INST("rldiclRC", b11_5, S, b16_5 + (aa ? 32 : 0), b21_5 + (b26_1 ? 32 : 0))
-                INST("rldicl", b11_5, S, b16_5 + (aa ? 32 : 0), b21_5 + (b26_1 ? 32 : 0))
+// primary 30, 64 bit rotates
+static constexpr XOEntry s_op30_xo27_3[] = {
+  {0, {X_RLDI, {OP_rldicl, OP_rldiclRC}}},
+  {1, {X_RLDI, {OP_rldicr, OP_rldicrlRC}}},
+  {2, {X_RLDI, {OP_rldic, OP_rldicRC}}},
+  {3, {X_RLDI, {OP_rldimi, OP_rldimiRC}}},
+};
+static constexpr XOEntry s_op30_xo27_4[] = {
+  {8, {X_RLD, {OP_rldcl, OP_rldclRC}}},
+  {9, {X_RLD, {OP_rldcr, OP_rldcrRC}}},
+};
 
-        case 1:
-            if (b31_1)
-                INST("rldicrlRC", b11_5, S, b16_5 + (aa ? 32 : 0), b21_5 + (b26_1 ? 32 : 0))
-                INST("rldicr", b11_5, S, b16_5 + (aa ? 32 : 0), b21_5 + (b26_1 ? 32 : 0))
+// primary 31, integer extended ops
+static constexpr XOEntry s_op31_xo21_10[] = {
+  {0, {X_CMP, {OP_cmpw, OP_cmpd}}},
+  {32, {X_CMP, {OP_cmplw, OP_cmpld}}},
+  {371, {X_S_SPR, {OP_mftb}}},
+  {21, {X_S_A, {OP_ldx}}},
+  {53, {X_S_A_B, {OP_ldux}}},
+  {23, {X_S_A_B, {OP_lwzx}}},
+  {55, {X_S_A_B, {OP_lwzux}}},
+  {341, {X_S_A_B, {OP_lwax}}},
+  {373, {X_S_A_B, {OP_lwaux}}},
+  {279, {X_S_A_B, {OP_lhzx}}},
+  {311, {X_S_A_B, {OP_lhzux}}},
+  {343, {X_S_A_B, {OP_lhax}}},
+  {375, {X_S_A_B, {OP_lhaux}}},
+  {790, {X_S_A_B, {OP_lhbrx}}},
+  {534, {X_S_A_B, {OP_lwbrx}}},
+  {918, {X_S_A_B, {OP_sthbrx}}},
+  {662, {X_S_A_B, {OP_stwbrx}}},
+  {663, {X_S_A_B, {OP_stfsx}}},
+  {695, {X_S_A_B, {OP_stfsux}}},
+  {727, {X_S_A_B, {OP_stfdx}}},
+  {759, {X_S_A_B, {OP_stfdux}}},
+  {983, {X_S_A_B, {OP_stfiwx}}},
+  {151, {X_S_A_B, {OP_stwx}}},
+  {183, {X_S_A_B, {OP_stwux}}},
+  {407, {X_S_A_B, {OP_sthx}}},
+  {439, {X_S_A_B, {OP_sthux}}},
+  {215, {X_S_A_B, {OP_stbx}}},
+  {247, {X_S_A_B, {OP_stbux}}},
+  {87, {X_S_A_B, {OP_lbzx}}},
+  {119, {X_S_A_B, {OP_lbzux}}},
+  {149, {X_S_A_B, {OP_stdx}}},
+  {181, {X_S_A_B, {OP_stdux}}},
+  {122, {X_A_S_S, {OP_popcntb}}},
+  {598, {&DecodeSync}},
+  {854, {X_NONE, {OP_eieio}}},
+  {535, {X_S_A_B, {OP_lfsx}}},
+  {567, {X_S_A_B, {OP_lfsux}}},
+  {599, {X_S_A_B, {OP_lfdx}}},
+  {631, {X_S_A_B, {OP_lfdux}}},
+  {954, {X_A_S_S_RC, {OP_extsb, OP_extsbRC}}},
+  {922, {X_A_S_S_RC, {OP_extsh, OP_extshRC}}},
+  {986, {X_A_S_S_RC, {OP_extsw, OP_extswRC}}},
+  {26, {X_A_S_S_RC, {OP_cntlzw, OP_cntlzwRC}}},
+  {58, {X_A_S_S_RC, {OP_cntlzd, OP_cntlzdRC}}},
+  {27, {X_A_S_B_RC, {OP_sld, OP_sldRC}}},
+  {24, {X_A_S_B_RC, {OP_slw, OP_slwRC}}},
+  {539, {X_A_S_B_RC, {OP_srd, OP_srdRC}}},
+  {536, {X_A_S_B_RC, {OP_srw, OP_srwRC}}},
+  {794, {X_A_S_B_RC, {OP_srad, OP_sradRC}}},
+  {792, {X_A_S_B_RC, {OP_sraw, OP_srawRC}}},
+  {28, {X_A_S_B_RC, {OP_and, OP_andRC}}},
+  {444, {X_A_S_B_RC, {OP_or, OP_orRC}}},
+  {316, {X_A_S_B_RC, {OP_xor, OP_xorRC}}},
+  {476, {X_A_S_B_RC, {OP_nand, OP_nandRC}}},
+  {124, {X_A_S_B_RC, {OP_nor, OP_norRC}}},
+  {284, {X_A_S_B_RC, {OP_eqv, OP_eqvRC}}},
+  {60, {X_A_S_B_RC, {OP_andc, OP_andcRC}}},
+  {412, {X_A_S_B_RC, {OP_orc, OP_orcRC}}},
+  {824, {X_A_S_B_RC, {OP_srawi, OP_srawiRC}}},
+  {826, {X_A_S_B_RC, {OP_sradi, OP_sradiRC}}}, // 413*3+0
+  {827, {X_A_S_B_RC, {OP_sradi, OP_sradiRC}}}, // 413*3+1
+  {86, {X_A_B, {OP_dcbf}}},
+  {54, {X_A_B, {OP_dcbst}}},
+  {278, {X_A_B, {OP_dcbt}}},
+  {246, {X_A_B, {OP_dcbtst}}},
+  {1014, {X_A_B, {OP_dcbz}}},
+  {20, {X_S_A_B, {OP_lwarx}}},
+  {84, {X_S_A_B, {OP_ldarx}}},
+  {150, {X_S_A_B, {OP_stwcxRC}}},
+  {214, {X_S_A_B, {OP_stdcxRC}}},
+  {467, {X_SPR_S, {OP_mtspr}}},
+  {339, {X_S_SPR, {OP_mfspr}}},
+  {83, {X_S, {OP_mfmsr}}},
+  {178, {X_S, {OP_mtmsrd}}},
+  {144, {X_MTCRF, {OP_mtcrf, OP_mtocrf}}},
+  {19, {&DecodeMfcr}},
+};
+static constexpr XOEntry s_op31_xo21_11[] = {
+  {12, {X_S_A_B, {OP_lvsl}}},
+  {1038, {X_S_A_B, {OP_lvlx}}},
+  {1550, {X_S_A_B, {OP_lvlxl}}},
+  {1102, {X_S_A_B, {OP_lvrx}}},
+  {1614, {X_S_A_B, {OP_lvrxl}}},
+  {206, {X_S_A_B, {OP_lvx}}},
+  {718, {X_S_A_B, {OP_lvxl}}},
+  {76, {X_S_A_B, {OP_lvsr}}},
+  {270, {X_S_A_B, {OP_stvebx}}},
+  {334, {X_S_A_B, {OP_stvehx}}},
+  {398, {X_S_A_B, {OP_stvewx}}},
+  {1294, {X_S_A_B, {OP_stvlx}}},
+  {1806, {X_S_A_B, {OP_stvlxl}}},
+  {1358, {X_S_A_B, {OP_stvrx}}},
+  {1870, {X_S_A_B, {OP_stvrxl}}},
+  {462, {X_S_A_B, {OP_stvx}}},
+  {974, {X_S_A_B, {OP_stvxl}}},
+};
+static constexpr XOEntry s_op31_xo22_9[] = {
+  {10, {X_OE_S_A_B, {OP_addc, OP_addcRC, OP_addcOE, OP_addcOERC}}},
+  {104, {X_OE_S_A, {OP_neg, OP_negRC, OP_negOE, OP_negOERC}}},
+  {136, {X_OE_S_A_B, {OP_subfe, OP_subfeRC, OP_subfeOE, OP_subfeOERC}}},
+  {138, {X_OE_S_A_B, {OP_adde, OP_addeRC, OP_addeOE, OP_addeOERC}}},
+  {200, {X_OE_S_A, {OP_subfze, OP_subfzeRC, OP_subfzeOE, OP_subfzeOERC}}},
+  {235, {X_OE_S_A_B, {OP_mullw, OP_mullwRC, OP_mullwOE, OP_mullwOERC}}},
+  {233, {X_OE_S_A_B, {OP_mulld, OP_mulldRC, OP_mulldOE, OP_mulldOERC}}},
+  {266, {X_OE_S_A_B, {OP_add, OP_addRC, OP_addOE, OP_addOERC}}},
+  {202, {X_OE_S_A, {OP_addze, OP_addzeRC, OP_addzeOE, OP_addzeOERC}}},
+  {8, {X_OE_S_A_B, {OP_subfc, OP_subfcRC, OP_subfcOE, OP_subfcOERC}}},
+  {40, {X_OE_S_A_B, {OP_subf, OP_subfRC, OP_subfOE, OP_subfOERC}}},
+  {234, {X_OE_S_A, {OP_addme, OP_addmeRC, OP_addmeOE, OP_addmeOERC}}},
+  {489, {X_OE_S_A_B, {OP_divd, OP_divdRC, OP_divdOE, OP_divdOERC}}},
+  {491, {X_OE_S_A_B, {OP_divw, OP_divwRC, OP_divwOE, OP_divwOERC}}},
+  {457, {X_OE_S_A_B, {OP_divdu, OP_divduRC, OP_divduOE, OP_divduOERC}}},
+  {459, {X_OE_S_A_B, {OP_divwu, OP_divwuRC, OP_divwuOE, OP_divwuOERC}}},
+};
 
-        case 2:
-            if (b31_1)
-                INST("rldicRC", b11_5, S, b16_5 + (aa ? 32 : 0), b21_5 + (b26_1 ? 32 : 0))
-                INST("rldic", b11_5, S, b16_5 + (aa ? 32 : 0), b21_5 + (b26_1 ? 32 : 0))
+// primary 59, single floating math
+static constexpr XOEntry s_op59_xo26_5[] = {
+  {20, {X_F_S_A_B, {OP_fsubs, OP_fsubsRC}}},
+  {21, {X_F_S_A_B, {OP_fadds, OP_faddsRC}}},
+  {25, {X_F_S_A_C, {OP_fmuls, OP_fmulsRC}}},
+  {18, {X_F_S_A_B, {OP_fdivs, OP_fdivsRC}}},
+  {29, {X_F_S_A_C_B, {OP_fmadds, OP_fmaddsRC}}},
+  {28, {X_F_S_A_C_B, {OP_fmsubs, OP_fmsubsRC}}},
+  {31, {X_F_S_A_C_B, {OP_fnmadds, OP_fnmaddsRC}}},
+  {30, {X_F_S_A_C_B, {OP_fnmsubs, OP_fnmsubsRC}}},
+  {22, {X_F_S_B, {OP_fsqrts, OP_fsqrtsRC}}},
+  {24, {X_F_S_B, {OP_fres, OP_fresRC}}},
+};
 
-        case 3:
-            if (b31_1)
-                INST("rldimiRC", b11_5, S, b16_5 + (aa ? 32 : 0), b21_5 + (b26_1 ? 32 : 0))
-                INST("rldimi", b11_5, S, b16_5 + (aa ? 32 : 0), b21_5 + (b26_1 ? 32 : 0))
-        }
+// primary 63, double floating math
+static constexpr XOEntry s_op63_xo21_10[] = {
+  {0, {X_F_CMP, {OP_fcmpu}}},
+  {32, {X_F_CMP, {OP_fcmpo}}},
+  {814, {X_F_S_B, {OP_fctid, OP_fctidRC}}},
+  {14, {X_F_S_B, {OP_fctiw, OP_fctiwRC}}},
+  {15, {X_F_S_B, {OP_fctiwz, OP_fctiwzRC}}},
+  {12, {X_F_S_B, {OP_frsp, OP_frspRC}}},
+  {40, {X_F_S_B, {OP_fneg, OP_fnegRC}}},
+  {72, {X_F_S_B, {OP_fmr, OP_fmrRC}}},
+  {264, {X_F_S_B, {OP_fabs, OP_fabsRC}}},
+  {136, {X_F_S_B, {OP_fnabs, OP_fnabsRC}}},
+  {815, {X_F_S_B, {OP_fctidz, OP_fctidzRC}}},
+  {846, {X_F_S_B, {OP_fcfid, OP_fcfidRC}}},
+  {583, {X_F_S, {OP_mffs, OP_mffsRC}}},
+  {711, {X_MTFSF, {OP_mtfsf, OP_mtfsfRC}}},
+};
+static constexpr XOEntry s_op63_xo26_5[] = {
+  {21, {X_F_S_A_B, {OP_fadd, OP_faddRC}}},
+  {20, {X_F_S_A_B, {OP_fsub, OP_fsubRC}}},
+  {25, {X_F_S_A_B, {OP_fmul, OP_fmulRC}}}, // BEWARE, the second arg is at bit 21
+  {18, {X_F_S_A_B, {OP_fdiv, OP_fdivRC}}},
+  {29, {X_F_S_A_C_B, {OP_fmadd, OP_fmaddRC}}},
+  {28, {X_F_S_A_C_B, {OP_fmsub, OP_fmsubRC}}},
+  {31, {X_F_S_A_C_B, {OP_fnmadd, OP_fnmaddRC}}},
+  {30, {X_F_S_A_C_B, {OP_fnmsub, OP_fnmsubRC}}},
+  {23, {X_F_S_A_C_B, {OP_fsel, OP_fselRC}}},
+  {22, {X_F_S_B, {OP_fsqrt, OP_fsqrtRC}}},
+  {24, {X_F_S_B, {OP_fre, OP_freRC}}},
+  {26, {X_F_S_B, {OP_frsqrte, OP_frsqrteRC}}},
+};
 
-        uint32_t ext27_4 = ibf->GetAt(27, 4);
-        switch (ext27_4) {
-            // rldcl, rldcl., rldcr, rldcr.
-        case 8:
-            if (b31_1)
-                INST("rldclRC", b11_5, S, b16_5, b21_5 + (b26_1 ? 32 : 0))
-                INST("rldcl", b11_5, S, b16_5, b21_5 + (b26_1 ? 32 : 0))
+//
+// Table builders
+// A table is indexed by a run of `keyBits` bits of the instruction, a spec list matches a
+// `width` bit field at `shift` inside that key. Lists are applied lowest precedence first
+// so later ones overwrite.
+//
 
-        case 9:
-            if (b31_1)
-                INST("rldcrRC", b11_5, S, b16_5, b21_5 + (b26_1 ? 32 : 0))
-                INST("rldcr", b11_5, S, b16_5, b21_5 + (b26_1 ? 32 : 0))
-        }
+template <size_t N>
+static constexpr void FillDefault(std::array<DecodeEntry, N> &table, const DecodeFn fail) {
+  for (DecodeEntry &entry : table)
+    entry = {fail};
+}
 
-        printf("EXTENDED OPS NOT IMPLEMENTED EXTOC27_4: %i OP: %i\n", ext27_4, opcode);
-        return 0;
+template <size_t N, size_t M>
+static constexpr void FillField(std::array<DecodeEntry, N> &table,
+  const XOEntry (&specs)[M],
+  const uint32_t shift,
+  const uint32_t width) {
+  const uint32_t highCount = (uint32_t)(N >> (shift + width));
+  for (const XOEntry &spec : specs) {
+    for (uint32_t high = 0; high < highCount; high++) {
+      for (uint32_t low = 0; low < (1u << shift); low++)
+        table[(high << (shift + width)) | (spec.xo << shift) | low] = spec.entry;
     }
+  }
+}
 
-    case 31: {
-        switch (ext21_10) {
-            // cmpw, cmpd
-        case 0: {
-            uint32_t l = ibf->GetAt(10, 1);
-            if (!l)
-                INST("cmpw", b6_3, b10_1, b11_5, b16_5)
-                INST("cmpd", b6_3, b10_1, b11_5, b16_5)
-        }
-
-              // mftb (move from time base register)
-        case 371:
-            INST("mftb", S, b11_10);
-
-        case 21:
-            INST("ldx", S, b11_5, )
-        case 53:
-            INST("ldux", S, b11_5, b16_5)
-
-                // lwzx, lwzux, lwax, lwaux
-        case 23:
-            INST("lwzx", S, b11_5, b16_5)
-        case 55:
-            INST("lwzux", S, b11_5, b16_5)
-        case 341:
-            INST("lwax", S, b11_5, b16_5)
-        case 373:
-            INST("lwaux", S, b11_5, b16_5)
-
-                // lhzx, lhzux, lhax, lhaux
-        case 279:
-            INST("lhzx", S, b11_5, b16_5)
-        case 311:
-            INST("lhzux", S, b11_5, b16_5)
-        case 343:
-            INST("lhax", S, b11_5, b16_5)
-        case 375:
-            INST("lhaux", S, b11_5, b16_5)
-
-        case 790:
-            INST("lhbrx", S, b11_5, b16_5)
-        case 534:
-            INST("lwbrx", S, b11_5, b16_5)
-        case 918:
-            INST("sthbrx", S, b11_5, b16_5)
-        case 662:
-            INST("stwbrx", S, b11_5, b16_5)
-
-                // stfsx, stfsux, stfdx, stfdux, stfiwx
-        case 663:
-            INST("stfsx", S, b11_5, b16_5)
-        case 695:
-            INST("stfsux", S, b11_5, b16_5)
-        case 727:
-            INST("stfdx", S, b11_5, b16_5)
-        case 759:
-            INST("stfdux", S, b11_5, b16_5)
-        case 983:
-            INST("stfiwx", S, b11_5, b16_5)
-
-                // stwx, stwux
-        case 151:
-            INST("stwx", S, b11_5, b16_5)
-        case 183:
-            INST("stwux", S, b11_5, b16_5)
-
-                // sthx, sthux
-        case 407:
-            INST("sthx", S, b11_5, b16_5)
-        case 439:
-            INST("sthux", S, b11_5, b16_5)
-
-                // stbx, stbux
-        case 215:
-            INST("stbx", S, b11_5, b16_5)
-        case 247:
-            INST("stbux", S, b11_5, b16_5)
-
-                // lbzx, lbzxu
-        case 87:
-            INST("lbzx", S, b11_5, b16_5)
-        case 119:
-            INST("lbzux", S, b11_5, b16_5)
-
-                // stdx, stdux
-        case 149:
-            INST("stdx", S, b11_5, b16_5)
-        case 181:
-            INST("stdux", S, b11_5, b16_5)
-
-        case 122:
-            INST("popcntb", b11_5, S, b6_5)
-
-                // sync (memory bariers)
-        case 598:
-            if (b9_2 == 0)
-                INST("sync");
-            if (b9_2 == 1)
-                INST("lwsync");
-            if (b9_2 == 2)
-                INST("ptesync");
-            printf("Decode: Invalid sync instruction type\n");
-
-            // eieio
-        case 854:
-            INST("eieio");
-
-            // lfsx, lfsux, lfdx, lfdux
-        case 535:
-            INST("lfsx", S, b11_5, b16_5)
-        case 567:
-            INST("lfsux", S, b11_5, b16_5)
-        case 599:
-            INST("lfdx", S, b11_5, b16_5)
-        case 631:
-            INST("lfdux", S, b11_5, b16_5)
-
-                // extsb, extsb., extsh, extsh., extsw, extsw., popcntb, popcntb., cntlzw, cntlzw., cntlzd,
-                // cntlzd.
-        case 954:
-            if (b31_1)
-                INST("extsbRC", b11_5, S, b6_5)
-                INST("extsb", b11_5, S, b6_5)
-
-        case 922:
-            if (b31_1)
-                INST("extshRC", b11_5, S, b6_5)
-                INST("extsh", b11_5, S, b6_5)
-
-        case 986:
-            if (b31_1)
-                INST("extswRC", b11_5, S, b6_5)
-                INST("extsw", b11_5, S, b6_5)
-
-        case 26:
-            if (b31_1)
-                INST("cntlzwRC", b11_5, S, b6_5)
-                INST("cntlzw", b11_5, S, b6_5)
-
-        case 58:
-            if (b31_1)
-                INST("cntlzdRC", b11_5, S, b6_5)
-                INST("cntlzd", b11_5, S, b6_5)
-
-                // sld, sld., slw, slw., srd, srd., srw, srw., srad, srad., sraw, sraw.
-        case 27:
-            if (b31_1)
-                INST("sldRC", b11_5, S, b16_5)
-                INST("sld", b11_5, S, b16_5)
-
-        case 24:
-            if (b31_1)
-                INST("slwRC", b11_5, S, b16_5)
-                INST("slw", b11_5, S, b16_5)
-
-        case 539:
-            if (b31_1)
-                INST("srdRC", b11_5, S, b16_5)
-                INST("srd", b11_5, S, b16_5)
-
-        case 536:
-            if (b31_1)
-                INST("srwRC", b11_5, S, b16_5)
-                INST("srw", b11_5, S, b16_5)
-
-        case 794:
-            if (b31_1)
-                INST("sradRC", b11_5, S, b16_5)
-                INST("srad", b11_5, S, b16_5)
-
-        case 792:
-            if (b31_1)
-                INST("srawRC", b11_5, S, b16_5)
-                INST("sraw", b11_5, S, b16_5)
-
-                // and, and., or, or., xor, xor., nand, nand, nor, nor., eqv, eqv., andc, andc., orc, orc
-        case 28:
-            if (b31_1)
-                INST("andRC", b11_5, S, b16_5)
-                INST("and", b11_5, S, b16_5)
-
-                // cmplw, cmpld
-        case 32: {
-                uint32_t l = ibf->GetAt(10, 1);
-                if (!l)
-                    INST("cmplw", b6_3, 0, b11_5, b16_5);
-                INST("cmpld", b6_3, 1, b11_5, b16_5);
-            }
-
-            // or rA,rS,rB (also RC)
-        case 444:
-            if (b31_1)
-                INST("orRC", b11_5, S, b16_5)
-                INST("or", b11_5, S, b16_5)
-
-        case 316:
-            if (b31_1)
-                INST("xorRC", b11_5, S, b16_5)
-                INST("xor", b11_5, S, b16_5)
-
-        case 476:
-            if (b31_1)
-                INST("nandRC", b11_5, S, b16_5)
-                INST("nand", b11_5, S, b16_5)
-
-        case 124:
-            if (b31_1)
-                INST("norRC", b11_5, S, b16_5)
-                INST("nor", b11_5, S, b16_5)
-
-        case 284:
-            if (b31_1)
-                INST("eqvRC", b11_5, S, b16_5)
-                INST("eqv", b11_5, S, b16_5)
-
-        case 60:
-            if (b31_1)
-                INST("andcRC", b11_5, S, b16_5)
-                INST("andc", b11_5, S, b16_5)
-
-        case 412:
-            if (b31_1)
-                INST("orcRC", b11_5, S, b16_5)
-                INST("orc", b11_5, S, b16_5)
-
-                // sradi, sradi., srawi, srawi.
-        case 824:
-            if (b31_1)
-                INST("srawiRC", b11_5, S, b16_5)
-                INST("srawi", b11_5, S, b16_5)
-
-        case 826: // 413*3+0
-            if (b31_1)
-                INST("sradiRC", b11_5, S, b16_5)
-                INST("sradi", b11_5, S, b16_5)
-
-        case 827: // 413*3+1
-            if (b31_1)
-                INST("sradiRC", b11_5, S, b16_5)
-                INST("sradi", b11_5, S, b16_5)
-
-                // cache operations
-        case 86:
-            INST("dcbf", b11_5, b16_5);
-        case 54:
-            INST("dcbst", b11_5, b16_5);
-        case 278:
-            INST("dcbt", b11_5, b16_5);
-        case 246:
-            INST("dcbtst", b11_5, b16_5);
-        case 1014:
-            INST("dcbz", b11_5, b16_5);
-
-            // lwarx/stwcx
-        case 20:
-            INST("lwarx", S, b11_5, b16_5)
-        case 84:
-            INST("ldarx", S, b11_5, b16_5)
-        case 150:
-            INST("stwcxRC", S, b11_5, b16_5)
-        case 214:
-            INST("stdcxRC", S, b11_5, b16_5)
-
-                // mtspr, mfspr (move to/from system register)
-        case 467:
-            INST("mtspr", b11_10, b6_5)
-        case 339:
-            INST("mfspr", b6_5, b11_10)
-
-                // MSR (Machine State Register)
-        case 83:
-            INST("mfmsr", b6_5)
-        case 178:
-            INST("mtmsrd", b6_5)
-
-                // mtcrf, mtocrf
-        case 144:
-            if (b11_1 == 0)
-                INST("mtcrf", b12_8, b6_5);
-            INST("mtocrf", b12_8, b6_5);
-
-            // mfcr, mfocrf
-        case 19:
-            if (b11_1 == 0)
-                INST("mfcr", b6_5);
-            INST("mfocrf", b12_8, b6_5);
-        }
-
-        uint32_t ext21_11 = ibf->GetAt(21, 11);
-        switch (ext21_11) {
-            // VMX LOADS
-        case 12:
-            INST("lvsl", b6_5, b11_5, b16_5)
-        case 1038:
-            INST("lvlx", S, b11_5, b16_5)
-        case 1550:
-            INST("lvlxl", S, b11_5, b16_5)
-        case 1102:
-            INST("lvrx", S, b11_5, b16_5)
-        case 1614:
-            INST("lvrxl", S, b11_5, b16_5)
-        case 206:
-            INST("lvx", S, b11_5, b16_5)
-        case 718:
-            INST("lvxl", S, b11_5, b16_5)
-        case 76:
-            INST("lvsr", S, b11_5, b16_5)
-
-                // STORE
-
-        case 270:
-            INST("stvebx", b6_5, b11_5, b16_5)
-        case 334:
-            INST("stvehx", b6_5, b11_5, b16_5)
-        case 398:
-            INST("stvewx", b6_5, b11_5, b16_5)
-        case 1294:
-            INST("stvlx", b6_5, b11_5, b16_5)
-        case 1806:
-            INST("stvlxl", b6_5, b11_5, b16_5)
-        case 1358:
-            INST("stvrx", b6_5, b11_5, b16_5)
-        case 1870:
-            INST("stvrxl", b6_5, b11_5, b16_5)
-        case 462:
-            INST("stvx", b6_5, b11_5, b16_5)
-        case 974:
-            INST("stvxl", b6_5, b11_5, b16_5)
-        }
-
-        // math extended
-        switch (ext22_9) {
-        case 10:
-            if (!b21_1 && !b31_1)
-                INST("addc", S, b11_5, b16_5);
-            if (!b21_1 && b31_1)
-                INST("addcRC", S, b11_5, b16_5);
-            if (b21_1 && !b31_1)
-                INST("addcOE", S, b11_5, b16_5);
-            if (b21_1 && b31_1)
-                INST("addcOERC", S, b11_5, b16_5);
-
-            // neg, neg., nego, nego.
-        case 104:
-            if (!b21_1 && !b31_1)
-                INST("neg", S, b11_5);
-            if (!b21_1 && b31_1)
-                INST("negRC", S, b11_5);
-            if (b21_1 && !b31_1)
-                INST("negOE", S, b11_5);
-            if (b21_1 && b31_1)
-                INST("negOERC", S, b11_5);
-
-            // subfe, subfe., subfeo, subfeo.
-        case 136:
-            if (!b21_1 && !b31_1)
-                INST("subfe", S, b11_5, b16_5);
-            if (!b21_1 && b31_1)
-                INST("subfeRC", S, b11_5, b16_5);
-            if (b21_1 && !b31_1)
-                INST("subfeOE", S, b11_5, b16_5);
-            if (b21_1 && b31_1)
-                INST("subfeOERC", S, b11_5, b16_5);
-
-        case 138:
-            if (!b21_1 && !b31_1)
-                INST("adde", S, b11_5, b16_5);
-            if (!b21_1 && b31_1)
-                INST("addeRC", S, b11_5, b16_5);
-            if (b21_1 && !b31_1)
-                INST("addeOE", S, b11_5, b16_5);
-            if (b21_1 && b31_1)
-                INST("addeOERC", S, b11_5, b16_5);
-
-        case 200:
-            if (!b21_1 && !b31_1)
-                INST("subfze", S, b11_5);
-            if (!b21_1 && b31_1)
-                INST("subfzeRC", S, b11_5);
-            if (b21_1 && !b31_1)
-                INST("subfzeOE", S, b11_5);
-            if (b21_1 && b31_1)
-                INST("subfzeOERC", S, b11_5);
-
-            // mullw, mullw., mullwo, mullwo.
-        case 235:
-            if (!b21_1 && !b31_1)
-                INST("mullw", S, b11_5, b16_5);
-            if (!b21_1 && b31_1)
-                INST("mullwRC", S, b11_5, b16_5);
-            if (b21_1 && !b31_1)
-                INST("mullwOE", S, b11_5, b16_5);
-            if (b21_1 && b31_1)
-                INST("mullwOERC", S, b11_5, b16_5);
-
-        case 233:
-            if (!b21_1 && !b31_1)
-                INST("mulld", S, b11_5, b16_5);
-            if (!b21_1 && b31_1)
-                INST("mulldRC", S, b11_5, b16_5);
-            if (b21_1 && !b31_1)
-                INST("mulldOE", S, b11_5, b16_5);
-            if (b21_1 && b31_1)
-                INST("mulldOERC", S, b11_5, b16_5);
-
-            // add rD,rA,rB (also RC OE)
-        case 266:
-            if (!b21_1 && !b31_1)
-                INST("add", S, b11_5, b16_5);
-            if (!b21_1 && b31_1)
-                INST("addRC", S, b11_5, b16_5);
-            if (b21_1 && !b31_1)
-                INST("addOE", S, b11_5, b16_5);
-            if (b21_1 && b31_1)
-                INST("addOERC", S, b11_5, b16_5);
-
-            // addze, addze., addzeo, addzeo.
-        case 202:
-            if (!b21_1 && !b31_1)
-                INST("addze", S, b11_5);
-            if (!b21_1 && b31_1)
-                INST("addzeRC", S, b11_5);
-            if (b21_1 && !b31_1)
-                INST("addzeOE", S, b11_5);
-            if (b21_1 && b31_1)
-                INST("addzeOERC", S, b11_5);
-
-            // subfc, subfc., subfco, subfco.
-        case 8:
-            if (!b21_1 && !b31_1)
-                INST("subfc", S, b11_5, b16_5);
-            if (!b21_1 && b31_1)
-                INST("subfcRC", S, b11_5, b16_5);
-            if (b21_1 && !b31_1)
-                INST("subfcOE", S, b11_5, b16_5);
-            if (b21_1 && b31_1)
-                INST("subfcOERC", S, b11_5, b16_5);
-
-            // subf rD,rA,rB (also RC OE)
-        case 40:
-            if (!b21_1 && !b31_1)
-                INST("subf", S, b11_5, b16_5);
-            if (!b21_1 && b31_1)
-                INST("subfRC", S, b11_5, b16_5);
-            if (b21_1 && !b31_1)
-                INST("subfOE", S, b11_5, b16_5);
-            if (b21_1 && b31_1)
-                INST("subfOERC", S, b11_5, b16_5);
-
-        case 234:
-            if (!b21_1 && !b31_1)
-                INST("addme", S, b11_5);
-            if (!b21_1 && b31_1)
-                INST("addmeRC", S, b11_5);
-            if (b21_1 && !b31_1)
-                INST("addmeOE", S, b11_5);
-            if (b21_1 && b31_1)
-                INST("addmeOERC", S, b11_5);
-
-        case 489:
-            if (!b21_1 && !b31_1)
-                INST("divd", S, b11_5, b16_5);
-            if (!b21_1 && b31_1)
-                INST("divdRC", S, b11_5, b16_5);
-            if (b21_1 && !b31_1)
-                INST("divdOE", S, b11_5, b16_5);
-            if (b21_1 && b31_1)
-                INST("divdOERC", S, b11_5, b16_5);
-
-            // divw, divw., divwo, divwo.
-        case 491:
-            if (!b21_1 && !b31_1)
-                INST("divw", S, b11_5, b16_5);
-            if (!b21_1 && b31_1)
-                INST("divwRC", S, b11_5, b16_5);
-            if (b21_1 && !b31_1)
-                INST("divwOE", S, b11_5, b16_5);
-            if (b21_1 && b31_1)
-                INST("divwOERC", S, b11_5, b16_5);
-
-            // divdu, divdu., divduo, divduo.
-        case 457:
-            if (!b21_1 && !b31_1)
-                INST("divdu", S, b11_5, b16_5);
-            if (!b21_1 && b31_1)
-                INST("divduRC", S, b11_5, b16_5);
-            if (b21_1 && !b31_1)
-                INST("divduOE", S, b11_5, b16_5);
-            if (b21_1 && b31_1)
-                INST("divduOERC", S, b11_5, b16_5);
+template <Field... fields>
+static uint32_t DecodeFail(const uint32_t instr, const DecodeEntry &, Instruction &) {
+  printf("EXTENDED OPS NOT IMPLEMENTED OP: %i", Bits(instr, 0, 6));
+  ((printf(" %i", Extract<fields>(instr, 0))), ...);
+  printf(" (%08X)\n", instr);
+  return 0;
+}
 
-            // divwu, divwu., divwuo, divwuo.
-        case 459:
-            if (!b21_1 && !b31_1)
-                INST("divwu", S, b11_5, b16_5);
-            if (!b21_1 && b31_1)
-                INST("divwuRC", S, b11_5, b16_5);
-            if (b21_1 && !b31_1)
-                INST("divwuOE", S, b11_5, b16_5);
-            if (b21_1 && b31_1)
-                INST("divwuOERC", S, b11_5, b16_5);
-        }
+static uint32_t DecodeUnknown(const uint32_t instr, const DecodeEntry &, Instruction &) {
+  printf("UNABLE TO DECODE INSTRUCTION: opcode: %i\n", Bits(instr, 0, 6));
+  __debugbreak();
+  printf("Unknown instruction %08X\n", instr);
+  return 0;
+}
 
-        printf("EXTENDED OPS NOT IMPLEMENTED EXTOC21_10: %i EXTOC21_11: %i EXTOC22_9: %i OP: %i\n",
-            ext21_10,
-            ext21_11,
-            ext22_9,
-            opcode);
-        return 0;
+static constexpr auto s_op4Table = [] {
+  std::array<DecodeEntry, 2048> table{}; // bits 21-31
+  FillDefault(table, &DecodeFail<>);
+  FillField(table, s_op4_xo21_1, 10, 1);
+  FillField(table, s_op4_xo26_6, 0, 6);
+  FillField(table, s_op4_xo21_7, 4, 7);
+  FillField(table, s_op4_xo21_11, 0, 11);
+  return table;
+}();
+
+static constexpr auto s_op5Table = [] {
+  std::array<DecodeEntry, 32> table{}; // (bit 27 << 4) | bits 22-25
+  FillDefault(table, &DecodeFail<>);
+  FillField(table, s_op5_xo, 0, 5);
+  return table;
+}();
+
+static constexpr auto s_op6Table = [] {
+  std::array<DecodeEntry, 128> table{}; // bits 21-27
+  FillDefault(table, &DecodeFail<>);
+  // bits 22-25 and bit 27 aren't contiguous in the key, bit 26 is a don't care
+  for (const XOEntry &spec : s_op6_xo) {
+    for (uint32_t b21 = 0; b21 < 2; b21++) {
+      for (uint32_t b26 = 0; b26 < 2; b26++)
+        table[(b21 << 6) | ((spec.xo & 0xF) << 2) | (b26 << 1) | (spec.xo >> 4)] = spec.entry;
     }
+  }
+  FillField(table, s_op6_xo21_7, 0, 7);
+  return table;
+}();
+
+static constexpr auto s_op19Table = [] {
+  std::array<DecodeEntry, 1024> table{}; // bits 21-30
+  FillDefault(table, &DecodeFail<>);
+  FillField(table, s_op19_xo21_10, 0, 10);
+  return table;
+}();
+
+static constexpr auto s_op30Table = [] {
+  std::array<DecodeEntry, 16> table{}; // bits 27-30
+  FillDefault(table, &DecodeFail<>);
+  FillField(table, s_op30_xo27_4, 0, 4);
+  FillField(table, s_op30_xo27_3, 1, 3);
+  return table;
+}();
+
+static constexpr auto s_op31Table = [] {
+  std::array<DecodeEntry, 2048> table{}; // bits 21-31
+  FillDefault(table, &DecodeFail<>);
+  FillField(table, s_op31_xo22_9, 1, 9);
+  FillField(table, s_op31_xo21_11, 0, 11);
+  FillField(table, s_op31_xo21_10, 1, 10);
+  return table;
+}();
+
+static constexpr auto s_op59Table = [] {
+  std::array<DecodeEntry, 32> table{}; // bits 26-30
+  FillDefault(table, &DecodeFail<>);
+  FillField(table, s_op59_xo26_5, 0, 5);
+  return table;
+}();
+
+static constexpr auto s_op63Table = [] {
+  std::array<DecodeEntry, 1024> table{}; // bits 21-30
+  FillDefault(table, &DecodeFail<>);
+  FillField(table, s_op63_xo26_5, 0, 5);
+  FillField(table, s_op63_xo21_10, 0, 10);
+  return table;
+}();
+
+template <const auto &table, uint32_t bestart, uint32_t length>
+static uint32_t DecodeExtended(const uint32_t instr, const DecodeEntry &, Instruction &out) {
+  const DecodeEntry &entry = table[Bits(instr, bestart, length)];
+  return entry.fn(instr, entry, out);
+}
 
-    case 32:
-        INST("lwz", S, b16_16, b11_5) // lwz rS,d(rA)
-    case 33:
-        INST("lwzu", S, b16_16, b11_5) // lwzu rS,d(rA)
-    case 34:
-        INST("lbz", S, b16_16, b11_5); // lbz rS,d(rA)
-    case 35:
-        INST("lbzu", S, b16_16, b11_5); // lbzu rS,d(rA)
-    case 36:
-        INST("stw", S, b16_16, b11_5) // stw rS,d(rA)
-    case 37:
-        INST("stwu", S, b16_16, b11_5) // stwu rS,d(rA)
-    case 38:
-        INST("stb", S, b16_16, b11_5) // stb rS,d(rA)
-    case 39:
-        INST("stbu", S, b16_16, b11_5) // stbu rS,d(rA)
-    case 40:
-        INST("lhz", S, b16_16, b11_5) // lhz rS,d(rA)
-    case 41:
-        INST("lhzu", S, b16_16, b11_5) // lhzu rS,d(rA)
-    case 42:
-        INST("lha", S, b16_16, b11_5) // lha rS,d(rA)
-    case 43:
-        INST("lhau", S, b16_16, b11_5) // lhau rS,d(rA)
-    case 44:
-        INST("sth", S, b16_16, b11_5) // sth rS,d(rA)
-    case 45:
-        INST("sthu", S, b16_16, b11_5) // sthu rS,d(rA)
-
-    case 48:
-        INST("lfs", S, b16_16, b11_5) // lfs frD,d(rA)
-    case 49:
-        INST("lfsu", S, b16_16, b11_5); // lfsu frD, d(rA)
-    case 50:
-        INST("lfd", S, b16_16, b11_5) // lfd frD, d(rA)
-    case 51:
-        INST("lfdu", S, b16_16, b11_5); // lfdu frD, d(rA)
-    case 52:
-        INST("stfs", S, b16_16, b11_5) // stfs frS,d(rA)
-    case 53:
-        INST("stfsu", S, b16_16, b11_5); // stfsu frS, d(rA)
-    case 54:
-        INST("stfd", S, b16_16, b11_5) // stfd frS, d(rA)
-    case 55:
-        INST("stfdu", S, b16_16, b11_5); // stfdu frS, d(rA)
-
-        // offset is *4
-    case 58:
-        if (aa && !b31_1)
-            INST("lwa", S, b16_14, b11_5) // lwa rD,ds(rA)
-            if (!aa && !b31_1)
-                INST("ld", S, b16_14, b11_5) // ld rD,ds(rA)
-                if (!aa && b31_1)
-                    INST("ldu", S, b16_14, b11_5) // ldu rD,ds(rA)
-
-    case 62:
-        if (!aa && !b31_1)
-            INST("std", S, b16_14, b11_5) // std rS,ds(rA)
-            if (!aa && b31_1)
-                INST("stdu", S, b16_14, b11_5) // stdu rS,ds(rA) if lk == 1
-
-                // single floating math wowoy
-    case 59: {
-            switch (ext26_5) {
-            case 20:
-                if (b31_1)
-                    INST("fsubsRC", S, b11_5, b16_5)
-                    INST("fsubs", S, b11_5, b16_5)
-            case 21:
-                if (b31_1)
-                    INST("faddsRC", S, b11_5, b16_5)
-                    INST("fadds", S, b11_5, b16_5)
-                    // fmuls frD,frA,frC (also RC)
-            case 25:
-                if (b31_1)
-                    INST("fmulsRC", S, b11_5, b21_5)
-                    INST("fmuls", S, b11_5, b21_5)
-            case 18:
-                if (b31_1)
-                    INST("fdivsRC", S, b11_5, b16_5)
-                    INST("fdivs", S, b11_5, b16_5)
-                    // fmadd, fmsub, fnmadd, fnmsub
-            case 29:
-                if (b31_1)
-                    INST("fmaddsRC", S, b11_5, b21_5, b16_5)
-                    INST("fmadds", S, b11_5, b21_5, b16_5)
-
-            case 28:
-                if (b31_1)
-                    INST("fmsubsRC", S, b11_5, b21_5, b16_5)
-                    INST("fmsubs", S, b11_5, b21_5, b16_5)
-
-            case 31:
-                if (b31_1)
-                    INST("fnmaddsRC", S, b11_5, b21_5, b16_5)
-                    INST("fnmadds", S, b11_5, b21_5, b16_5)
-
-            case 30:
-                if (b31_1)
-                    INST("fnmsubsRC", S, b11_5, b21_5, b16_5)
-                    INST("fnmsubs", S, b11_5, b21_5, b16_5)
-
-                    // fsqrts, fres
-            case 22:
-                if (b31_1)
-                    INST("fsqrtsRC", S, b16_5)
-                    INST("fsqrts", S, b16_5)
-
-            case 24:
-                if (b31_1)
-                    INST("fresRC", S, b16_5)
-                    INST("fres", S, b16_5)
-            }
-
-            printf("EXTENDED SINGLE FLOATING OPS NOT IMPLEMENTED EXTOC26_5: %i OP: %i\n", ext26_5, opcode);
-            return 0;
-        }
-
-        // double floating math wowoy
-    case 63: {
-        switch (ext21_10) {
-        case 0:
-            INST("fcmpu", b6_3, b11_5, b16_5)
-        case 32:
-            INST("fcmpo", b6_3, b11_5, b16_5)
-
-        case 814:
-            if (b31_1)
-                INST("fctidRC", S, b16_5)
-                INST("fctid", S, b16_5)
-
-        case 14:
-            if (b31_1)
-                INST("fctiwRC", S, b16_5)
-                INST("fctiw", S, b16_5)
-
-        case 15:
-            if (b31_1)
-                INST("fctiwzRC", S, b16_5)
-                INST("fctiwz", S, b16_5)
-
-                // frsp frD,frB (also RC)
-        case 12:
-            if (b31_1)
-                INST("frspRC", S, b16_5)
-                INST("frsp", S, b16_5)
-
-                // fneg frD,frB (also RC)
-        case 40:
-            if (b31_1)
-                INST("fnegRC", S, b16_5)
-                INST("fneg", S, b16_5)
-
-                // fmr frD, frB (also RC)
-        case 72:
-            if (b31_1)
-                INST("fmrRC", S, b16_5)
-                INST("fmr", S, b16_5)
-
-        case 264:
-            if (b31_1)
-                INST("fabsRC", S, b16_5)
-                INST("fabs", S, b16_5)
-
-        case 136:
-            if (b31_1)
-                INST("fnabsRC", S, b16_5)
-                INST("fnabs", S, b16_5)
-
-        case 815:
-            if (b31_1)
-                INST("fctidzRC", S, b16_5)
-                INST("fctidz", S, b16_5)
-
-                // fcfid frD,frB (also RC)
-        case 846:
-            if (b31_1)
-                INST("fcfidRC", S, b16_5)
-                INST("fcfid", S, b16_5)
-
-        case 583:
-            if (b31_1)
-                INST("mffsRC", b6_5)
-                INST("mffs", b6_5)
-
-        case 711:
-            if (b31_1)
-                INST("mtfsfRC", b7_8, b16_5)
-                INST("mtfsf", b7_8, b16_5)
-        }
-
-        switch (ext26_5) {
-            // fadd, fsub, fmul, fdiv
-        case 21:
-            if (b31_1)
-                INST("faddRC", S, b11_5, b16_5)
-                INST("fadd", S, b11_5, b16_5)
-
-        case 20:
-            if (b31_1)
-                INST("fsubRC", S, b11_5, b16_5)
-                INST("fsub", S, b11_5, b16_5)
-
-        case 25: // BEWARE, the second arg is at bit 21
-            if (b31_1)
-                INST("fmulRC", S, b11_5, b16_5)
-                INST("fmul", S, b11_5, b16_5)
-
-        case 18:
-            if (b31_1)
-                INST("fdivRC", S, b11_5, b16_5)
-                INST("fdiv", S, b11_5, b16_5)
-
-                // fmadd, fmsub, fnmadd, fnmsub
-        case 29:
-            if (b31_1)
-                INST("fmaddRC", S, b11_5, b21_5, b16_5)
-                INST("fmadd", S, b11_5, b21_5, b16_5)
-
-        case 28:
-            if (b31_1)
-                INST("fmsubRC", S, b11_5, b21_5, b16_5)
-                INST("fmsub", S, b11_5, b21_5, b16_5)
-
-        case 31:
-            if (b31_1)
-                INST("fnmaddRC", S, b11_5, b21_5, b16_5)
-                INST("fnmadd", S, b11_5, b21_5, b16_5)
+static uint32_t DecodeOp5(const uint32_t instr, const DecodeEntry &, Instruction &out) {
+  const DecodeEntry &entry = s_op5Table[(Bits(instr, 27, 1) << 4) | Bits(instr, 22, 4)];
+  return entry.fn(instr, entry, out);
+}
 
-        case 30:
-            if (b31_1)
-                INST("fnmsubRC", S, b11_5, b21_5, b16_5)
-                INST("fnmsub", S, b11_5, b21_5, b16_5)
+// ld/std families, DS form with the variant in the low 2 bits.
+// The invalid combinations used to fall through the switch into the primary 59 decoding,
+// keep doing that so the output stays the same.
+static uint32_t DecodeOp62(const uint32_t instr, const DecodeEntry &, Instruction &out) {
+  switch (Bits(instr, 30, 2)) {
+  case 0:
+    SetInstr(out, OP_std, {Bits(instr, 6, 5), Bits(instr, 16, 14), Bits(instr, 11, 5)});
+    return 4;
+  case 1:
+    SetInstr(out, OP_stdu, {Bits(instr, 6, 5), Bits(instr, 16, 14), Bits(instr, 11, 5)});
+    return 4;
+  }
+  static constexpr DecodeEntry op59 = {&DecodeExtended<s_op59Table, 26, 5>};
+  return op59.fn(instr, op59, out);
+}
 
-                // fsel frD,frA,frC,frB
-        case 23:
-            if (b31_1)
-                INST("fselRC", S, b11_5, b21_5, b16_5)
-                INST("fsel", S, b11_5, b21_5, b16_5)
+static uint32_t DecodeOp58(const uint32_t instr, const DecodeEntry &entry, Instruction &out) {
+  static constexpr PPCOpcode loads[] = {OP_ld, OP_ldu, OP_lwa};
+  const uint32_t variant = Bits(instr, 30, 2);
+  if (variant == 3)
+    return DecodeOp62(instr, entry, out);
 
-                // fsqrt and some other optional instructions
-        case 22:
-            if (b31_1)
-                INST("fsqrtRC", S, b16_5)
-                INST("fsqrt", S, b16_5)
+  SetInstr(out, loads[variant], {Bits(instr, 6, 5), Bits(instr, 16, 14), Bits(instr, 11, 5)});
+  return 4;
+}
 
-        case 24:
-            if (b31_1)
-                INST("freRC", S, b16_5)
-                INST("fre", S, b16_5)
+static constexpr auto s_primaryTable = [] {
+  std::array<DecodeEntry, 64> table{};
+  FillDefault(table, &DecodeUnknown);
+
+  table[0] = {X_NONE, {OP_nop}};
+  table[2] = {X_S_A_D, {OP_tdi}};
+  table[3] = {X_S_A_D, {OP_twi}};
+  table[4] = {&DecodeExtended<s_op4Table, 21, 11>};
+  table[5] = {&DecodeOp5};
+  table[6] = {&DecodeExtended<s_op6Table, 21, 7>};
+  table[7] = {X_S_A_D, {OP_mulli}};
+  table[8] = {X_S_A_D, {OP_subfic}};
+  table[10] = {X_CMPI, {OP_cmplwi, OP_cmpldi}};
+  table[11] = {X_CMPI, {OP_cmpwi, OP_cmpdi}};
+  table[12] = {X_S_A_D, {OP_addic}};
+  table[13] = {X_S_A_D, {OP_addicRC}};
+  // li and lis are just addi and addis with rA == 0
+  table[14] = {X_S_A_D_LI, {OP_addi, OP_li}};
+  table[15] = {X_S_A_D_LI, {OP_addis, OP_lis}};
+  table[16] = {X_BC, {OP_bc, OP_bcl, OP_bca, OP_bcla}};
+  table[18] = {X_B, {OP_b, OP_bl, OP_ba, OP_bla}};
+  table[19] = {&DecodeExtended<s_op19Table, 21, 10>};
+  table[20] = {X_RLW, {OP_rlwimi, OP_rlwimiRC}};
+  table[21] = {X_RLW, {OP_rlwinm, OP_rlwinmRC}};
+  table[23] = {X_RLW, {OP_rlwnm, OP_rlwnmRC}};
+  table[24] = {X_A_S_D, {OP_ori}};
+  table[25] = {X_A_S_D, {OP_oris}};
+  table[26] = {X_A_S_D, {OP_xori}};
+  table[27] = {X_A_S_D, {OP_xoris}};
+  table[28] = {X_A_S_D, {OP_andiRC}};
+  table[29] = {X_A_S_D, {OP_andisRC}};
+  table[30] = {&DecodeExtended<s_op30Table, 27, 4>};
+  table[31] = {&DecodeExtended<s_op31Table, 21, 11>};
+
+  // rS,d(rA) loads and stores
+  constexpr PPCOpcode dForm[] = {OP_lwz, OP_lwzu, OP_lbz,  OP_lbzu,  OP_stw,  OP_stwu,
+                                 OP_stb, OP_stbu, OP_lhz,  OP_lhzu,  OP_lha,  OP_lhau,
+                                 OP_sth, OP_sthu, OP_invalid, OP_invalid, OP_lfs, OP_lfsu,
+                                 OP_lfd, OP_lfdu, OP_stfs, OP_stfsu, OP_stfd, OP_stfdu};
+  for (uint32_t i = 0; i < 24; i++) {
+    if (dForm[i] != OP_invalid)
+      table[32 + i] = {X_S_D_A, {dForm[i]}};
+  }
 
-        case 26:
-            if (b31_1)
-                INST("frsqrteRC", S, b16_5)
-                INST("frsqrte", S, b16_5)
-        }
+  table[58] = {&DecodeOp58};
+  table[59] = {&DecodeExtended<s_op59Table, 26, 5>};
+  table[62] = {&DecodeOp62};
+  table[63] = {&DecodeExtended<s_op63Table, 21, 10>};
+  return table;
+}();
 
-        printf("EXTENDED DOUBLE FLOATING OPS NOT IMPLEMENTED EXTOC: %i OP: %i\n", ext21_10, opcode);
-        return 0;
-    }
-    }
+// *Stride* pointer to start of the 4 bytes of the instruction in memory
+// [out] instruction - the decoded instruction
+uint32_t InstructionDecoder::DecodeInstruction(const uint8_t *stride, Instruction &instruction) const {
+  // Xenons PowerPC instructions are always 4 bytes long and stored big endian
+  const uint32_t instr = SwapInstrBytes(*(uint32_t *)stride);
+  return DecodeWord(instr, (uint32_t)(m_imageBaseAddress + (stride - m_imageDataPtr)), instruction);
+}
 
-    printf("UNABLE TO DECODE INSTRUCTION: opcode: %i\n", opcode);
-    __debugbreak();
-    printf("Unknown instruction %08X\n", instr);
+uint32_t InstructionDecoder::DecodeWord(uint32_t instr, uint32_t address, Instruction &instruction) const {
+  instruction.address = address;
+  instruction.instrWord = instr;
 
-    return 0;
+  const DecodeEntry &entry = s_primaryTable[instr >> 26];
+  return entry.fn(instr, entry, instruction);
 }
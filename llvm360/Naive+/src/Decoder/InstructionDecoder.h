@@ -17,8 +17,11 @@ static inline uint32_t SwapInstrBytes(const uint32_t v) {
 class InstructionDecoder {
 public:
   InstructionDecoder(const Section *imageSection);
-  uint32_t GetInstructionAt(uint32_t address, Instruction &instruction);
-  uint32_t DecodeInstruction(const uint8_t *stride, Instruction &instruction);
+  // both are const so one decoder can be shared by the decode workers
+  uint32_t GetInstructionAt(uint32_t address, Instruction &instruction) const;
+  uint32_t DecodeInstruction(const uint8_t *stride, Instruction &instruction) const;
+  // decode an already byte swapped word (see WordScan.h)
+  uint32_t DecodeWord(uint32_t instr, uint32_t address, Instruction &instruction) const;
 
   const Section *m_imageSection;
   uint64_t m_imageBaseAddress;
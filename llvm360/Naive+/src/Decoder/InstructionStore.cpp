@@ -0,0 +1,149 @@
+#include "InstructionStore.h"
+#include <stdio.h>
+#include <stdexcept>
+#include <algorithm>
+
+void InstructionStore::AddSection(uint32_t base, uint32_t end) {
+  SectionRange section;
+  section.base = base;
+  section.end = end;
+  section.first = m_words.size();
+
+  // keep sections sorted so iterating the arrays is iterating addresses in order
+  if (!m_sections.empty() && base < m_sections.back().end) {
+    printf("InstructionStore: sections must be added in address order (%08X)\n", base);
+    return;
+  }
+  m_sections.push_back(section);
+
+  const size_t count = m_words.size() + (end - base) / 4;
+  m_words.resize(count, 0);
+  m_classes.resize(count, WC_UNKNOWN);
+  m_opcodes.resize(count, OP_invalid);
+  m_opsCount.resize(count, 0);
+  m_ops.resize(count, {});
+}
+
+void InstructionStore::LoadWords(uint32_t base, const uint8_t *bigEndian, size_t count) {
+  if (count == 0)
+    return;
+  const size_t first = indexOf(base);
+  indexOf(base + (uint32_t)(count - 1) * 4); // whole range must be inside the section
+  SwapWords(bigEndian, m_words.data() + first, count);
+  ClassifyWords(m_words.data() + first, m_classes.data() + first, count);
+}
+
+void InstructionStore::Restore(uint32_t base, const uint32_t *words, const uint8_t *classes, const PPCOpcode *opcodes,
+                               const uint8_t *opsCount, const std::array<uint32_t, INSTR_MAX_OPS> *ops, size_t count) {
+  if (count == 0)
+    return;
+  const size_t first = indexOf(base);
+  indexOf(base + (uint32_t)(count - 1) * 4);
+  std::copy(words, words + count, m_words.begin() + first);
+  std::copy(classes, classes + count, m_classes.begin() + first);
+  std::copy(opcodes, opcodes + count, m_opcodes.begin() + first);
+  std::copy(opsCount, opsCount + count, m_opsCount.begin() + first);
+  std::copy(ops, ops + count, m_ops.begin() + first);
+}
+
+void InstructionStore::Set(const Instruction &instr) {
+  const size_t idx = indexOf(instr.address);
+  m_words[idx] = instr.instrWord;
+  m_opcodes[idx] = instr.opcode;
+  m_opsCount[idx] = instr.opsCount;
+  std::copy(instr.ops, instr.ops + INSTR_MAX_OPS, m_ops[idx].begin());
+}
+
+uint32_t InstructionStore::Invalidate(uint32_t start, uint32_t end) {
+  uint32_t dropped = 0;
+  for (uint32_t address = start; address < end; address += 4) {
+    const size_t idx = indexOf(address);
+    if (m_opcodes[idx] != OP_invalid)
+      dropped++;
+    m_words[idx] = 0;
+    m_classes[idx] = WC_UNKNOWN;
+    m_opcodes[idx] = OP_invalid;
+    m_opsCount[idx] = 0;
+    m_ops[idx] = {};
+  }
+  return dropped;
+}
+
+void InstructionStore::Clear() {
+  m_sections.clear();
+  m_words.clear();
+  m_classes.clear();
+  m_opcodes.clear();
+  m_opsCount.clear();
+  m_ops.clear();
+}
+
+const InstructionStore::SectionRange *InstructionStore::findSection(uint32_t address) const {
+  // there are only a handful of executable sections, usually just one
+  for (const SectionRange &section : m_sections) {
+    if (address >= section.base && address < section.end)
+      return &section;
+  }
+  return nullptr;
+}
+
+size_t InstructionStore::indexOf(uint32_t address) const {
+  const SectionRange *section = findSection(address);
+  if (section == nullptr || (address & 3) != 0) {
+    char msg[64];
+    snprintf(msg, sizeof(msg), "InstructionStore: no instruction at %08X", address);
+    throw std::out_of_range(msg);
+  }
+  return section->first + (address - section->base) / 4;
+}
+
+bool InstructionStore::contains(uint32_t address) const {
+  return (address & 3) == 0 && findSection(address) != nullptr;
+}
+
+Instruction InstructionStore::at(uint32_t address) const {
+  const size_t idx = indexOf(address);
+  Instruction instr;
+  instr.address = address;
+  instr.instrWord = m_words[idx];
+  instr.opcode = m_opcodes[idx];
+  instr.opsCount = m_opsCount[idx];
+  std::copy(m_ops[idx].begin(), m_ops[idx].end(), instr.ops);
+  return instr;
+}
+
+PPCOpcode InstructionStore::opcodeAt(uint32_t address) const {
+  return m_opcodes[indexOf(address)];
+}
+
+uint32_t InstructionStore::wordAt(uint32_t address) const {
+  return m_words[indexOf(address)];
+}
+
+InstructionStore::Range InstructionStore::range(uint32_t start, uint32_t end) const {
+  return Range{Iterator(this, start), Iterator(this, end)};
+}
+
+WordClass InstructionStore::classAt(uint32_t address) const {
+  return (WordClass)m_classes[indexOf(address)];
+}
+
+const uint32_t *InstructionStore::wordData(uint32_t address) const {
+  return m_words.data() + indexOf(address);
+}
+
+const uint8_t *InstructionStore::classData(uint32_t address) const {
+  return m_classes.data() + indexOf(address);
+}
+
+const PPCOpcode *InstructionStore::opcodeData(uint32_t address) const {
+  return m_opcodes.data() + indexOf(address);
+}
+
+const uint8_t *InstructionStore::opsCountData(uint32_t address) const {
+  return m_opsCount.data() + indexOf(address);
+}
+
+const std::array<uint32_t, INSTR_MAX_OPS> *InstructionStore::opsData(uint32_t address) const {
+  return m_ops.data() + indexOf(address);
+}
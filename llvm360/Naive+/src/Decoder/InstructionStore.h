@@ -0,0 +1,104 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <array>
+#include "Instruction.h"
+#include "WordScan.h"
+
+//
+// Flat, address indexed storage for every decoded instruction.
+// PPC instructions are always 4 bytes so each executable section is just an array
+// indexed by (address - sectionBase) / 4, no hashing and scans are sequential.
+// Data is kept as structure of arrays (raw words, word classes, opcode ids, operands) so
+// passes that only look at opcodes or raw words never touch the operands.
+//
+class InstructionStore {
+public:
+  struct SectionRange {
+    uint32_t base;   // first address of the section
+    uint32_t end;    // one past the last decoded address
+    size_t first;    // index of `base` inside the arrays
+  };
+
+  class Iterator {
+  public:
+    Iterator(const InstructionStore *store, uint32_t address)
+      : m_store(store)
+      , m_address(address) {
+    }
+
+    inline Instruction operator*() const {
+      return m_store->at(m_address);
+    }
+    inline Iterator &operator++() {
+      m_address += 4;
+      return *this;
+    }
+    inline bool operator!=(const Iterator &other) const {
+      return m_address != other.m_address;
+    }
+    inline uint32_t address() const {
+      return m_address;
+    }
+
+  private:
+    const InstructionStore *m_store;
+    uint32_t m_address;
+  };
+
+  // [start, end) view usable in range based for loops
+  struct Range {
+    Iterator b;
+    Iterator e;
+    inline Iterator begin() const { return b; }
+    inline Iterator end() const { return e; }
+  };
+
+  // reserve the slots for a section, must be called before any Set in that range
+  void AddSection(uint32_t base, uint32_t end);
+  // bulk load the raw big endian words of [base, base + count * 4) and classify them,
+  // done once per section before decoding
+  void LoadWords(uint32_t base, const uint8_t *bigEndian, size_t count);
+  // bulk copy of a section saved earlier by the analysis cache, stands in for LoadWords and the
+  // decoding of [base, base + count * 4)
+  void Restore(uint32_t base, const uint32_t *words, const uint8_t *classes, const PPCOpcode *opcodes,
+               const uint8_t *opsCount, const std::array<uint32_t, INSTR_MAX_OPS> *ops, size_t count);
+  // Set is safe to call from multiple threads as long as they write different addresses
+  void Set(const Instruction &instr);
+  // reset [start, end) to undecoded, returns how many decoded slots were dropped
+  uint32_t Invalidate(uint32_t start, uint32_t end);
+  void Clear();
+
+  bool contains(uint32_t address) const;
+  Instruction at(uint32_t address) const;
+  PPCOpcode opcodeAt(uint32_t address) const;
+  uint32_t wordAt(uint32_t address) const;
+  WordClass classAt(uint32_t address) const;
+  // raw pointers into the section arrays, valid up to the end of the section holding `address`
+  const uint32_t *wordData(uint32_t address) const;
+  const uint8_t *classData(uint32_t address) const;
+  const PPCOpcode *opcodeData(uint32_t address) const;
+  const uint8_t *opsCountData(uint32_t address) const;
+  const std::array<uint32_t, INSTR_MAX_OPS> *opsData(uint32_t address) const;
+  Range range(uint32_t start, uint32_t end) const;
+
+  inline size_t size() const {
+    return m_words.size();
+  }
+  inline const std::vector<SectionRange> &sections() const {
+    return m_sections;
+  }
+
+private:
+  const SectionRange *findSection(uint32_t address) const;
+  size_t indexOf(uint32_t address) const;
+
+  std::vector<SectionRange> m_sections;
+
+  // SoA, all indexed the same way
+  std::vector<uint32_t> m_words;
+  std::vector<uint8_t> m_classes; // WordClass
+  std::vector<PPCOpcode> m_opcodes;
+  std::vector<uint8_t> m_opsCount;
+  std::vector<std::array<uint32_t, INSTR_MAX_OPS>> m_ops;
+};
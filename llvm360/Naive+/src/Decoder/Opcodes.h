@@ -0,0 +1,414 @@
+#pragma once
+#include <cstdint>
+
+//
+// Every mnemonic the decoder can produce, the enum value is what gets stored in
+// the decoded Instruction, the string is only used for printing / debug callbacks.
+// Keep OP_invalid first so a zeroed instruction is never mistaken for a real one
+//
+#define PPC_OPCODE_LIST(X) \
+  X(OP_invalid, "invalid") \
+  X(OP_nop, "nop") \
+  X(OP_tdi, "tdi") \
+  X(OP_twi, "twi") \
+  X(OP_stvewx, "stvewx") \
+  X(OP_mr, "mr") \
+  X(OP_vor, "vor") \
+  X(OP_lvlx, "lvlx") \
+  X(OP_lvlxl, "lvlxl") \
+  X(OP_lvrx, "lvrx") \
+  X(OP_lvrxl, "lvrxl") \
+  X(OP_lvx, "lvx") \
+  X(OP_lvxl, "lvxl") \
+  X(OP_stvlx, "stvlx") \
+  X(OP_stvlxl, "stvlxl") \
+  X(OP_stvrx, "stvrx") \
+  X(OP_stvx128, "stvx128") \
+  X(OP_vmaddfp, "vmaddfp") \
+  X(OP_vnmsubfp, "vnmsubfp") \
+  X(OP_vsldoi, "vsldoi") \
+  X(OP_vperm, "vperm") \
+  X(OP_vpkshss, "vpkshss") \
+  X(OP_vpkshus, "vpkshus") \
+  X(OP_vpkswss, "vpkswss") \
+  X(OP_vpkswus, "vpkswus") \
+  X(OP_vpkuhum, "vpkuhum") \
+  X(OP_vpkuhus, "vpkuhus") \
+  X(OP_vpkuwum, "vpkuwum") \
+  X(OP_vpkuwus, "vpkuwus") \
+  X(OP_vaddfp, "vaddfp") \
+  X(OP_vsubfp, "vsubfp") \
+  X(OP_vmulfp128, "vmulfp128") \
+  X(OP_vdot3fp, "vdot3fp") \
+  X(OP_vdot4fp, "vdot4fp") \
+  X(OP_vand, "vand") \
+  X(OP_vandc, "vandc") \
+  X(OP_vnor, "vnor") \
+  X(OP_vxor, "vxor") \
+  X(OP_vsel, "vsel") \
+  X(OP_vpermwi128, "vpermwi128") \
+  X(OP_vpkd3d128, "vpkd3d128") \
+  X(OP_vlogefp, "vlogefp") \
+  X(OP_vexptefp, "vexptefp") \
+  X(OP_vcfpsxws, "vcfpsxws") \
+  X(OP_vcfpuxws, "vcfpuxws") \
+  X(OP_vspltisw, "vspltisw") \
+  X(OP_vcsxwfp, "vcsxwfp") \
+  X(OP_vrsqrtefp, "vrsqrtefp") \
+  X(OP_vcmpeqfp, "vcmpeqfp") \
+  X(OP_vcmpeqfpRC, "vcmpeqfpRC") \
+  X(OP_vcmpgefp, "vcmpgefp") \
+  X(OP_vcmpgefpRC, "vcmpgefpRC") \
+  X(OP_vcmpgtfp, "vcmpgtfp") \
+  X(OP_vcmpgtfpRC, "vcmpgtfpRC") \
+  X(OP_vcmpbfp, "vcmpbfp") \
+  X(OP_vcmpbfpRC, "vcmpbfpRC") \
+  X(OP_vcmpequw, "vcmpequw") \
+  X(OP_vcmpequwRC, "vcmpequwRC") \
+  X(OP_vmaxfp, "vmaxfp") \
+  X(OP_vminfp, "vminfp") \
+  X(OP_vmrghw, "vmrghw") \
+  X(OP_vmrglw, "vmrglw") \
+  X(OP_vrlw, "vrlw") \
+  X(OP_vslw, "vslw") \
+  X(OP_vsraw, "vsraw") \
+  X(OP_vsrw, "vsrw") \
+  X(OP_vrfim, "vrfim") \
+  X(OP_vrfin, "vrfin") \
+  X(OP_vrfip, "vrfip") \
+  X(OP_vrfiz, "vrfiz") \
+  X(OP_mulli, "mulli") \
+  X(OP_subfic, "subfic") \
+  X(OP_cmplwi, "cmplwi") \
+  X(OP_cmpldi, "cmpldi") \
+  X(OP_cmpwi, "cmpwi") \
+  X(OP_cmpdi, "cmpdi") \
+  X(OP_addic, "addic") \
+  X(OP_addicRC, "addicRC") \
+  X(OP_li, "li") \
+  X(OP_addi, "addi") \
+  X(OP_lis, "lis") \
+  X(OP_addis, "addis") \
+  X(OP_bc, "bc") \
+  X(OP_bcl, "bcl") \
+  X(OP_bca, "bca") \
+  X(OP_bcla, "bcla") \
+  X(OP_b, "b") \
+  X(OP_bl, "bl") \
+  X(OP_ba, "ba") \
+  X(OP_bla, "bla") \
+  X(OP_bclrl, "bclrl") \
+  X(OP_bclr, "bclr") \
+  X(OP_bcctrl, "bcctrl") \
+  X(OP_bcctr, "bcctr") \
+  X(OP_rlwimiRC, "rlwimiRC") \
+  X(OP_rlwimi, "rlwimi") \
+  X(OP_rlwinmRC, "rlwinmRC") \
+  X(OP_rlwinm, "rlwinm") \
+  X(OP_rlwnmRC, "rlwnmRC") \
+  X(OP_rlwnm, "rlwnm") \
+  X(OP_oris, "oris") \
+  X(OP_xori, "xori") \
+  X(OP_xoris, "xoris") \
+  X(OP_andiRC, "andiRC") \
+  X(OP_andisRC, "andisRC") \
+  X(OP_ori, "ori") \
+  X(OP_rldiclRC, "rldiclRC") \
+  X(OP_rldicl, "rldicl") \
+  X(OP_rldicrlRC, "rldicrlRC") \
+  X(OP_rldicr, "rldicr") \
+  X(OP_rldicRC, "rldicRC") \
+  X(OP_rldic, "rldic") \
+  X(OP_rldimiRC, "rldimiRC") \
+  X(OP_rldimi, "rldimi") \
+  X(OP_rldclRC, "rldclRC") \
+  X(OP_rldcl, "rldcl") \
+  X(OP_rldcrRC, "rldcrRC") \
+  X(OP_rldcr, "rldcr") \
+  X(OP_cmpw, "cmpw") \
+  X(OP_cmpd, "cmpd") \
+  X(OP_mftb, "mftb") \
+  X(OP_ldx, "ldx") \
+  X(OP_ldux, "ldux") \
+  X(OP_lwzx, "lwzx") \
+  X(OP_lwzux, "lwzux") \
+  X(OP_lwax, "lwax") \
+  X(OP_lwaux, "lwaux") \
+  X(OP_lhzx, "lhzx") \
+  X(OP_lhzux, "lhzux") \
+  X(OP_lhax, "lhax") \
+  X(OP_lhaux, "lhaux") \
+  X(OP_lhbrx, "lhbrx") \
+  X(OP_lwbrx, "lwbrx") \
+  X(OP_sthbrx, "sthbrx") \
+  X(OP_stwbrx, "stwbrx") \
+  X(OP_stfsx, "stfsx") \
+  X(OP_stfsux, "stfsux") \
+  X(OP_stfdx, "stfdx") \
+  X(OP_stfdux, "stfdux") \
+  X(OP_stfiwx, "stfiwx") \
+  X(OP_stwx, "stwx") \
+  X(OP_stwux, "stwux") \
+  X(OP_sthx, "sthx") \
+  X(OP_sthux, "sthux") \
+  X(OP_stbx, "stbx") \
+  X(OP_stbux, "stbux") \
+  X(OP_lbzx, "lbzx") \
+  X(OP_lbzux, "lbzux") \
+  X(OP_stdx, "stdx") \
+  X(OP_stdux, "stdux") \
+  X(OP_popcntb, "popcntb") \
+  X(OP_sync, "sync") \
+  X(OP_lwsync, "lwsync") \
+  X(OP_ptesync, "ptesync") \
+  X(OP_eieio, "eieio") \
+  X(OP_lfsx, "lfsx") \
+  X(OP_lfsux, "lfsux") \
+  X(OP_lfdx, "lfdx") \
+  X(OP_lfdux, "lfdux") \
+  X(OP_extsbRC, "extsbRC") \
+  X(OP_extsb, "extsb") \
+  X(OP_extshRC, "extshRC") \
+  X(OP_extsh, "extsh") \
+  X(OP_extswRC, "extswRC") \
+  X(OP_extsw, "extsw") \
+  X(OP_cntlzwRC, "cntlzwRC") \
+  X(OP_cntlzw, "cntlzw") \
+  X(OP_cntlzdRC, "cntlzdRC") \
+  X(OP_cntlzd, "cntlzd") \
+  X(OP_sldRC, "sldRC") \
+  X(OP_sld, "sld") \
+  X(OP_slwRC, "slwRC") \
+  X(OP_slw, "slw") \
+  X(OP_srdRC, "srdRC") \
+  X(OP_srd, "srd") \
+  X(OP_srwRC, "srwRC") \
+  X(OP_srw, "srw") \
+  X(OP_sradRC, "sradRC") \
+  X(OP_srad, "srad") \
+  X(OP_srawRC, "srawRC") \
+  X(OP_sraw, "sraw") \
+  X(OP_andRC, "andRC") \
+  X(OP_and, "and") \
+  X(OP_cmplw, "cmplw") \
+  X(OP_cmpld, "cmpld") \
+  X(OP_orRC, "orRC") \
+  X(OP_or, "or") \
+  X(OP_xorRC, "xorRC") \
+  X(OP_xor, "xor") \
+  X(OP_nandRC, "nandRC") \
+  X(OP_nand, "nand") \
+  X(OP_norRC, "norRC") \
+  X(OP_nor, "nor") \
+  X(OP_eqvRC, "eqvRC") \
+  X(OP_eqv, "eqv") \
+  X(OP_andcRC, "andcRC") \
+  X(OP_andc, "andc") \
+  X(OP_orcRC, "orcRC") \
+  X(OP_orc, "orc") \
+  X(OP_srawiRC, "srawiRC") \
+  X(OP_srawi, "srawi") \
+  X(OP_sradiRC, "sradiRC") \
+  X(OP_sradi, "sradi") \
+  X(OP_dcbf, "dcbf") \
+  X(OP_dcbst, "dcbst") \
+  X(OP_dcbt, "dcbt") \
+  X(OP_dcbtst, "dcbtst") \
+  X(OP_dcbz, "dcbz") \
+  X(OP_lwarx, "lwarx") \
+  X(OP_ldarx, "ldarx") \
+  X(OP_stwcxRC, "stwcxRC") \
+  X(OP_stdcxRC, "stdcxRC") \
+  X(OP_mtspr, "mtspr") \
+  X(OP_mfspr, "mfspr") \
+  X(OP_mfmsr, "mfmsr") \
+  X(OP_mtmsrd, "mtmsrd") \
+  X(OP_mtcrf, "mtcrf") \
+  X(OP_mtocrf, "mtocrf") \
+  X(OP_mfcr, "mfcr") \
+  X(OP_mfocrf, "mfocrf") \
+  X(OP_lvsl, "lvsl") \
+  X(OP_lvsr, "lvsr") \
+  X(OP_stvebx, "stvebx") \
+  X(OP_stvehx, "stvehx") \
+  X(OP_stvrxl, "stvrxl") \
+  X(OP_stvx, "stvx") \
+  X(OP_stvxl, "stvxl") \
+  X(OP_addc, "addc") \
+  X(OP_addcRC, "addcRC") \
+  X(OP_addcOE, "addcOE") \
+  X(OP_addcOERC, "addcOERC") \
+  X(OP_neg, "neg") \
+  X(OP_negRC, "negRC") \
+  X(OP_negOE, "negOE") \
+  X(OP_negOERC, "negOERC") \
+  X(OP_subfe, "subfe") \
+  X(OP_subfeRC, "subfeRC") \
+  X(OP_subfeOE, "subfeOE") \
+  X(OP_subfeOERC, "subfeOERC") \
+  X(OP_adde, "adde") \
+  X(OP_addeRC, "addeRC") \
+  X(OP_addeOE, "addeOE") \
+  X(OP_addeOERC, "addeOERC") \
+  X(OP_subfze, "subfze") \
+  X(OP_subfzeRC, "subfzeRC") \
+  X(OP_subfzeOE, "subfzeOE") \
+  X(OP_subfzeOERC, "subfzeOERC") \
+  X(OP_mullw, "mullw") \
+  X(OP_mullwRC, "mullwRC") \
+  X(OP_mullwOE, "mullwOE") \
+  X(OP_mullwOERC, "mullwOERC") \
+  X(OP_mulld, "mulld") \
+  X(OP_mulldRC, "mulldRC") \
+  X(OP_mulldOE, "mulldOE") \
+  X(OP_mulldOERC, "mulldOERC") \
+  X(OP_add, "add") \
+  X(OP_addRC, "addRC") \
+  X(OP_addOE, "addOE") \
+  X(OP_addOERC, "addOERC") \
+  X(OP_addze, "addze") \
+  X(OP_addzeRC, "addzeRC") \
+  X(OP_addzeOE, "addzeOE") \
+  X(OP_addzeOERC, "addzeOERC") \
+  X(OP_subfc, "subfc") \
+  X(OP_subfcRC, "subfcRC") \
+  X(OP_subfcOE, "subfcOE") \
+  X(OP_subfcOERC, "subfcOERC") \
+  X(OP_subf, "subf") \
+  X(OP_subfRC, "subfRC") \
+  X(OP_subfOE, "subfOE") \
+  X(OP_subfOERC, "subfOERC") \
+  X(OP_addme, "addme") \
+  X(OP_addmeRC, "addmeRC") \
+  X(OP_addmeOE, "addmeOE") \
+  X(OP_addmeOERC, "addmeOERC") \
+  X(OP_divd, "divd") \
+  X(OP_divdRC, "divdRC") \
+  X(OP_divdOE, "divdOE") \
+  X(OP_divdOERC, "divdOERC") \
+  X(OP_divw, "divw") \
+  X(OP_divwRC, "divwRC") \
+  X(OP_divwOE, "divwOE") \
+  X(OP_divwOERC, "divwOERC") \
+  X(OP_divdu, "divdu") \
+  X(OP_divduRC, "divduRC") \
+  X(OP_divduOE, "divduOE") \
+  X(OP_divduOERC, "divduOERC") \
+  X(OP_divwu, "divwu") \
+  X(OP_divwuRC, "divwuRC") \
+  X(OP_divwuOE, "divwuOE") \
+  X(OP_divwuOERC, "divwuOERC") \
+  X(OP_lwz, "lwz") \
+  X(OP_lwzu, "lwzu") \
+  X(OP_lbz, "lbz") \
+  X(OP_lbzu, "lbzu") \
+  X(OP_stw, "stw") \
+  X(OP_stwu, "stwu") \
+  X(OP_stb, "stb") \
+  X(OP_stbu, "stbu") \
+  X(OP_lhz, "lhz") \
+  X(OP_lhzu, "lhzu") \
+  X(OP_lha, "lha") \
+  X(OP_lhau, "lhau") \
+  X(OP_sth, "sth") \
+  X(OP_sthu, "sthu") \
+  X(OP_lfs, "lfs") \
+  X(OP_lfsu, "lfsu") \
+  X(OP_lfd, "lfd") \
+  X(OP_lfdu, "lfdu") \
+  X(OP_stfs, "stfs") \
+  X(OP_stfsu, "stfsu") \
+  X(OP_stfd, "stfd") \
+  X(OP_stfdu, "stfdu") \
+  X(OP_lwa, "lwa") \
+  X(OP_ld, "ld") \
+  X(OP_ldu, "ldu") \
+  X(OP_std, "std") \
+  X(OP_stdu, "stdu") \
+  X(OP_fsubsRC, "fsubsRC") \
+  X(OP_fsubs, "fsubs") \
+  X(OP_faddsRC, "faddsRC") \
+  X(OP_fadds, "fadds") \
+  X(OP_fmulsRC, "fmulsRC") \
+  X(OP_fmuls, "fmuls") \
+  X(OP_fdivsRC, "fdivsRC") \
+  X(OP_fdivs, "fdivs") \
+  X(OP_fmaddsRC, "fmaddsRC") \
+  X(OP_fmadds, "fmadds") \
+  X(OP_fmsubsRC, "fmsubsRC") \
+  X(OP_fmsubs, "fmsubs") \
+  X(OP_fnmaddsRC, "fnmaddsRC") \
+  X(OP_fnmadds, "fnmadds") \
+  X(OP_fnmsubsRC, "fnmsubsRC") \
+  X(OP_fnmsubs, "fnmsubs") \
+  X(OP_fsqrtsRC, "fsqrtsRC") \
+  X(OP_fsqrts, "fsqrts") \
+  X(OP_fresRC, "fresRC") \
+  X(OP_fres, "fres") \
+  X(OP_fcmpu, "fcmpu") \
+  X(OP_fcmpo, "fcmpo") \
+  X(OP_fctidRC, "fctidRC") \
+  X(OP_fctid, "fctid") \
+  X(OP_fctiwRC, "fctiwRC") \
+  X(OP_fctiw, "fctiw") \
+  X(OP_fctiwzRC, "fctiwzRC") \
+  X(OP_fctiwz, "fctiwz") \
+  X(OP_frspRC, "frspRC") \
+  X(OP_frsp, "frsp") \
+  X(OP_fnegRC, "fnegRC") \
+  X(OP_fneg, "fneg") \
+  X(OP_fmrRC, "fmrRC") \
+  X(OP_fmr, "fmr") \
+  X(OP_fabsRC, "fabsRC") \
+  X(OP_fabs, "fabs") \
+  X(OP_fnabsRC, "fnabsRC") \
+  X(OP_fnabs, "fnabs") \
+  X(OP_fctidzRC, "fctidzRC") \
+  X(OP_fctidz, "fctidz") \
+  X(OP_fcfidRC, "fcfidRC") \
+  X(OP_fcfid, "fcfid") \
+  X(OP_mffsRC, "mffsRC") \
+  X(OP_mffs, "mffs") \
+  X(OP_mtfsfRC, "mtfsfRC") \
+  X(OP_mtfsf, "mtfsf") \
+  X(OP_faddRC, "faddRC") \
+  X(OP_fadd, "fadd") \
+  X(OP_fsubRC, "fsubRC") \
+  X(OP_fsub, "fsub") \
+  X(OP_fmulRC, "fmulRC") \
+  X(OP_fmul, "fmul") \
+  X(OP_fdivRC, "fdivRC") \
+  X(OP_fdiv, "fdiv") \
+  X(OP_fmaddRC, "fmaddRC") \
+  X(OP_fmadd, "fmadd") \
+  X(OP_fmsubRC, "fmsubRC") \
+  X(OP_fmsub, "fmsub") \
+  X(OP_fnmaddRC, "fnmaddRC") \
+  X(OP_fnmadd, "fnmadd") \
+  X(OP_fnmsubRC, "fnmsubRC") \
+  X(OP_fnmsub, "fnmsub") \
+  X(OP_fselRC, "fselRC") \
+  X(OP_fsel, "fsel") \
+  X(OP_fsqrtRC, "fsqrtRC") \
+  X(OP_fsqrt, "fsqrt") \
+  X(OP_freRC, "freRC") \
+  X(OP_fre, "fre") \
+  X(OP_frsqrteRC, "frsqrteRC") \
+  X(OP_frsqrte, "frsqrte")
+
+enum PPCOpcode : uint16_t {
+#define X(e, s) e,
+  PPC_OPCODE_LIST(X)
+#undef X
+  OP_COUNT
+};
+
+static const char *const s_opcodeNames[OP_COUNT] = {
+#define X(e, s) s,
+  PPC_OPCODE_LIST(X)
+#undef X
+};
+
+inline const char *GetOpcodeName(const PPCOpcode opcode) {
+  return opcode < OP_COUNT ? s_opcodeNames[opcode] : "invalid";
+}
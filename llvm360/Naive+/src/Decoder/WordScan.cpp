@@ -0,0 +1,154 @@
+#include "WordScan.h"
+#include <cstring>
+#include "misc/Utils.h"
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define WORDSCAN_X86 1
+#include <immintrin.h>
+// msvc lets us use any intrinsic, gcc/clang need the function to be tagged
+#ifdef _MSC_VER
+#define WORDSCAN_TARGET(x)
+#else
+#define WORDSCAN_TARGET(x) __attribute__((target(x)))
+#endif
+#endif
+
+// primary opcode -> WordClass
+static constexpr uint8_t s_primaryClass[64] = {
+  WC_NOP,       WC_UNKNOWN,   WC_ALU,       WC_ALU,       WC_VMX,       WC_VMX,       WC_VMX,       WC_ALU,        // 0-7
+  WC_ALU,       WC_UNKNOWN,   WC_ALU,       WC_ALU,       WC_ALU,       WC_ALU,       WC_ALU,       WC_ALU,        // 8-15
+  WC_BRANCH,    WC_UNKNOWN,   WC_BRANCH,    WC_BRANCH,    WC_ALU,       WC_ALU,       WC_UNKNOWN,   WC_ALU,        // 16-23
+  WC_ALU,       WC_ALU,       WC_ALU,       WC_ALU,       WC_ALU,       WC_ALU,       WC_ALU,       WC_ALU,        // 24-31
+  WC_LOADSTORE, WC_LOADSTORE, WC_LOADSTORE, WC_LOADSTORE, WC_LOADSTORE, WC_LOADSTORE, WC_LOADSTORE, WC_LOADSTORE,  // 32-39
+  WC_LOADSTORE, WC_LOADSTORE, WC_LOADSTORE, WC_LOADSTORE, WC_LOADSTORE, WC_LOADSTORE, WC_UNKNOWN,   WC_UNKNOWN,    // 40-47
+  WC_LOADSTORE, WC_LOADSTORE, WC_LOADSTORE, WC_LOADSTORE, WC_LOADSTORE, WC_LOADSTORE, WC_LOADSTORE, WC_LOADSTORE,  // 48-55
+  WC_UNKNOWN,   WC_UNKNOWN,   WC_LOADSTORE, WC_FPU,       WC_UNKNOWN,   WC_UNKNOWN,   WC_LOADSTORE, WC_FPU,        // 56-63
+};
+
+WordClass ClassifyWord(uint32_t word) {
+  return (WordClass)s_primaryClass[word >> 26];
+}
+
+static void SwapWordsScalar(const uint8_t *src, uint32_t *dst, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    uint32_t v;
+    memcpy(&v, src + i * 4, 4);
+    dst[i] = Swap32(v);
+  }
+}
+
+static void ClassifyWordsScalar(const uint32_t *words, uint8_t *classes, size_t count) {
+  for (size_t i = 0; i < count; i++)
+    classes[i] = s_primaryClass[words[i] >> 26];
+}
+
+#ifdef WORDSCAN_X86
+WORDSCAN_TARGET("sse4.1")
+static size_t SwapWordsSSE41(const uint8_t *src, uint32_t *dst, size_t count) {
+  const __m128i shuffle = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    const __m128i v = _mm_loadu_si128((const __m128i *)(src + i * 4));
+    _mm_storeu_si128((__m128i *)(dst + i), _mm_shuffle_epi8(v, shuffle));
+  }
+  return i;
+}
+
+WORDSCAN_TARGET("avx2")
+static size_t SwapWordsAVX2(const uint8_t *src, uint32_t *dst, size_t count) {
+  const __m256i shuffle = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                           3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    const __m256i v = _mm256_loadu_si256((const __m256i *)(src + i * 4));
+    _mm256_storeu_si256((__m256i *)(dst + i), _mm256_shuffle_epi8(v, shuffle));
+  }
+  return i;
+}
+
+//
+// 16 words per step: the primary opcodes are narrowed to 16 bytes, then looked up in the
+// 64 entry class table as four 16 byte pshufb tables selected by the top 2 bits
+//
+WORDSCAN_TARGET("sse4.1")
+static size_t ClassifyWordsSSE41(const uint32_t *words, uint8_t *classes, size_t count) {
+  __m128i lut[4];
+  for (int i = 0; i < 4; i++)
+    lut[i] = _mm_loadu_si128((const __m128i *)(s_primaryClass + i * 16));
+  const __m128i lowMask = _mm_set1_epi8(0x0F);
+
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    const __m128i a = _mm_srli_epi32(_mm_loadu_si128((const __m128i *)(words + i)), 26);
+    const __m128i b = _mm_srli_epi32(_mm_loadu_si128((const __m128i *)(words + i + 4)), 26);
+    const __m128i c = _mm_srli_epi32(_mm_loadu_si128((const __m128i *)(words + i + 8)), 26);
+    const __m128i d = _mm_srli_epi32(_mm_loadu_si128((const __m128i *)(words + i + 12)), 26);
+    const __m128i primary = _mm_packus_epi16(_mm_packus_epi32(a, b), _mm_packus_epi32(c, d));
+
+    const __m128i low = _mm_and_si128(primary, lowMask);
+    const __m128i high = _mm_and_si128(_mm_srli_epi16(primary, 4), lowMask);
+    __m128i result = _mm_setzero_si128();
+    for (int s = 0; s < 4; s++) {
+      const __m128i select = _mm_cmpeq_epi8(high, _mm_set1_epi8((char)s));
+      result = _mm_or_si128(result, _mm_and_si128(select, _mm_shuffle_epi8(lut[s], low)));
+    }
+    _mm_storeu_si128((__m128i *)(classes + i), result);
+  }
+  return i;
+}
+
+WORDSCAN_TARGET("avx2")
+static size_t ClassifyWordsAVX2(const uint32_t *words, uint8_t *classes, size_t count) {
+  __m256i lut[4];
+  for (int i = 0; i < 4; i++)
+    lut[i] = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)(s_primaryClass + i * 16)));
+  const __m256i lowMask = _mm256_set1_epi8(0x0F);
+  // the packs work per 128 bit lane, this puts the dwords back in word order
+  const __m256i fixOrder = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+  size_t i = 0;
+  for (; i + 32 <= count; i += 32) {
+    const __m256i a = _mm256_srli_epi32(_mm256_loadu_si256((const __m256i *)(words + i)), 26);
+    const __m256i b = _mm256_srli_epi32(_mm256_loadu_si256((const __m256i *)(words + i + 8)), 26);
+    const __m256i c = _mm256_srli_epi32(_mm256_loadu_si256((const __m256i *)(words + i + 16)), 26);
+    const __m256i d = _mm256_srli_epi32(_mm256_loadu_si256((const __m256i *)(words + i + 24)), 26);
+    __m256i primary = _mm256_packus_epi16(_mm256_packus_epi32(a, b), _mm256_packus_epi32(c, d));
+    primary = _mm256_permutevar8x32_epi32(primary, fixOrder);
+
+    const __m256i low = _mm256_and_si256(primary, lowMask);
+    const __m256i high = _mm256_and_si256(_mm256_srli_epi16(primary, 4), lowMask);
+    __m256i result = _mm256_setzero_si256();
+    for (int s = 0; s < 4; s++) {
+      const __m256i select = _mm256_cmpeq_epi8(high, _mm256_set1_epi8((char)s));
+      result = _mm256_or_si256(result, _mm256_and_si256(select, _mm256_shuffle_epi8(lut[s], low)));
+    }
+    _mm256_storeu_si256((__m256i *)(classes + i), result);
+  }
+  return i;
+}
+#endif
+
+void SwapWords(const uint8_t *src, uint32_t *dst, size_t count) {
+  size_t done = 0;
+#ifdef WORDSCAN_X86
+  const CpuFeatures &cpu = GetCpuFeatures();
+  if (cpu.avx2)
+    done = SwapWordsAVX2(src, dst, count);
+  else if (cpu.sse41)
+    done = SwapWordsSSE41(src, dst, count);
+#endif
+  // tail (or everything on hosts without SIMD)
+  SwapWordsScalar(src + done * 4, dst + done, count - done);
+}
+
+void ClassifyWords(const uint32_t *words, uint8_t *classes, size_t count) {
+  size_t done = 0;
+#ifdef WORDSCAN_X86
+  const CpuFeatures &cpu = GetCpuFeatures();
+  if (cpu.avx2)
+    done = ClassifyWordsAVX2(words, classes, count);
+  else if (cpu.sse41)
+    done = ClassifyWordsSSE41(words, classes, count);
+#endif
+  ClassifyWordsScalar(words + done, classes + done, count - done);
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+//
+// Bulk front end of the decoder.
+// Byte swaps a whole section of big endian words in one go and buckets every word by its
+// primary opcode, so passes that only care about a kind of instruction (branches, a
+// specific raw word...) can skip everything else without fully decoding it.
+// SSE4.1 and AVX2 paths are picked at runtime, with a scalar fallback.
+//
+
+enum WordClass : uint8_t {
+  WC_UNKNOWN,    // primary opcode we don't decode
+  WC_NOP,        // nop / zero padding
+  WC_BRANCH,     // b, bc, bclr, bcctr
+  WC_LOADSTORE,  // D/DS form loads and stores
+  WC_ALU,        // integer, compare, rotate, and primary 31 X forms
+  WC_FPU,        // primary 59 / 63
+  WC_VMX,        // primary 4 / 5 / 6
+};
+
+// big endian words at `src` to host order words at `dst`, src and dst may alias
+void SwapWords(const uint8_t *src, uint32_t *dst, size_t count);
+// host order words to one WordClass per word
+void ClassifyWords(const uint32_t *words, uint8_t *classes, size_t count);
+WordClass ClassifyWord(uint32_t word);
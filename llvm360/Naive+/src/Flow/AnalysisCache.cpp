@@ -0,0 +1,312 @@
+#include "AnalysisCache.h"
+#include "IR/IRGenerator.h"
+#include "IR/IRFunc.h"
+#include "IR/JumpTables.h"
+#include "Xex/XexLoader.h"
+#include "misc/SHA1.h"
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <fstream>
+#include <algorithm>
+#include <iterator>
+
+#define ANALYSIS_CACHE_MAGIC 0x3143414E // "NAC1"
+
+// generated by the CMake build from the analysis sources, other builds only have the time this
+// file was compiled
+#if __has_include("AnalysisBuildId.h")
+#include "AnalysisBuildId.h"
+#else
+#define ANALYSIS_BUILD_ID __DATE__ " " __TIME__
+#endif
+
+//
+// File layout, host endian (the magic reads differently otherwise), every array 4 byte aligned:
+//   CacheHeader
+//   CacheSection  [numSections]
+//   CacheFunction [numFunctions]
+//   CacheTable    [numTables]   in function order
+//   uint32_t      [numTargets]  in table order
+//   uint32_t      [numLeaders]  in function order
+//   words, ops, opcodes, opsCount, classes [numSlots] each, sections one after the other
+//
+struct CacheHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t flags;
+  uint32_t overrideEnd;
+  uint32_t baseAddress;
+  uint8_t imageHash[20];
+  uint8_t buildId[20];
+  uint32_t instCount;
+  uint32_t numSections;
+  uint32_t numFunctions;
+  uint32_t numTables;
+  uint32_t numTargets;
+  uint32_t numLeaders;
+  uint32_t numSlots;
+};
+
+struct CacheSection {
+  uint32_t base;
+  uint32_t end;
+};
+
+enum CacheFunctionFlags {
+  CACHE_FUNC_MFSPR_LR = 1 << 0,
+  CACHE_FUNC_PROMOTION = 1 << 1,
+};
+
+struct CacheFunction {
+  uint32_t start;
+  uint32_t end;
+  uint32_t flags;
+  uint32_t numTables;
+  uint32_t numLeaders; // 0 when the CFG was never built
+};
+
+struct CacheTable {
+  uint32_t start;
+  uint32_t end;
+  uint32_t variant; // JTVariantEnum
+  uint32_t numTargets;
+  uint32_t targetCount;
+};
+
+// bounds checked cursor over the file, every Take after a failed one fails too
+class CacheReader {
+public:
+  CacheReader(const uint8_t *data, size_t size)
+    : m_data(data)
+    , m_size(size) {
+  }
+
+  template <typename T> const T *Take(size_t count) {
+    if (m_failed || count > (m_size - m_pos) / sizeof(T)) {
+      m_failed = true;
+      return nullptr;
+    }
+    const T *out = reinterpret_cast<const T *>(m_data + m_pos);
+    m_pos += count * sizeof(T);
+    return out;
+  }
+
+  inline bool failed() const {
+    return m_failed;
+  }
+
+private:
+  const uint8_t *m_data;
+  size_t m_size;
+  size_t m_pos = 0;
+  bool m_failed = false;
+};
+
+AnalysisCache::AnalysisCache(IRGenerator *irGen, XexImage *image, uint32_t flags, uint32_t overrideEnd)
+  : m_irGen(irGen)
+  , m_image(image)
+  , m_flags(flags)
+  , m_overrideEnd(overrideEnd) {
+  SHA1::Hash(image->GetMemory(), image->GetMemorySize(), m_imageHash);
+  SHA1::Hash((const uint8_t *)ANALYSIS_BUILD_ID, sizeof(ANALYSIS_BUILD_ID) - 1, m_buildId);
+}
+
+bool AnalysisCache::Load(const std::string &path, uint32_t &instCount) {
+  const auto loadStart = std::chrono::high_resolution_clock::now();
+
+  MappedFile file;
+  if (!file.Open(std::wstring(path.begin(), path.end()).c_str()))
+    return false;
+
+  CacheReader reader(file.GetData(), file.GetSize());
+  const CacheHeader *header = reader.Take<CacheHeader>(1);
+  if (header == nullptr || header->magic != ANALYSIS_CACHE_MAGIC) {
+    printf("AnalysisCache: %s is not an analysis cache, ignored\n", path.c_str());
+    return false;
+  }
+  if (header->version != ANALYSIS_CACHE_VERSION || header->flags != m_flags ||
+      header->overrideEnd != m_overrideEnd || header->baseAddress != (uint32_t)m_image->GetBaseAddress() ||
+      memcmp(header->imageHash, m_imageHash, sizeof(m_imageHash)) != 0 ||
+      memcmp(header->buildId, m_buildId, sizeof(m_buildId)) != 0) {
+    printf("AnalysisCache: %s is stale, rebuilding\n", path.c_str());
+    return false;
+  }
+
+  const CacheSection *sections = reader.Take<CacheSection>(header->numSections);
+  const CacheFunction *functions = reader.Take<CacheFunction>(header->numFunctions);
+  const CacheTable *tables = reader.Take<CacheTable>(header->numTables);
+  const uint32_t *targets = reader.Take<uint32_t>(header->numTargets);
+  const uint32_t *leaders = reader.Take<uint32_t>(header->numLeaders);
+  const uint32_t *words = reader.Take<uint32_t>(header->numSlots);
+  const std::array<uint32_t, INSTR_MAX_OPS> *ops = reader.Take<std::array<uint32_t, INSTR_MAX_OPS>>(header->numSlots);
+  const PPCOpcode *opcodes = reader.Take<PPCOpcode>(header->numSlots);
+  const uint8_t *opsCount = reader.Take<uint8_t>(header->numSlots);
+  const uint8_t *classes = reader.Take<uint8_t>(header->numSlots);
+
+  // the counts have to add up before anything is restored
+  bool valid = !reader.failed();
+  size_t slots = 0;
+  uint64_t tableCount = 0, leaderCount = 0, targetCount = 0;
+  for (uint32_t i = 0; valid && i < header->numSections; i++) {
+    valid = sections[i].end >= sections[i].base && (sections[i].end - sections[i].base) % 4 == 0;
+    slots += (sections[i].end - sections[i].base) / 4;
+  }
+  for (uint32_t i = 0; valid && i < header->numFunctions; i++) {
+    tableCount += functions[i].numTables;
+    leaderCount += functions[i].numLeaders;
+  }
+  for (uint32_t i = 0; valid && i < header->numTables; i++) {
+    valid = tables[i].variant < JTVariantEnum::ENUM_SIZE;
+    targetCount += tables[i].targetCount;
+  }
+  if (!valid || slots != header->numSlots || tableCount != header->numTables || leaderCount != header->numLeaders ||
+      targetCount != header->numTargets) {
+    printf("AnalysisCache: %s is corrupted, rebuilding\n", path.c_str());
+    return false;
+  }
+
+  InstructionStore &store = m_irGen->instrsList;
+  size_t first = 0;
+  for (uint32_t i = 0; i < header->numSections; i++) {
+    const size_t count = (sections[i].end - sections[i].base) / 4;
+    store.AddSection(sections[i].base, sections[i].end);
+    store.Restore(sections[i].base, words + first, classes + first, opcodes + first, opsCount + first, ops + first, count);
+    first += count;
+  }
+
+  m_restored.clear();
+  m_leaders.clear();
+  for (uint32_t i = 0; i < header->numFunctions; i++) {
+    const CacheFunction &entry = functions[i];
+    IRFunc *func = m_irGen->getCreateFuncInMap(entry.start);
+    m_irGen->setFuncEnd(func, entry.end);
+    func->startW_MFSPR_LR = (entry.flags & CACHE_FUNC_MFSPR_LR) != 0;
+    func->is_promotion = (entry.flags & CACHE_FUNC_PROMOTION) != 0;
+
+    for (uint32_t t = 0; t < entry.numTables; t++, tables++) {
+      JumpTable *table = new JumpTable();
+      table->start_Address = tables->start;
+      table->end_Address = tables->end;
+      table->variant = jtVariantTypes[tables->variant];
+      table->numTargets = tables->numTargets;
+      table->targets.assign(targets, targets + tables->targetCount);
+      targets += tables->targetCount;
+      func->jumpTables.push_back(table);
+      func->has_jumpTable = true;
+    }
+
+    if (entry.numLeaders != 0) {
+      m_restored.push_back(func);
+      m_leaders.emplace_back(leaders, leaders + entry.numLeaders);
+      leaders += entry.numLeaders;
+    }
+  }
+  instCount += header->instCount;
+
+  const double loadMs =
+      std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - loadStart).count();
+  printf("AnalysisCache: loaded %s, %u functions, %u instructions in %.3f ms\n", path.c_str(), header->numFunctions,
+         header->instCount, loadMs);
+  return true;
+}
+
+void AnalysisCache::RestoreCFGs() {
+  for (size_t i = 0; i < m_restored.size(); i++)
+    m_restored[i]->cfg.Build(m_irGen, m_restored[i], m_leaders[i]);
+  m_restored.clear();
+  m_leaders.clear();
+}
+
+bool AnalysisCache::Save(const std::string &path, uint32_t instCount) const {
+  const InstructionStore &store = m_irGen->instrsList;
+
+  // by address so the file doesn't depend on the order of the function map
+  std::vector<IRFunc *> funcs;
+  for (const auto &pair : m_irGen->m_function_map) {
+    if (!pair.second->emission_done)
+      funcs.push_back(pair.second);
+  }
+  std::sort(funcs.begin(), funcs.end(), [](const IRFunc *a, const IRFunc *b) { return a->start_address < b->start_address; });
+
+  std::vector<CacheSection> sections;
+  std::vector<CacheFunction> functions;
+  std::vector<CacheTable> tables;
+  std::vector<uint32_t> targets;
+  std::vector<uint32_t> leaders;
+  std::vector<uint32_t> funcLeaders;
+  uint32_t slots = 0;
+  for (const InstructionStore::SectionRange &section : store.sections()) {
+    sections.push_back(CacheSection{section.base, section.end});
+    slots += (section.end - section.base) / 4;
+  }
+  for (const IRFunc *func : funcs) {
+    CacheFunction entry{};
+    entry.start = func->start_address;
+    entry.end = func->end_address;
+    entry.flags = (func->startW_MFSPR_LR ? CACHE_FUNC_MFSPR_LR : 0) | (func->is_promotion ? CACHE_FUNC_PROMOTION : 0);
+    for (const JumpTable *table : func->jumpTables) {
+      tables.push_back(CacheTable{table->start_Address, table->end_Address, (uint32_t)table->variant.type,
+                                  table->numTargets, (uint32_t)table->targets.size()});
+      targets.insert(targets.end(), table->targets.begin(), table->targets.end());
+      entry.numTables++;
+    }
+    if (func->cfg.built()) {
+      func->cfg.Leaders(funcLeaders);
+      leaders.insert(leaders.end(), funcLeaders.begin(), funcLeaders.end());
+      entry.numLeaders = (uint32_t)funcLeaders.size();
+    }
+    functions.push_back(entry);
+  }
+
+  CacheHeader header{};
+  header.magic = ANALYSIS_CACHE_MAGIC;
+  header.version = ANALYSIS_CACHE_VERSION;
+  header.flags = m_flags;
+  header.overrideEnd = m_overrideEnd;
+  header.baseAddress = (uint32_t)m_image->GetBaseAddress();
+  memcpy(header.imageHash, m_imageHash, sizeof(m_imageHash));
+  memcpy(header.buildId, m_buildId, sizeof(m_buildId));
+  header.instCount = instCount;
+  header.numSections = (uint32_t)sections.size();
+  header.numFunctions = (uint32_t)functions.size();
+  header.numTables = (uint32_t)tables.size();
+  header.numTargets = (uint32_t)targets.size();
+  header.numLeaders = (uint32_t)leaders.size();
+  header.numSlots = slots;
+
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  if (!out.is_open()) {
+    printf("AnalysisCache: can't write %s\n", path.c_str());
+    return false;
+  }
+  auto write = [&](const void *data, size_t bytes) { out.write(reinterpret_cast<const char *>(data), bytes); };
+  write(&header, sizeof(header));
+  write(sections.data(), sections.size() * sizeof(CacheSection));
+  write(functions.data(), functions.size() * sizeof(CacheFunction));
+  write(tables.data(), tables.size() * sizeof(CacheTable));
+  write(targets.data(), targets.size() * sizeof(uint32_t));
+  write(leaders.data(), leaders.size() * sizeof(uint32_t));
+
+  // one array at a time, every section in turn, the reader sees each as a single block
+  std::vector<CacheSection> filled;
+  std::copy_if(sections.begin(), sections.end(), std::back_inserter(filled),
+               [](const CacheSection &section) { return section.end != section.base; });
+  for (const CacheSection &section : filled)
+    write(store.wordData(section.base), (section.end - section.base) / 4 * sizeof(uint32_t));
+  for (const CacheSection &section : filled)
+    write(store.opsData(section.base), (section.end - section.base) / 4 * sizeof(std::array<uint32_t, INSTR_MAX_OPS>));
+  for (const CacheSection &section : filled)
+    write(store.opcodeData(section.base), (section.end - section.base) / 4 * sizeof(PPCOpcode));
+  for (const CacheSection &section : filled)
+    write(store.opsCountData(section.base), (section.end - section.base) / 4);
+  for (const CacheSection &section : filled)
+    write(store.classData(section.base), (section.end - section.base) / 4);
+
+  if (!out.good()) {
+    printf("AnalysisCache: failed writing %s\n", path.c_str());
+    return false;
+  }
+  printf("AnalysisCache: saved %s, %u functions, %u instructions\n", path.c_str(), header.numFunctions, instCount);
+  return true;
+}
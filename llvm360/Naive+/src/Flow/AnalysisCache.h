@@ -0,0 +1,52 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class IRGenerator;
+class IRFunc;
+class XexImage;
+
+// bump when the file layout changes, what the decoder and flow passes produce is covered by the
+// build id (cmake/AnalysisBuildId.cmake)
+#define ANALYSIS_CACHE_VERSION 2
+
+// options that change the analysis result, part of the key
+enum AnalysisCacheFlags {
+  ANALYSIS_FLOW_DISCOVERY = 1 << 0,
+  ANALYSIS_END_OVERRIDE = 1 << 1,
+};
+
+//
+// On disk copy of what the decode and flow passes produce for one image: the instruction
+// store arrays, the function bounds and flags, the jump tables and the block starts of every
+// CFG. Keyed by the SHA-1 of the loaded image, ANALYSIS_CACHE_VERSION, the build id and the
+// flags above so an unchanged XEX goes straight to emission. The file is the raw arrays one
+// after the other, Load validates them in the mapping and copies them into the instruction
+// store and the functions, the file is closed once it returns.
+// Import thunks aren't stored, they hold LLVM declarations and are patched again after Load.
+//
+class AnalysisCache {
+public:
+  AnalysisCache(IRGenerator *irGen, XexImage *image, uint32_t flags, uint32_t overrideEnd);
+
+  // restores the instruction store and the functions, false if the file is missing, truncated
+  // or made for another image / version / options, nothing is touched then
+  bool Load(const std::string &path, uint32_t &instCount);
+  // builds the CFGs of the restored functions from their saved block starts, once every other
+  // function (imports included) is in the map
+  void RestoreCFGs();
+  bool Save(const std::string &path, uint32_t instCount) const;
+
+private:
+  IRGenerator *m_irGen;
+  XexImage *m_image;
+  uint32_t m_flags;
+  uint32_t m_overrideEnd;
+  uint8_t m_imageHash[20];
+  uint8_t m_buildId[20];
+
+  // filled by Load, consumed by RestoreCFGs
+  std::vector<IRFunc *> m_restored;
+  std::vector<std::vector<uint32_t>> m_leaders;
+};
@@ -0,0 +1,399 @@
+#include "FlowDiscovery.h"
+#include "IR/IRGenerator.h"
+#include "IR/IRFunc.h"
+#include "IR/JumpTables.h"
+#include "IR/JumpTableMatcher.h"
+#include "misc/Profiler.h"
+#include <stdio.h>
+#include <chrono>
+#include <algorithm>
+
+enum BranchKind {
+  BR_NONE,          // not a branch, or one that comes back (calls)
+  BR_CALL,          // bl, target is a function
+  BR_JUMP,          // b / bc always
+  BR_COND,          // bc
+  BR_RETURN,        // bclr always
+  BR_COND_RETURN,   // bclr
+  BR_INDIRECT,      // bcctr always, a jump table or an indirect tail call
+  BR_COND_INDIRECT, // bcctr
+};
+
+struct Branch {
+  BranchKind kind;
+  uint32_t target;
+};
+
+// straight from the word, the decoded operands aren't needed to follow the flow
+static Branch classifyBranch(uint32_t address, uint32_t word) {
+  const uint32_t primary = word >> 26;
+  const bool link = (word & 1) != 0;
+  const bool absolute = (word & 2) != 0;
+  const bool always = (((word >> 21) & 0x1F) & 0x14) == 0x14; // BO ignores CR and CTR
+
+  if (primary == 18) {
+    uint32_t li = word & 0x03FFFFFC;
+    if (li & 0x02000000)
+      li |= 0xFC000000;
+    return Branch{link ? BR_CALL : BR_JUMP, absolute ? li : address + li};
+  }
+  if (primary == 16) {
+    uint32_t bd = word & 0xFFFC;
+    if (bd & 0x8000)
+      bd |= 0xFFFF0000;
+    // bcl is only used to read the PC (bcl 20,31,$+4)
+    if (link)
+      return Branch{BR_NONE, 0};
+    return Branch{always ? BR_JUMP : BR_COND, absolute ? bd : address + bd};
+  }
+  if (primary == 19 && !link) {
+    const uint32_t xo = (word >> 1) & 0x3FF;
+    if (xo == 16)
+      return Branch{always ? BR_RETURN : BR_COND_RETURN, 0};
+    if (xo == 528)
+      return Branch{always ? BR_INDIRECT : BR_COND_INDIRECT, 0};
+  }
+  return Branch{BR_NONE, 0};
+}
+
+FlowDiscovery::FlowDiscovery(IRGenerator *irGen, XexImage *image)
+  : m_irGen(irGen)
+  , m_image(image) {
+  const InstructionStore &store = m_irGen->instrsList;
+  for (const InstructionStore::SectionRange &section : store.sections()) {
+    if (section.end <= section.base)
+      continue;
+    CodeView view;
+    view.base = section.base;
+    view.end = section.end;
+    view.words = store.wordData(section.base);
+    view.opcodes = store.opcodeData(section.base);
+    view.visit.assign((section.end - section.base) / 4, 0);
+    view.leader.assign((section.end - section.base) / 4, 0);
+    m_views.push_back(std::move(view));
+  }
+}
+
+FlowDiscovery::CodeView *FlowDiscovery::findView(uint32_t address) {
+  for (CodeView &view : m_views) {
+    if (address >= view.base && address < view.end)
+      return &view;
+  }
+  return nullptr;
+}
+
+bool FlowDiscovery::isCode(uint32_t address) {
+  const CodeView *view = findView(address);
+  return view != nullptr && (address & 3) == 0 && view->opcodes[(address - view->base) / 4] != OP_invalid;
+}
+
+bool FlowDiscovery::readImageWord(uint32_t address, uint32_t &out) const {
+  const uint64_t offset = (uint64_t)address - m_image->GetBaseAddress();
+  if (address < m_image->GetBaseAddress() || offset + 4 > m_image->GetMemorySize())
+    return false;
+  const uint8_t *data = m_image->GetMemory() + offset;
+  out = ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | data[3];
+  return true;
+}
+
+bool FlowDiscovery::AddSeed(uint32_t address, const char *origin) {
+  if (!isCode(address))
+    return false;
+  if (m_irGen->isIRFuncinMap(address))
+    return true;
+
+  printf("{discovery} Found new function at: %08X (%s)\n", address, origin);
+  m_irGen->getCreateFuncInMap(address);
+  m_pending.push_back(address);
+  m_found.push_back(address);
+  return true;
+}
+
+void FlowDiscovery::SeedEntryPoint() {
+  const uint32_t entry = (uint32_t)m_image->GetEntryAddress();
+  if (!AddSeed(entry, "entry point"))
+    printf("{discovery} Entry point %08X is not decoded code\n", entry);
+}
+
+void FlowDiscovery::SeedKnownFunctions() {
+  std::vector<uint32_t> dropped;
+  for (const auto &pair : m_irGen->m_function_map) {
+    IRFunc *func = pair.second;
+    if (func->emission_done)
+      continue; // imports
+    if (!isCode(func->start_address)) {
+      dropped.push_back(func->start_address);
+      continue;
+    }
+    if (func->end_address != 0)
+      m_presetEnds[func->start_address] = func->end_address;
+    m_pending.push_back(func->start_address);
+  }
+  for (uint32_t address : dropped) {
+    printf("{discovery} Dropped function at: %08X, not decoded code\n", address);
+    m_irGen->removeFuncFromMap(address);
+  }
+}
+
+//
+// export table, ordOffset[i] + (imagebaseaddr << 16) is the address of ordinal base + i
+//
+void FlowDiscovery::SeedExports() {
+  const uint32_t table = m_image->m_xexData.loader_info.export_table;
+  uint32_t imageBase, count;
+  if (table == 0 || !readImageWord(table + 8 * 4, imageBase) || !readImageWord(table + 9 * 4, count))
+    return;
+
+  uint32_t seeded = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t offset;
+    if (!readImageWord(table + (11 + i) * 4, offset))
+      break;
+    if (offset != 0 && AddSeed(offset + (imageBase << 16), "export"))
+      seeded++;
+  }
+  printf("{discovery} %u exports\n", seeded);
+}
+
+//
+// words of the data sections that point at code, only kept when the code before the target ends
+// a function (blr, b, padding) so constants that happen to look like addresses aren't taken
+//
+void FlowDiscovery::SeedDataPointers() {
+  const uint32_t baseAddress = (uint32_t)m_image->GetBaseAddress();
+  uint32_t seeded = 0;
+  for (uint32_t i = 0; i < m_image->GetNumSections(); i++) {
+    const Section *section = m_image->GetSection(i);
+    if (section->CanExecute())
+      continue;
+
+    const uint32_t start = baseAddress + section->GetVirtualOffset();
+    const uint32_t end = start + section->GetVirtualSize();
+    for (uint32_t address = start; address + 4 <= end; address += 4) {
+      uint32_t target;
+      if (!readImageWord(address, target))
+        break;
+      const CodeView *view = findView(target);
+      if (view == nullptr || (target & 3) != 0 || m_irGen->isIRFuncinMap(target))
+        continue;
+
+      const uint32_t index = (target - view->base) / 4;
+      if (view->opcodes[index] == OP_invalid || view->opcodes[index] == OP_nop)
+        continue;
+      if (!isBoundary(*view, target))
+        continue;
+      if (AddSeed(target, "data pointer"))
+        seeded++;
+    }
+  }
+  printf("{discovery} %u functions from data pointers\n", seeded);
+}
+
+JumpTable *FlowDiscovery::matchJumpTable(const CodeView &view, uint32_t bcctr) {
+  auto cached = m_tables.find(bcctr);
+  if (cached != m_tables.end())
+    return cached->second;
+
+  JumpTable *table = nullptr;
+  const int match = JumpTableMatcher::Get().MatchEndingAt(view.opcodes, (bcctr - view.base) / 4);
+  if (match >= 0) {
+    const JTVariant &variant = jtVariantTypes[match];
+    table = new JumpTable();
+    table->start_Address = bcctr - ((uint32_t)variant.pattern.size() - 1) * 4;
+    table->end_Address = table->start_Address + (uint32_t)variant.pattern.size() * 4;
+    table->variant = variant;
+    table->ComputeTargets(m_irGen);
+    printf("{discovery} Found new jump table at: %08X\n", table->start_Address);
+  }
+  m_tables[bcctr] = table;
+  return table;
+}
+
+bool FlowDiscovery::isBoundary(const CodeView &view, uint32_t address) const {
+  if (address == view.base)
+    return true;
+  const uint32_t prev = view.words[(address - view.base) / 4 - 1];
+  return prev == 0x4E800020 || prev == 0x60000000 || prev == 0 || ((prev >> 26) == 18 && (prev & 1) == 0);
+}
+
+bool FlowDiscovery::isTailTarget(const CodeView &view, uint32_t func, uint32_t limit, uint32_t from,
+  const Branch &branch) {
+  const uint32_t target = branch.target;
+  if (target == func)
+    return false; // loops back to the start
+  if (target < func || target >= limit || m_irGen->isIRFuncinMap(target))
+    return true;
+  // a forward b over the end of this function to one nothing else found yet
+  return branch.kind == BR_JUMP && target > from && isBoundary(view, target);
+}
+
+//
+// walks everything reachable from the function start, the words reached and the block starts are
+// marked with m_gen in the section view
+//
+void FlowDiscovery::Explore(IRFunc *func, Shape &shape) {
+  const uint32_t start = func->start_address;
+  CodeView *view = findView(start);
+  shape.end = start;
+  shape.reached = 0;
+  shape.tables.clear();
+  if (view == nullptr)
+    return;
+
+  m_gen++;
+
+  // branches past the next function (or the .pdata end) leave this one
+  uint32_t limit = view->end;
+  const IRFunc *next = m_irGen->findNextFunc(start + 4);
+  if (next != nullptr && next->start_address < limit)
+    limit = next->start_address;
+  auto preset = m_presetEnds.find(start);
+  if (preset != m_presetEnds.end() && preset->second + 4 < limit)
+    limit = preset->second + 4;
+  shape.limit = limit;
+
+  std::vector<uint32_t> work;
+  auto addLeader = [&](uint32_t address) {
+    if (address < view->base || address >= view->end || (address & 3) != 0)
+      return;
+    const uint32_t index = (address - view->base) / 4;
+    if (view->leader[index] == m_gen)
+      return;
+    view->leader[index] = m_gen;
+    work.push_back(address);
+  };
+
+  addLeader(start);
+  while (!work.empty()) {
+    uint32_t address = work.back();
+    work.pop_back();
+
+    bool afterCall = false;
+    for (; address < view->end; address += 4) {
+      const uint32_t index = (address - view->base) / 4;
+      if (view->visit[index] == m_gen) {
+        addLeader(address); // joins code already walked, that's a block start
+        break;
+      }
+      if (view->opcodes[index] == OP_invalid)
+        break;
+      // fell into another function right after a call, that call doesn't return
+      if (afterCall && m_irGen->isIRFuncinMap(address))
+        break;
+
+      view->visit[index] = m_gen;
+      shape.end = std::max(shape.end, address);
+      shape.reached++;
+
+      const Branch branch = classifyBranch(address, view->words[index]);
+      afterCall = branch.kind == BR_CALL;
+      bool stop = true;
+      switch (branch.kind) {
+      case BR_NONE:
+        stop = false;
+        break;
+      case BR_CALL:
+        AddSeed(branch.target, "call");
+        stop = false;
+        break;
+      case BR_JUMP:
+        if (isTailTarget(*view, start, limit, address, branch))
+          AddSeed(branch.target, "tail call");
+        else
+          addLeader(branch.target);
+        break;
+      case BR_COND:
+        if (isTailTarget(*view, start, limit, address, branch))
+          AddSeed(branch.target, "conditional tail call");
+        else
+          addLeader(branch.target);
+        addLeader(address + 4);
+        break;
+      case BR_RETURN:
+        break;
+      case BR_COND_RETURN:
+      case BR_COND_INDIRECT:
+        addLeader(address + 4);
+        break;
+      case BR_INDIRECT:
+        if (JumpTable *table = matchJumpTable(*view, address)) {
+          for (uint32_t target : table->targets)
+            addLeader(target);
+          shape.tables.push_back(table);
+        }
+        break;
+      }
+      if (stop)
+        break;
+    }
+  }
+}
+
+//
+// stores what the last Explore found, the blocks are cut by the CFG once every bound is final
+//
+void FlowDiscovery::Build(IRFunc *func, const Shape &shape) {
+  if (m_presetEnds.find(func->start_address) == m_presetEnds.end())
+    m_irGen->setFuncEnd(func, shape.end);
+  func->jumpTables = shape.tables;
+  func->has_jumpTable = !shape.tables.empty();
+  m_extents[func->start_address] = Extent{shape.limit, shape.end, shape.reached};
+}
+
+void FlowDiscovery::Run() {
+  ProfileScope scope("flow", "discovery");
+  const auto start = std::chrono::high_resolution_clock::now();
+
+  size_t rounds = 0;
+  size_t explored = 0;
+  Shape shape;
+  do {
+    rounds++;
+    // follow calls and tail calls until no new function shows up
+    while (!m_pending.empty()) {
+      const uint32_t address = m_pending.back();
+      m_pending.pop_back();
+      auto it = m_irGen->m_function_map.find(address);
+      if (it != m_irGen->m_function_map.end()) {
+        Explore(it->second, shape);
+        explored++;
+      }
+    }
+
+    // the split between a branch and a tail call depends on every start being known, so the
+    // bounds are only stored now. A function found inside the range an earlier one was built
+    // with moves its limit or turns its branches into tail calls, the others come out the same
+    // and aren't explored again. A function found at this point means another round.
+    std::sort(m_found.begin(), m_found.end());
+    std::vector<IRFunc *> funcs;
+    for (const auto &pair : m_irGen->m_funcBounds.byStart()) {
+      IRFunc *func = pair.second;
+      if (func->emission_done)
+        continue;
+      auto extent = m_extents.find(func->start_address);
+      if (extent != m_extents.end()) {
+        const uint32_t last = std::max(extent->second.limit - 4, extent->second.end);
+        auto found = std::upper_bound(m_found.begin(), m_found.end(), func->start_address);
+        if (found == m_found.end() || *found > last)
+          continue;
+      }
+      funcs.push_back(func);
+    }
+    m_found.clear();
+
+    for (IRFunc *func : funcs) {
+      Explore(func, shape);
+      Build(func, shape);
+      explored++;
+    }
+  } while (!m_pending.empty());
+
+  size_t reachedCount = 0;
+  for (const auto &pair : m_extents)
+    reachedCount += pair.second.reached;
+
+  ProfileCount("discovery explored", explored);
+  printf("Discovery: %zu functions, %zu instructions reached, %zu explored in %zu rounds, %.3f ms\n",
+    m_irGen->m_function_map.size(), reachedCount, explored, rounds,
+    std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count());
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <unordered_map>
+#include "Decoder/InstructionStore.h"
+
+class IRGenerator;
+class IRFunc;
+class XexImage;
+class JumpTable;
+struct Branch;
+
+//
+// Recursive descent discovery, the alternative to the bounds heuristics of the FlowEngine.
+// Functions are seeded from the entry point, the ones already known (.pdata, imports), the
+// exports and the code pointers stored in the data sections, then a worklist follows calls,
+// direct branches and resolved jump tables. Every function gets its bounds and jump tables from
+// the code reachable from its start, code nothing reaches is never visited. A function is only
+// explored again when one found later lands inside the range it was built with.
+//
+class FlowDiscovery {
+public:
+  FlowDiscovery(IRGenerator *irGen, XexImage *image);
+
+  void SeedEntryPoint();
+  void SeedKnownFunctions(); // everything already in the function map
+  void SeedExports();
+  void SeedDataPointers();
+  // queues a function start, false if the address isn't decoded code
+  bool AddSeed(uint32_t address, const char *origin);
+
+  // explores the worklist until no new function shows up and stores the bounds
+  void Run();
+
+private:
+  // decoded executable section with the marks of the walk in progress
+  struct CodeView {
+    uint32_t base;
+    uint32_t end;
+    const uint32_t *words;
+    const PPCOpcode *opcodes;
+    std::vector<uint32_t> visit; // m_gen of the last walk that reached the word
+    std::vector<uint32_t> leader; // m_gen of the last walk that started a block there
+  };
+
+  struct Shape {
+    uint32_t end;
+    uint32_t limit; // branches at or past it are tail calls
+    uint32_t reached; // instructions walked
+    std::vector<JumpTable *> tables;
+  };
+
+  // what a function was last explored with
+  struct Extent {
+    uint32_t limit;
+    uint32_t end;
+    uint32_t reached;
+  };
+
+  CodeView *findView(uint32_t address);
+  bool isCode(uint32_t address);
+  bool readImageWord(uint32_t address, uint32_t &out) const;
+  JumpTable *matchJumpTable(const CodeView &view, uint32_t bcctr);
+  // the code before `address` ends a function (blr, b, padding)
+  bool isBoundary(const CodeView &view, uint32_t address) const;
+  // branch out of the function rather than inside it
+  bool isTailTarget(const CodeView &view, uint32_t func, uint32_t limit, uint32_t from, const Branch &branch);
+
+  void Explore(IRFunc *func, Shape &shape);
+  void Build(IRFunc *func, const Shape &shape);
+
+  IRGenerator *m_irGen;
+  XexImage *m_image;
+
+  std::vector<CodeView> m_views;
+  uint32_t m_gen = 0;
+
+  std::vector<uint32_t> m_pending;
+  std::vector<uint32_t> m_found; // functions found since the last build
+  std::unordered_map<uint32_t, Extent> m_extents; // by function start
+  std::unordered_map<uint32_t, uint32_t> m_presetEnds; // bounds that came from .pdata / imports
+  std::unordered_map<uint32_t, JumpTable *> m_tables;  // by bcctr address, null if no table
+};
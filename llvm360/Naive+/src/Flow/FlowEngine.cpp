@@ -0,0 +1,135 @@
+#include "FlowEngine.h"
+#include "IR/IRGenerator.h"
+#include "misc/Profiler.h"
+#include <stdio.h>
+#include <chrono>
+#include <algorithm>
+
+uint32_t FlowSection::nextLandmark(FlowLandmark landmark, uint32_t address) const {
+  const std::vector<uint32_t> &list = landmarks[landmark];
+  auto it = std::lower_bound(list.begin(), list.end(), address);
+  return it == list.end() ? end : *it;
+}
+
+FlowEngine::FlowEngine(IRGenerator *irGen, XexImage *image)
+  : m_irGen(irGen)
+  , m_image(image) {
+}
+
+void FlowEngine::AddTarget(const FlowTrigger &trigger, const Target &target) {
+  if (trigger.opcode != OP_invalid) {
+    m_byOpcode[trigger.opcode].push_back(target);
+  } else {
+    Target t = target;
+    t.word = trigger.word;
+    m_byPrimary[trigger.word >> 26].push_back(t);
+  }
+}
+
+void FlowEngine::AddRule(const FlowRule &rule, std::initializer_list<FlowTrigger> triggers) {
+  const uint16_t index = (uint16_t)m_rules.size();
+  m_rules.push_back(rule);
+  m_stages.push_back(Stage{true, index});
+  for (const FlowTrigger &trigger : triggers)
+    AddTarget(trigger, Target{0, index, false});
+}
+
+void FlowEngine::AddStep(const FlowStep &step) {
+  m_stages.push_back(Stage{false, (uint32_t)m_steps.size()});
+  m_steps.push_back(step);
+}
+
+void FlowEngine::AddLandmark(FlowLandmark landmark, FlowTrigger trigger) {
+  AddTarget(trigger, Target{0, (uint16_t)landmark, true});
+}
+
+const FlowSection *FlowEngine::FindSection(uint32_t address) const {
+  for (const std::unique_ptr<FlowSection> &section : m_sections) {
+    if (section->contains(address))
+      return section.get();
+  }
+  return nullptr;
+}
+
+//
+// the single pass over the section, every word is only handed to the rules that registered for
+// its opcode or for its exact value, matches are kept per rule in address order
+//
+void FlowEngine::Sweep(FlowSection &section, std::vector<std::vector<FlowMatch>> &matches) {
+  const uint32_t count = (section.end - section.base) / 4;
+  for (uint32_t i = 0; i < count; i++) {
+    const uint32_t address = section.base + i * 4;
+    const uint32_t word = section.words[i];
+
+    for (const Target &target : m_byOpcode[section.opcodes[i]]) {
+      if (target.isLandmark) {
+        section.landmarks[target.index].push_back(address);
+        continue;
+      }
+      FlowMatch match;
+      if (m_rules[target.index].match(section, address, match))
+        matches[target.index].push_back(match);
+    }
+
+    for (const Target &target : m_byPrimary[word >> 26]) {
+      if (target.word != word)
+        continue;
+      if (target.isLandmark) {
+        section.landmarks[target.index].push_back(address);
+        continue;
+      }
+      FlowMatch match;
+      if (m_rules[target.index].match(section, address, match))
+        matches[target.index].push_back(match);
+    }
+  }
+}
+
+void FlowEngine::Run(uint32_t base, uint32_t end) {
+  if (base >= end)
+    return;
+
+  const auto sweepStart = std::chrono::high_resolution_clock::now();
+
+  const InstructionStore &store = m_irGen->instrsList;
+  std::unique_ptr<FlowSection> owned = std::make_unique<FlowSection>();
+  FlowSection &section = *owned;
+  section.base = base;
+  section.end = end;
+  section.words = store.wordData(base);
+  section.opcodes = store.opcodeData(base);
+  section.ops = store.opsData(base);
+  m_sections.push_back(std::move(owned));
+
+  std::vector<std::vector<FlowMatch>> matches(m_rules.size());
+  {
+    ProfileScope scope("flow", "sweep", base);
+    Sweep(section, matches);
+  }
+
+  const double sweepMs =
+    std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - sweepStart).count();
+
+  // apply in registration order, each rule sees the map as its old pass did
+  FlowContext ctx{m_irGen, m_image, this, &section};
+  for (const Stage &stage : m_stages) {
+    if (stage.isRule) {
+      const FlowRule &rule = m_rules[stage.index];
+      ProfileScope scope("flow rule", rule.name);
+      for (const FlowMatch &match : matches[stage.index])
+        rule.apply(ctx, match);
+      if (Profiler::Get().enabled())
+        Profiler::Get().Count(std::string("flow matches: ") + rule.name, matches[stage.index].size());
+    } else {
+      ProfileScope scope("flow step", m_steps[stage.index].name);
+      m_steps[stage.index].run(ctx);
+    }
+  }
+
+  size_t matchCount = 0;
+  for (const std::vector<FlowMatch> &list : matches)
+    matchCount += list.size();
+  printf("Flow: swept %u words in %.3f ms, %zu rule matches, %.3f ms total\n", (end - base) / 4, sweepMs,
+    matchCount,
+    std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - sweepStart).count());
+}
@@ -0,0 +1,151 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <array>
+#include <initializer_list>
+#include <memory>
+#include "Decoder/InstructionStore.h"
+
+class IRGenerator;
+class XexImage;
+class FlowEngine;
+
+//
+// Addresses the sweep records for the epilogue steps, so they can jump from a function start
+// to the next candidate instead of walking every word again.
+//
+enum FlowLandmark {
+  FLOW_LM_EXIT,     // b / bclr, candidates for a function end
+  FLOW_LM_BCLR,     // bclr only
+  FLOW_LM_MTLR,     // mtspr LR, r12 (restores the LR saved by the prologue)
+  FLOW_LM_COUNT
+};
+
+//
+// One swept executable section.
+// Raw views into the instruction store plus the landmarks found while sweeping it.
+//
+struct FlowSection {
+  uint32_t base = 0;
+  uint32_t end = 0;
+  const uint32_t *words = nullptr;
+  const PPCOpcode *opcodes = nullptr;
+  const std::array<uint32_t, INSTR_MAX_OPS> *ops = nullptr;
+  std::vector<uint32_t> landmarks[FLOW_LM_COUNT];
+
+  inline bool contains(uint32_t address) const {
+    return address >= base && address < end;
+  }
+  inline uint32_t index(uint32_t address) const {
+    return (address - base) / 4;
+  }
+  inline uint32_t wordAt(uint32_t address) const {
+    return words[index(address)];
+  }
+  inline PPCOpcode opcodeAt(uint32_t address) const {
+    return opcodes[index(address)];
+  }
+  inline const uint32_t *opsAt(uint32_t address) const {
+    return ops[index(address)].data();
+  }
+  // first landmark at or after `address`, `end` if there is none
+  uint32_t nextLandmark(FlowLandmark landmark, uint32_t address) const;
+};
+
+struct FlowContext {
+  IRGenerator *irGen;
+  XexImage *image;
+  const FlowEngine *engine;
+  const FlowSection *section; // the one being run
+};
+
+// what a rule matched during the sweep, applied once the sweep is done
+struct FlowMatch {
+  uint32_t address;
+  uint32_t target;
+  uint32_t kind; // rule defined
+};
+
+// rules are triggered by a decoded opcode or by an exact instruction word
+struct FlowTrigger {
+  PPCOpcode opcode;
+  uint32_t word;
+
+  static inline FlowTrigger Op(PPCOpcode opcode) {
+    return FlowTrigger{opcode, 0};
+  }
+  static inline FlowTrigger Word(uint32_t word) {
+    return FlowTrigger{OP_invalid, word};
+  }
+};
+
+//
+// Pattern rule.
+// `match` only looks at the instruction words (never at the function map) so every rule can
+// be tested on the same sweep, `apply` runs afterwards in address order with the map in the
+// same state the standalone pass used to see.
+//
+struct FlowRule {
+  const char *name;
+  bool (*match)(const FlowSection &section, uint32_t address, FlowMatch &out);
+  void (*apply)(FlowContext &ctx, const FlowMatch &match);
+};
+
+// step that needs the results of the rules before it (epilogues, fixups...)
+struct FlowStep {
+  const char *name;
+  void (*run)(FlowContext &ctx);
+};
+
+//
+// Flow analysis engine.
+// Replaces the standalone flow passes that each rescanned the section: all rules are
+// evaluated in a single sweep, then their matches and the dependent steps are applied in
+// registration order, which is the order the passes used to run in.
+//
+class FlowEngine {
+public:
+  FlowEngine(IRGenerator *irGen, XexImage *image);
+
+  void AddRule(const FlowRule &rule, std::initializer_list<FlowTrigger> triggers);
+  void AddStep(const FlowStep &step);
+  void AddLandmark(FlowLandmark landmark, FlowTrigger trigger);
+
+  // sweep [base, end) and apply every stage to it
+  void Run(uint32_t base, uint32_t end);
+
+  // section holding `address` from the ones swept so far, null if none
+  const FlowSection *FindSection(uint32_t address) const;
+
+private:
+  struct Stage {
+    bool isRule;
+    uint32_t index; // into m_rules or m_steps
+  };
+
+  // what fires for a trigger, rules or landmarks
+  struct Target {
+    uint32_t word;   // exact word for word triggers
+    uint16_t index;  // rule index or landmark
+    bool isLandmark;
+  };
+
+  void AddTarget(const FlowTrigger &trigger, const Target &target);
+  void Sweep(FlowSection &section, std::vector<std::vector<FlowMatch>> &matches);
+
+  IRGenerator *m_irGen;
+  XexImage *m_image;
+
+  std::vector<FlowRule> m_rules;
+  std::vector<FlowStep> m_steps;
+  std::vector<Stage> m_stages;
+
+  // trigger dispatch, by opcode and by primary opcode for the exact word triggers
+  std::vector<Target> m_byOpcode[OP_COUNT];
+  std::vector<Target> m_byPrimary[64];
+
+  std::vector<std::unique_ptr<FlowSection>> m_sections;
+};
+
+// the bounds detectors that used to be the flow_* passes, in their old order
+void RegisterFlowRules(FlowEngine &engine);
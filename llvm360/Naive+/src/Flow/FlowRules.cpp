@@ -0,0 +1,410 @@
+#include "FlowEngine.h"
+#include "IR/IRGenerator.h"
+#include "IR/IRFunc.h"
+#include "Decoder/InstructionDecoder.h"
+#include <stdio.h>
+#include <cstring>
+
+//
+// The function bounds detectors, each one was a flow_* pass rescanning the whole section.
+// Registration order is the order the passes ran in, matches are applied in that order too.
+//
+
+static inline uint32_t branchTarget(uint32_t address, uint32_t li) {
+  // address + signExtend(li, 24)
+  return address + ((li & 0x800000) ? (li | 0xFF000000) : li);
+}
+
+// lwz whose word is really an address into the image, a data word right after the code
+static bool isAddressWord(XexImage *image, PPCOpcode opcode, uint32_t word) {
+  return opcode == OP_lwz && image->getSectionByAddressBounds(word) != nullptr &&
+         (((word & 0x82000000) >> 24) & 0x82) == 0x82;
+}
+
+//
+// save/rest helpers promoted to functions
+//
+enum SaveRestKind {
+  SR_SAVEGPRLR_14,
+  SR_RESTGPRLR_14,
+  SR_SAVEFPR_14,
+  SR_RESTFPR_14,
+  SR_SAVEVMX_14,
+  SR_RESTVMX_14,
+  SR_SAVEVMX_64,
+  SR_RESTVMX_64,
+};
+
+static bool matchSaveRest(const FlowSection &section, uint32_t address, FlowMatch &out) {
+  if (address + 4 >= section.end)
+    return false;
+
+  const uint32_t word = section.wordAt(address);
+  const uint32_t after = section.wordAt(address + 4);
+  out.address = address;
+  out.target = 0;
+  switch (word) {
+  case 0xf9c1ff68: out.kind = SR_SAVEGPRLR_14; return true;
+  case 0xe9c1ff68: out.kind = SR_RESTGPRLR_14; return true;
+  case 0xd9ccff70: out.kind = SR_SAVEFPR_14; return true;
+  case 0xc9ccff70: out.kind = SR_RESTFPR_14; return true;
+  case 0x3960fee0:
+    if (after == 0x7dcb61ce) {
+      out.kind = SR_SAVEVMX_14;
+      return true;
+    }
+    if (after == 0x7dcb60ce) {
+      out.kind = SR_RESTVMX_14;
+      return true;
+    }
+    return false;
+  case 0x3960fc00:
+    if (after == 0x100b61cb) {
+      out.kind = SR_SAVEVMX_64;
+      return true;
+    }
+    if (after == 0x100b60cb) {
+      out.kind = SR_RESTVMX_64;
+      return true;
+    }
+    return false;
+  }
+  return false;
+}
+
+static void applySaveRest(FlowContext &ctx, const FlowMatch &match) {
+  switch (match.kind) {
+  case SR_SAVEGPRLR_14:
+    printf("savegprlr_14 Found at: %08X\n", match.address);
+    for (uint32_t i = 14; i < 32; i++) {
+      IRFunc *func = ctx.irGen->getCreateFuncInMap(match.address + (i - 14) * 4);
+      ctx.irGen->setFuncEnd(func, func->start_address + ((32 - i) * 4) + 4);
+    }
+    break;
+  case SR_RESTGPRLR_14:
+    printf("restgprlr_14 Found at: %08X\n", match.address);
+    for (uint32_t i = 14; i < 32; i++) {
+      IRFunc *func = ctx.irGen->getCreateFuncInMap(match.address + (i - 14) * 4);
+      ctx.irGen->setFuncEnd(func, func->start_address + ((32 - i) * 4) + 8);
+    }
+    break;
+  case SR_SAVEFPR_14:
+    printf("savefpr_14 Found at: %08X\n", match.address);
+    DebugBreak();
+    break;
+  case SR_RESTFPR_14:
+    printf("restfpr_14 Found at: %08X\n", match.address);
+    DebugBreak();
+    break;
+  case SR_SAVEVMX_14:
+    printf("savevmx_14 Found at: %08X\n", match.address);
+    DebugBreak();
+    break;
+  case SR_RESTVMX_14:
+    printf("restvmx_14 Found at: %08X\n", match.address);
+    DebugBreak();
+    break;
+  case SR_SAVEVMX_64:
+    printf("savevmx_64 Found at: %08X\n", match.address);
+    DebugBreak();
+    break;
+  case SR_RESTVMX_64:
+    printf("restvmx_64 Found at: %08X\n", match.address);
+    DebugBreak();
+    break;
+  }
+}
+
+//
+// every BL target is a function prologue
+//
+static bool matchBlJump(const FlowSection &section, uint32_t address, FlowMatch &out) {
+  out.address = address;
+  out.target = branchTarget(address, section.opsAt(address)[0]);
+  out.kind = 0;
+  return true;
+}
+
+static void applyBlJump(FlowContext &ctx, const FlowMatch &match) {
+  if (!ctx.irGen->isIRFuncinMap(match.target)) {
+    printf("{flow_blJumps} Found new start of function bounds at: %08X\n", match.target);
+    ctx.irGen->getCreateFuncInMap(match.target);
+  }
+}
+
+//
+// prologues saving LR with mfspr r12, LR, the epilogue will restore it with mtspr
+// so the function is flagged for the mtspr epilogue step
+//
+static bool matchMfsprProl(const FlowSection &section, uint32_t address, FlowMatch &out) {
+  out.address = address;
+  out.target = 0;
+  out.kind = 0;
+  return true;
+}
+
+static void applyMfsprProl(FlowContext &ctx, const FlowMatch &match) {
+  if (!ctx.irGen->isIRFuncinMap(match.address))
+    printf("{flow_mfsprProl} Found new start of function bounds at: %08X\n", match.address);
+  IRFunc *func = ctx.irGen->getCreateFuncInMap(match.address);
+  func->startW_MFSPR_LR = true;
+}
+
+//
+// tail calls, the branched address is promoted to a function
+//
+enum TailKind {
+  TAIL_ALWAYS,
+  TAIL_IF_NEXT_IS_FUNC, // only if a function already starts right after the branch
+};
+
+static bool matchPromoteTail(const FlowSection &section, uint32_t address, FlowMatch &out) {
+  if (address + 4 >= section.end)
+    return false;
+
+  const uint32_t *ops = section.opsAt(address);
+  const PPCOpcode after = section.opcodeAt(address + 4);
+  out.address = address;
+
+  if (section.opcodeAt(address) == OP_b) {
+    out.target = branchTarget(address, ops[0]);
+    // b + nop far enough away, treshold of distance to be considered a tail call
+    out.kind = (after == OP_nop && ops[0] > 0x40) ? TAIL_ALWAYS : TAIL_IF_NEXT_IS_FUNC;
+    return true;
+  }
+
+  /*
+  bge LAB_82013ab0
+  b  FUN_820150d0     // Tail call
+  LAB_82013ab0
+  addi  ...*/
+  if (after == OP_b && address + (int16_t)(ops[2] << 2) == address + 8) {
+    out.target = branchTarget(address + 4, section.opsAt(address + 4)[0]);
+    out.kind = TAIL_ALWAYS;
+    return true;
+  }
+  return false;
+}
+
+static void applyPromoteTail(FlowContext &ctx, const FlowMatch &match) {
+  // depends on the functions promoted by earlier matches, hence applied in address order
+  if (match.kind == TAIL_IF_NEXT_IS_FUNC && !ctx.irGen->isIRFuncinMap(match.address + 4))
+    return;
+
+  if (!ctx.irGen->isIRFuncinMap(match.target)) {
+    printf("{flow_promoteTailProl} Promoted new function at: %08X\n", match.target);
+    IRFunc *func = ctx.irGen->getCreateFuncInMap(match.target);
+    func->is_promotion = true;
+  }
+}
+
+//
+// stw rX, d(r1) at the start of the section or right after a bclr / nop
+//
+static bool matchStackInitProl(const FlowSection &section, uint32_t address, FlowMatch &out) {
+  if (address + 4 >= section.end || section.opsAt(address)[2] != 1)
+    return false;
+
+  if (address != section.base) {
+    const PPCOpcode prev = section.opcodeAt(address - 4);
+    if (prev != OP_bclr && prev != OP_nop)
+      return false;
+  }
+
+  out.address = address;
+  out.target = 0;
+  out.kind = 0;
+  return true;
+}
+
+static void applyStackInitProl(FlowContext &ctx, const FlowMatch &match) {
+  if (!ctx.irGen->isIRFuncinMap(match.address)) {
+    printf("{flow_stackInitProl} Found new start of function bounds at: %08X\n", match.address);
+    ctx.irGen->getCreateFuncInMap(match.address);
+  }
+}
+
+//
+// code addresses stored in .data (vtables, callbacks...)
+//
+static void runDataSecAdr(FlowContext &ctx) {
+  XexImage *image = ctx.image;
+  Section *data = nullptr;
+  for (uint32_t i = 0; i < image->GetNumSections(); i++) {
+    if (strcmp(image->GetSection(i)->GetName().c_str(), ".data") == 0) {
+      data = image->GetSection(i);
+      break;
+    }
+  }
+  if (data == nullptr)
+    return;
+
+  const uint8_t *stride = image->GetMemory() + data->GetVirtualOffset();
+  const uint32_t size = data->GetVirtualSize() / 4;
+  const uint32_t start = ctx.section->base;
+  const uint32_t end = ctx.section->end;
+  for (uint32_t i = 0; i < size; i++) {
+    const uint32_t val = SwapInstrBytes(*(const uint32_t *)(stride + (i * 4)));
+    if (val >= start && val <= end) {
+      ctx.irGen->getCreateFuncInMap(val);
+      printf("Function address found in .Data\n");
+    }
+  }
+}
+
+//
+// functions that saved LR end at the first bclr after the mtspr LR, r12 restoring it
+// (there can be some loads in between)
+//
+static void runMtsprEpil(FlowContext &ctx) {
+  for (const auto &pair : ctx.irGen->m_function_map) {
+    IRFunc *func = pair.second;
+    if (!func->startW_MFSPR_LR || func->end_address != 0)
+      continue;
+
+    const FlowSection *section = ctx.engine->FindSection(func->start_address);
+    if (section == nullptr)
+      continue;
+    const uint32_t mtlr = section->nextLandmark(FLOW_LM_MTLR, func->start_address);
+    if (mtlr >= section->end)
+      continue;
+    const uint32_t bclr = section->nextLandmark(FLOW_LM_BCLR, mtlr + 4);
+    if (bclr >= section->end)
+      continue;
+
+    ctx.irGen->setFuncEnd(func, bclr);
+    printf("{flow_mtsprEpil} Found new end of function bounds at: %08X\n", func->end_address);
+  }
+}
+
+//
+// remaining functions end at the first b / bclr that is followed by a function start,
+// padding, or an address word, whatever comes first
+//
+static void runBclrAndTailEpil(FlowContext &ctx) {
+  IRGenerator *irGen = ctx.irGen;
+  for (const auto &pair : irGen->m_function_map) {
+    IRFunc *func = pair.second;
+    if (func->end_address != 0)
+      continue;
+
+    const FlowSection *section = ctx.engine->FindSection(func->start_address);
+    if (section == nullptr)
+      continue;
+    const uint32_t last = section->end - 4;
+
+    uint32_t address = func->start_address;
+    while (true) {
+      address = section->nextLandmark(FLOW_LM_EXIT, address);
+      if (address >= last) {
+        ctx.irGen->setFuncEnd(func, last);
+        printf("{flow_bclrAndTailEpil} Found new end of function bounds at: %08X\n", func->end_address);
+        break;
+      }
+
+      // check if "instruction" is addr, and fix the end
+      const uint32_t next = address + 4;
+      const PPCOpcode nextOpcode = section->opcodeAt(next);
+      if (isAddressWord(ctx.image, nextOpcode, section->wordAt(next))) {
+        ctx.irGen->setFuncEnd(func, address);
+        printf("{flow_bclrAndTailEpil} Fixed bound becasue of Addr: %08X\n", func->end_address);
+        break;
+      }
+
+      if (nextOpcode == OP_nop) {
+        // a tail call padded up to the next function, the padding belongs to this one
+        uint32_t end = address;
+        if (section->opcodeAt(address) == OP_b) {
+          const IRFunc *nextFunc = irGen->findNextFunc(next);
+          end = (nextFunc != nullptr && nextFunc->start_address < section->end ? nextFunc->start_address
+                                                                               : section->end) - 4;
+        }
+        ctx.irGen->setFuncEnd(func, end);
+        printf("{flow_bclrAndTailEpil} Found new end of function bounds at: %08X\n", func->end_address);
+        break;
+      }
+
+      // the next address is a function, this is the epilogue of the current one
+      if (irGen->isIRFuncinMap(next)) {
+        ctx.irGen->setFuncEnd(func, address);
+        printf("{flow_bclrAndTailEpil} Found new end of function bounds at: %08X\n", func->end_address);
+        break;
+      }
+
+      address += 4;
+    }
+  }
+}
+
+//
+// ends landing on an address word are moved back to the last branch
+//
+static void runFixIfAddresses(FlowContext &ctx) {
+  const InstructionStore &store = ctx.irGen->instrsList;
+  for (const auto &pair : ctx.irGen->m_function_map) {
+    IRFunc *func = pair.second;
+    if (func->end_address == 0 || func->end_address == ctx.section->end)
+      continue;
+    if (!store.contains(func->end_address))
+      continue;
+    if (!isAddressWord(ctx.image, store.opcodeAt(func->end_address), store.wordAt(func->end_address)))
+      continue;
+
+    uint32_t off = func->end_address;
+    PPCOpcode opcode;
+    do {
+      off -= 4;
+      if (!store.contains(off))
+        break;
+      opcode = store.opcodeAt(off);
+    } while (opcode != OP_b && opcode != OP_bclr && opcode != OP_bc);
+    if (!store.contains(off))
+      continue;
+
+    printf("{flow_fixIfAddresses} Fixed func end at: %08X\n", off);
+    ctx.irGen->setFuncEnd(func, off);
+  }
+}
+
+//
+// promoted functions that turned out to be inside another function are dropped
+//
+static void runDemoteInBounds(FlowContext &ctx) {
+  std::vector<uint32_t> demoted;
+  for (const auto &pair : ctx.irGen->m_function_map) {
+    IRFunc *func = pair.second;
+    if (func->is_promotion && ctx.irGen->findFuncContaining(func->start_address) != nullptr) {
+      printf("{flow_demoteInBounds} Func demoted at: %08X\n", func->start_address);
+      demoted.push_back(func->start_address);
+    }
+  }
+  for (uint32_t address : demoted)
+    ctx.irGen->removeFuncFromMap(address);
+}
+
+void RegisterFlowRules(FlowEngine &engine) {
+  // prologues
+  engine.AddRule(FlowRule{"promoteSaveRest", matchSaveRest, applySaveRest},
+    {FlowTrigger::Word(0xf9c1ff68), FlowTrigger::Word(0xe9c1ff68), FlowTrigger::Word(0xd9ccff70),
+      FlowTrigger::Word(0xc9ccff70), FlowTrigger::Word(0x3960fee0), FlowTrigger::Word(0x3960fc00)});
+  engine.AddRule(FlowRule{"blJumps", matchBlJump, applyBlJump}, {FlowTrigger::Op(OP_bl)});
+  engine.AddRule(FlowRule{"mfsprProl", matchMfsprProl, applyMfsprProl}, {FlowTrigger::Word(0x7d8802a6)});
+  engine.AddRule(FlowRule{"promoteTailProl", matchPromoteTail, applyPromoteTail},
+    {FlowTrigger::Op(OP_b), FlowTrigger::Op(OP_bc)});
+  engine.AddRule(FlowRule{"stackInitProl", matchStackInitProl, applyStackInitProl}, {FlowTrigger::Op(OP_stw)});
+  engine.AddStep(FlowStep{"dataSecAdr", runDataSecAdr});
+  // this break stuff :/
+  // aftBclrProl as last resort, if called before could break everything
+
+  // epilogues
+  engine.AddLandmark(FLOW_LM_EXIT, FlowTrigger::Op(OP_b));
+  engine.AddLandmark(FLOW_LM_EXIT, FlowTrigger::Op(OP_bclr));
+  engine.AddLandmark(FLOW_LM_BCLR, FlowTrigger::Op(OP_bclr));
+  engine.AddLandmark(FLOW_LM_MTLR, FlowTrigger::Word(0x7d8803a6));
+  engine.AddStep(FlowStep{"mtsprEpil", runMtsprEpil});
+  engine.AddStep(FlowStep{"bclrAndTailEpil", runBclrAndTailEpil});
+
+  // second pass
+  engine.AddStep(FlowStep{"fixIfAddresses", runFixIfAddresses});
+  engine.AddStep(FlowStep{"demoteInBounds", runDemoteInBounds});
+}
@@ -0,0 +1,114 @@
+#include "CRLiveness.h"
+#include "FunctionCFG.h"
+#include "IRGenerator.h"
+
+void CRFieldAccess(const Instruction& instr, uint8_t& uses, uint8_t& defs)
+{
+    uses = 0;
+    defs = 0;
+    switch (instr.opcode)
+    {
+    // the compares emitted through UpdateCR_CmpValue, the Rc forms may leave the field alone
+    case OP_cmpw:
+    case OP_cmpwi:
+    case OP_cmpdi:
+    case OP_cmplw:
+    case OP_cmplwi:
+    case OP_cmpldi:
+        defs = 1 << instr.ops[0];
+        break;
+
+    // BO 1z1zz ignores the condition, unconditional branches don't read BI
+    case OP_bc:
+    case OP_bca:
+    case OP_bclr:
+        if (!(instr.ops[0] & 0x10))
+            uses = 1 << (instr.ops[1] / 4);
+        break;
+    case OP_bcl:
+    case OP_bcla:
+    case OP_bclrl:
+    case OP_bcctr: // a tail call through HandleBcctrl, if not a jump table
+    case OP_bcctrl:
+        uses = CR_FIELDS_NONVOLATILE;
+        if (!(instr.ops[0] & 0x10))
+            uses |= 1 << (instr.ops[1] / 4);
+        break;
+    case OP_bl:
+    case OP_bla:
+        uses = CR_FIELDS_NONVOLATILE;
+        break;
+
+    case OP_mfcr:
+    case OP_mfocrf:
+        uses = CR_FIELDS_ALL;
+        break;
+    default:
+        break;
+    }
+}
+
+bool IsStateSite(const Instruction& instr)
+{
+    switch (instr.opcode)
+    {
+    case OP_bl:
+    case OP_bla:
+    case OP_bcl:
+    case OP_bcla:
+    case OP_bclrl:
+    case OP_bcctrl:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void ComputeCRLiveOut(IRGenerator* irGen, const FunctionCFG& cfg, std::vector<uint8_t>& liveOut)
+{
+    const std::vector<CFGBlock>& blocks = cfg.blocks();
+    std::vector<uint8_t> uses(blocks.size(), 0);
+    std::vector<uint8_t> defs(blocks.size(), 0);
+    std::vector<uint8_t> exits(blocks.size(), 0); // read by whatever the block leaves the function for
+    for (size_t i = 0; i < blocks.size(); i++)
+    {
+        const CFGBlock& block = blocks[i];
+        for (uint32_t address = block.address; address <= block.end; address += 4)
+        {
+            uint8_t instrUses, instrDefs;
+            CRFieldAccess(irGen->instructions().at(address), instrUses, instrDefs);
+            uses[i] |= instrUses & ~defs[i];
+            defs[i] |= instrDefs;
+        }
+
+        const Instruction last = irGen->instructions().at(block.end);
+        uint32_t target = CFG_NONE;
+        if (last.opcode == OP_b)
+            target = block.end + ((last.ops[0] & 0x800000) ? (last.ops[0] | 0xFF000000) : last.ops[0]);
+        else if (last.opcode == OP_bc)
+            target = block.end + (int16_t)(last.ops[2] << 2);
+
+        if (block.succs.empty())
+            exits[i] = CR_FIELDS_NONVOLATILE; // return, tail call
+        if (target != CFG_NONE && cfg.blockAt(target) == CFG_NONE)
+            exits[i] |= irGen->isIRFuncinMap(target) ? CR_FIELDS_NONVOLATILE : CR_FIELDS_ALL;
+    }
+
+    liveOut.assign(blocks.size(), 0);
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (size_t i = blocks.size(); i-- > 0;)
+        {
+            uint8_t out = exits[i];
+            for (uint32_t succ : blocks[i].succs)
+                out |= uses[succ] | (liveOut[succ] & ~defs[succ]);
+            if (out != liveOut[i])
+            {
+                liveOut[i] = out;
+                changed = true;
+            }
+        }
+    }
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "Decoder/Instruction.h"
+
+class IRGenerator;
+class FunctionCFG;
+
+// one bit per CR field, bit n = crn
+#define CR_FIELDS_ALL 0xFF
+// cr2-cr4 survive calls in the PPC ABI, the others are volatile: undefined after a call and
+// on entry, a caller can't read them after a return either
+#define CR_FIELDS_NONVOLATILE 0x1C
+
+// the fields instr reads, and the ones it certainly writes whole
+void CRFieldAccess(const Instruction& instr, uint8_t& uses, uint8_t& defs);
+// calls, the emitters sync XenonState around them and forget what the block computed
+bool IsStateSite(const Instruction& instr);
+
+//
+// Backward dataflow over the CFG of a function: the CR fields still to be read on exit of every
+// block. Calls and returns only read the non volatile fields, branches out of the function all.
+//
+void ComputeCRLiveOut(IRGenerator* irGen, const FunctionCFG& cfg, std::vector<uint8_t>& liveOut);
@@ -0,0 +1,67 @@
+#include "FunctionBounds.h"
+#include "IRFunc.h"
+#include <algorithm>
+
+void FunctionBounds::Insert(IRFunc* func)
+{
+    m_byStart[func->start_address] = func;
+    m_dirty = true;
+}
+
+void FunctionBounds::Remove(uint32_t start)
+{
+    if (m_byStart.erase(start))
+        m_dirty = true;
+}
+
+void FunctionBounds::Clear()
+{
+    m_byStart.clear();
+    m_dirty = true;
+}
+
+void FunctionBounds::Rebuild()
+{
+    m_starts.clear();
+    m_maxEnd.clear();
+    m_maxFunc.clear();
+    m_starts.reserve(m_byStart.size());
+    m_maxEnd.reserve(m_byStart.size());
+    m_maxFunc.reserve(m_byStart.size());
+
+    uint32_t maxEnd = 0;
+    IRFunc* maxFunc = nullptr;
+    for (const auto& pair : m_byStart)
+    {
+        IRFunc* func = pair.second;
+        if (maxFunc == nullptr || func->end_address > maxEnd)
+        {
+            maxEnd = func->end_address;
+            maxFunc = func;
+        }
+        m_starts.push_back(pair.first);
+        m_maxEnd.push_back(maxEnd);
+        m_maxFunc.push_back(maxFunc);
+    }
+    m_dirty = false;
+}
+
+IRFunc* FunctionBounds::FindContaining(uint32_t address)
+{
+    if (m_dirty)
+        Rebuild();
+
+    // last function starting before the address, the one ending the furthest among
+    // it and its predecessors contains the address if anything does
+    auto it = std::lower_bound(m_starts.begin(), m_starts.end(), address);
+    if (it == m_starts.begin())
+        return nullptr;
+    const size_t idx = (it - m_starts.begin()) - 1;
+    return m_maxEnd[idx] > address ? m_maxFunc[idx] : nullptr;
+}
+
+IRFunc* FunctionBounds::FindNext(uint32_t address) const
+{
+    auto it = m_byStart.lower_bound(address);
+    return it == m_byStart.end() ? nullptr : it->second;
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+class IRFunc;
+
+//
+// Ordered index over the functions of the map, kept next to m_function_map by IRGenerator.
+// Starts live in a tree so "next function after X" is a lower_bound, "which function contains X"
+// uses the running max of the end addresses in start order, rebuilt lazily after functions or
+// their ends change (ends have to be set through IRGenerator::setFuncEnd for that).
+//
+class FunctionBounds
+{
+public:
+    void Insert(IRFunc* func);
+    void Remove(uint32_t start);
+    void Clear();
+    inline void InvalidateEnds() { m_dirty = true; }
+
+    // function with start < address < end, null if none
+    IRFunc* FindContaining(uint32_t address);
+    // first function starting at or after address, null if none
+    IRFunc* FindNext(uint32_t address) const;
+
+    inline size_t size() const { return m_byStart.size(); }
+    inline const std::map<uint32_t, IRFunc*>& byStart() const { return m_byStart; }
+
+private:
+    void Rebuild();
+
+    std::map<uint32_t, IRFunc*> m_byStart;
+
+    // in start order: the functions, the max end so far and the function holding it
+    std::vector<uint32_t> m_starts;
+    std::vector<uint32_t> m_maxEnd;
+    std::vector<IRFunc*> m_maxFunc;
+    bool m_dirty = true;
+};
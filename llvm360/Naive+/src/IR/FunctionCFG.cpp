@@ -0,0 +1,336 @@
+#include "FunctionCFG.h"
+#include "IRGenerator.h"
+#include "IRFunc.h"
+#include <algorithm>
+
+void FunctionCFG::Clear()
+{
+    m_blocks.clear();
+    m_loops.clear();
+    m_external.clear();
+    m_rpo.clear();
+    m_rpoIndex.clear();
+    m_built = false;
+}
+
+void FunctionCFG::Build(IRGenerator* irGen, const IRFunc* func)
+{
+    Clear();
+    m_built = true;
+
+    const uint32_t start = func->start_address;
+    const uint32_t end = func->end_address;
+    if (end < start)
+        return; // bounds never found, nothing gets emitted
+
+    // block starts, the function start, local branch targets, both sides of a conditional
+    // branch and the jump table cases
+    std::vector<uint32_t> leaders{ start };
+    for (uint32_t address = start; address <= end; address += 4)
+    {
+        const Instruction instr = irGen->instrsList.at(address);
+        if (instr.opcode == OP_b)
+        {
+            const uint32_t li = instr.ops[0];
+            const uint32_t target = address + ((li & 0x800000) ? (li | 0xFF000000) : li);
+            if (!irGen->isIRFuncinMap(target))
+                leaders.push_back(target);
+        }
+        else if (instr.opcode == OP_bc)
+        {
+            leaders.push_back(address + (int16_t)(instr.ops[2] << 2));
+            leaders.push_back(address + 4);
+        }
+    }
+    for (const JumpTable* table : func->jumpTables)
+    {
+        if (table->end_Address < start || table->start_Address > end)
+            continue;
+        leaders.insert(leaders.end(), table->targets.begin(), table->targets.end());
+    }
+    std::sort(leaders.begin(), leaders.end());
+    leaders.erase(std::unique(leaders.begin(), leaders.end()), leaders.end());
+
+    Link(irGen, func, leaders);
+}
+
+void FunctionCFG::Build(IRGenerator* irGen, const IRFunc* func, const std::vector<uint32_t>& leaders)
+{
+    Clear();
+    m_built = true;
+    if (func->end_address < func->start_address)
+        return;
+    Link(irGen, func, leaders);
+}
+
+void FunctionCFG::Leaders(std::vector<uint32_t>& out) const
+{
+    out.clear();
+    for (const CFGBlock& block : m_blocks)
+        out.push_back(block.address);
+    out.insert(out.end(), m_external.begin(), m_external.end());
+    std::sort(out.begin(), out.end());
+}
+
+void FunctionCFG::Link(IRGenerator* irGen, const IRFunc* func, const std::vector<uint32_t>& leaders)
+{
+    const uint32_t start = func->start_address;
+    const uint32_t end = func->end_address;
+    auto inside = [&](uint32_t address) { return address >= start && address <= end; };
+
+    for (uint32_t leader : leaders)
+    {
+        if (!inside(leader))
+        {
+            m_external.push_back(leader);
+            continue;
+        }
+        CFGBlock block{};
+        block.address = leader;
+        block.idom = CFG_NONE;
+        block.loop = CFG_NONE;
+        if (!m_blocks.empty())
+            m_blocks.back().end = leader - 4;
+        m_blocks.push_back(block);
+    }
+    m_blocks.back().end = end;
+
+    // edges from the last instruction of every block
+    for (uint32_t i = 0; i < m_blocks.size(); i++)
+    {
+        CFGBlock& block = m_blocks[i];
+        const Instruction instr = irGen->instrsList.at(block.end);
+        const uint32_t next = i + 1 < m_blocks.size() ? i + 1 : CFG_NONE;
+        block.fallsThrough = block.end != end && instr.opcode != OP_bclr;
+
+        auto addSucc = [&](uint32_t address)
+        {
+            const uint32_t succ = blockAt(address);
+            if (succ != CFG_NONE && std::find(block.succs.begin(), block.succs.end(), succ) == block.succs.end())
+                block.succs.push_back(succ);
+        };
+
+        switch (instr.opcode)
+        {
+        case OP_b:
+        {
+            const uint32_t li = instr.ops[0];
+            const uint32_t target = block.end + ((li & 0x800000) ? (li | 0xFF000000) : li);
+            if (!irGen->isIRFuncinMap(target))
+                addSucc(target); // a tail call otherwise
+            break;
+        }
+        case OP_bc:
+            addSucc(block.end + (int16_t)(instr.ops[2] << 2));
+            addSucc(block.end + 4);
+            break;
+        case OP_bclr:
+            break;
+        case OP_bcctr:
+        {
+            bool isTable = false;
+            for (const JumpTable* table : func->jumpTables)
+            {
+                if (block.end < table->start_Address || block.end > table->end_Address)
+                    continue;
+                for (uint32_t target : table->targets)
+                    addSucc(target);
+                isTable = true;
+                break;
+            }
+            if (!isTable && next != CFG_NONE)
+                addSucc(block.end + 4);
+            break;
+        }
+        default:
+            if (next != CFG_NONE)
+                addSucc(block.end + 4);
+            break;
+        }
+    }
+    for (uint32_t i = 0; i < m_blocks.size(); i++)
+    {
+        for (uint32_t succ : m_blocks[i].succs)
+            m_blocks[succ].preds.push_back(i);
+    }
+
+    ComputeDominators();
+    ComputeLoops();
+}
+
+uint32_t FunctionCFG::blockAt(uint32_t address) const
+{
+    auto it = std::lower_bound(m_blocks.begin(), m_blocks.end(), address,
+        [](const CFGBlock& block, uint32_t value) { return block.address < value; });
+    return it != m_blocks.end() && it->address == address ? (uint32_t)(it - m_blocks.begin()) : CFG_NONE;
+}
+
+uint32_t FunctionCFG::blockContaining(uint32_t address) const
+{
+    auto it = std::upper_bound(m_blocks.begin(), m_blocks.end(), address,
+        [](uint32_t value, const CFGBlock& block) { return value < block.address; });
+    if (it == m_blocks.begin())
+        return CFG_NONE;
+    --it;
+    return address <= it->end ? (uint32_t)(it - m_blocks.begin()) : CFG_NONE;
+}
+
+bool FunctionCFG::dominates(uint32_t a, uint32_t b) const
+{
+    if (m_blocks[b].idom == CFG_NONE)
+        return false;
+    while (b != a)
+    {
+        const uint32_t up = m_blocks[b].idom;
+        if (up == b)
+            return false; // reached the entry
+        b = up;
+    }
+    return true;
+}
+
+//
+// Cooper, Harvey, Kennedy: "A Simple, Fast Dominance Algorithm", iterated over the reverse post order
+//
+void FunctionCFG::ComputeDominators()
+{
+    const uint32_t count = (uint32_t)m_blocks.size();
+    m_rpoIndex.assign(count, CFG_NONE);
+    if (count == 0)
+        return;
+
+    // iterative DFS, post order then reversed
+    std::vector<uint32_t> post;
+    std::vector<std::pair<uint32_t, uint32_t>> stack{ { 0, 0 } };
+    std::vector<bool> seen(count, false);
+    seen[0] = true;
+    while (!stack.empty())
+    {
+        auto& top = stack.back();
+        const CFGBlock& block = m_blocks[top.first];
+        if (top.second < block.succs.size())
+        {
+            const uint32_t succ = block.succs[top.second++];
+            if (!seen[succ])
+            {
+                seen[succ] = true;
+                stack.push_back({ succ, 0 });
+            }
+            continue;
+        }
+        post.push_back(top.first);
+        stack.pop_back();
+    }
+    m_rpo.assign(post.rbegin(), post.rend());
+    for (uint32_t i = 0; i < m_rpo.size(); i++)
+        m_rpoIndex[m_rpo[i]] = i;
+
+    auto intersect = [&](uint32_t a, uint32_t b)
+    {
+        while (a != b)
+        {
+            while (m_rpoIndex[a] > m_rpoIndex[b])
+                a = m_blocks[a].idom;
+            while (m_rpoIndex[b] > m_rpoIndex[a])
+                b = m_blocks[b].idom;
+        }
+        return a;
+    };
+
+    m_blocks[0].idom = 0;
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (uint32_t i = 1; i < m_rpo.size(); i++)
+        {
+            CFGBlock& block = m_blocks[m_rpo[i]];
+            uint32_t idom = CFG_NONE;
+            for (uint32_t pred : block.preds)
+            {
+                if (m_blocks[pred].idom == CFG_NONE)
+                    continue;
+                idom = idom == CFG_NONE ? pred : intersect(pred, idom);
+            }
+            if (idom != block.idom)
+            {
+                block.idom = idom;
+                changed = true;
+            }
+        }
+    }
+}
+
+//
+// natural loops, one per header with the bodies of all its back edges merged
+//
+void FunctionCFG::ComputeLoops()
+{
+    std::vector<uint32_t> loopOf(m_blocks.size(), CFG_NONE); // by header
+    for (uint32_t latch : m_rpo)
+    {
+        for (uint32_t header : m_blocks[latch].succs)
+        {
+            if (!dominates(header, latch))
+                continue;
+            if (loopOf[header] == CFG_NONE)
+            {
+                loopOf[header] = (uint32_t)m_loops.size();
+                CFGLoop loop{};
+                loop.header = header;
+                loop.parent = CFG_NONE;
+                m_loops.push_back(loop);
+            }
+            m_loops[loopOf[header]].latches.push_back(latch);
+        }
+    }
+
+    // everything reaching a latch without going through the header
+    std::vector<uint32_t> mark(m_blocks.size(), CFG_NONE);
+    std::vector<uint32_t> work;
+    for (uint32_t i = 0; i < m_loops.size(); i++)
+    {
+        CFGLoop& loop = m_loops[i];
+        mark[loop.header] = i;
+        loop.blocks.push_back(loop.header);
+        work = loop.latches;
+        while (!work.empty())
+        {
+            const uint32_t index = work.back();
+            work.pop_back();
+            if (mark[index] == i)
+                continue;
+            mark[index] = i;
+            loop.blocks.push_back(index);
+            for (uint32_t pred : m_blocks[index].preds)
+            {
+                if (m_blocks[pred].idom != CFG_NONE)
+                    work.push_back(pred);
+            }
+        }
+    }
+
+    // outer loops first, then the innermost one holding a header is its parent
+    for (CFGLoop& loop : m_loops)
+        std::sort(loop.blocks.begin(), loop.blocks.end());
+    std::stable_sort(m_loops.begin(), m_loops.end(),
+        [](const CFGLoop& a, const CFGLoop& b) { return a.blocks.size() > b.blocks.size(); });
+
+    for (uint32_t i = 0; i < m_loops.size(); i++)
+    {
+        CFGLoop& loop = m_loops[i];
+        loop.depth = 1;
+        for (uint32_t j = i; j-- > 0;)
+        {
+            const std::vector<uint32_t>& outer = m_loops[j].blocks;
+            if (std::binary_search(outer.begin(), outer.end(), loop.header))
+            {
+                loop.parent = j;
+                loop.depth = m_loops[j].depth + 1;
+                break;
+            }
+        }
+        for (uint32_t index : loop.blocks)
+            m_blocks[index].loop = i;
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+class IRGenerator;
+class IRFunc;
+
+#define CFG_NONE 0xFFFFFFFF
+
+struct CFGBlock
+{
+    uint32_t address;
+    uint32_t end;                 // last instruction, inclusive
+    std::vector<uint32_t> succs;  // block indices
+    std::vector<uint32_t> preds;
+    uint32_t idom;                // immediate dominator, the entry is its own, CFG_NONE if unreachable
+    uint32_t loop;                // innermost loop, CFG_NONE if in none
+    bool fallsThrough;            // the emitter branches to the next block after the last instruction
+};
+
+struct CFGLoop
+{
+    uint32_t header;
+    uint32_t parent;              // enclosing loop, CFG_NONE for the outermost ones
+    uint32_t depth;               // 1 for the outermost ones
+    std::vector<uint32_t> blocks; // sorted, nested loops included
+    std::vector<uint32_t> latches;
+};
+
+//
+// Control flow graph of one function, built once the bounds are final and used as is by the
+// emitter. Blocks are split the way the emitter always did: at the function start, at every
+// local branch target, after a conditional branch and at every jump table case. On top of it
+// the dominator tree and the natural loops for the passes that want them.
+//
+class FunctionCFG
+{
+public:
+    void Build(IRGenerator* irGen, const IRFunc* func);
+    // same graph from block starts saved earlier (sorted, external targets included)
+    void Build(IRGenerator* irGen, const IRFunc* func, const std::vector<uint32_t>& leaders);
+    void Clear();
+    // the block starts Build found, the external targets included
+    void Leaders(std::vector<uint32_t>& out) const;
+
+    inline bool built() const { return m_built; }
+    inline const std::vector<CFGBlock>& blocks() const { return m_blocks; }
+    inline const std::vector<CFGLoop>& loops() const { return m_loops; }
+    // branch targets outside the function bounds, still given a label by the emitter
+    inline const std::vector<uint32_t>& externalTargets() const { return m_external; }
+    // reachable blocks in reverse post order
+    inline const std::vector<uint32_t>& rpo() const { return m_rpo; }
+
+    // block starting at address, CFG_NONE if none
+    uint32_t blockAt(uint32_t address) const;
+    // block holding address, CFG_NONE if outside the function
+    uint32_t blockContaining(uint32_t address) const;
+    bool dominates(uint32_t a, uint32_t b) const;
+
+private:
+    void Link(IRGenerator* irGen, const IRFunc* func, const std::vector<uint32_t>& leaders);
+    void ComputeDominators();
+    void ComputeLoops();
+
+    std::vector<CFGBlock> m_blocks; // by address
+    std::vector<CFGLoop> m_loops;   // outer loops before the loops they contain
+    std::vector<uint32_t> m_external;
+    std::vector<uint32_t> m_rpo;
+    std::vector<uint32_t> m_rpoIndex;
+    bool m_built = false;
+};
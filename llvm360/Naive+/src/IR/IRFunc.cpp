@@ -1,6 +1,6 @@
 #include "IRFunc.h"
+#include "CRLiveness.h"
 #include <sstream>
-#include <unordered_set>
 
 
 
@@ -11,124 +11,50 @@
 
 
 
-inline uint32_t signExtend(uint32_t value, int size)
-{
-    if (value & (1 << (size - 1))) {
-        return value | (~0 << size);
-    }
-    return value;
-}
-
 bool IRFunc::EmitFunction()
 {
-    bool result;
+    initRegisterShadows();
     m_irGen->m_builder->SetInsertPoint(getCreateBBinMap(start_address));
 
-    uint32_t idx = this->start_address;
     if (start_address == 0x82014DA8) DebugBreak();
 
-    // discover start basic blocks
-    while (idx <= this->end_address)
-    {
-		Instruction instr = m_irGen->instrsList.at(idx);
-		if (strcmp(instr.opcName.c_str(), "b") == 0)
-		{
-            uint32_t target = idx + signExtend(instr.ops[0], 24);
-            // check for tail calls
-            if (!m_irGen->isIRFuncinMap(target))
-            {
-                this->getCreateBBinMap(target);
-                //this->getCreateBBinMap(instr.address + 4);
-            }
-		}
-        if (strcmp(instr.opcName.c_str(), "bc") == 0)
-        {
-            this->getCreateBBinMap(instr.address + (int16_t)(instr.ops[2] << 2));
-            this->getCreateBBinMap(instr.address + 4);
-        }
-
+    // functions first seen while emitting (bl targets) never went through the flow pass
+    if (!cfg.built())
+        cfg.Build(m_irGen, this);
+    ComputeCRLiveOut(m_irGen, cfg, m_crLiveOut);
 
-        if (has_jumpTable)
-        {
-            for (JumpTable* table : jumpTables)
-            {
-                if (instr.address >= table->start_Address && instr.address <= table->end_Address)
-                {
-                    std::unordered_set<uint32_t> processedValues; // do not allow duplicates
-                    for (uint32_t target : table->targets)
-                    {
-                        if (processedValues.find(target) == processedValues.end())
-                        {
-                            getCreateBBinMap(target);
-                            processedValues.insert(target);
-                        }
-                    }
-                }
-            }
-        }
-
-
-        idx += 4;
+    // every label exists before the branches to it get emitted
+    for (const CFGBlock& block : cfg.blocks())
+    {
+        getCreateBBinMap(block.address);
+        codeBlocks.at(block.address)->end = block.end;
     }
-
-	CodeBlock* currentBlock = codeBlocks.at(start_address);
-    idx = this->start_address;
-	// discover end basic blocks
-    while (idx <= this->end_address)
+    for (uint32_t target : cfg.externalTargets())
     {
-        Instruction instr = m_irGen->instrsList.at(idx);
-		if (isBBinMap(idx + 4))
-		{
-			currentBlock->end = idx;
-			currentBlock = codeBlocks.at(idx + 4);
-		}
-		if (strcmp(instr.opcName.c_str(), "bclr") == 0)
-		{
-			currentBlock->end = idx;
-		}
-        if(idx == this->end_address)
-        {
-            currentBlock->end = this->end_address;
-        }
-        idx += 4;
+        getCreateBBinMap(target);
     }
 
-    // can be optimized?
-    // TODO
-
     // emit
-    idx = this->start_address;
-    while (idx <= this->end_address)
+    const std::vector<CFGBlock>& blocks = cfg.blocks();
+    for (size_t i = 0; i < blocks.size(); i++)
     {
-		if (isBBinMap(idx))
-		{
-			m_irGen->m_builder->SetInsertPoint(codeBlocks.at(idx)->bb_Block);
-
-            CodeBlock* block = codeBlocks.at(idx);
-
+        const CFGBlock& block = blocks[i];
+        m_irGen->m_builder->SetInsertPoint(codeBlocks.at(block.address)->bb_Block);
+        std::fill(std::begin(m_crKnown), std::end(m_crKnown), nullptr);
 
-            uint32_t blockIdx = block->address;
-            while (blockIdx <= block->end)
-            {
-                Instruction instr = m_irGen->instrsList.at(blockIdx);
-
-                if (!m_irGen->EmitInstruction(m_irGen->instrsList.at(blockIdx), this))
-                {
-                    __debugbreak();
-                    return 1;
-                }
-
-                if (blockIdx != this->end_address && blockIdx == block->end && strcmp(instr.opcName.c_str(), "bclr") != 0 )
-                {
-                    m_irGen->m_builder->CreateBr(codeBlocks.at(block->end + 4)->bb_Block);
-                }
-                blockIdx += 4;
-                
-            }
+        for (uint32_t address = block.address; address <= block.end; address += 4)
+        {
+            // left unfinished, the module is still written for a look at what came out
+            if (!m_irGen->EmitInstruction(m_irGen->instructions().at(address), this))
+                return false;
+        }
 
-			idx = blockIdx;
-		}
+        if (block.fallsThrough && m_irGen->m_builder->GetInsertBlock()->getTerminator() == nullptr)
+        {
+            m_irGen->m_builder->CreateBr(codeBlocks.at(blocks[i + 1].address)->bb_Block);
+        }
     }
+    finalizeRegisterShadows();
 
 
     return true;
@@ -136,17 +62,40 @@ bool IRFunc::EmitFunction()
 
 void IRFunc::genBody()
 {
-    std::ostringstream oss{};
-    oss << "func_" << std::hex << std::setfill('0') << std::setw(8) << start_address;
-
-    llvm::FunctionType* mainType = llvm::FunctionType::get(m_irGen->m_builder->getVoidTy(), {m_irGen->XenonStateType->getPointerTo(), m_irGen->m_builder->getInt32Ty()}, false);
-    m_irFunc = llvm::Function::Create(mainType, llvm::Function::ExternalLinkage, oss.str(), m_irGen->m_module);
+    m_irFunc = llvm::Function::Create(m_irGen->guestFunctionType(), llvm::Function::ExternalLinkage, symbolName(), m_irGen->m_module);
 
     getCreateBBinMap(start_address);
     //m_irGen->m_builder->SetInsertPoint(getCreateBBinMap(start_address));
 
 }
 
+void IRFunc::resetBody()
+{
+    for (const auto& block : codeBlocks)
+        delete block.second;
+    codeBlocks.clear();
+    m_irFunc = nullptr;
+    m_entryBlock = nullptr;
+    std::fill(std::begin(m_shadows), std::end(m_shadows), nullptr);
+    m_stateSites.clear();
+    std::fill(std::begin(m_crBits), std::end(m_crBits), nullptr);
+    m_crReads.clear();
+    std::fill(std::begin(m_crKnown), std::end(m_crKnown), nullptr);
+    m_crLiveOut.clear();
+}
+
+std::string IRFunc::symbolName() const
+{
+    return m_symbol.empty() ? SymbolName(start_address) : m_symbol;
+}
+
+std::string IRFunc::SymbolName(uint32_t address)
+{
+    std::ostringstream oss{};
+    oss << "func_" << std::hex << std::setfill('0') << std::setw(8) << address;
+    return oss.str();
+}
+
 llvm::BasicBlock* IRFunc::createBasicBlock(uint32_t address)
 {
     std::ostringstream oss{};
@@ -184,6 +133,23 @@ bool IRFunc::isBBinMap(uint32_t address)
 //
 
 llvm::Value* IRFunc::getRegister(const std::string& regName, int index1, int index2)
+{
+    if (m_entryBlock != nullptr && m_irGen->m_promoteRegs)
+    {
+        if (regName == "LR") return getShadow(SHADOW_LR);
+        if (regName == "CTR") return getShadow(SHADOW_CTR);
+        if (regName == "XER") return getShadow(SHADOW_XER);
+        if (regName == "CR") return getShadow(SHADOW_CR);
+        if (regName == "RR")
+        {
+            assert(index1 != -1 && "Index for RR must be provided.");
+            return getShadow(SHADOW_RR0 + index1);
+        }
+    }
+    return getStateRegister(regName, index1, index2);
+}
+
+llvm::Value* IRFunc::getStateRegister(const std::string& regName, int index1, int index2)
 {
     auto argIter = this->m_irFunc->arg_begin();
     llvm::Argument* xCtx = &*argIter;
@@ -235,4 +201,278 @@ llvm::Value* IRFunc::getSPR(uint32_t n)
     if (spr4 == 8) return this->getRegister("LR");
     if (spr4 == 9) return this->getRegister("CTR");
     return NULL;
-}
\ No newline at end of file
+}
+
+//
+// Guest register promotion
+// GPRs, CR, CTR, LR and XER live in allocas for the whole function, every emitter keeps
+// going through getRegister and mem2reg / SROA turn them into SSA values. XenonState is only
+// brought up to date where something else can see it: calls (guest functions, imports, the
+// bcctrl handler), tail calls, returns and the debug callback. A shadow is created the first
+// time its register is used, so the syncing is added once the whole function is emitted:
+// every shadow is loaded on entry and reloaded after a call (the callee may change any of
+// them), only the written ones are stored back.
+// MSR and the FPRs stay in XenonState.
+//
+// The condition register goes further with m_lazyCR: every bit is an i1 shadow of its own, so a
+// compare stores three flags and the branch reading one of them is left with the icmp once the
+// shadows are promoted. The packed CR is only rebuilt, from the written bits, at the same state
+// sites and before mfcr. It works with or without the promotion of the other registers.
+//
+
+void IRFunc::initRegisterShadows()
+{
+    if ((!m_irGen->m_promoteRegs && !m_irGen->m_lazyCR) || m_entryBlock != nullptr)
+        return;
+
+    // the start block can be a branch target, the shadows are loaded once before it
+    m_entryBlock = llvm::BasicBlock::Create(m_irGen->m_module->getContext(), "entry", m_irFunc, &m_irFunc->getEntryBlock());
+    llvm::IRBuilder<> entry(m_entryBlock);
+    entry.CreateBr(getCreateBBinMap(start_address));
+}
+
+llvm::Value* IRFunc::getShadow(uint32_t index)
+{
+    if (m_shadows[index] == nullptr)
+    {
+        static const char* names[SHADOW_RR0] = { "LR", "CTR", "XER", "CR" };
+        const std::string name = index < SHADOW_RR0 ? names[index] : "r" + std::to_string(index - SHADOW_RR0);
+        llvm::IRBuilder<> entry(m_entryBlock, m_entryBlock->begin());
+        llvm::Type* type = index == SHADOW_CR ? entry.getInt32Ty() : entry.getInt64Ty();
+        m_shadows[index] = entry.CreateAlloca(type, nullptr, name);
+    }
+    return m_shadows[index];
+}
+
+llvm::Value* IRFunc::getStateRegister(uint32_t shadowIndex)
+{
+    switch (shadowIndex)
+    {
+    case SHADOW_LR: return getStateRegister("LR");
+    case SHADOW_CTR: return getStateRegister("CTR");
+    case SHADOW_XER: return getStateRegister("XER");
+    case SHADOW_CR: return getStateRegister("CR");
+    default: return getStateRegister("RR", shadowIndex - SHADOW_RR0);
+    }
+}
+
+void IRFunc::finalizeRegisterShadows()
+{
+    if (m_entryBlock == nullptr)
+        return;
+
+    // the emitters are the only ones storing to the shadows so far
+    bool written[SHADOW_COUNT] = {};
+    for (uint32_t i = 0; i < SHADOW_COUNT; i++)
+    {
+        if (m_shadows[i] == nullptr)
+            continue;
+        for (llvm::User* user : m_shadows[i]->users())
+        {
+            llvm::StoreInst* store = llvm::dyn_cast<llvm::StoreInst>(user);
+            if (store != nullptr && store->getPointerOperand() == m_shadows[i])
+                written[i] = true;
+        }
+    }
+
+    llvm::IRBuilder<llvm::NoFolder>* builder = m_irGen->m_builder;
+    llvm::IRBuilderBase::InsertPointGuard guard(*builder);
+    auto reload = [&]()
+    {
+        for (uint32_t i = 0; i < SHADOW_COUNT; i++)
+        {
+            if (m_shadows[i] == nullptr)
+                continue;
+            llvm::Type* type = m_shadows[i]->getAllocatedType();
+            builder->CreateStore(builder->CreateLoad(type, getStateRegister(i), "stateV"), m_shadows[i]);
+        }
+    };
+
+    // the CR bits unpack from and pack into the one state field
+    uint32_t crWritten = 0;
+    for (uint32_t bit = 0; bit < 32; bit++)
+    {
+        if (m_crBits[bit] == nullptr)
+            continue;
+        for (llvm::User* user : m_crBits[bit]->users())
+        {
+            llvm::StoreInst* store = llvm::dyn_cast<llvm::StoreInst>(user);
+            if (store != nullptr && store->getPointerOperand() == m_crBits[bit])
+                crWritten |= 1u << bit;
+        }
+    }
+    auto reloadCR = [&]()
+    {
+        llvm::Value* packed = nullptr;
+        for (uint32_t bit = 0; bit < 32; bit++)
+        {
+            if (m_crBits[bit] == nullptr)
+                continue;
+            if (packed == nullptr)
+                packed = builder->CreateLoad(builder->getInt32Ty(), getStateRegister("CR"), "crV");
+            builder->CreateStore(builder->CreateTrunc(builder->CreateLShr(packed, bit, "crBit"), builder->getInt1Ty(), "trc1"), m_crBits[bit]);
+        }
+    };
+    auto packCR = [&]()
+    {
+        if (crWritten == 0)
+            return;
+        llvm::Value* packed = builder->CreateAnd(builder->CreateLoad(builder->getInt32Ty(), getStateRegister("CR"), "crV"), ~crWritten, "zCR");
+        for (uint32_t bit = 0; bit < 32; bit++)
+        {
+            if (crWritten & (1u << bit))
+            {
+                llvm::Value* value = builder->CreateZExt(builder->CreateLoad(builder->getInt1Ty(), m_crBits[bit], "crBitV"), builder->getInt32Ty(), "zEx32");
+                packed = builder->CreateOr(packed, builder->CreateShl(value, bit, "sh"), "uCR");
+            }
+        }
+        builder->CreateStore(packed, getStateRegister("CR"));
+    };
+
+    builder->SetInsertPoint(m_entryBlock->getTerminator());
+    reload();
+    reloadCR();
+    for (const auto& site : m_stateSites)
+    {
+        builder->SetInsertPoint(site.first);
+        for (uint32_t i = 0; i < SHADOW_COUNT; i++)
+        {
+            if (!written[i])
+                continue;
+            llvm::Type* type = m_shadows[i]->getAllocatedType();
+            builder->CreateStore(builder->CreateLoad(type, m_shadows[i], "shadowV"), getStateRegister(i));
+        }
+        packCR();
+        if (site.second)
+        {
+            builder->SetInsertPoint(site.first->getNextNode());
+            reload();
+            reloadCR();
+        }
+    }
+    for (llvm::Instruction* read : m_crReads)
+    {
+        builder->SetInsertPoint(read);
+        packCR();
+    }
+    m_stateSites.clear();
+    m_crReads.clear();
+}
+
+void IRFunc::markStateSite(llvm::Instruction* site, bool reload)
+{
+    if (m_entryBlock != nullptr)
+        m_stateSites.push_back({ site, reload });
+}
+
+llvm::Value* IRFunc::getCRShadow(uint32_t bit)
+{
+    if (m_crBits[bit] == nullptr)
+    {
+        static const char* names[4] = { "lt", "gt", "eq", "so" };
+        llvm::IRBuilder<> entry(m_entryBlock, m_entryBlock->begin());
+        m_crBits[bit] = entry.CreateAlloca(entry.getInt1Ty(), nullptr, "cr" + std::to_string(bit / 4) + "." + names[bit % 4]);
+    }
+    return m_crBits[bit];
+}
+
+llvm::Value* IRFunc::getCRBit(uint32_t bit)
+{
+    llvm::IRBuilder<llvm::NoFolder>* builder = m_irGen->m_builder;
+    if (m_crKnown[bit] != nullptr)
+        return m_crKnown[bit];
+    if (lazyCR())
+        return builder->CreateLoad(builder->getInt1Ty(), getCRShadow(bit), "crBitV");
+
+    llvm::Value* packed = builder->CreateLoad(builder->getInt32Ty(), getRegister("CR"), "crV");
+    return builder->CreateTrunc(builder->CreateLShr(packed, bit, "bi"), builder->getInt1Ty(), "cast1");
+}
+
+void IRFunc::setCRField(uint32_t field, llvm::Value* lt, llvm::Value* gt, llvm::Value* eq, llvm::Value* so)
+{
+    llvm::IRBuilder<llvm::NoFolder>* builder = m_irGen->m_builder;
+    llvm::Value* bits[4] = { lt, gt, eq, so };
+    std::copy(std::begin(bits), std::end(bits), m_crKnown + field * 4);
+    if (lazyCR())
+    {
+        for (uint32_t i = 0; i < 4; i++)
+            builder->CreateStore(bits[i], getCRShadow(field * 4 + i));
+        return;
+    }
+
+    // read-modify-write of the field in the packed CR
+    llvm::Value* value = builder->getInt32(0);
+    for (uint32_t i = 0; i < 4; i++)
+        value = builder->CreateOr(value, builder->CreateShl(builder->CreateZExt(bits[i], builder->getInt32Ty(), "zEx32"), i, "sh"), "or");
+    llvm::Value* cleared = builder->CreateAnd(builder->CreateLoad(builder->getInt32Ty(), getRegister("CR"), "crV"), ~(0b1111u << (field * 4)), "zCR");
+    builder->CreateStore(builder->CreateOr(cleared, builder->CreateShl(value, field * 4, "shVal"), "uCR"), getRegister("CR"));
+}
+
+bool IRFunc::fuseCompare(const Instruction& cmp, uint32_t field, uint32_t& bit)
+{
+    // the debug callback shows CR the way the guest has it
+    if (m_irGen->m_dbCallBack || m_crLiveOut.empty())
+        return false;
+
+    const uint32_t index = cfg.blockContaining(cmp.address);
+    if (index == CFG_NONE)
+        return false;
+    const CFGBlock& block = cfg.blocks()[index];
+    const Instruction branch = m_irGen->instructions().at(block.end);
+    if (branch.opcode != OP_bc || (branch.ops[0] & 0x10) || branch.ops[1] / 4 != field)
+        return false;
+
+    // nothing in between may see CR, the fused value is all there is, and no call may forget it
+    for (uint32_t address = cmp.address + 4; address < block.end; address += 4)
+    {
+        const Instruction& instr = m_irGen->instructions().at(address);
+        uint8_t uses, defs;
+        CRFieldAccess(instr, uses, defs);
+        if (uses != 0 || defs != 0 || IsStateSite(instr))
+            return false;
+    }
+    if (m_crLiveOut[index] & (1 << field))
+        return false;
+
+    bit = branch.ops[1];
+    return true;
+}
+
+void IRFunc::setFusedCRBit(uint32_t bit, llvm::Value* value)
+{
+    m_crKnown[bit] = value;
+}
+
+llvm::Value* IRFunc::readPackedCR()
+{
+    llvm::IRBuilder<llvm::NoFolder>* builder = m_irGen->m_builder;
+    if (!lazyCR())
+        return builder->CreateLoad(builder->getInt32Ty(), getRegister("CR"), "crV");
+
+    llvm::Instruction* packed = builder->CreateLoad(builder->getInt32Ty(), getStateRegister("CR"), "crV");
+    markCRRead(packed);
+    return packed;
+}
+
+void IRFunc::markCRRead(llvm::Instruction* site)
+{
+    if (lazyCR())
+        m_crReads.push_back(site);
+}
+
+void IRFunc::emitStateCall(llvm::Function* callee, llvm::ArrayRef<llvm::Value*> args)
+{
+    std::fill(std::begin(m_crKnown), std::end(m_crKnown), nullptr); // the callee can change CR
+    markStateSite(m_irGen->m_builder->CreateCall(callee, args), true);
+}
+
+void IRFunc::emitTailCall(llvm::Function* callee, llvm::ArrayRef<llvm::Value*> args)
+{
+    markStateSite(m_irGen->m_builder->CreateCall(callee, args), false);
+    m_irGen->m_builder->CreateRetVoid();
+}
+
+void IRFunc::emitReturn()
+{
+    markStateSite(m_irGen->m_builder->CreateRetVoid(), false);
+}
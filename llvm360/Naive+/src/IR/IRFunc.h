@@ -3,6 +3,7 @@
 #include <iomanip>
 #include "IRGenerator.h"
 #include "JumpTables.h"
+#include "FunctionCFG.h"
 
 
 struct CodeBlock
@@ -19,9 +20,14 @@ public:
     bool emission_done;
     std::unordered_map<uint32_t, CodeBlock*> codeBlocks;
     llvm::Function* m_irFunc;
+    std::string m_symbol; // imports keep their name, empty for func_XXXXXXXX
 
     bool EmitFunction();
     void genBody();
+    // forgets the LLVM function and its blocks, for when the module they live in goes away
+    void resetBody();
+    std::string symbolName() const;
+    static std::string SymbolName(uint32_t address);
 
     llvm::BasicBlock* createBasicBlock(uint32_t address);
     llvm::BasicBlock* getCreateBBinMap(uint32_t address);
@@ -29,8 +35,58 @@ public:
     llvm::Value* getRegister(const std::string& regName, int arrayIndex = -1, int index2 = -1);
     llvm::Value* getSPR(uint32_t n);
 
+    // anything that can read or write the guest state goes through these, with register
+    // promotion (m_irGen->m_promoteRegs) XenonState is synced before them
+    void emitStateCall(llvm::Function* callee, llvm::ArrayRef<llvm::Value*> args); // shadows reloaded after
+    void emitTailCall(llvm::Function* callee, llvm::ArrayRef<llvm::Value*> args);
+    void emitReturn();
+    void markStateSite(llvm::Instruction* site, bool reload);
+
+    // condition register, with m_irGen->m_lazyCR every CR bit is an i1 local while the function
+    // is emitted and XenonState CR is only packed where something can see it
+    llvm::Value* getCRBit(uint32_t bit); // i1, bit as in BI (field * 4 + LT / GT / EQ / SO)
+    void setCRField(uint32_t field, llvm::Value* lt, llvm::Value* gt, llvm::Value* eq, llvm::Value* so);
+    llvm::Value* readPackedCR(); // i32, mfcr
+    void markCRRead(llvm::Instruction* site); // the written CR bits are packed before it
+    // compare / branch fusion: true if the compare's field is only read by the bc ending its
+    // block, bit is the one the bc tests and the only one worth computing
+    bool fuseCompare(const Instruction& cmp, uint32_t field, uint32_t& bit);
+    void setFusedCRBit(uint32_t bit, llvm::Value* value);
+
     IRGenerator* m_irGen;
 
+private:
+    enum ShadowReg
+    {
+        SHADOW_LR,
+        SHADOW_CTR,
+        SHADOW_XER,
+        SHADOW_CR,
+        SHADOW_RR0,
+        SHADOW_COUNT = SHADOW_RR0 + 32
+    };
+
+    void initRegisterShadows();
+    void finalizeRegisterShadows();
+    llvm::Value* getShadow(uint32_t index);
+    // the XenonState field, whatever the promotion
+    llvm::Value* getStateRegister(const std::string& regName, int arrayIndex = -1, int index2 = -1);
+    llvm::Value* getStateRegister(uint32_t shadowIndex);
+    inline bool lazyCR() const { return m_entryBlock != nullptr && m_irGen->m_lazyCR; }
+    llvm::Value* getCRShadow(uint32_t bit);
+
+    //
+    // Guest register shadows, function locals standing for the XenonState fields while the
+    // function is emitted, created on first use. Null when promotion is off.
+    //
+    llvm::BasicBlock* m_entryBlock = nullptr; // loads the shadows, branches to the start block
+    llvm::AllocaInst* m_shadows[SHADOW_COUNT] = {};
+    std::vector<std::pair<llvm::Instruction*, bool>> m_stateSites; // call / ret, reload after it
+    llvm::AllocaInst* m_crBits[32] = {};
+    std::vector<llvm::Instruction*> m_crReads; // packed CR loads, the bits are stored before them
+    llvm::Value* m_crKnown[32] = {}; // i1 the current block's compares computed, read in place of CR
+    std::vector<uint8_t> m_crLiveOut; // CR fields live out of every cfg block
+
 public:
     //
     // Metadata for bounds analyser
@@ -39,4 +95,5 @@ public:
     bool is_promotion;
     bool has_jumpTable;
 	std::vector<JumpTable*> jumpTables;
+    FunctionCFG cfg; // built at the end of the flow pass, or on emission for late functions
 };
\ No newline at end of file
@@ -1,6 +1,11 @@
 #include "IRGenerator.h"
 #include "InstructionEmitter.h"
-#include <format>
+#include "misc/Profiler.h"
+#include "llvm/Bitcode/BitcodeWriter.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Transforms/Utils/Cloning.h"
+#include <chrono>
+#include <array>
 #include <iomanip>
 #include <sstream>
 
@@ -10,6 +15,20 @@ IRGenerator::IRGenerator(XexImage *xex, llvm::Module* mod, llvm::IRBuilder<llvm:
   : m_builder(builder)
   , m_module(mod) {
   m_xexImage = xex;
+  m_analysis = this;
+}
+
+IRGenerator::IRGenerator(IRGenerator* analysis, llvm::Module* mod, llvm::IRBuilder<llvm::NoFolder>* builder)
+  : m_builder(builder)
+  , m_module(mod) {
+  m_xexImage = analysis->m_xexImage;
+  m_analysis = analysis;
+  m_dbCallBack = analysis->m_dbCallBack;
+  m_dumpIRConsole = analysis->m_dumpIRConsole;
+  m_promoteRegs = analysis->m_promoteRegs;
+  m_lazyCR = analysis->m_lazyCR;
+  m_annotateIR = analysis->m_annotateIR;
+  m_irText = analysis->m_irText;
 }
 
 
@@ -47,8 +66,7 @@ void IRGenerator::CxtSwapFunc()
 
 void IRGenerator::initExtFunc()
 {
-    llvm::FunctionType* importType = llvm::FunctionType::get(m_builder->getVoidTy(), { XenonStateType->getPointerTo(), m_builder->getInt32Ty() }, false);
-    bcctrlFunc = llvm::Function::Create(importType, llvm::Function::ExternalLinkage, "HandleBcctrl", m_module);
+    bcctrlFunc = llvm::Function::Create(guestFunctionType(), llvm::Function::ExternalLinkage, "HandleBcctrl", m_module);
 
     // XenonState, instrAddress, name
     llvm::FunctionType* callBkType = llvm::FunctionType::get(m_builder->getVoidTy(), { XenonStateType->getPointerTo(), m_builder->getInt32Ty(),  m_builder->getInt8Ty()->getPointerTo() }, false);
@@ -79,10 +97,7 @@ void IRGenerator::InitLLVM() {
     );
     module_base->setDLLStorageClass(llvm::GlobalValue::DLLExportStorageClass);
 
-    // intrinsics types
-    swap16 = llvm::Intrinsic::getDeclaration(m_module, llvm::Intrinsic::bswap, m_builder->getInt16Ty());
-    swap32 = llvm::Intrinsic::getDeclaration(m_module, llvm::Intrinsic::bswap, m_builder->getInt32Ty());
-    swap64 = llvm::Intrinsic::getDeclaration(m_module, llvm::Intrinsic::bswap, m_builder->getInt64Ty());
+    initIntrinsics();
 
 
 	// main function / entry point
@@ -142,8 +157,9 @@ void IRGenerator::exportFunctionArray()
     //
     std::vector<llvm::Type*> fieldTypes = { i32Ty, i8PtrTy };
     llvm::StructType* xFuncType = llvm::StructType::create(m_module->getContext(), fieldTypes, "X_Function");
+    // sorted by address so the runtime can binary search it
     std::vector<llvm::Constant*> initElements;
-    for (const auto& pair : m_function_map)
+    for (const auto& pair : m_funcBounds.byStart())
     {
         IRFunc* func = pair.second;
         llvm::Constant* addrConst = llvm::ConstantInt::get(i32Ty, func->start_address, false);
@@ -169,172 +185,309 @@ void IRGenerator::exportFunctionArray()
     exportArrGV->setDLLStorageClass(llvm::GlobalValue::DLLExportStorageClass);
 }
 
+void IRGenerator::initIntrinsics()
+{
+    swap16 = llvm::Intrinsic::getDeclaration(m_module, llvm::Intrinsic::bswap, m_builder->getInt16Ty());
+    swap32 = llvm::Intrinsic::getDeclaration(m_module, llvm::Intrinsic::bswap, m_builder->getInt32Ty());
+    swap64 = llvm::Intrinsic::getDeclaration(m_module, llvm::Intrinsic::bswap, m_builder->getInt64Ty());
+}
+
 void IRGenerator::Initialize() {
    InitLLVM();
 }
 
-bool first = true;
+//
+// A partition module only declares what the main module defines (the context TLS, module base),
+// the runtime functions and the guest functions of other partitions get resolved when the modules
+// are linked.
+//
+void IRGenerator::InitPartition()
+{
+    tlsVariable = new llvm::GlobalVariable(
+        *m_module,
+        XenonStateType->getPointerTo(),
+        false,
+        llvm::GlobalValue::ExternalLinkage,
+        nullptr,
+        "xCtx",
+        nullptr,
+        llvm::GlobalValue::GeneralDynamicTLSModel,
+        0
+    );
+    module_base = new llvm::GlobalVariable(*m_module, m_builder->getInt64Ty(), false, llvm::GlobalValue::ExternalLinkage, nullptr, "moduleBase");
 
-#define DEBUG_COMMENT(x) m_builder->CreateAdd(m_builder->getInt32(0), m_builder->getInt32(0), x);
-#define DEBUG_CALLBACK() m_builder->CreateCall(dBCallBackFunc, { &*func->m_irFunc->arg_begin(), m_builder->getInt32(instr.address), m_builder->CreateGlobalStringPtr(instr.opcName) });
+    initExtFunc();
+    initIntrinsics();
+}
 
-bool IRGenerator::EmitInstruction(Instruction instr, IRFunc* func) {
-    // EEHHE can't use a std::string in a switch statement sooo...
-    // let's map all the instruction names (as i already needed to do with a switch statement)
-    // in a vector, so i can look up the instr opcode name in that vector and call the instruction
-    // emitter
-    // all emitter functions take as parameter <Instruction, IRGenerator>
-
-	// Debug, help to find the instruction and debug IR code
-    std::ostringstream oss;
-    oss << std::hex << std::uppercase << std::setfill('0');
-    oss << "------ " << std::setw(8) << instr.address << ":   " << instr.opcName;
-
-    for (size_t i = 0; i < instr.ops.size(); ++i) {
-        oss << " " << std::setw(2) << static_cast<int>(instr.ops.at(i));
+//
+// Emitter dispatch, a dense table indexed by opcode built at compile time.
+// Opcodes without an emitter are null.
+//
+typedef void (*InstructionEmitterFn)(Instruction instr, IRFunc* func);
+
+static constexpr std::array<InstructionEmitterFn, OP_COUNT> BuildEmitterTable()
+{
+    // <name>_e = <name>_emitter
+    std::array<InstructionEmitterFn, OP_COUNT> table{};
+    table[OP_nop] = nop_e;
+    table[OP_twi] = twi_e;
+    table[OP_tdi] = tdi_e;
+    table[OP_mfspr] = mfspr_e;
+    table[OP_mfcr] = mfcr_e;
+    table[OP_stw] = stw_e;
+    table[OP_stwu] = stwu_e;
+    table[OP_lis] = addis_e;
+    table[OP_addis] = addis_e;
+    table[OP_li] = addi_e;
+    table[OP_addi] = addi_e;
+    table[OP_lwz] = lwz_e;
+    table[OP_lwzu] = lwzu_e;
+    table[OP_lwzx] = lwzx_e;
+    table[OP_mtspr] = mtspr_e;
+    table[OP_or] = orx_e;
+    table[OP_orRC] = orx_e;
+    table[OP_sth] = sth_e;
+    table[OP_sthu] = sthu_e;
+    table[OP_sthx] = sthx_e;
+    table[OP_b] = b_e;
+    table[OP_bl] = bl_e;
+    table[OP_bclr] = bclr_e;
+    table[OP_bcctrl] = bcctrl_e;
+    table[OP_lhz] = lhz_e;
+    table[OP_lhzu] = lhzu_e;
+    table[OP_lha] = lha_e;
+    table[OP_lhzx] = lhzx_e;
+    table[OP_cmpw] = cmpw_e;
+    table[OP_bc] = bcx_e;
+    table[OP_add] = add_e;
+    table[OP_ori] = ori_e;
+    table[OP_cmpwi] = cmpi_e;
+    table[OP_cmpdi] = cmpi_e;
+    table[OP_neg] = neg_e;
+    table[OP_and] = and_e;
+    table[OP_xor] = xor_e;
+    table[OP_rlwinmRC] = rlwinm_e;
+    table[OP_rlwinm] = rlwinm_e;
+    table[OP_mullw] = mullw_e;
+    table[OP_mullwRC] = mullw_e;
+    table[OP_srawi] = srawi_e;
+    table[OP_divw] = divwx_e;
+    table[OP_andc] = andc_e;
+    table[OP_subf] = subf_e;
+    table[OP_subfe] = subfe_e;
+    table[OP_subfRC] = subf_e;
+    table[OP_subfeRC] = subfe_e;
+    table[OP_stwx] = stwx_e;
+    table[OP_cmplwi] = cmpli_e;
+    table[OP_mulli] = mulli_e;
+    table[OP_std] = std_e;
+    table[OP_stdu] = stdu_e;
+    table[OP_lbz] = lbz_e;
+    table[OP_lbzu] = lbzu_e;
+    table[OP_lbzx] = lbzx_e;
+    table[OP_bcctr] = bcctr_e;
+    table[OP_xori] = xori_e;
+    table[OP_nor] = nor_e;
+    table[OP_cntlzw] = cntlzw_e;
+    table[OP_andiRC] = andiRC_e;
+    table[OP_stb] = stb_e;
+    table[OP_stbu] = stbu_e;
+    table[OP_extsw] = extsw_e;
+    table[OP_extswRC] = extsw_e;
+    table[OP_extsh] = extsh_e;
+    table[OP_extshRC] = extsh_e;
+    table[OP_extsb] = extsb_e;
+    table[OP_extsbRC] = extsb_e;
+    table[OP_cmplw] = cmpl_e;
+    table[OP_ld] = ld_e;
+    table[OP_adde] = adde_e;
+    table[OP_addic] = addic_e;
+    table[OP_addicRC] = addic_e;
+    table[OP_slw] = slw_e;
+    table[OP_addze] = addze_e;
+    table[OP_addzeRC] = addze_e;
+    table[OP_oris] = oris_e;
+    table[OP_rlwimi] = rlwimi_e;
+    table[OP_subfic] = subfic_e;
+    table[OP_rldicl] = rldicl_e;
+    table[OP_lwa] = lwa_e;
+    table[OP_divdu] = divdu_e;
+    table[OP_divwu] = divwux_e;
+    table[OP_mulld] = mulld_e;
+    table[OP_dcbt] = dcbt_e;
+    table[OP_dcbtst] = dcbtst_e;
+    table[OP_ldu] = ldu_e;
+    table[OP_cmpldi] = cmpli_e;
+    return table;
+}
+
+static constexpr std::array<InstructionEmitterFn, OP_COUNT> s_emitters = BuildEmitterTable();
+
+#define DEBUG_CALLBACK() m_builder->CreateCall(dBCallBackFunc, { &*func->m_irFunc->arg_begin(), m_builder->getInt32(instr.address), m_builder->CreateGlobalStringPtr(instr.GetName()) });
+
+// "82000010: addi 04 04 FFFF", attached as !ppc metadata to what the instruction emitted: the
+// instructions after before in block, and all of the blocks created after lastBlock
+void IRGenerator::annotateInstruction(const Instruction& instr, llvm::BasicBlock* block, llvm::Instruction* before, llvm::BasicBlock* lastBlock)
+{
+    char text[128];
+    int length = snprintf(text, sizeof(text), "%08X: %s", instr.address, instr.GetName());
+    for (uint32_t i = 0; i < instr.opsCount && length < (int)sizeof(text); ++i)
+    {
+        length += snprintf(text + length, sizeof(text) - length, " %02X", instr.ops[i]);
     }
-    oss << " ------";
-    DEBUG_COMMENT(oss.str().c_str())
 
-    if (m_dbCallBack)
+    llvm::LLVMContext& context = m_module->getContext();
+    llvm::MDNode* node = llvm::MDNode::get(context, llvm::MDString::get(context, text));
+    llvm::BasicBlock::iterator it = before != nullptr ? std::next(before->getIterator()) : block->begin();
+    for (; it != block->end(); ++it)
     {
-        DEBUG_CALLBACK();
+        it->setMetadata("ppc", node);
     }
 
-        // <name>_e = <name>_emitter
-    static std::unordered_map<std::string, std::function<void(Instruction, IRFunc*)>>
-        instructionMap =
+    llvm::Function* function = lastBlock->getParent();
+    for (auto created = std::next(lastBlock->getIterator()); created != function->end(); ++created)
     {
-         {"nop", nop_e },
-         {"twi", twi_e },
-         {"tdi", tdi_e},
-         {"mfspr", mfspr_e },
-         {"mfcr", mfcr_e}, //
-         {"stw", stw_e },
-         {"stwu", stwu_e },
-         {"lis", addis_e }, // it's a simplified mnemonic
-         {"addis", addis_e },
-         {"li", addi_e },
-         {"addi", addi_e },
-         {"lwz", lwz_e },
-         {"lwzu", lwzu_e },
-         {"lwzx", lwzx_e},
-         {"mtspr", mtspr_e },
-         {"or", orx_e },
-         {"orRC", orx_e},
-         {"sth", sth_e },
-         {"sthu", sthu_e},
-         {"sthx", sthx_e},
-         {"b", b_e },
-         {"bl", bl_e },
-         {"bclr", bclr_e },
-         {"bcctrl", bcctrl_e},
-         {"lhz", lhz_e },
-         {"lhzu", lhzu_e},
-         {"lha", lha_e},
-         {"lhzx", lhzx_e},
-         {"cmpw", cmpw_e},
-         {"bc", bcx_e},
-         {"add", add_e},
-         {"ori", ori_e},
-         {"cmpwi", cmpi_e},
-         {"cmpdi", cmpi_e},
-         {"neg", neg_e},
-         {"and", and_e},
-         {"xor", xor_e},
-         {"rlwinmRC", rlwinm_e},
-         {"rlwinm", rlwinm_e},
-         {"mullw", mullw_e},
-         {"mullwRC", mullw_e},
-         {"srawi", srawi_e},
-         {"divw", divwx_e},
-         {"andc", andc_e},
-         {"subf", subf_e},
-         {"subfe", subfe_e},
-         {"subfRC", subf_e},
-         {"subfeRC", subfe_e},
-         {"stwx", stwx_e},
-         {"cmplwi", cmpli_e},
-         {"mulli", mulli_e},
-         {"std", std_e},
-         {"stdu", stdu_e},
-         {"lbz", lbz_e},
-         {"lbzu", lbzu_e},
-         {"lbzx", lbzx_e},
-         {"bcctr", bcctr_e},
-         {"xori", xori_e},
-         {"nor", nor_e},
-         {"cntlzw", cntlzw_e},
-         {"andiRC", andiRC_e},
-         {"stb", stb_e},
-         {"stbu", stbu_e},
-         {"extsw", extsw_e},
-         {"extswRC", extsw_e},
-         {"extsh", extsh_e}, 
-         {"extshRC", extsh_e}, 
-         {"extsb", extsb_e}, //
-         {"extsbRC", extsb_e}, //
-         {"cmplw", cmpl_e}, //
-         {"ld", ld_e},
-         {"adde", adde_e}, //
-         {"addic", addic_e},
-         {"addicRC", addic_e}, //
-         {"slw", slw_e}, //
-         {"adde", adde_e}, //
-         {"addze", addze_e},
-         {"addzeRC", addze_e},
-         {"oris", oris_e},
-         {"rlwimi", rlwimi_e},
-         {"subfic", subfic_e},
-         {"rldicl", rldicl_e},
-         {"lwa", lwa_e},
-         {"divdu", divdu_e},
-         {"divwu", divwux_e},
-         {"mulld", mulld_e},
-         {"dcbt", dcbt_e},
-         {"dcbtst", dcbtst_e},
-         {"ldu", ldu_e},
-
-         {"cmpldi", cmpli_e},
-    };
+        for (llvm::Instruction& inst : *created)
+            inst.setMetadata("ppc", node);
+    }
+}
 
+bool IRGenerator::EmitInstruction(Instruction instr, IRFunc* func) {
+    const InstructionEmitterFn emitter = instr.opcode < OP_COUNT ? s_emitters[instr.opcode] : nullptr;
+    if (emitter == nullptr)
+    {
+        // the module is written once at the end, broken or not
+        printf("Instruction:   %s  not Implemented (%08X)\n", instr.GetName(), instr.address);
+        return false;
+    }
 
-  if (instructionMap.find(instr.opcName) != instructionMap.end()) {
-    instructionMap[instr.opcName](instr, func);
-    return true;
-  } else {
-        printf("Instruction:   %s  not Implemented\n", instr.opcName.c_str());
-  }
+    // what is already in the function isn't annotated, the emitters append to the current block
+    // and to the blocks they create (at the end of the function)
+    llvm::BasicBlock* block = m_builder->GetInsertBlock();
+    llvm::Instruction* before = m_annotateIR && !block->empty() ? &block->back() : nullptr;
+    llvm::BasicBlock* lastBlock = &block->getParent()->back();
 
-  writeIRtoFile();
+    if (m_dbCallBack)
+    {
+        llvm::CallInst* callBack = DEBUG_CALLBACK();
+        func->markStateSite(callBack, false); // reads the guest state
+    }
 
-  return false;
+    emitter(instr, func);
+
+    if (m_annotateIR)
+        annotateInstruction(instr, block, before, lastBlock);
+    return true;
 }
 
 
 
 
+//
+// The module is written once, when everything is emitted: bitcode by default, text only when asked
+// for (m_irText) since formatting it is most of the time spent writing on large titles.
+// With m_splitSections the guest functions of each executable section go to their own file,
+// <output>_<section>, and <output> keeps the rest (main, the context, the function array).
+//
 void IRGenerator::writeIRtoFile()
 {
-    
+    ProfileScope scope("output", "writeIRtoFile");
 
-    printf("----IR DUMP----\n\n\n");
     if (m_dumpIRConsole)
     {
+        printf("----IR DUMP----\n\n\n");
         llvm::raw_fd_ostream& out = llvm::outs();
         m_module->print(out, nullptr);
     }
-    
+
+    if (!m_splitSections || isPartition())
+    {
+        writeModuleFile(*m_module, m_outputPath);
+        return;
+    }
+
+    // guest function definitions by section
+    std::unordered_map<const llvm::GlobalValue*, uint32_t> sectionOf;
+    for (const auto& pair : m_funcBounds.byStart())
+    {
+        const IRFunc* func = pair.second;
+        if (func->m_irFunc == nullptr || func->m_irFunc->isDeclaration())
+            continue;
+        for (uint32_t i = 0; i < m_xexImage->GetNumSections(); i++)
+        {
+            const Section* section = m_xexImage->GetSection(i);
+            const uint32_t start = m_xexImage->GetBaseAddress() + section->GetVirtualOffset();
+            if (section->CanExecute() && func->start_address >= start && func->start_address < start + section->GetVirtualSize())
+                sectionOf[func->m_irFunc] = i;
+        }
+    }
+
+    // every part gets all the private constants, only the ones it uses are kept
+    auto dropUnusedLocals = [](llvm::Module& part)
+    {
+        for (auto it = part.global_begin(); it != part.global_end();)
+        {
+            llvm::GlobalVariable& global = *it++;
+            if (global.hasLocalLinkage() && global.use_empty())
+                global.eraseFromParent();
+        }
+    };
+
+    llvm::ValueToValueMapTy restMap;
+    std::unique_ptr<llvm::Module> rest = llvm::CloneModule(*m_module, restMap, [&](const llvm::GlobalValue* value)
+        { return sectionOf.find(value) == sectionOf.end(); });
+    dropUnusedLocals(*rest);
+    writeModuleFile(*rest, m_outputPath);
+
+    for (uint32_t i = 0; i < m_xexImage->GetNumSections(); i++)
+    {
+        const Section* section = m_xexImage->GetSection(i);
+        if (!section->CanExecute())
+            continue;
+
+        llvm::ValueToValueMapTy map;
+        std::unique_ptr<llvm::Module> part = llvm::CloneModule(*m_module, map, [&](const llvm::GlobalValue* value)
+        {
+            auto it = sectionOf.find(value);
+            return it != sectionOf.end() ? it->second == i : value->hasLocalLinkage();
+        });
+        dropUnusedLocals(*part);
+
+        std::string name = section->GetName();
+        name.erase(0, name.find_first_not_of('.'));
+        for (char& c : name)
+        {
+            if (!isalnum((unsigned char)c))
+                c = '_';
+        }
+        writeModuleFile(*part, m_outputPath + "_" + name);
+    }
+}
+
+bool IRGenerator::writeModuleFile(const llvm::Module& module, const std::string& basePath)
+{
+    const auto start = std::chrono::high_resolution_clock::now();
+    const std::string path = basePath + (m_irText ? ".ll" : ".bc");
 
     std::error_code EC;
-    llvm::raw_fd_ostream OS("../../bin/Debug/output.ll", EC);
-    if (EC) {
+    llvm::raw_fd_ostream OS(path, EC, m_irText ? llvm::sys::fs::OF_Text : llvm::sys::fs::OF_None);
+    if (EC)
+    {
         llvm::errs() << "Error writing to file: " << EC.message() << "\n";
+        return false;
     }
-    else {
-        m_module->print(OS, nullptr);
-    }
+    if (m_irText)
+        module.print(OS, nullptr);
+    else
+        llvm::WriteBitcodeToFile(module, OS);
+
+    const uint64_t bytes = OS.tell();
     OS.close();
+    ProfileCount("IR bytes written", bytes);
+    printf("IR written to %s: %.2f MB in %.3f ms\n", path.c_str(), bytes / (1024.0 * 1024.0),
+        std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count());
+    return !OS.has_error();
 }
 
 
@@ -356,18 +509,98 @@ void IRGenerator::initFuncBody(IRFunc* func)
 
 IRFunc* IRGenerator::getCreateFuncInMap(uint32_t address)
 {
-    if (isIRFuncinMap(address)) {
-        return m_function_map.at(address);
+    auto it = m_function_map.find(address);
+    if (it != m_function_map.end()) {
+        return it->second;
     }
     IRFunc* func = new IRFunc();
 	func->start_address = address;
     func->end_address = NULL;
 	func->m_irGen = this;
     m_function_map.try_emplace(address, func);
+    m_funcBounds.Insert(func);
     return func;
 }
 
 bool IRGenerator::isIRFuncinMap(uint32_t address)
 {
-    return m_function_map.find(address) != m_function_map.end();
+    return m_analysis->m_function_map.find(address) != m_analysis->m_function_map.end();
+}
+
+llvm::FunctionType* IRGenerator::guestFunctionType()
+{
+    return llvm::FunctionType::get(m_builder->getVoidTy(), { XenonStateType->getPointerTo(), m_builder->getInt32Ty() }, false);
+}
+
+llvm::Function* IRGenerator::getCallee(uint32_t address)
+{
+    if (!isPartition())
+    {
+        IRFunc* callee = getCreateFuncInMap(address);
+        if (callee->m_irFunc == nullptr)
+            initFuncBody(callee);
+        return callee->m_irFunc;
+    }
+
+    // the other workers read the map too, every call target was added before the partitions
+    // were cut (see PartitionedEmitter)
+    auto it = m_analysis->m_function_map.find(address);
+    const std::string name = it != m_analysis->m_function_map.end() ? it->second->symbolName() : IRFunc::SymbolName(address);
+    if (it == m_analysis->m_function_map.end())
+        printf("Call to %08X, not a known function\n", address);
+    return llvm::cast<llvm::Function>(m_module->getOrInsertFunction(name, guestFunctionType()).getCallee());
+}
+
+void IRGenerator::addCallTargets()
+{
+    std::vector<IRFunc*> pending;
+    for (const auto& pair : m_funcBounds.byStart())
+    {
+        pending.push_back(pair.second);
+    }
+
+    while (!pending.empty())
+    {
+        IRFunc* func = pending.back();
+        pending.pop_back();
+        if (func->emission_done)
+            continue; // imports
+
+        if (!func->cfg.built())
+            func->cfg.Build(this, func);
+        for (const CFGBlock& block : func->cfg.blocks())
+        {
+            for (uint32_t address = block.address; address <= block.end; address += 4)
+            {
+                const Instruction instr = instrsList.at(address);
+                if (instr.opcode != OP_bl)
+                    continue;
+                const uint32_t target = instr.address + signExtend(instr.ops[0], 24);
+                if (!isIRFuncinMap(target))
+                    pending.push_back(getCreateFuncInMap(target));
+            }
+        }
+    }
+}
+
+void IRGenerator::removeFuncFromMap(uint32_t address)
+{
+    m_function_map.erase(address);
+    m_funcBounds.Remove(address);
+}
+
+void IRGenerator::setFuncEnd(IRFunc* func, uint32_t endAddress)
+{
+    func->end_address = endAddress;
+    m_funcBounds.InvalidateEnds();
+}
+
+IRFunc* IRGenerator::findFuncContaining(uint32_t address)
+{
+    return m_funcBounds.FindContaining(address);
+}
+
+IRFunc* IRGenerator::findNextFunc(uint32_t address) const
+{
+    return m_funcBounds.FindNext(address);
 }
\ No newline at end of file
@@ -12,7 +12,9 @@
 
 #include "Xex/XexLoader.h"
 #include "Decoder/Instruction.h"
-#include <Windows.h>
+#include "Decoder/InstructionStore.h"
+#include "FunctionBounds.h"
+#include "misc/Platform.h"
 #include <map>
 
 class IRFunc;
@@ -28,15 +30,28 @@ public:
   XexImage *m_xexImage;
   bool m_dbCallBack;
   bool m_dumpIRConsole;
+  bool m_promoteRegs = false; // keep guest registers in function locals, see IRFunc::initRegisterShadows
+  bool m_lazyCR = true;       // CR bits in function locals, packed into XenonState only where it's observed
+  bool m_annotateIR = false;  // tag the IR of every instruction with its PPC address and operands
 
   IRGenerator(XexImage *xex, llvm::Module* mod, llvm::IRBuilder<llvm::NoFolder>* builder);
+  // partition worker: emits into its own module, the function map and the instructions are the
+  // ones of `analysis`, only read
+  IRGenerator(IRGenerator* analysis, llvm::Module* mod, llvm::IRBuilder<llvm::NoFolder>* builder);
   void Initialize();
+  void InitPartition();
   bool EmitInstruction(Instruction instr, IRFunc* func);
+  void annotateInstruction(const Instruction& instr, llvm::BasicBlock* block, llvm::Instruction* before, llvm::BasicBlock* lastBlock);
   void InitLLVM();
   void writeIRtoFile();
+  bool writeModuleFile(const llvm::Module& module, const std::string& basePath);
+  std::string m_outputPath = "../../bin/Debug/output"; // .bc / .ll / .obj appended
+  bool m_irText = false;        // textual IR instead of bitcode
+  bool m_splitSections = false; // one file per executable section
   void CxtSwapFunc();
   void exportFunctionArray();
   void initExtFunc();
+  void initIntrinsics();
 
 
   llvm::Function* dBCallBackFunc;
@@ -61,13 +76,33 @@ public:
           //llvm::ArrayType::get(llvm::ArrayType::get(llvm::Type::getInt64Ty(m_builder->getContext()), 2), 128) // VR
       }, "xenonState");
 
+  // void(XenonState*, i32), every guest function and import
+  llvm::FunctionType* guestFunctionType();
+  // what a call to the guest function at address goes to, a declaration in a partition that
+  // doesn't emit it
+  llvm::Function* getCallee(uint32_t address);
+  inline bool isPartition() const { return m_analysis != this; }
+  inline const InstructionStore& instructions() const { return m_analysis->instrsList; }
+
   void initFuncBody(IRFunc* func);
   IRFunc* getCreateFuncInMap(uint32_t address);
+  // bl targets the flow pass didn't make functions of are created by the serial emission as it
+  // goes, emitters that share the map between modules need them all up front
+  void addCallTargets();
   bool isIRFuncinMap(uint32_t address);
+  void removeFuncFromMap(uint32_t address);
+  // ends must be set through here so the bounds index sees them
+  void setFuncEnd(IRFunc* func, uint32_t endAddress);
+  // function with start < address < end, null if none
+  IRFunc* findFuncContaining(uint32_t address);
+  // first function starting at or after address, null if none
+  IRFunc* findNextFunc(uint32_t address) const;
 
   llvm::Function* mainFn;
   std::unordered_map<uint32_t, IRFunc*> m_function_map;
-  std::unordered_map<uint32_t, Instruction> instrsList;
+  FunctionBounds m_funcBounds; // same functions, ordered by address
+  InstructionStore instrsList;
+  IRGenerator* m_analysis; // this, or the generator a partition worker emits for
 };
 
 
@@ -30,7 +30,6 @@
 
 // register value access / store
 #define gprVal(x) BUILD->CreateLoad(BUILD->getInt64Ty(), func->getRegister("RR", x), "rrV")
-#define crVal() BUILD->CreateLoad(BUILD->getInt32Ty(), func->getRegister("CR"), "crV")
 #define xerVal() BUILD->CreateLoad(BUILD->getInt32Ty(), func->getRegister("XER"), "xerV")
 #define ctrVal() BUILD->CreateLoad(BUILD->getInt32Ty(), func->getRegister("CTR"), "ctrV")
 
@@ -147,60 +146,44 @@ inline llvm::Value* getBOOperation(IRFunc* func, Instruction instr, llvm::Value*
     return nullptr;
 }
 
-// TODO refactor
-inline void setCRField(IRFunc* func, uint32_t index, llvm::Value* field)
-{
-    int bitOffset = index * 4;
-    llvm::Value* shiftedMask = BUILD->CreateShl(i32Const(0b1111), bitOffset, "shMsk");
-
-    // clear the already stored bits
-    llvm::Value* invertedMask = BUILD->CreateNot(shiftedMask, "inMsk");
-    llvm::Value* clearedCR = BUILD->CreateAnd(crVal(), invertedMask, "zCR");
-    llvm::Value* fieldExtended = zExt32(field); // Cast 'field' to i32 before shifting
-
-    // update bits
-    llvm::Value* shiftedFieldValue = BUILD->CreateShl(fieldExtended, bitOffset, "shVal");
-    llvm::Value* updatedCR = BUILD->CreateOr(clearedCR, shiftedFieldValue, "uCR");
-
-    BUILD->CreateStore(updatedCR, func->getRegister("CR"));
-}
-
-inline void UpdateCR_CmpZero(IRFunc* func, Instruction instr, const char* name, llvm::Value* val)
+inline void UpdateCR_CmpZero(IRFunc* func, Instruction instr, PPCOpcode rcOpcode, llvm::Value* val)
 {
     // RC
-    if (strcmp(instr.opcName.c_str(), name) == 0)
+    if (instr.opcode == rcOpcode)
     {
-        llvm::Value* LT = zExt32(BUILD->CreateICmpSLT(val, i64Const(0), "lt"));
-        llvm::Value* GT = zExt32(BUILD->CreateICmpSGT(val, i64Const(0), "gt"));
-        llvm::Value* EQ = zExt32(BUILD->CreateICmpEQ(val, i64Const(0), "eq"));
+        llvm::Value* LT = BUILD->CreateICmpSLT(val, i64Const(0), "lt");
+        llvm::Value* GT = BUILD->CreateICmpSGT(val, i64Const(0), "gt");
+        llvm::Value* EQ = BUILD->CreateICmpEQ(val, i64Const(0), "eq");
         // TODO
-        llvm::Value* SO_bit = i32Const(0);
-        llvm::Value* field = zExt32(BUILD->CreateOr(BUILD->CreateOr(BUILD->CreateOr(LT, BUILD->CreateShl(GT, 1, "sh"), "or"), BUILD->CreateShl(EQ, 2, "sh"), "or"), BUILD->CreateShl(SO_bit, 3, "sh"), "or"));
-
-        setCRField(func, 0, field);
+        llvm::Value* SO_bit = i1Const(0);
+        func->setCRField(0, LT, GT, EQ, SO_bit);
     }
 }
 
-inline void UpdateCR_CmpValue(IRFunc* func, Instruction instr, llvm::Value* v1, llvm::Value* v2, uint32_t field)
+// the CR bit a compare sets, LT / GT / EQ / SO within the field
+inline llvm::Value* CompareCRBit(IRFunc* func, llvm::Value* v1, llvm::Value* v2, uint32_t bit)
 {
-    llvm::Value* LT = zExt32(BUILD->CreateICmpSLT(v1, v2, "lt"));
-    llvm::Value* GT = zExt32(BUILD->CreateICmpSGT(v1, v2, "gt"));
-    llvm::Value* EQ = zExt32(BUILD->CreateICmpEQ(v1, v2, "eq"));
-    // TODO
-    llvm::Value* SO_bit = i32Const(0);
-    llvm::Value* res = zExt32(BUILD->CreateOr(BUILD->CreateOr(BUILD->CreateOr(LT, BUILD->CreateShl(GT, 1, "sh"), "or"), BUILD->CreateShl(EQ, 2, "sh"), "or"), BUILD->CreateShl(SO_bit, 3, "sh"), "or"));
-    setCRField(func, field, res);
+    switch (bit)
+    {
+    case 0: return BUILD->CreateICmpSLT(v1, v2, "lt");
+    case 1: return BUILD->CreateICmpSGT(v1, v2, "gt");
+    case 2: return BUILD->CreateICmpEQ(v1, v2, "eq");
+    default: return i1Const(0); // TODO SO
+    }
 }
 
-inline llvm::Value* extractCRBit(IRFunc* func, uint32_t BI) {
-    // create mask at bit pos
-    llvm::Value* mask = i32Const(1);
-    llvm::Value* shiftAmount = i32Const(BI);
-    llvm::Value* shiftedMask = BUILD->CreateShl(mask, shiftAmount, "shm");
+inline void UpdateCR_CmpValue(IRFunc* func, Instruction instr, llvm::Value* v1, llvm::Value* v2, uint32_t field)
+{
+    // compare / branch fusion, the bc ending the block gets the one icmp it tests and the
+    // field is left alone, nothing reads it afterwards
+    uint32_t bit;
+    if (func->fuseCompare(instr, field, bit))
+    {
+        func->setFusedCRBit(bit, CompareCRBit(func, v1, v2, bit % 4));
+        return;
+    }
 
-    // mask the bit
-    llvm::Value* isolatedBit = BUILD->CreateAnd(crVal(), shiftedMask, "ib");
-    return BUILD->CreateIntCast(BUILD->CreateLShr(isolatedBit, shiftAmount, "bi"), BUILD->getInt1Ty(), false,"cast1");
+    func->setCRField(field, CompareCRBit(func, v1, v2, 0), CompareCRBit(func, v1, v2, 1), CompareCRBit(func, v1, v2, 2), CompareCRBit(func, v1, v2, 3));
 }
 
 inline llvm::Value* AddCarried(IRFunc* func, llvm::Value* v1, llvm::Value* v2)
@@ -259,7 +242,7 @@ inline void nop_e(Instruction instr, IRFunc* func)
     // lil hack
     if (instr.address == func->end_address && func->m_irGen->isIRFuncinMap(instr.address + 4))
     {
-        BUILD->CreateRetVoid();
+        func->emitReturn();
     }
     return;
 }
@@ -306,14 +289,13 @@ inline void mtspr_e(Instruction instr, IRFunc* func)
 
 inline void mfcr_e(Instruction instr, IRFunc* func)
 {
-    BUILD->CreateStore(crVal(), func->getRegister("RR", instr.ops[0]));
+    BUILD->CreateStore(zExt64(func->readPackedCR()), func->getRegister("RR", instr.ops[0]));
 }
 
 inline void bl_e(Instruction instr, IRFunc* func)
 {
     uint32_t target = instr.address + signExtend(instr.ops[0], 24);
-	IRFunc* targetFunc = func->m_irGen->getCreateFuncInMap(target);
-    func->m_irGen->initFuncBody(targetFunc);
+	llvm::Function* targetFunc = func->m_irGen->getCallee(target);
 
     // outdated:
     // 
@@ -330,25 +312,22 @@ inline void bl_e(Instruction instr, IRFunc* func)
     llvm::Argument* arg2 = &*(++argIter);
 
     BUILD->CreateStore(i32Const(instr.address + 4), func->getRegister("LR"));
-	BUILD->CreateCall(targetFunc->m_irFunc, {arg1, i32Const(instr.address + 4)});
+	func->emitStateCall(targetFunc, {arg1, i32Const(instr.address + 4)});
 
 
     uint32_t lrAddr = instr.address + 4;
-    Instruction lrInstr = func->m_irGen->instrsList.at(lrAddr);
+    Instruction lrInstr = func->m_irGen->instructions().at(lrAddr);
 
-    while (strcmp(lrInstr.opcName.c_str(), "nop") == 0)
+    while (lrInstr.opcode == OP_nop)
     {
         lrAddr += 4;
-        lrInstr = func->m_irGen->instrsList.at(lrAddr);
+        lrInstr = func->m_irGen->instructions().at(lrAddr);
     }
 
     // check if the lr target is a function, if yes, restore execution flow to that
     if (func->m_irGen->isIRFuncinMap(lrAddr))
     {
-        IRFunc* lrFunc = func->m_irGen->getCreateFuncInMap(lrAddr);
-        func->m_irGen->initFuncBody(lrFunc);
-        BUILD->CreateCall(lrFunc->m_irFunc, { arg1, i32Const(lrAddr)});
-        BUILD->CreateRetVoid();
+        func->emitTailCall(func->m_irGen->getCallee(lrAddr), { arg1, i32Const(lrAddr)});
     }
 }
 
@@ -362,10 +341,7 @@ inline void b_e(Instruction instr, IRFunc* func)
         llvm::Argument* arg1 = &*argIter;
         llvm::Argument* arg2 = &*(++argIter);
 
-        IRFunc* tailCall = func->m_irGen->getCreateFuncInMap(target);
-		if (tailCall->m_irFunc == nullptr) func->m_irGen->initFuncBody(tailCall);
-        BUILD->CreateCall(tailCall->m_irFunc, { arg1, arg2 });
-        BUILD->CreateRetVoid();
+        func->emitTailCall(func->m_irGen->getCallee(target), { arg1, arg2 });
         return;
     }
 
@@ -375,7 +351,7 @@ inline void b_e(Instruction instr, IRFunc* func)
 
 inline void bclr_e(Instruction instr, IRFunc* func)
 {
-	BUILD->CreateRetVoid();
+	func->emitReturn();
 }
 
 inline void bcctrl_e(Instruction instr, IRFunc* func)
@@ -384,7 +360,7 @@ inline void bcctrl_e(Instruction instr, IRFunc* func)
     llvm::Argument* arg1 = &*argIter;
     llvm::Argument* arg2 = &*(++argIter);
 
-    BUILD->CreateCall(func->m_irGen->bcctrlFunc, { arg1, i32Const(instr.address + 4) });
+    func->emitStateCall(func->m_irGen->bcctrlFunc, { arg1, i32Const(instr.address + 4) });
 }
 
 inline void bcctr_e(Instruction instr, IRFunc* func)
@@ -414,12 +390,11 @@ inline void bcctr_e(Instruction instr, IRFunc* func)
     auto argIter = func->m_irFunc->arg_begin();
     llvm::Argument* arg1 = &*argIter;
     llvm::Argument* arg2 = &*(++argIter);
-    BUILD->CreateCall(func->m_irGen->bcctrlFunc, { arg1, i32Const(instr.address + 4) });
 
     // here i also make a return, because this is the form that do not save LR
     // so when the runtime handler return it will return to the next address of this
     // instruction, but we actually want to return to the last time lr was "stored"
-    BUILD->CreateRetVoid();
+    func->emitTailCall(func->m_irGen->bcctrlFunc, { arg1, i32Const(instr.address + 4) });
     return;
 }
 
@@ -455,7 +430,7 @@ inline void addic_e(Instruction instr, IRFunc* func)
 
 
 	StoreCA(func, AddCarried(func, rrValue, im));
-    UpdateCR_CmpZero(func, instr, "addicRC", val);
+    UpdateCR_CmpZero(func, instr, OP_addicRC, val);
 }
 
 
@@ -495,7 +470,7 @@ inline void addze_e(Instruction instr, IRFunc* func)
 
     // XER CA and RC
     StoreCA(func, AddCarried(func, gprVal(instr.ops[1]), getCA(func)));
-    UpdateCR_CmpZero(func, instr, "addzeRC", ab);
+    UpdateCR_CmpZero(func, instr, OP_addzeRC, ab);
 }
 
 inline void add_e(Instruction instr, IRFunc* func)
@@ -508,7 +483,7 @@ inline void bcx_e(Instruction instr, IRFunc* func)
 {
     // first check how to manage the branch condition
     // if "should_branch" == True then
-    llvm::Value* bi = BUILD->CreateTrunc(extractCRBit(func, instr.ops[1]), BUILD->getInt1Ty(), "tr");
+    llvm::Value* bi = func->getCRBit(instr.ops[1]);
     llvm::Value* should_branch = getBOOperation(func, instr, bi);
 
     
@@ -523,21 +498,21 @@ inline void extsw_e(Instruction instr, IRFunc* func)
 {
     llvm::Value* val = sExt64(trcTo32(gprVal(instr.ops[1])));
     BUILD->CreateStore(val, func->getRegister("RR", instr.ops[0]));
-    UpdateCR_CmpZero(func, instr, "extswRC", val);
+    UpdateCR_CmpZero(func, instr, OP_extswRC, val);
 }
 
 inline void extsh_e(Instruction instr, IRFunc* func)
 {
     llvm::Value* val = sExt64(trcTo16(gprVal(instr.ops[1])));
     BUILD->CreateStore(val, func->getRegister("RR", instr.ops[0]));
-    UpdateCR_CmpZero(func, instr, "extshRC", val);
+    UpdateCR_CmpZero(func, instr, OP_extshRC, val);
 }
 
 inline void extsb_e(Instruction instr, IRFunc* func)
 {
     llvm::Value* val = sExt64(trcTo8(gprVal(instr.ops[1])));
 	BUILD->CreateStore(val, func->getRegister("RR", instr.ops[0]));
-    UpdateCR_CmpZero(func, instr, "extsbRC", val);
+    UpdateCR_CmpZero(func, instr, OP_extsbRC, val);
 }
 
 inline void cmpli_e(Instruction instr, IRFunc* func)
@@ -774,7 +749,7 @@ inline void rlwinm_e(Instruction instr, IRFunc* func)
     
     auto masked = trcTo32(BUILD->CreateAnd(rotl, i64Const(mask), "and"));
     BUILD->CreateStore(zExt64(masked), func->getRegister("RR", instr.ops[0]));
-    UpdateCR_CmpZero(func, instr, "rlwinmRC", zExt64(masked));
+    UpdateCR_CmpZero(func, instr, OP_rlwinmRC, zExt64(masked));
 }
 
 inline void rlwimi_e(Instruction instr, IRFunc* func)
@@ -873,7 +848,7 @@ inline void orx_e(Instruction instr, IRFunc* func)
     // The contents of rS are ORed with the contents of rB and the result is placed into rA.
     llvm::Value* value = BUILD->CreateOr(gprVal(instr.ops[1]), gprVal(instr.ops[2]), "or");
     BUILD->CreateStore(value, func->getRegister("RR", instr.ops[0]));
-    UpdateCR_CmpZero(func, instr, "orRC", value);
+    UpdateCR_CmpZero(func, instr, OP_orRC, value);
 }
 
 inline void ori_e(Instruction instr, IRFunc* func)
@@ -906,7 +881,7 @@ inline void andiRC_e(Instruction instr, IRFunc* func)
 {
     auto andResult = BUILD->CreateAnd(gprVal(instr.ops[1]), zExt64(i16Const(instr.ops[2])), "and");
     BUILD->CreateStore(andResult, func->getRegister("RR", instr.ops[0]));
-    UpdateCR_CmpZero(func, instr, "andiRC", andResult);
+    UpdateCR_CmpZero(func, instr, OP_andiRC, andResult);
 }
 
 inline void xor_e(Instruction instr, IRFunc* func)
@@ -943,7 +918,7 @@ inline void mullw_e(Instruction instr, IRFunc* func)
 {
     auto mulResult = trcTo32(BUILD->CreateMul(gprVal(instr.ops[1]), gprVal(instr.ops[2]), "Mul"));
     BUILD->CreateStore(mulResult, func->getRegister("RR", instr.ops[0]));
-    UpdateCR_CmpZero(func, instr, "mullwRC", zExt64(mulResult));
+    UpdateCR_CmpZero(func, instr, OP_mullwRC, zExt64(mulResult));
 }
 
 inline void mulld_e(Instruction instr, IRFunc* func)
@@ -998,7 +973,7 @@ inline void subf_e(Instruction instr, IRFunc* func)
     // but can be simplified to -> rB - rA, THEY ARE SWAPPED
     llvm::Value* v = BUILD->CreateSub(gprVal(instr.ops[2]), gprVal(instr.ops[1]), "sub");
     BUILD->CreateStore(v, func->getRegister("RR", instr.ops[0]));
-    UpdateCR_CmpZero(func, instr, "subfRC", v);
+    UpdateCR_CmpZero(func, instr, OP_subfRC, v);
 }
 
 inline void subfe_e(Instruction instr, IRFunc* func)
@@ -1009,7 +984,7 @@ inline void subfe_e(Instruction instr, IRFunc* func)
     llvm::Value* v = BUILD->CreateSub(gprVal(instr.ops[2]), gprVal(instr.ops[1]), "sub");
     llvm::Value* vXer = BUILD->CreateAdd(v, zExt64(getCA(func)), "valXer");
     BUILD->CreateStore(vXer, func->getRegister("RR", instr.ops[0]));
-    UpdateCR_CmpZero(func, instr, "subfeRC", v);
+    UpdateCR_CmpZero(func, instr, OP_subfeRC, v);
 }
 
 inline void subfic_e(Instruction instr, IRFunc* func)
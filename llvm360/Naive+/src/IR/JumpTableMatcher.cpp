@@ -0,0 +1,104 @@
+#include "JumpTableMatcher.h"
+#include "JumpTables.h"
+#include <algorithm>
+
+#define JTM_NO_STATE 0xFFFF
+
+JumpTableMatcher::JumpTableMatcher()
+    : m_maxLength(0)
+{
+    // trie of the patterns
+    std::vector<uint16_t> trie(OP_COUNT, JTM_NO_STATE);
+    m_outputs.emplace_back();
+    for (uint32_t v = 0; v < jtVariantTypes.size(); v++)
+    {
+        const std::vector<PPCOpcode>& pattern = jtVariantTypes[v].pattern;
+        m_maxLength = std::max(m_maxLength, (uint32_t)pattern.size());
+
+        uint32_t state = 0;
+        for (PPCOpcode opcode : pattern)
+        {
+            uint16_t& next = trie[state * OP_COUNT + opcode];
+            if (next == JTM_NO_STATE)
+            {
+                next = (uint16_t)m_outputs.size();
+                m_outputs.emplace_back();
+                trie.resize(trie.size() + OP_COUNT, JTM_NO_STATE);
+            }
+            state = trie[state * OP_COUNT + opcode];
+        }
+        m_outputs[state].push_back(v);
+    }
+
+    // failure links folded into a full transition table, breadth first so the state a
+    // failure points to is always complete
+    const uint32_t states = (uint32_t)m_outputs.size();
+    m_next.assign((size_t)states * OP_COUNT, 0);
+    std::vector<uint32_t> fail(states, 0);
+    std::vector<uint32_t> queue;
+    queue.reserve(states);
+
+    for (uint32_t op = 0; op < OP_COUNT; op++)
+    {
+        const uint16_t child = trie[op];
+        if (child != JTM_NO_STATE)
+        {
+            m_next[op] = child;
+            queue.push_back(child);
+        }
+    }
+    for (size_t i = 0; i < queue.size(); i++)
+    {
+        const uint32_t state = queue[i];
+        for (uint32_t op = 0; op < OP_COUNT; op++)
+        {
+            const uint16_t child = trie[state * OP_COUNT + op];
+            const uint16_t onFail = m_next[fail[state] * OP_COUNT + op];
+            if (child == JTM_NO_STATE)
+            {
+                m_next[state * OP_COUNT + op] = onFail;
+                continue;
+            }
+            m_next[state * OP_COUNT + op] = child;
+            fail[child] = onFail;
+            const std::vector<uint32_t>& inherited = m_outputs[onFail];
+            m_outputs[child].insert(m_outputs[child].end(), inherited.begin(), inherited.end());
+            std::sort(m_outputs[child].begin(), m_outputs[child].end());
+            queue.push_back(child);
+        }
+    }
+}
+
+const JumpTableMatcher& JumpTableMatcher::Get()
+{
+    static const JumpTableMatcher matcher;
+    return matcher;
+}
+
+void JumpTableMatcher::Scan(const PPCOpcode* opcodes, uint32_t base, uint32_t count, std::vector<JTMatch>& out) const
+{
+    const size_t first = out.size();
+    uint32_t state = 0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        state = step(state, opcodes[i]);
+        for (uint32_t v : m_outputs[state])
+        {
+            const uint32_t length = (uint32_t)jtVariantTypes[v].pattern.size();
+            out.push_back(JTMatch{ base + (i + 1 - length) * 4, v });
+        }
+    }
+    std::sort(out.begin() + first, out.end(), [](const JTMatch& a, const JTMatch& b)
+    {
+        return a.address != b.address ? a.address < b.address : a.variant < b.variant;
+    });
+}
+
+int JumpTableMatcher::MatchEndingAt(const PPCOpcode* opcodes, uint32_t last) const
+{
+    // a pattern ending at `last` starts in the window, so running from its start is enough
+    uint32_t state = 0;
+    for (uint32_t i = last + 1 > m_maxLength ? last + 1 - m_maxLength : 0; i <= last; i++)
+        state = step(state, opcodes[i]);
+    return m_outputs[state].empty() ? -1 : (int)m_outputs[state].front();
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "Decoder/Instruction.h"
+
+struct JTMatch
+{
+    uint32_t address;  // first instruction of the pattern
+    uint32_t variant;  // index in jtVariantTypes
+};
+
+//
+// All the jtVariantTypes patterns compiled into one Aho-Corasick automaton over opcode ids,
+// a section is swept once whatever the number of forms, each opcode is a single table lookup.
+//
+class JumpTableMatcher
+{
+public:
+    JumpTableMatcher();
+
+    // shared instance, built on first use
+    static const JumpTableMatcher& Get();
+
+    // every table pattern in the `count` opcodes starting at `base`, in address order
+    void Scan(const PPCOpcode* opcodes, uint32_t base, uint32_t count, std::vector<JTMatch>& out) const;
+    // variant whose pattern ends at opcodes[last], -1 if none (the first declared one wins)
+    int MatchEndingAt(const PPCOpcode* opcodes, uint32_t last) const;
+
+private:
+    inline uint32_t step(uint32_t state, PPCOpcode opcode) const
+    {
+        return m_next[state * OP_COUNT + opcode];
+    }
+
+    uint32_t m_maxLength;
+    std::vector<uint16_t> m_next;                 // [state * OP_COUNT + opcode]
+    std::vector<std::vector<uint32_t>> m_outputs; // variants ending in each state, sorted
+};
@@ -3,28 +3,44 @@
 
 
 
-static const std::vector<const char*> COMPUTED_TABLE_0_pattern = { "lis", "addi", "lbzx", "rlwinm", "lis", "ori", "addi", "add", "mtspr", "bcctr" };
-static const std::vector<const char*> OFFSET_TABLE_0_pattern = { "lis", "addi", "lbzx", "lis", "ori", "addi", "ori", "add", "mtspr", "bcctr" };
-static const std::vector<const char*> WORDOFFSET_TABLE_0_pattern = { "lis", "rlwinm", "addi", "lhzx", "lis", "addi", "ori", "add", "mtspr", "bcctr" };
-
 enum JTVariantEnum
 {
     COMPUTED_TABLE_0,
     OFFSET_TABLE_0,
     WORDOFFSET_TABLE_0,
+    ABSOLUTE_TABLE_0,
     ENUM_SIZE
 };
 
+#define JT_NONE 0xFF
+
+//
+// One switch form, declared as data: the opcodes up to the bcctr and where, inside that pattern,
+// the operands needed to read the table are. The table address and the base its entries are
+// added to are lis / addi pairs, `shift` is the rlwinm shifting the entries.
+// Adding a form is adding an entry to jtVariantTypes, JumpTableMatcher picks it up.
+//
 struct JTVariant
 {
     JTVariantEnum type;
-    std::vector<const char*> pattern;
+    std::vector<PPCOpcode> pattern;
+    uint8_t tableHi;
+    uint8_t tableLo;
+    uint8_t baseHi;     // JT_NONE when the entries are absolute addresses
+    uint8_t baseLo;
+    uint8_t shift;      // JT_NONE when the entries aren't shifted
+    uint8_t entrySize;  // 1, 2 or 4 bytes, big endian
 };
 
 static const std::array<JTVariant, JTVariantEnum::ENUM_SIZE> jtVariantTypes = {
-    JTVariant{COMPUTED_TABLE_0, COMPUTED_TABLE_0_pattern},
-    JTVariant{OFFSET_TABLE_0, OFFSET_TABLE_0_pattern},
-    JTVariant{WORDOFFSET_TABLE_0, WORDOFFSET_TABLE_0_pattern},
+    // base + (byte << sh)
+    JTVariant{COMPUTED_TABLE_0, { OP_lis, OP_addi, OP_lbzx, OP_rlwinm, OP_lis, OP_ori, OP_addi, OP_add, OP_mtspr, OP_bcctr }, 0, 1, 4, 6, 3, 1},
+    // base + byte
+    JTVariant{OFFSET_TABLE_0, { OP_lis, OP_addi, OP_lbzx, OP_lis, OP_ori, OP_addi, OP_ori, OP_add, OP_mtspr, OP_bcctr }, 0, 1, 3, 5, JT_NONE, 1},
+    // base + half
+    JTVariant{WORDOFFSET_TABLE_0, { OP_lis, OP_rlwinm, OP_addi, OP_lhzx, OP_lis, OP_addi, OP_ori, OP_add, OP_mtspr, OP_bcctr }, 0, 2, 4, 5, JT_NONE, 2},
+    // absolute word addresses
+    JTVariant{ABSOLUTE_TABLE_0, { OP_lis, OP_addi, OP_rlwinm, OP_lwzx, OP_mtspr, OP_bcctr }, 0, 1, JT_NONE, JT_NONE, JT_NONE, 4},
 };
 
 inline uint16_t ByteSwap16(uint16_t value)
@@ -32,6 +48,11 @@ inline uint16_t ByteSwap16(uint16_t value)
     return (value << 8) | (value >> 8);
 }
 
+inline uint32_t ByteSwap32(uint32_t value)
+{
+    return (value << 24) | ((value << 8) & 0x00FF0000) | ((value >> 8) & 0x0000FF00) | (value >> 24);
+}
+
 // Define a jump table inside a function
 // `targets` are the addresses of the cases, index 0 is always the default case
 class JumpTable
@@ -45,95 +66,43 @@ public:
 
 	void ComputeTargets(IRGenerator* irGen)
     {
-		
 		findTargetsSize(irGen);
-		
-        switch (variant.type)
-        {
-        case COMPUTED_TABLE_0:
+
+        // immediate of the pattern instruction at `index`
+        auto immAt = [&](uint8_t index) { return irGen->instrsList.at(start_Address + (index * 4)).ops[2]; };
+
+        const uint32_t off = (immAt(variant.tableHi) << 16) + immAt(variant.tableLo);
+        Section* sec = irGen->m_xexImage->getSectionByAddressBounds(off);
+        if (sec == nullptr)
         {
-			uint32_t off = 0;
-            Instruction instr = irGen->instrsList.at(start_Address);
-            off = instr.ops[2] << 16;
-            instr = irGen->instrsList.at(start_Address + 4);
-            off += instr.ops[2];
-            
-            
-            
-            Section* sec = irGen->m_xexImage->getSectionByAddressBounds(off);
-            const uint8_t* m_imageDataPtr = (const uint8_t*)sec->GetImage()->GetMemory() + (sec->GetVirtualOffset() - sec->GetImage()->GetBaseAddress());
-            const auto* offsets = (uint8_t*)m_imageDataPtr + off - sec->GetVirtualOffset();
-
-            instr = irGen->instrsList.at(start_Address + (4 * 4));  // lis
-            uint32_t baseAddr = instr.ops[2] << 16; 
-            instr = irGen->instrsList.at(start_Address + (6 * 4));  // addi
-            baseAddr += instr.ops[2]; 
-            instr = irGen->instrsList.at(start_Address + (3 * 4));  // rlwinm
-            uint32_t sh = instr.ops[2]; 
-
-            for (size_t i = 1; i < numTargets; i++)
-            {
-                targets.push_back(baseAddr + (offsets[i] << sh));
-            }
-            break;
+            return;
         }
+        const uint8_t* m_imageDataPtr = (const uint8_t*)sec->GetImage()->GetMemory() + (sec->GetVirtualOffset() - sec->GetImage()->GetBaseAddress());
+        const uint8_t* entries = m_imageDataPtr + off - sec->GetVirtualOffset();
 
-        case OFFSET_TABLE_0:
+        uint32_t baseAddr = 0;
+        if (variant.baseHi != JT_NONE)
         {
-            uint32_t off = 0;
-            Instruction instr = irGen->instrsList.at(start_Address);
-            off = instr.ops[2] << 16;
-            instr = irGen->instrsList.at(start_Address + 4);
-            off += instr.ops[2];
-
-            Section* sec = irGen->m_xexImage->getSectionByAddressBounds(off);
-            const uint8_t* m_imageDataPtr = (const uint8_t*)sec->GetImage()->GetMemory() + (sec->GetVirtualOffset() - sec->GetImage()->GetBaseAddress());
-            const auto* offsets = (uint8_t*)m_imageDataPtr + off - sec->GetVirtualOffset();
-
-            instr = irGen->instrsList.at(start_Address + (3 * 4));  // lis
-            uint32_t baseAddr = instr.ops[2] << 16;
-            instr = irGen->instrsList.at(start_Address + (5 * 4));  // addi
-            baseAddr += instr.ops[2];
-
-
-            for (size_t i = 1; i < numTargets; i++)
-            {
-                targets.push_back(baseAddr + offsets[i]);
-            }
-            break;
+            baseAddr = (immAt(variant.baseHi) << 16) + immAt(variant.baseLo);
         }
+        const uint32_t sh = variant.shift != JT_NONE ? immAt(variant.shift) : 0;
 
-        case WORDOFFSET_TABLE_0:
+        for (size_t i = 1; i < numTargets; i++)
         {
-            uint32_t off = 0;
-            Instruction instr = irGen->instrsList.at(start_Address);
-            off = instr.ops[2] << 16;
-            instr = irGen->instrsList.at(start_Address + 8); // addi
-            off += instr.ops[2];
-
-            Section* sec = irGen->m_xexImage->getSectionByAddressBounds(off);
-            const uint8_t* m_imageDataPtr = (const uint8_t*)sec->GetImage()->GetMemory() + (sec->GetVirtualOffset() - sec->GetImage()->GetBaseAddress());
-            // uint16_t
-            const uint8_t* offsets = (uint8_t*)m_imageDataPtr + off - sec->GetVirtualOffset();
-            const uint16_t* wordOffsets = reinterpret_cast<const uint16_t*>(offsets);
-
-            instr = irGen->instrsList.at(start_Address + (4 * 4));  // lis
-            uint32_t baseAddr = instr.ops[2] << 16;
-            instr = irGen->instrsList.at(start_Address + (5 * 4));  // addi
-            baseAddr += instr.ops[2];
-
-
-            for (size_t i = 1; i < numTargets; i++)
+            uint32_t entry;
+            switch (variant.entrySize)
             {
-                targets.push_back(baseAddr + ByteSwap16( wordOffsets[i]));
+            case 1:
+                entry = entries[i];
+                break;
+            case 2:
+                entry = ByteSwap16(reinterpret_cast<const uint16_t*>(entries)[i]);
+                break;
+            default:
+                entry = ByteSwap32(reinterpret_cast<const uint32_t*>(entries)[i]);
+                break;
             }
-            break;
-        }
-		
-		break;
-
-        default:
-            break;
+            targets.push_back(baseAddr + (entry << sh));
         }
     }
 
@@ -146,13 +115,13 @@ private:
         {
             Instruction instr = irGen->instrsList.at(start_Address - (i * 4));
             
-            if (strcmp(instr.opcName.c_str(), "bc") == 0 || strcmp(instr.opcName.c_str(), "bca") == 0)
+            if (instr.opcode == OP_bc || instr.opcode == OP_bca)
             {
                 field = instr.ops[1] / 4;
                 uint32_t defaultTarget = instr.address + (instr.ops[2] << 2);
 				targets.push_back(defaultTarget);
             }
-			else if (strcmp(instr.opcName.c_str(), "cmplwi") == 0 && field == instr.ops[0]) // check if the field is the same as the BC
+			else if (instr.opcode == OP_cmplwi && field == instr.ops[0]) // check if the field is the same as the BC
 			{
                 numTargets = instr.ops[3] + 1;
                 break;
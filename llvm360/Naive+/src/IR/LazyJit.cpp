@@ -0,0 +1,462 @@
+#include "LazyJit.h"
+#include "IRGenerator.h"
+#include "IRFunc.h"
+#include "misc/Profiler.h"
+#include "llvm/Config/llvm-config.h"
+#include "llvm/ExecutionEngine/Orc/ExecutionUtils.h"
+#include "llvm/Support/TargetSelect.h"
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+#define JIT_GUEST_SPACE 0x100000000ull // all of the 32 bit guest space, reserved up front
+#define JIT_STACK_ADDRESS 0x70000000   // main thread stack, below the image
+#define JIT_STACK_SIZE (512 * 1024)
+
+#if LLVM_VERSION_MAJOR >= 17
+typedef llvm::orc::ExecutorSymbolDef JitSymbol;
+
+static JitSymbol hostSymbol(const void* pointer)
+{
+    return JitSymbol(llvm::orc::ExecutorAddr::fromPtr(pointer), llvm::JITSymbolFlags::Exported | llvm::JITSymbolFlags::Callable);
+}
+
+static void* symbolPointer(const JitSymbol& symbol)
+{
+    return symbol.getAddress().toPtr<void*>();
+}
+#else
+typedef llvm::JITEvaluatedSymbol JitSymbol;
+
+static JitSymbol hostSymbol(const void* pointer)
+{
+    return JitSymbol(llvm::pointerToJITTargetAddress(pointer), llvm::JITSymbolFlags::Exported | llvm::JITSymbolFlags::Callable);
+}
+
+static void* symbolPointer(const JitSymbol& symbol)
+{
+    return llvm::jitTargetAddressToPointer<void*>(symbol.getAddress());
+}
+#endif
+
+// host view of xenonState, same layout as IRGenerator::XenonStateType
+struct JitXenonState
+{
+    uint64_t LR;
+    uint64_t CTR;
+    uint64_t MSR;
+    uint64_t XER;
+    uint32_t CR;
+    uint64_t RR[32];
+    double FR[32];
+};
+
+typedef void (*GuestFunction)(JitXenonState* ctx, uint32_t lr);
+
+//
+// Runtime functions the generated code calls, C signatures matching IRGenerator::initExtFunc.
+// There is one JIT per process, they reach it through s_activeJit.
+//
+static LazyJit* s_activeJit = nullptr;
+
+static void JitHandleBcctrl(JitXenonState* ctx, uint32_t lr)
+{
+    s_activeJit->dispatch(ctx, lr);
+}
+
+static void JitDebugCallBack(JitXenonState*, uint32_t, const char*)
+{
+}
+
+static void JitDllHack()
+{
+}
+
+static void JitImport(JitXenonState*, uint32_t lr, uint32_t address)
+{
+    s_activeJit->importCalled(address, lr);
+}
+
+// a lazy stub whose function failed to compile was called
+static void JitCompileFailed()
+{
+    printf("JIT: call to a function that failed to compile\n");
+    abort();
+}
+
+static bool reportError(const char* what, llvm::Error error)
+{
+    printf("JIT: %s: %s\n", what, llvm::toString(std::move(error)).c_str());
+    return false;
+}
+
+//
+// One guest function of the guest dylib, emitted and compiled the first time its stub is called
+//
+class LazyJit::GuestFunctionUnit : public llvm::orc::MaterializationUnit
+{
+public:
+    GuestFunctionUnit(LazyJit& jit, IRFunc* func, llvm::orc::SymbolFlagsMap symbols)
+        : llvm::orc::MaterializationUnit(Interface(std::move(symbols), nullptr))
+        , m_jit(jit)
+        , m_func(func)
+    {
+    }
+
+    llvm::StringRef getName() const override { return "GuestFunction"; }
+
+    void materialize(std::unique_ptr<llvm::orc::MaterializationResponsibility> responsibility) override
+    {
+        m_jit.emitFunction(m_func, std::move(responsibility));
+    }
+
+private:
+    void discard(const llvm::orc::JITDylib&, const llvm::orc::SymbolStringPtr&) override
+    {
+    }
+
+    LazyJit& m_jit;
+    IRFunc* m_func;
+};
+
+LazyJit::LazyJit(IRGenerator* irGen, OptLevel level)
+    : m_irGen(irGen)
+    , m_level(level)
+{
+}
+
+LazyJit::~LazyJit()
+{
+    // the code goes before the memory it works on
+    m_jit.reset();
+    if (m_guestMemory != nullptr)
+    {
+#ifdef _WIN32
+        VirtualFree(m_guestMemory, 0, MEM_RELEASE);
+#else
+        munmap(m_guestMemory, JIT_GUEST_SPACE);
+#endif
+    }
+    if (s_activeJit == this)
+        s_activeJit = nullptr;
+}
+
+bool LazyJit::initGuestMemory()
+{
+    const XexImage* xex = m_irGen->m_xexImage;
+#ifdef _WIN32
+    m_guestMemory = (uint8_t*)VirtualAlloc(nullptr, JIT_GUEST_SPACE, MEM_RESERVE, PAGE_NOACCESS);
+    if (m_guestMemory != nullptr &&
+        (VirtualAlloc(m_guestMemory + xex->GetBaseAddress(), xex->GetMemorySize(), MEM_COMMIT, PAGE_READWRITE) == nullptr ||
+        VirtualAlloc(m_guestMemory + JIT_STACK_ADDRESS, JIT_STACK_SIZE, MEM_COMMIT, PAGE_READWRITE) == nullptr))
+    {
+        VirtualFree(m_guestMemory, 0, MEM_RELEASE);
+        m_guestMemory = nullptr;
+    }
+#else
+    // pages only get backed once touched
+    void* memory = mmap(nullptr, JIT_GUEST_SPACE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    m_guestMemory = memory == MAP_FAILED ? nullptr : (uint8_t*)memory;
+#endif
+    if (m_guestMemory == nullptr)
+    {
+        printf("JIT: can't reserve the guest address space\n");
+        return false;
+    }
+
+    memcpy(m_guestMemory + xex->GetBaseAddress(), xex->GetMemory(), xex->GetMemorySize());
+    m_moduleBase = (uint64_t)m_guestMemory;
+    return true;
+}
+
+bool LazyJit::defineRuntime()
+{
+    llvm::orc::JITDylib& main = m_jit->getMainJITDylib();
+    llvm::orc::SymbolMap symbols;
+    symbols[m_jit->mangleAndIntern("HandleBcctrl")] = hostSymbol((const void*)&JitHandleBcctrl);
+    symbols[m_jit->mangleAndIntern("DebugCallBack")] = hostSymbol((const void*)&JitDebugCallBack);
+    symbols[m_jit->mangleAndIntern("dllHack")] = hostSymbol((const void*)&JitDllHack);
+    symbols[m_jit->mangleAndIntern("JitImport")] = hostSymbol((const void*)&JitImport);
+    symbols[m_jit->mangleAndIntern("moduleBase")] = hostSymbol(&m_moduleBase);
+    if (llvm::Error error = main.define(llvm::orc::absoluteSymbols(std::move(symbols))))
+        return reportError("runtime symbols", std::move(error));
+
+    // optimized code can end up calling memcpy / memset and the like
+    auto process = llvm::orc::DynamicLibrarySearchGenerator::GetForCurrentProcess(m_jit->getDataLayout().getGlobalPrefix());
+    if (!process)
+        return reportError("process symbols", process.takeError());
+    main.addGenerator(std::move(*process));
+    return true;
+}
+
+//
+// Imports have nothing behind them here, every one is a small thunk telling JitImport which
+// import got called. They are few and tiny, compiled eagerly as one module.
+//
+bool LazyJit::defineImports()
+{
+    auto context = std::make_unique<llvm::LLVMContext>();
+    auto module = std::make_unique<llvm::Module>("Xenon.imports", *context);
+    module->setDataLayout(m_jit->getDataLayout());
+    module->setTargetTriple(m_jit->getTargetTriple().str());
+
+    llvm::IRBuilder<> builder(*context);
+    llvm::Type* statePtr = builder.getInt8Ty()->getPointerTo();
+    llvm::FunctionType* guestType = llvm::FunctionType::get(builder.getVoidTy(), { statePtr, builder.getInt32Ty() }, false);
+    llvm::FunctionCallee report = module->getOrInsertFunction("JitImport",
+        llvm::FunctionType::get(builder.getVoidTy(), { statePtr, builder.getInt32Ty(), builder.getInt32Ty() }, false));
+
+    for (IRFunc* import : m_imports)
+    {
+        if (module->getFunction(import->symbolName()) != nullptr)
+            continue; // same name imported twice, the first thunk stands for both
+
+        llvm::Function* thunk = llvm::Function::Create(guestType, llvm::Function::ExternalLinkage, import->symbolName(), module.get());
+        builder.SetInsertPoint(llvm::BasicBlock::Create(*context, "entry", thunk));
+        builder.CreateCall(report, { thunk->getArg(0), thunk->getArg(1), builder.getInt32(import->start_address) });
+        builder.CreateRetVoid();
+    }
+
+    if (llvm::Error error = m_jit->addIRModule(llvm::orc::ThreadSafeModule(std::move(module), std::move(context))))
+        return reportError("imports", std::move(error));
+    return true;
+}
+
+//
+// The bodies go in the guest dylib, one materialization unit each, and the main dylib re-exports
+// them through lazy call-through stubs under the same names. The guest dylib links against the
+// main one only, so calls between guest functions go through the stubs too and only what is
+// reached gets compiled.
+//
+bool LazyJit::defineGuestFunctions()
+{
+    const llvm::JITSymbolFlags flags = llvm::JITSymbolFlags::Exported | llvm::JITSymbolFlags::Callable;
+    llvm::orc::SymbolAliasMap aliases;
+    for (IRFunc* func : m_funcs)
+    {
+        const llvm::orc::SymbolStringPtr name = m_jit->mangleAndIntern(func->symbolName());
+        llvm::orc::SymbolFlagsMap symbols;
+        symbols[name] = flags;
+        if (llvm::Error error = m_guestDylib->define(std::make_unique<GuestFunctionUnit>(*this, func, std::move(symbols))))
+            return reportError(func->symbolName().c_str(), std::move(error));
+        aliases[name] = llvm::orc::SymbolAliasMapEntry(name, flags);
+    }
+
+    if (llvm::Error error = m_jit->getMainJITDylib().define(llvm::orc::lazyReexports(*m_callThrough, *m_stubs, *m_guestDylib, std::move(aliases))))
+        return reportError("lazy stubs", std::move(error));
+    return true;
+}
+
+// every guest function starts out as its stub, the imports as their thunk
+bool LazyJit::fillDispatchTable()
+{
+    llvm::orc::SymbolLookupSet names;
+    llvm::DenseSet<llvm::orc::SymbolStringPtr> seen; // imports of the same name share a thunk
+    std::vector<std::pair<uint32_t, llvm::orc::SymbolStringPtr>> entries;
+    for (const std::vector<IRFunc*>* funcs : { &m_funcs, &m_imports })
+    {
+        for (IRFunc* func : *funcs)
+        {
+            entries.push_back({ func->start_address, m_jit->mangleAndIntern(func->symbolName()) });
+            if (seen.insert(entries.back().second).second)
+                names.add(entries.back().second);
+        }
+    }
+
+    auto symbols = m_jit->getExecutionSession().lookup(llvm::orc::makeJITDylibSearchOrder(&m_jit->getMainJITDylib()), names);
+    if (!symbols)
+        return reportError("dispatch table", symbols.takeError());
+
+    m_dispatch.clear();
+    for (const auto& entry : entries)
+    {
+        m_dispatch.push_back({ entry.first, symbolPointer((*symbols)[entry.second]) });
+    }
+    std::sort(m_dispatch.begin(), m_dispatch.end(), [](const DispatchEntry& a, const DispatchEntry& b) { return a.xexAddress < b.xexAddress; });
+    return true;
+}
+
+bool LazyJit::Init()
+{
+    ProfileScope scope("pass", "JitInit");
+    const auto start = std::chrono::high_resolution_clock::now();
+
+    llvm::InitializeNativeTarget();
+    llvm::InitializeNativeTargetAsmPrinter();
+
+    auto jit = llvm::orc::LLJITBuilder().create();
+    if (!jit)
+        return reportError("can't create the JIT", jit.takeError());
+    m_jit = std::move(*jit);
+    s_activeJit = this;
+
+    llvm::orc::ExecutionSession& session = m_jit->getExecutionSession();
+    const llvm::Triple& triple = m_jit->getTargetTriple();
+#if LLVM_VERSION_MAJOR >= 17
+    auto callThrough = llvm::orc::createLocalLazyCallThroughManager(triple, session, llvm::orc::ExecutorAddr::fromPtr(&JitCompileFailed));
+#else
+    auto callThrough = llvm::orc::createLocalLazyCallThroughManager(triple, session, llvm::pointerToJITTargetAddress(&JitCompileFailed));
+#endif
+    if (!callThrough)
+        return reportError("lazy call-through", callThrough.takeError());
+    m_callThrough = std::move(*callThrough);
+
+    auto stubsBuilder = llvm::orc::createLocalIndirectStubsManagerBuilder(triple);
+    if (!stubsBuilder)
+    {
+        printf("JIT: no lazy stubs for %s\n", triple.str().c_str());
+        return false;
+    }
+    m_stubs = stubsBuilder();
+
+    m_guestDylib = &session.createBareJITDylib("guest");
+    m_guestDylib->setLinkOrder(llvm::orc::makeJITDylibSearchOrder(&m_jit->getMainJITDylib(), llvm::orc::JITDylibLookupFlags::MatchAllSymbols), false);
+
+    // the map is shared with the emission of every function, it has to be complete first
+    m_irGen->addCallTargets();
+    m_funcs.clear();
+    m_imports.clear();
+    for (const auto& pair : m_irGen->m_funcBounds.byStart())
+    {
+        IRFunc* func = pair.second;
+        if (func->emission_done)
+        {
+            if (!func->m_symbol.empty())
+                m_imports.push_back(func);
+            continue;
+        }
+        // the entry point body was started in the main module by Initialize, it gets emitted here
+        if (func->m_irFunc != nullptr)
+        {
+            func->m_irFunc->deleteBody();
+            func->resetBody();
+        }
+        m_funcs.push_back(func);
+    }
+
+    if (!initGuestMemory() || !defineRuntime() || !defineImports() || !defineGuestFunctions() || !fillDispatchTable())
+        return false;
+
+    printf("JIT: %zu functions behind lazy stubs, %zu imports, %s, -O%s, ready in %.3f ms\n", m_funcs.size(), m_imports.size(),
+        triple.str().c_str(), OptLevelName(m_level), std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count());
+    return true;
+}
+
+//
+// First call of a stub: the function is emitted the way a partition worker emits, into its own
+// context and module with everything it calls declared, then optimized and compiled.
+//
+void LazyJit::emitFunction(IRFunc* func, std::unique_ptr<llvm::orc::MaterializationResponsibility> responsibility)
+{
+    ProfileScope scope("jit", "CompileFunction", func->start_address);
+
+    auto context = std::make_unique<llvm::LLVMContext>();
+    auto module = std::make_unique<llvm::Module>(func->symbolName(), *context);
+    module->setDataLayout(m_jit->getDataLayout());
+    module->setTargetTriple(m_jit->getTargetTriple().str());
+
+    bool emitted;
+    {
+        llvm::IRBuilder<llvm::NoFolder> builder(*context);
+        IRGenerator worker(m_irGen, module.get(), &builder);
+        worker.InitPartition();
+        func->m_irGen = &worker;
+        worker.initFuncBody(func);
+        emitted = func->EmitFunction();
+        func->resetBody();
+        func->m_irGen = m_irGen;
+    }
+    if (!emitted)
+    {
+        printf("JIT: emission of %08X failed\n", func->start_address);
+        responsibility->failMaterialization();
+        return;
+    }
+
+    ModuleOptimizer optimizer(m_level);
+    optimizer.Run(*module);
+    ProfileCount("functions compiled", 1);
+    m_compiled++;
+
+    const llvm::orc::SymbolStringPtr name = m_jit->mangleAndIntern(func->symbolName());
+    m_jit->getIRCompileLayer().emit(std::move(responsibility), llvm::orc::ThreadSafeModule(std::move(module), std::move(context)));
+
+    // bcctr stops going through the stub once the code is ready
+    const uint32_t address = func->start_address;
+    m_jit->getExecutionSession().lookup(llvm::orc::LookupKind::Static, llvm::orc::makeJITDylibSearchOrder(m_guestDylib, llvm::orc::JITDylibLookupFlags::MatchAllSymbols),
+        llvm::orc::SymbolLookupSet(name), llvm::orc::SymbolState::Ready,
+        [this, address](llvm::Expected<llvm::orc::SymbolMap> symbols)
+        {
+            if (!symbols)
+            {
+                reportError("dispatch patch", symbols.takeError());
+                return;
+            }
+            patchDispatch(address, symbolPointer(symbols->begin()->second));
+        }, llvm::orc::NoDependenciesToRegister);
+}
+
+LazyJit::DispatchEntry* LazyJit::findDispatch(uint32_t address)
+{
+    auto it = std::lower_bound(m_dispatch.begin(), m_dispatch.end(), address,
+        [](const DispatchEntry& entry, uint32_t value) { return entry.xexAddress < value; });
+    return it != m_dispatch.end() && it->xexAddress == address ? &*it : nullptr;
+}
+
+void LazyJit::patchDispatch(uint32_t address, void* compiled)
+{
+    DispatchEntry* entry = findDispatch(address);
+    if (entry != nullptr)
+        entry->funcPtr = compiled;
+}
+
+void LazyJit::dispatch(void* state, uint32_t lr)
+{
+    JitXenonState* ctx = (JitXenonState*)state;
+    const DispatchEntry* entry = findDispatch((uint32_t)ctx->CTR);
+    if (entry == nullptr)
+    {
+        printf("-------- {HandleBcctrl} ERROR: NO FUNCTION AT: %08X \n", (uint32_t)ctx->CTR);
+        return;
+    }
+    ((GuestFunction)entry->funcPtr)(ctx, lr);
+}
+
+void LazyJit::importCalled(uint32_t address, uint32_t lr)
+{
+    auto it = std::lower_bound(m_imports.begin(), m_imports.end(), address,
+        [](const IRFunc* import, uint32_t value) { return import->start_address < value; });
+    const char* name = it != m_imports.end() && (*it)->start_address == address ? (*it)->m_symbol.c_str() : "?";
+    printf("JIT: import %s (%08X) called, lr %08X\n", name, address, lr);
+}
+
+bool LazyJit::Run(uint32_t address)
+{
+    const DispatchEntry* entry = findDispatch(address);
+    if (entry == nullptr)
+    {
+        printf("JIT: no function at %08X\n", address);
+        return false;
+    }
+
+    // what the runtime sets up for the main thread
+    std::unique_ptr<JitXenonState> state = std::make_unique<JitXenonState>();
+    state->LR = 0x3242;
+    state->RR[1] = (JIT_STACK_ADDRESS + JIT_STACK_SIZE) & ~0xF;
+
+    printf("JIT: running %08X\n", address);
+    const auto start = std::chrono::high_resolution_clock::now();
+    {
+        ProfileScope scope("pass", "JitRun");
+        ((GuestFunction)entry->funcPtr)(state.get(), address);
+    }
+    printf("JIT: %08X returned after %.3f ms, %u functions compiled\n", address,
+        std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count(), m_compiled);
+    return true;
+}
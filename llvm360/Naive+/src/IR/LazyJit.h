@@ -0,0 +1,71 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Optimizer.h"
+#include "llvm/ExecutionEngine/Orc/LLJIT.h"
+#include "llvm/ExecutionEngine/Orc/LazyReexports.h"
+#include "llvm/ExecutionEngine/Orc/IndirectionUtils.h"
+
+class IRGenerator;
+class IRFunc;
+
+//
+// Runs the image in process instead of writing it out. Every guest function is a lazy call-through
+// stub in the main JITDylib, the first call emits that one function into its own context (the same
+// way a partition worker does), optimizes it and compiles it, later calls go straight to the code.
+// The dispatch table bcctr goes through starts out with the stubs and gets the compiled address
+// of a function once it is ready.
+//
+// The host side is the bare minimum to run headless: guest memory with the image and a main
+// thread stack, HandleBcctrl over the dispatch table, and imports that only report the call.
+//
+class LazyJit
+{
+public:
+    LazyJit(IRGenerator* irGen, OptLevel level);
+    ~LazyJit();
+
+    bool Init();
+    // calls the guest function at address on the main thread state, false if it couldn't be reached
+    bool Run(uint32_t address);
+
+    // runtime side of the generated code
+    void dispatch(void* state, uint32_t lr);
+    void importCalled(uint32_t address, uint32_t lr);
+
+    inline uint32_t numCompiled() const { return m_compiled; }
+
+private:
+    class GuestFunctionUnit;
+
+    struct DispatchEntry
+    {
+        uint32_t xexAddress;
+        void* funcPtr;
+    };
+
+    bool initGuestMemory();
+    bool defineRuntime();
+    bool defineImports();
+    bool defineGuestFunctions();
+    bool fillDispatchTable();
+    void emitFunction(IRFunc* func, std::unique_ptr<llvm::orc::MaterializationResponsibility> responsibility);
+    void patchDispatch(uint32_t address, void* compiled);
+    DispatchEntry* findDispatch(uint32_t address);
+
+    IRGenerator* m_irGen;
+    OptLevel m_level;
+    std::unique_ptr<llvm::orc::LLJIT> m_jit;
+    std::unique_ptr<llvm::orc::LazyCallThroughManager> m_callThrough;
+    std::unique_ptr<llvm::orc::IndirectStubsManager> m_stubs;
+    llvm::orc::JITDylib* m_guestDylib = nullptr; // the compiled bodies, the main dylib has the stubs
+
+    uint8_t* m_guestMemory = nullptr; // the 4GB guest space, guest address = offset
+    uint64_t m_moduleBase = 0;        // what moduleBase holds for the generated code
+    std::vector<DispatchEntry> m_dispatch; // by address
+    std::vector<IRFunc*> m_funcs;  // JIT compiled, by address
+    std::vector<IRFunc*> m_imports;
+    uint32_t m_compiled = 0;
+};
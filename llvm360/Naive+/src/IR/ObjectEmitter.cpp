@@ -0,0 +1,180 @@
+#include "ObjectEmitter.h"
+#include "misc/Profiler.h"
+#include "llvm/Config/llvm-config.h"
+#include "llvm/CodeGen/ParallelCG.h"
+#include "llvm/MC/TargetRegistry.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/TargetSelect.h"
+#include "llvm/Support/raw_ostream.h"
+#if LLVM_VERSION_MAJOR >= 16
+#include "llvm/TargetParser/Host.h"
+#else
+#include "llvm/Support/Host.h"
+#endif
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+#if LLVM_VERSION_MAJOR >= 18
+#define CODEGEN_OPT_LEVEL(level) llvm::CodeGenOptLevel::level
+#define CODEGEN_OBJECT_FILE llvm::CodeGenFileType::ObjectFile
+#else
+#define CODEGEN_OPT_LEVEL(level) llvm::CodeGenOpt::level
+#define CODEGEN_OBJECT_FILE llvm::CGFT_ObjectFile
+#endif
+
+bool ParseCodegenPreset(const char* text, CodegenPreset& out)
+{
+    static const CodegenPreset presets[] = { CODEGEN_FAST, CODEGEN_DEFAULT, CODEGEN_RELEASE };
+    for (CodegenPreset preset : presets)
+    {
+        if (strcmp(text, CodegenPresetName(preset)) == 0)
+        {
+            out = preset;
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* CodegenPresetName(CodegenPreset preset)
+{
+    switch (preset)
+    {
+    case CODEGEN_NONE: return "none";
+    case CODEGEN_FAST: return "fast";
+    case CODEGEN_DEFAULT: return "default";
+    case CODEGEN_RELEASE: return "release";
+    }
+    return "?";
+}
+
+static void InitializeTargets()
+{
+    static std::once_flag targetsInitialized;
+    std::call_once(targetsInitialized, []()
+    {
+        llvm::InitializeNativeTarget();
+        llvm::InitializeNativeTargetAsmPrinter();
+    });
+}
+
+bool ObjectEmitter::SetModuleTarget(llvm::Module& module)
+{
+    InitializeTargets();
+    const std::string triple = module.getTargetTriple().empty() ? llvm::sys::getDefaultTargetTriple() : module.getTargetTriple();
+    std::string error;
+    std::unique_ptr<llvm::TargetMachine> machine = ObjectEmitter(CODEGEN_DEFAULT).createTargetMachine(triple, error);
+    if (machine == nullptr)
+    {
+        printf("Codegen: no target for %s: %s\n", triple.c_str(), error.c_str());
+        return false;
+    }
+    module.setTargetTriple(triple);
+    module.setDataLayout(machine->createDataLayout());
+    return true;
+}
+
+// one machine per thread, splitCodeGen asks for them from its workers
+std::unique_ptr<llvm::TargetMachine> ObjectEmitter::createTargetMachine(const std::string& triple, std::string& error) const
+{
+    const llvm::Target* target = llvm::TargetRegistry::lookupTarget(triple, error);
+    if (target == nullptr)
+        return nullptr;
+
+    llvm::TargetOptions options;
+    auto level = CODEGEN_OPT_LEVEL(Default);
+    if (m_preset == CODEGEN_FAST)
+        level = CODEGEN_OPT_LEVEL(None);
+    else if (m_preset == CODEGEN_RELEASE)
+        level = CODEGEN_OPT_LEVEL(Aggressive);
+
+    std::unique_ptr<llvm::TargetMachine> machine(target->createTargetMachine(triple, "", "", options, llvm::Reloc::PIC_, {}, level));
+    if (machine == nullptr)
+    {
+        error = "can't create a target machine";
+        return nullptr;
+    }
+    machine->setFastISel(m_preset == CODEGEN_FAST);
+    machine->setO0WantsFastISel(m_preset == CODEGEN_FAST);
+    machine->setGlobalISel(false);
+    return machine;
+}
+
+bool ObjectEmitter::Emit(llvm::Module& module, const std::string& basePath, uint32_t numThreads)
+{
+    if (m_preset == CODEGEN_NONE)
+        return true;
+
+    ProfileScope scope("output", "Codegen");
+    const auto start = std::chrono::high_resolution_clock::now();
+
+    InitializeTargets();
+
+    const std::string triple = module.getTargetTriple().empty() ? llvm::sys::getDefaultTargetTriple() : module.getTargetTriple();
+    module.setTargetTriple(triple);
+
+    // every machine is made up front, splitCodeGen can't be told that one is missing, it asks for
+    // one per output stream
+    numThreads = std::max(1u, numThreads);
+    std::vector<std::unique_ptr<llvm::TargetMachine>> machines;
+    for (uint32_t i = 0; i < numThreads; i++)
+    {
+        std::string error;
+        machines.push_back(createTargetMachine(triple, error));
+        if (machines.back() == nullptr)
+        {
+            printf("Codegen: no target for %s: %s\n", triple.c_str(), error.c_str());
+            return false;
+        }
+    }
+    // the layout the module was optimized with stays, SetModuleTarget gave it the host one
+    if (module.getDataLayout().isDefault())
+        module.setDataLayout(machines[0]->createDataLayout());
+
+    std::vector<std::unique_ptr<llvm::raw_fd_ostream>> files;
+    std::vector<llvm::raw_pwrite_stream*> streams;
+    for (uint32_t i = 0; i < numThreads; i++)
+    {
+        char suffix[16];
+        snprintf(suffix, sizeof(suffix), numThreads == 1 ? ".obj" : "_%02u.obj", i);
+        const std::string path = basePath + suffix;
+
+        std::error_code EC;
+        files.push_back(std::make_unique<llvm::raw_fd_ostream>(path, EC, llvm::sys::fs::OF_None));
+        if (EC)
+        {
+            printf("Codegen: can't write %s: %s\n", path.c_str(), EC.message().c_str());
+            return false;
+        }
+        streams.push_back(files.back().get());
+    }
+
+    std::atomic<uint32_t> nextMachine{ 0 };
+    llvm::splitCodeGen(module, streams, {}, [&]()
+    {
+        const uint32_t index = nextMachine.fetch_add(1);
+        std::string error;
+        return index < machines.size() ? std::move(machines[index]) : createTargetMachine(triple, error);
+    }, CODEGEN_OBJECT_FILE);
+
+    uint64_t bytes = 0;
+    for (const auto& file : files)
+    {
+        bytes += file->tell();
+        file->close();
+        if (file->has_error())
+        {
+            printf("Codegen: writing %s failed\n", basePath.c_str());
+            return false;
+        }
+    }
+    ProfileCount("object bytes written", bytes);
+
+    printf("Codegen: %u object(s) for %s (%s) in %.3f ms\n", numThreads, triple.c_str(), CodegenPresetName(m_preset),
+        std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count());
+    return true;
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "llvm/IR/Module.h"
+#include "llvm/Target/TargetMachine.h"
+
+enum CodegenPreset
+{
+    CODEGEN_NONE,    // IR only, compiled by an external step
+    CODEGEN_FAST,    // fast-isel, no codegen optimization, for iteration builds
+    CODEGEN_DEFAULT,
+    CODEGEN_RELEASE, // selection DAG, aggressive codegen optimization
+};
+
+// "fast", "default", "release", false if unknown
+bool ParseCodegenPreset(const char* text, CodegenPreset& out);
+const char* CodegenPresetName(CodegenPreset preset);
+
+//
+// Native objects straight from the module through a TargetMachine for the host triple (the
+// module keeps its own if it has one). With more than one thread the module is split and the
+// parts are compiled in parallel, one object each: <path>.obj, or <path>_NN.obj when split.
+// Codegen changes the module, it has to be the last thing done with it.
+//
+class ObjectEmitter
+{
+public:
+    explicit ObjectEmitter(CodegenPreset preset) : m_preset(preset) {}
+
+    bool Emit(llvm::Module& module, const std::string& basePath, uint32_t numThreads);
+
+    // host triple (unless the module has one) and its data layout, set before anything is emitted:
+    // the optimizer folds the XenonState GEPs into byte offsets from that layout
+    static bool SetModuleTarget(llvm::Module& module);
+
+private:
+    std::unique_ptr<llvm::TargetMachine> createTargetMachine(const std::string& triple, std::string& error) const;
+
+    CodegenPreset m_preset;
+};
@@ -0,0 +1,242 @@
+#include "Optimizer.h"
+#include "misc/Profiler.h"
+#include "llvm/Config/llvm-config.h"
+#include "llvm/Analysis/ValueTracking.h"
+#include "llvm/IR/IntrinsicInst.h"
+#include "llvm/IR/Verifier.h"
+#include "llvm/Passes/PassBuilder.h"
+#include "llvm/Transforms/Scalar/SROA.h"
+#include "llvm/Transforms/Scalar/EarlyCSE.h"
+#include "llvm/Transforms/Scalar/SimplifyCFG.h"
+#include "llvm/Transforms/Scalar/ADCE.h"
+#include "llvm/Transforms/Utils/Local.h"
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+bool ParseOptLevel(const char* text, OptLevel& out)
+{
+    static const OptLevel levels[] = { OPT_O0, OPT_O1, OPT_O2, OPT_O3, OPT_FAST };
+    for (OptLevel level : levels)
+    {
+        if (strcmp(text, OptLevelName(level)) == 0)
+        {
+            out = level;
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* OptLevelName(OptLevel level)
+{
+    switch (level)
+    {
+    case OPT_O0: return "0";
+    case OPT_O1: return "1";
+    case OPT_O2: return "2";
+    case OPT_O3: return "3";
+    case OPT_FAST: return "fast";
+    }
+    return "?";
+}
+
+// func_XXXXXXXX(XenonState*, i32), the only ones the state is handed to
+static bool isGuestFunction(const llvm::Function& func)
+{
+    return !func.isDeclaration() && func.arg_size() == 2 && func.getArg(0)->getType()->isPointerTy() &&
+        func.getReturnType()->isVoidTy();
+}
+
+static llvm::PreservedAnalyses preservedIf(bool changed)
+{
+    if (!changed)
+        return llvm::PreservedAnalyses::all();
+    llvm::PreservedAnalyses preserved;
+    preserved.preserveSet<llvm::CFGAnalyses>();
+    return preserved;
+}
+
+llvm::PreservedAnalyses XenonStateForwardPass::run(llvm::Function& func, llvm::FunctionAnalysisManager&)
+{
+    if (!isGuestFunction(func))
+        return llvm::PreservedAnalyses::all();
+
+    const llvm::Argument* state = func.getArg(0);
+    const llvm::DataLayout& layout = func.getParent()->getDataLayout();
+
+    // what the block knows about a field: its value, and the store that wrote it if nothing
+    // read it since
+    struct Field
+    {
+        int64_t offset;
+        uint64_t size;
+        llvm::Value* value;
+        llvm::StoreInst* store;
+    };
+    std::vector<Field> fields;
+    std::vector<llvm::Instruction*> dead;
+
+    auto overlaps = [](const Field& field, int64_t offset, uint64_t size)
+    {
+        return field.offset < offset + (int64_t)size && offset < field.offset + (int64_t)field.size;
+    };
+    // constant offset into the state, false for anything else
+    auto stateField = [&](llvm::Value* pointer, int64_t& offset)
+    {
+        offset = 0;
+        return llvm::GetPointerBaseWithConstantOffset(pointer, offset, layout) == state;
+    };
+
+    for (llvm::BasicBlock& block : func)
+    {
+        fields.clear();
+        for (llvm::Instruction& inst : block)
+        {
+            int64_t offset;
+            if (llvm::LoadInst* load = llvm::dyn_cast<llvm::LoadInst>(&inst))
+            {
+                if (!load->isSimple() || !stateField(load->getPointerOperand(), offset))
+                {
+                    if (!load->isSimple() || llvm::getUnderlyingObject(load->getPointerOperand()) == state)
+                        fields.clear(); // somewhere in the state
+                    continue;
+                }
+                const uint64_t size = layout.getTypeStoreSize(load->getType());
+                auto known = std::find_if(fields.begin(), fields.end(), [&](const Field& field)
+                    { return field.offset == offset && field.size == size && field.value->getType() == load->getType(); });
+                if (known != fields.end())
+                {
+                    load->replaceAllUsesWith(known->value);
+                    dead.push_back(load);
+                    continue;
+                }
+                fields.erase(std::remove_if(fields.begin(), fields.end(),
+                    [&](const Field& field) { return overlaps(field, offset, size); }), fields.end());
+                fields.push_back({ offset, size, load, nullptr });
+            }
+            else if (llvm::StoreInst* store = llvm::dyn_cast<llvm::StoreInst>(&inst))
+            {
+                if (!store->isSimple() || !stateField(store->getPointerOperand(), offset))
+                {
+                    if (!store->isSimple() || llvm::getUnderlyingObject(store->getPointerOperand()) == state)
+                        fields.clear();
+                    continue;
+                }
+                const uint64_t size = layout.getTypeStoreSize(store->getValueOperand()->getType());
+                for (const Field& field : fields)
+                {
+                    if (field.store != nullptr && field.offset == offset && field.size == size)
+                        dead.push_back(field.store); // overwritten unread
+                }
+                fields.erase(std::remove_if(fields.begin(), fields.end(),
+                    [&](const Field& field) { return overlaps(field, offset, size); }), fields.end());
+                fields.push_back({ offset, size, store->getValueOperand(), store });
+            }
+            else if (inst.mayReadOrWriteMemory())
+            {
+                fields.clear(); // calls, the callee sees the whole state
+            }
+        }
+    }
+
+    for (llvm::Instruction* inst : dead)
+        inst->eraseFromParent();
+    return preservedIf(!dead.empty());
+}
+
+llvm::PreservedAnalyses BswapPairPass::run(llvm::Function& func, llvm::FunctionAnalysisManager&)
+{
+    std::vector<llvm::IntrinsicInst*> pairs;
+    for (llvm::BasicBlock& block : func)
+    {
+        for (llvm::Instruction& inst : block)
+        {
+            llvm::IntrinsicInst* outer = llvm::dyn_cast<llvm::IntrinsicInst>(&inst);
+            if (outer == nullptr || outer->getIntrinsicID() != llvm::Intrinsic::bswap)
+                continue;
+            llvm::IntrinsicInst* inner = llvm::dyn_cast<llvm::IntrinsicInst>(outer->getArgOperand(0));
+            if (inner != nullptr && inner->getIntrinsicID() == llvm::Intrinsic::bswap)
+                pairs.push_back(outer);
+        }
+    }
+
+    for (llvm::IntrinsicInst* outer : pairs)
+    {
+        llvm::Value* inner = outer->getArgOperand(0);
+        outer->replaceAllUsesWith(llvm::cast<llvm::IntrinsicInst>(inner)->getArgOperand(0));
+        llvm::RecursivelyDeleteTriviallyDeadInstructions(outer);
+    }
+    return preservedIf(!pairs.empty());
+}
+
+bool ModuleOptimizer::Run(llvm::Module& module)
+{
+    if (m_level == OPT_O0)
+        return true;
+
+    ProfileScope scope("pass", "Optimize");
+    const auto start = std::chrono::high_resolution_clock::now();
+
+    std::string errors;
+    llvm::raw_string_ostream errorStream(errors);
+    if (llvm::verifyModule(module, &errorStream))
+    {
+        printf("Optimizer: the module doesn't verify, left unoptimized\n%s\n", errorStream.str().c_str());
+        return false;
+    }
+
+    llvm::LoopAnalysisManager loopAnalyses;
+    llvm::FunctionAnalysisManager functionAnalyses;
+    llvm::CGSCCAnalysisManager cgsccAnalyses;
+    llvm::ModuleAnalysisManager moduleAnalyses;
+    llvm::PassBuilder passBuilder;
+
+    // the recompiler passes go where the default pipelines clean up after instcombine
+    passBuilder.registerPeepholeEPCallback([](llvm::FunctionPassManager& passes, llvm::OptimizationLevel)
+    {
+        passes.addPass(XenonStateForwardPass());
+        passes.addPass(BswapPairPass());
+    });
+
+    passBuilder.registerModuleAnalyses(moduleAnalyses);
+    passBuilder.registerCGSCCAnalyses(cgsccAnalyses);
+    passBuilder.registerFunctionAnalyses(functionAnalyses);
+    passBuilder.registerLoopAnalyses(loopAnalyses);
+    passBuilder.crossRegisterProxies(loopAnalyses, functionAnalyses, cgsccAnalyses, moduleAnalyses);
+
+    llvm::ModulePassManager passes;
+    switch (m_level)
+    {
+    case OPT_FAST:
+    {
+        llvm::FunctionPassManager functionPasses;
+#if LLVM_VERSION_MAJOR >= 16
+        functionPasses.addPass(llvm::SROAPass(llvm::SROAOptions::ModifyCFG));
+#else
+        functionPasses.addPass(llvm::SROAPass());
+#endif
+        functionPasses.addPass(XenonStateForwardPass());
+        functionPasses.addPass(BswapPairPass());
+        functionPasses.addPass(llvm::EarlyCSEPass());
+        functionPasses.addPass(llvm::SimplifyCFGPass());
+        functionPasses.addPass(llvm::ADCEPass());
+        passes.addPass(llvm::createModuleToFunctionPassAdaptor(std::move(functionPasses)));
+        break;
+    }
+    case OPT_O1:
+        passes = passBuilder.buildPerModuleDefaultPipeline(llvm::OptimizationLevel::O1);
+        break;
+    case OPT_O2:
+        passes = passBuilder.buildPerModuleDefaultPipeline(llvm::OptimizationLevel::O2);
+        break;
+    default:
+        passes = passBuilder.buildPerModuleDefaultPipeline(llvm::OptimizationLevel::O3);
+        break;
+    }
+    passes.run(module, moduleAnalyses);
+
+    printf("Optimizer: -O%s in %.3f ms\n", OptLevelName(m_level),
+        std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count());
+    return true;
+}
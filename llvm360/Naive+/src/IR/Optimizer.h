@@ -0,0 +1,50 @@
+#pragma once
+#include <cstdint>
+#include "llvm/IR/Module.h"
+#include "llvm/IR/PassManager.h"
+
+enum OptLevel
+{
+    OPT_O0,   // emitted IR as is
+    OPT_O1,
+    OPT_O2,
+    OPT_O3,
+    OPT_FAST, // SROA, the recompiler passes and cheap cleanups, for iteration builds
+};
+
+// "0".."3" or "fast", false if unknown
+bool ParseOptLevel(const char* text, OptLevel& out);
+const char* OptLevelName(OptLevel level);
+
+//
+// XenonState load forwarding and dead store elimination, inside a block.
+// Guest functions get the state as their first argument and nothing but calls can see it,
+// guest memory never aliases it, which LLVM alias analysis can't know. So a state load
+// after a store / load of the same field takes that value, and a store overwritten before
+// anything read the field is dropped. Calls (other than intrinsics) see the whole state.
+//
+struct XenonStateForwardPass : llvm::PassInfoMixin<XenonStateForwardPass>
+{
+    llvm::PreservedAnalyses run(llvm::Function& func, llvm::FunctionAnalysisManager& analyses);
+};
+
+// bswap(bswap(x)) -> x, what is left of a guest load stored back or compared to a swapped value
+struct BswapPairPass : llvm::PassInfoMixin<BswapPairPass>
+{
+    llvm::PreservedAnalyses run(llvm::Function& func, llvm::FunctionAnalysisManager& analyses);
+};
+
+//
+// Runs the new pass manager pipeline for the level over the whole module. The module is
+// verified first, a broken one is left as is rather than handed to the passes.
+//
+class ModuleOptimizer
+{
+public:
+    explicit ModuleOptimizer(OptLevel level) : m_level(level) {}
+
+    bool Run(llvm::Module& module);
+
+private:
+    OptLevel m_level;
+};
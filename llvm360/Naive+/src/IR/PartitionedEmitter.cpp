@@ -0,0 +1,146 @@
+#include "PartitionedEmitter.h"
+#include "IRGenerator.h"
+#include "IRFunc.h"
+#include "misc/Profiler.h"
+#include <stdio.h>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+
+PartitionedEmitter::PartitionedEmitter(IRGenerator* irGen, uint32_t partitionSize)
+    : m_irGen(irGen)
+    , m_partitionSize(std::max(1u, partitionSize))
+{
+}
+
+void PartitionedEmitter::cutPartitions()
+{
+    m_funcs.clear();
+    m_partitions.clear();
+    for (const auto& pair : m_irGen->m_funcBounds.byStart())
+    {
+        IRFunc* func = pair.second;
+        if (func->emission_done)
+            continue;
+
+        // the entry point body was started in the main module by Initialize, it moves to its
+        // partition and main() keeps calling the declaration left behind
+        if (func->m_irFunc != nullptr)
+        {
+            func->m_irFunc->deleteBody();
+            func->resetBody();
+        }
+        m_funcs.push_back(func);
+    }
+
+    for (size_t first = 0; first < m_funcs.size(); first += m_partitionSize)
+    {
+        m_partitions.push_back({ first, std::min(m_funcs.size(), first + m_partitionSize) });
+    }
+}
+
+std::string PartitionedEmitter::partitionPath(uint32_t partition) const
+{
+    char suffix[16];
+    snprintf(suffix, sizeof(suffix), "_%03u", partition);
+    return m_irGen->m_outputPath + suffix;
+}
+
+bool PartitionedEmitter::emitPartition(uint32_t partition, OptLevel level, CodegenPreset codegen)
+{
+    const auto range = m_partitions[partition];
+    ProfileScope scope("emit", "partition", m_funcs[range.first]->start_address);
+
+    llvm::LLVMContext context;
+    llvm::Module module("Xenon." + std::to_string(partition), context);
+    if (!ObjectEmitter::SetModuleTarget(module))
+        return false;
+    llvm::IRBuilder<llvm::NoFolder> builder(context);
+    IRGenerator worker(m_irGen, &module, &builder);
+    worker.InitPartition();
+    worker.m_outputPath = partitionPath(partition);
+
+    // every definition exists before the calls between them, or they'd get declared first
+    for (size_t i = range.first; i < range.second; i++)
+    {
+        m_funcs[i]->m_irGen = &worker;
+        worker.initFuncBody(m_funcs[i]);
+    }
+
+    bool ret = true;
+    for (size_t i = range.first; i < range.second; i++)
+    {
+        IRFunc* func = m_funcs[i];
+        ProfileScope funcScope("emit", "EmitFunction", func->start_address);
+        if (!func->EmitFunction())
+            ret = false;
+        if (Profiler::Get().enabled())
+        {
+            ProfileCount("functions emitted", 1);
+            ProfileCount("blocks emitted", func->cfg.blocks().size());
+            ProfileCount("IR instructions", func->m_irFunc->getInstructionCount());
+        }
+    }
+
+    ModuleOptimizer optimizer(level);
+    optimizer.Run(module);
+    worker.writeIRtoFile();
+    // already running on every thread, the partition is compiled as one piece
+    ObjectEmitter objects(codegen);
+    if (ret && !objects.Emit(module, worker.m_outputPath, 1))
+        ret = false;
+
+    // nothing may point into the context once it is gone
+    for (size_t i = range.first; i < range.second; i++)
+    {
+        m_funcs[i]->resetBody();
+        m_funcs[i]->m_irGen = m_irGen;
+    }
+    return ret;
+}
+
+bool PartitionedEmitter::Run(uint32_t numThreads, OptLevel level, CodegenPreset codegen)
+{
+    m_irGen->addCallTargets();
+    cutPartitions();
+
+    const uint32_t count = numPartitions();
+    numThreads = std::max(1u, std::min(numThreads, count));
+    printf("Emitting %zu functions in %u partitions (%u threads)\n", m_funcs.size(), count, numThreads);
+
+    std::atomic<uint32_t> nextPartition{ 0 };
+    std::vector<uint8_t> partitionFailed(count, 0);
+
+    auto worker = [&]()
+    {
+        uint32_t partition;
+        while ((partition = nextPartition.fetch_add(1)) < count)
+        {
+            partitionFailed[partition] = !emitPartition(partition, level, codegen);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (uint32_t t = 0; t < numThreads; t++)
+        workers.emplace_back(worker);
+    for (std::thread& t : workers)
+        t.join();
+
+    // the main module sees every guest function as a declaration, for main() and the function array
+    for (IRFunc* func : m_funcs)
+    {
+        func->m_irFunc = llvm::cast<llvm::Function>(m_irGen->m_module->getOrInsertFunction(func->symbolName(), m_irGen->guestFunctionType()).getCallee());
+        func->emission_done = true;
+    }
+
+    bool ret = true;
+    for (uint32_t partition = 0; partition < count; partition++)
+    {
+        if (partitionFailed[partition])
+        {
+            printf("Emission failed in partition %u (%s)\n", partition, partitionPath(partition).c_str());
+            ret = false;
+        }
+    }
+    return ret;
+}
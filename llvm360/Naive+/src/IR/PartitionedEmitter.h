@@ -0,0 +1,37 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Optimizer.h"
+#include "ObjectEmitter.h"
+
+class IRGenerator;
+class IRFunc;
+
+//
+// Parallel emission. The functions, in address order, are cut in partitions of a fixed size and
+// every partition is emitted by a worker into its own context / module, optimized, written as
+// <output>_NNN.bc (.ll) and compiled to <output>_NNN.obj when a codegen preset is set. Calls into
+// other partitions are declarations, the main module keeps the runtime glue and the function
+// array and declares everything, so the outputs link together.
+// The partitions don't depend on the thread count, so neither does the output.
+//
+class PartitionedEmitter
+{
+public:
+    PartitionedEmitter(IRGenerator* irGen, uint32_t partitionSize);
+
+    bool Run(uint32_t numThreads, OptLevel level, CodegenPreset codegen = CODEGEN_NONE);
+
+    inline uint32_t numPartitions() const { return (uint32_t)m_partitions.size(); }
+
+private:
+    void cutPartitions();
+    bool emitPartition(uint32_t partition, OptLevel level, CodegenPreset codegen);
+    std::string partitionPath(uint32_t partition) const;
+
+    IRGenerator* m_irGen;
+    uint32_t m_partitionSize;
+    std::vector<IRFunc*> m_funcs; // to emit, by address
+    std::vector<std::pair<size_t, size_t>> m_partitions; // [first, last) in m_funcs
+};
@@ -1,5 +1,6 @@
 #pragma once
 #include <IR/InstructionEmitter.h>
+#include <algorithm>
 //#include "../InstructionEmitter.h"
 
 //
@@ -9,207 +10,186 @@
 // i can view the register dump via the runtime CpuContext dumper
 //
 
-inline void unit_mfspr(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
+inline Instruction unitInstr(const std::vector<uint32_t>& ops)
 {
 	Instruction instr;
-	instr.ops = ops;
+	instr.opsCount = (uint8_t)std::min<size_t>(ops.size(), INSTR_MAX_OPS);
+	std::copy_n(ops.begin(), instr.opsCount, instr.ops);
+	return instr;
+}
+
+inline void unit_mfspr(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
+{
+	Instruction instr = unitInstr(ops);
 	mfspr_e(instr, func);
 }
 
 inline void unit_stfd(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
+	Instruction instr = unitInstr(ops);
 	stfd_e(instr, func);
 }
 
 inline void unit_stw(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
+	Instruction instr = unitInstr(ops);
 	stw_e(instr, func);
 }
 
 inline void unit_stwu(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
+	Instruction instr = unitInstr(ops);
 	stwu_e(instr, func);
 }
 
 inline void unit_lis(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
+	Instruction instr = unitInstr(ops);
 	addis_e(instr, func);
 }
 
 inline void unit_li(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
+	Instruction instr = unitInstr(ops);
 	addi_e(instr, func);
 }
 
 inline void unit_divw(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
+	Instruction instr = unitInstr(ops);
 	divwx_e(instr, func);
 }
 
 inline void unit_divdu(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
+	Instruction instr = unitInstr(ops);
 	divdu_e(instr, func);
 }
 
 inline void unit_mulli(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
+	Instruction instr = unitInstr(ops);
 	mulli_e(instr, func);
 }
 
 inline void unit_subf(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
+	Instruction instr = unitInstr(ops);
 	subf_e(instr, func);
 }
 
 inline void unit_lwz(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
+	Instruction instr = unitInstr(ops);
 	lwz_e(instr, func);
 }
 
 inline void unit_cmpw(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
+	Instruction instr = unitInstr(ops);
 	cmpw_e(instr, func);
 }
 
 inline void unit_bclr(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
+	Instruction instr = unitInstr(ops);
 	bclr_e(instr, func);
 }
 
 inline void unit_srawi(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
+	Instruction instr = unitInstr(ops);
 	srawi_e(instr, func);
 }
 
 inline void unit_cntlzw(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
+	Instruction instr = unitInstr(ops);
 	cntlzw_e(instr, func);
 }
 
 inline void unit_slw(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
+	Instruction instr = unitInstr(ops);
 	slw_e(instr, func);
 }
 
 inline void unit_mfcr(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
+	Instruction instr = unitInstr(ops);
 	mfcr_e(instr, func);
 }
 
 inline void unit_adde(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
+	Instruction instr = unitInstr(ops);
 	adde_e(instr, func);
 }
 
 inline void unit_addicRC(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
-	instr.opcName = "addicRC";
+	Instruction instr = unitInstr(ops);
+	instr.opcode = OP_addicRC;
 	addic_e(instr, func);
 }
 
 inline void unit_addic(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
+	Instruction instr = unitInstr(ops);
 	addic_e(instr, func);
 }
 
 inline void unit_extsb(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
+	Instruction instr = unitInstr(ops);
 	extsb_e(instr, func);
 }
 
 inline void unit_extsbRC(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
-	instr.opcName = "extsbRC";
+	Instruction instr = unitInstr(ops);
+	instr.opcode = OP_extsbRC;
 	extsb_e(instr, func);
 }
 
 inline void unit_cmplw(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
+	Instruction instr = unitInstr(ops);
 	cmpl_e(instr, func);
 }
 
 inline void unit_rlwimi(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
+	Instruction instr = unitInstr(ops);
 	rlwimi_e(instr, func);
 }
 
 inline void unit_ori(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
+	Instruction instr = unitInstr(ops);
 	ori_e(instr, func);
 }
 
 inline void unit_oris(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
+	Instruction instr = unitInstr(ops);
 	oris_e(instr, func);
 }
 
 inline void unit_rldicl(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
+	Instruction instr = unitInstr(ops);
 	rldicl_e(instr, func);
 }
 
 inline void unit_cmpdi(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
+	Instruction instr = unitInstr(ops);
 	cmpi_e(instr, func);
 }
 
 inline void unit_cmpwi(IRFunc* func, IRGenerator* gen, std::vector<uint32_t> ops)
 {
-	Instruction instr;
-	instr.ops = ops;
+	Instruction instr = unitInstr(ops);
 	cmpi_e(instr, func);
 }
\ No newline at end of file
@@ -171,20 +171,12 @@ void unitTest(IRGenerator* gen)
     unit_divdu(func, gen, { 3, 4, 5, });
 
     unit_bclr(func, gen, {});
-    
-
-    //
-    // DUMP
-    //
-    printf("----IR DUMP----\n\n\n");
-    gen->writeIRtoFile();
 }
 
 
 inline uint32_t recursiveNopCheck(uint32_t address)
 {
-	const char* name = g_irGen->instrsList.at(address).opcName.c_str();
-	if (strcmp(name, "nop") == 0)
+	if (g_irGen->instrsList.at(address).opcode == OP_nop)
 	{
 		recursiveNopCheck(address + 4);
 	}
@@ -201,9 +193,9 @@ void patchImportsFunctions()
         if(import->type == FUNCTION)
         {
             IRFunc* func = g_irGen->getCreateFuncInMap(import->funcImportAddr);
-            func->end_address = func->start_address + 16;
-            llvm::FunctionType* importType = llvm::FunctionType::get(g_irGen->m_builder->getVoidTy(), { g_irGen->XenonStateType->getPointerTo(), g_irGen->m_builder->getInt32Ty() }, false);
-            llvm::Function* importFunc = llvm::Function::Create(importType, llvm::Function::ExternalLinkage,import->name.c_str(),g_irGen->m_module);
+            g_irGen->setFuncEnd(func, func->start_address + 16);
+            func->m_symbol = import->name;
+            llvm::Function* importFunc = llvm::Function::Create(g_irGen->guestFunctionType(), llvm::Function::ExternalLinkage, func->m_symbol, g_irGen->m_module);
             func->m_irFunc = importFunc;
             func->emission_done = true;
         }
@@ -223,6 +215,21 @@ bool pass_Flow()
     patchImportsFunctions();
     flow_pData();  // search pData
 
+    if (flowDiscovery)
+    {
+        FlowDiscovery discovery(g_irGen, loadedXex);
+        discovery.SeedKnownFunctions();
+        discovery.SeedEntryPoint();
+        discovery.SeedExports();
+        discovery.SeedDataPointers();
+        discovery.Run();
+        flow_buildCFGs();
+        return ret;
+    }
+
+    FlowEngine flowEngine(g_irGen, loadedXex);
+    RegisterFlowRules(flowEngine);
+
     for (size_t i = 0; i < loadedXex->GetNumSections(); i++)
     {
         const Section* section = loadedXex->GetSection(i);
@@ -249,35 +256,125 @@ bool pass_Flow()
         // Passes
         //
 
-        flow_promoteSaveRest(address, endAddress);
-
-        // prologue
-        printf("-- prologue search --\n");
-        flow_blJumps(address, endAddress);
-        flow_mfsprProl(address, endAddress);
-        flow_promoteTailProl(address, endAddress);
-        flow_stackInitProl(address, endAddress);
-		flow_dataSecAdr(address, endAddress);
-        // this break stuff :/
-        //flow_aftBclrProl(address, endAddress); // this as last resort, if called before could break everything
-
-        // epilogue
-        printf("\n-- epilogue search --\n");
-        flow_mtsprEpil(address, endAddress);
-        flow_bclrAndTailEpil(address, endAddress);
-
-        printf("\n-- prologue/epilogue second pass --\n");
-        //flow_undiscovered(address, endAddress);
-        flow_fixIfAddresses(address, endAddress);
-        flow_demoteInBounds(address, endAddress);
+        // prologue / epilogue detection, one sweep of the section
+        flowEngine.Run(address, endAddress);
+
 		flow_jumpTables(address, endAddress);
 		flow_detectIncomplete(address, endAddress);
     }
 
+    flow_buildCFGs();
+
     return ret;
 }
 
 
+//
+// decode [start, end) into the instruction store, returns the number of decoded instructions
+// and stops at the first word that can't be decoded (failAddr is set to it, 0 otherwise)
+//
+uint32_t decodeRange(const InstructionDecoder& decoder, uint32_t start, uint32_t end, uint32_t& failAddr)
+{
+    uint32_t count = 0;
+    failAddr = 0;
+    if (start >= end)
+        return 0;
+
+    // words were already byte swapped in bulk by LoadWords
+    const uint32_t* words = g_irGen->instrsList.wordData(start);
+    for (uint32_t address = start; address < end; address += 4) // always 4
+    {
+        Instruction instruction;
+        const auto instructionSize = decoder.DecodeWord(words[(address - start) / 4], address, instruction);
+        if (instructionSize == 0)
+        {
+            failAddr = address;
+            break;
+        }
+
+        // add instruction to the store
+        g_irGen->instrsList.Set(instruction);
+        count++;
+    }
+    return count;
+}
+
+//
+// decode a whole section splitting it into chunks picked up by a pool of workers,
+// every chunk writes to its own slots in the store so the result is the same as the
+// serial decode whatever the thread count is
+//
+bool decodeSectionParallel(const InstructionDecoder& decoder, uint32_t start, uint32_t end, uint32_t numThreads)
+{
+    const uint32_t chunkSize = DECODE_CHUNK_INSTRS * 4;
+    const uint32_t numChunks = (end - start + chunkSize - 1) / chunkSize;
+    numThreads = std::min(numThreads, numChunks);
+
+    std::atomic<uint32_t> nextChunk{ 0 };
+    std::atomic<uint32_t> decoded{ 0 };
+    std::vector<uint32_t> chunkFail(numChunks, 0);
+
+    auto worker = [&]()
+    {
+        uint32_t chunk;
+        while ((chunk = nextChunk.fetch_add(1)) < numChunks)
+        {
+            const uint32_t chunkStart = start + chunk * chunkSize;
+            const uint32_t chunkEnd = std::min(end, chunkStart + chunkSize);
+            ProfileScope scope("decode", "chunk", chunkStart);
+            decoded += decodeRange(decoder, chunkStart, chunkEnd, chunkFail[chunk]);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (uint32_t t = 0; t < numThreads; t++)
+        workers.emplace_back(worker);
+    for (std::thread& t : workers)
+        t.join();
+
+    instCount += decoded;
+
+    // same as the serial decode, everything after the first failure is discarded
+    for (uint32_t chunk = 0; chunk < numChunks; chunk++)
+    {
+        if (chunkFail[chunk] != 0)
+        {
+            printf("Failed to decode instruction at %08X\n", chunkFail[chunk]);
+            instCount -= g_irGen->instrsList.Invalidate(chunkFail[chunk], end);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void printDecoded(uint32_t start, uint32_t end, std::ofstream& outFile)
+{
+    for (const Instruction instruction : g_irGen->instrsList.range(start, end))
+    {
+        if (instruction.opcode == OP_invalid) break; // decoding stopped here
+
+        // print raw PPC decoded instruction + operands
+        std::ostringstream oss;
+        oss << std::hex << std::uppercase << std::setfill('0');
+        oss << std::setw(8) << instruction.address << ":   " << instruction.GetName();
+
+        for (size_t i = 0; i < instruction.opsCount; ++i) {
+            oss << " " << std::setw(2) << static_cast<int>(instruction.ops[i]);
+        }
+
+        std::string output = oss.str();
+        if (printFile) {
+            // Write output to file if printFile is true
+            outFile << output << std::endl;
+        }
+        else {
+            // Print output to the console
+            printf("%s\n", output.c_str());
+        }
+    }
+}
+
 bool pass_Decode()
 {
 
@@ -294,6 +391,8 @@ bool pass_Decode()
         }
     }
 
+    const uint32_t numThreads = decodeThreads != 0 ? decodeThreads : std::max(1u, std::thread::hardware_concurrency());
+
     for (size_t i = 0; i < loadedXex->GetNumSections(); i++)
     {
         const Section* section = loadedXex->GetSection(i);
@@ -302,53 +401,45 @@ bool pass_Decode()
         {
             continue;
         }
-        printf("Decoding Instructions for section %s\n", section->GetName().c_str());
+        printf("Decoding Instructions for section %s (%u threads)\n", section->GetName().c_str(), numThreads);
         // compute code range
         const auto baseAddress = loadedXex->GetBaseAddress();
         const auto sectionBaseAddress = baseAddress + section->GetVirtualOffset();
         auto endAddress = baseAddress + section->GetVirtualOffset() + section->GetVirtualSize();
-        auto address = sectionBaseAddress;
 
         InstructionDecoder decoder(section);
         if (doOverride) endAddress = overAddr;
-        while (address < endAddress)
+        g_irGen->instrsList.AddSection(sectionBaseAddress, endAddress);
+        g_irGen->instrsList.LoadWords(sectionBaseAddress, decoder.m_imageDataPtr, (endAddress - sectionBaseAddress) / 4);
+
+        // decoder throughput, keeps decoder regressions visible
+        const uint32_t countBefore = instCount;
+        const auto decodeStart = std::chrono::high_resolution_clock::now();
+
+        if (numThreads > 1)
         {
-            Instruction instruction;
-            const auto instructionSize = decoder.GetInstructionAt(address, instruction);
-            if (instructionSize == 0)
+            if (!decodeSectionParallel(decoder, sectionBaseAddress, endAddress, numThreads))
+                ret = false;
+        }
+        else
+        {
+            uint32_t failAddr;
+            instCount += decodeRange(decoder, sectionBaseAddress, endAddress, failAddr);
+            if (failAddr != 0)
             {
-                printf("Failed to decode instruction at %08X\n", address);
+                printf("Failed to decode instruction at %08X\n", failAddr);
                 ret = false;
-                break;
             }
+        }
 
-            // add instruction to map
-            g_irGen->instrsList.try_emplace(address, instruction);
-
-            if (printINST) {
-                // print raw PPC decoded instruction + operands
-                std::ostringstream oss;
-                oss << std::hex << std::uppercase << std::setfill('0');
-                oss << std::setw(8) << address << ":   " << instruction.opcName;
-
-                for (size_t i = 0; i < instruction.ops.size(); ++i) {
-                    oss << " " << std::setw(2) << static_cast<int>(instruction.ops.at(i));
-                }
-
-                std::string output = oss.str();
-                if (printFile) {
-                    // Write output to file if printFile is true
-                    outFile << output << std::endl;
-                }
-                else {
-                    // Print output to the console
-                    printf("%s\n", output.c_str());
-                }
-            }
+        const double decodeNs = std::chrono::duration<double, std::nano>(std::chrono::high_resolution_clock::now() - decodeStart).count();
+        const uint32_t decodedCount = instCount - countBefore;
+        ProfileCount("instructions decoded", decodedCount);
+        printf("Decoded %u instructions in %.3f ms (%.3f instr/ns)\n", decodedCount, decodeNs / 1000000.0,
+            decodeNs > 0 ? decodedCount / decodeNs : 0.0);
 
-            address += 4; // always 4
-            instCount++; // instruction count
-        }
+        if (printINST)
+            printDecoded(sectionBaseAddress, endAddress, outFile);
     }
 
     // Close the output file if it was opened
@@ -368,6 +459,13 @@ bool pass_Emit()
 		return true;
 	}
 
+    if (emitPartitions && genLLVMIR)
+    {
+        const uint32_t numThreads = emitThreads != 0 ? emitThreads : std::max(1u, std::thread::hardware_concurrency());
+        PartitionedEmitter emitter(g_irGen, EMIT_PARTITION_FUNCS);
+        return emitter.Run(numThreads, optLevel, codegenPreset);
+    }
+
     bool ret = true;
 
     for (size_t i = 0; i < loadedXex->GetNumSections(); i++)
@@ -391,15 +489,21 @@ bool pass_Emit()
             IRFunc* func = pair.second;
             if (genLLVMIR && !func->emission_done)
             {
+                ProfileScope scope("emit", "EmitFunction", func->start_address);
 				g_irGen->initFuncBody(func);
-				ret = func->EmitFunction();
+				if (!func->EmitFunction())
+                    ret = false;
                 func->emission_done = true;
+                if (Profiler::Get().enabled())
+                {
+                    ProfileCount("functions emitted", 1);
+                    ProfileCount("blocks emitted", func->cfg.blocks().size());
+                    ProfileCount("IR instructions", func->m_irFunc->getInstructionCount());
+                }
             }
         }
     }
 
-    g_irGen->writeIRtoFile();
-
     return ret;
 }
 
@@ -411,10 +515,103 @@ int main(int argc, char* argv[])
 
     if (argc < 2) 
     {
-		LOG_FATAL("MAIN", "Usage: %s <path_to_xex_file>", argv[0]);
+		LOG_FATAL("MAIN", "Usage: %s <path_to_xex_file> [--decode-threads N] [--flow-discovery] [--promote-regs] [--packed-cr] [--annotate-ir] [--emit-partitions] [--emit-threads N] [--cache <file>] [--no-cache] [--profile] [--trace <file>] [-O0|-O1|-O2|-O3|--opt <0-3|fast>] [--ir-text] [--split-sections] [--dump-ir] [--obj <fast|default|release>] [--codegen-threads N] [--jit] [--ignore-hash] [--no-debug-callback]", argv[0]);
         return 1;
     }
 
+    for (int i = 2; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--decode-threads") == 0 || strcmp(argv[i], "-j") == 0) && i + 1 < argc)
+        {
+            decodeThreads = (uint32_t)strtoul(argv[++i], nullptr, 10);
+        }
+        else if (strcmp(argv[i], "--jit") == 0)
+        {
+            jitMode = true;
+        }
+        else if (strcmp(argv[i], "--emit-partitions") == 0)
+        {
+            emitPartitions = true;
+        }
+        else if (strcmp(argv[i], "--emit-threads") == 0 && i + 1 < argc)
+        {
+            emitPartitions = true;
+            emitThreads = (uint32_t)strtoul(argv[++i], nullptr, 10);
+        }
+        else if (strcmp(argv[i], "--flow-discovery") == 0)
+        {
+            flowDiscovery = true;
+        }
+        else if (strcmp(argv[i], "--annotate-ir") == 0)
+        {
+            annotateIR = true;
+        }
+        else if (strcmp(argv[i], "--packed-cr") == 0)
+        {
+            lazyCR = false;
+        }
+        else if (strcmp(argv[i], "--no-debug-callback") == 0)
+        {
+            dbCallBack = false;
+        }
+        else if (strcmp(argv[i], "--ignore-hash") == 0)
+        {
+            ignoreHashMismatch = true;
+        }
+        else if (strcmp(argv[i], "--promote-regs") == 0)
+        {
+            promoteRegisters = true;
+        }
+        else if (strcmp(argv[i], "--cache") == 0 && i + 1 < argc)
+        {
+            analysisCachePath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--no-cache") == 0)
+        {
+            useAnalysisCache = false;
+        }
+        else if (strcmp(argv[i], "--profile") == 0)
+        {
+            Profiler::Get().Enable(true);
+        }
+        else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc)
+        {
+            Profiler::Get().Enable(true);
+            tracePath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--ir-text") == 0)
+        {
+            irText = true;
+        }
+        else if (strcmp(argv[i], "--split-sections") == 0)
+        {
+            splitSections = true;
+        }
+        else if (strcmp(argv[i], "--dump-ir") == 0)
+        {
+            dumpIRConsole = true;
+        }
+        else if (strcmp(argv[i], "--obj") == 0 && i + 1 < argc)
+        {
+            if (!ParseCodegenPreset(argv[++i], codegenPreset))
+                LOG_WARNING("MAIN", "Unknown codegen preset %s", argv[i]);
+        }
+        else if (strcmp(argv[i], "--codegen-threads") == 0 && i + 1 < argc)
+        {
+            codegenThreads = (uint32_t)strtoul(argv[++i], nullptr, 10);
+        }
+        else if (strncmp(argv[i], "-O", 2) == 0 || (strcmp(argv[i], "--opt") == 0 && i + 1 < argc))
+        {
+            const char* level = argv[i][1] == 'O' ? argv[i] + 2 : argv[++i];
+            if (!ParseOptLevel(level, optLevel))
+                LOG_WARNING("MAIN", "Unknown optimization level %s", level);
+        }
+        else
+        {
+            LOG_WARNING("MAIN", "Unknown option %s", argv[i]);
+        }
+    }
+
     std::string txtFilePath = argv[1];
     std::ifstream file(txtFilePath);
 
@@ -441,11 +638,27 @@ int main(int argc, char* argv[])
 
 
     loadedXex = new XexImage(L"LLVMTest1.xex");
-    loadedXex->LoadXex();
+    loadedXex->SetIgnoreHashMismatch(ignoreHashMismatch);
+    if (!loadedXex->LoadXex())
+    {
+        LOG_FATAL("MAIN", "Failed to load %ls", loadedXex->GetPath().c_str());
+        return -1;
+    }
+    // before anything is emitted, the optimizer depends on the layout
+    if (!ObjectEmitter::SetModuleTarget(*mod))
+    {
+        LOG_FATAL("MAIN", "No codegen target for %s", mod->getModuleIdentifier().c_str());
+        return -1;
+    }
     g_irGen = new IRGenerator(loadedXex, mod, &builder);
     g_irGen->Initialize();
     g_irGen->m_dbCallBack = dbCallBack;
     g_irGen->m_dumpIRConsole = dumpIRConsole;
+    g_irGen->m_irText = irText;
+    g_irGen->m_splitSections = splitSections;
+    g_irGen->m_promoteRegs = promoteRegisters;
+    g_irGen->m_lazyCR = lazyCR;
+    g_irGen->m_annotateIR = annotateIR;
 
     printf("\n\n\n");
     auto start = std::chrono::high_resolution_clock::now();
@@ -462,9 +675,8 @@ int main(int argc, char* argv[])
     // so it will slow down but it keeps emission phase good and easier to work with :}
     // 
     // Decode: decode ppc instructions and convert them into a Emitter friendly
-    //         format and add them into an unordered map, the map slow down a bit from
-    //         0.3 seconds to 0.9 seconds but it's useful for later, before i was just
-    //         feeding instruction per instruction to the emitter.
+    //         format and add them into the instruction store, a flat per section array
+    //         indexed by address, so lookups are just an index and scans are sequential.
     // 
     // ContrFlow: TODO, this is a control flow pass that detects part of the visible branching
     //            before emitting and the general skeleton of the executable, This can help with 
@@ -476,46 +688,114 @@ int main(int argc, char* argv[])
     //       e.g Load / Store in .rdata or .data section and more stuff.
     //
 
-    // first recomp pass: Decode xex instructions
+    // the decode and flow results of an image seen before come from the analysis cache,
+    // only the import thunks are patched again since they hold LLVM declarations
+    const uint32_t cacheFlags = (flowDiscovery ? ANALYSIS_FLOW_DISCOVERY : 0) | (doOverride ? ANALYSIS_END_OVERRIDE : 0);
+    const bool cacheEnabled = useAnalysisCache && !isUnitTesting;
+    AnalysisCache analysisCache(g_irGen, loadedXex, cacheFlags, doOverride ? overAddr : 0);
 
-    
-    if (!pass_Decode())
+    bool cacheHit;
     {
-        printf("something went wrong - Pass: DECODE\n");
-        return -1;
+        ProfileScope scope("pass", "LoadCache");
+        cacheHit = cacheEnabled && analysisCache.Load(analysisCachePath, instCount);
+    }
+    if (cacheHit)
+    {
+        patchImportsFunctions();
+        analysisCache.RestoreCFGs();
     }
+    else
+    {
+        // first recomp pass: Decode xex instructions
+        {
+            ProfileScope scope("pass", "Decode");
+            if (!pass_Decode())
+            {
+                printf("something went wrong - Pass: DECODE\n");
+                return -1;
+            }
+        }
 
-    if (!pass_Flow())
+        {
+            ProfileScope scope("pass", "Flow");
+            if (!pass_Flow())
+            {
+                printf("something went wrong - Pass: FLOW\n");
+                return -1;
+            }
+        }
+
+        if (cacheEnabled)
+        {
+            ProfileScope scope("pass", "SaveCache");
+            analysisCache.Save(analysisCachePath, instCount);
+        }
+    }
+    ProfileCount("functions found", g_irGen->m_function_map.size());
+
+    // nothing gets written, the functions are compiled as the image runs into them
+    if (jitMode && !isUnitTesting)
     {
-        printf("something went wrong - Pass: FLOW\n");
-        return -1;
+        LazyJit jit(g_irGen, optLevel);
+        const bool ran = jit.Init() && jit.Run(loadedXex->GetEntryAddress());
+        if (Profiler::Get().enabled())
+        {
+            Profiler::Get().PrintSummary();
+            Profiler::Get().WriteTrace(tracePath);
+        }
+        return ran ? 0 : -1;
     }
 
-    // third recomp pass: Emit IR code
-    if (!pass_Emit())
+    // third recomp pass: Emit IR code, a failure still writes the module
+    bool emitted;
     {
-        printf("something went wrong - Pass: EMIT\n");
-        return -1;
+        ProfileScope scope("pass", "Emit");
+        emitted = pass_Emit();
+        if (!emitted)
+            printf("something went wrong - Pass: EMIT\n");
     }
 
     // sections
-    saveSection("rdata.bin", 0);
-    //saveSection("../bin/Debug/data.bin", 3);
-    exportMetadata("MD.tss");
-    if(!isUnitTesting)
-        g_irGen->exportFunctionArray();
+    {
+        ProfileScope scope("pass", "Export");
+        saveSection("rdata.bin", 0);
+        //saveSection("../bin/Debug/data.bin", 3);
+        exportMetadata("MD.tss");
+        if(!isUnitTesting)
+            g_irGen->exportFunctionArray();
+    }
+
+    // the function array is in, the module is complete
+    if (!isUnitTesting)
+    {
+        ModuleOptimizer optimizer(optLevel);
+        optimizer.Run(*mod);
+    }
 
     // Stop the timer
     auto end = std::chrono::high_resolution_clock::now();
 
     
 	g_irGen->writeIRtoFile();
+    // last, codegen changes the module, nothing to compile if it is broken
+    if (emitted)
+    {
+        const uint32_t numThreads = emitPartitions ? 1 : codegenThreads != 0 ? codegenThreads : std::max(1u, std::thread::hardware_concurrency());
+        ObjectEmitter objects(codegenPreset);
+        objects.Emit(*mod, g_irGen->m_outputPath, numThreads);
+    }
     if(dbCallBack)
         serializeDBMapData(g_irGen->instrsList, "../../bin/Debug/dbMapData.bin");
     // Calculate the duration
     auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
     printf("\n\n\nDecoding process took: %f seconds\n", duration.count() / 1000000.0);
     printf("Decoded %i PPC Instructions\n", instCount);
+
+    if (Profiler::Get().enabled())
+    {
+        Profiler::Get().PrintSummary();
+        Profiler::Get().WriteTrace(tracePath);
+    }
   
 
 
@@ -531,6 +811,8 @@ int main(int argc, char* argv[])
     printf("Live and learn  @ashrindy\n");
     printf("On dog  @.nover.\n");
 	printf("Gotta Go Fast  @neoslyde\n");
+
+    return emitted ? 0 : -1;
 }
 
 
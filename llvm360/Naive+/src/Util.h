@@ -2,17 +2,32 @@
 #include <iostream>
 #include <fstream>
 #include <stdio.h>
+#include <cstdarg>
 #include <sstream>
 #include <iomanip>
 #include "misc/Utils.h"
 #include "Decoder/Instruction.h"
 #include "Decoder/InstructionDecoder.h"
 #include <chrono>
+#include <thread>
+#include <atomic>
+#include <algorithm>
 #include "IR/IRGenerator.h"
 #include <Xex/XexLoader.h>
+#ifdef _WIN32
 #include <conio.h>  // for _kbhit
+#endif
 #include <IR/Unit/UnitTesting.h>
 #include <IR/IRFunc.h>
+#include <IR/JumpTableMatcher.h>
+#include "Flow/FlowEngine.h"
+#include "Flow/FlowDiscovery.h"
+#include "Flow/AnalysisCache.h"
+#include "misc/Profiler.h"
+#include "IR/Optimizer.h"
+#include "IR/PartitionedEmitter.h"
+#include "IR/ObjectEmitter.h"
+#include "IR/LazyJit.h"
 
 
 enum LogLevel
@@ -61,10 +76,31 @@ bool printFile = false;
 bool genLLVMIR = true;
 bool isUnitTesting = false;
 bool doOverride = false; // if it should override the endAddress to debug
-bool dbCallBack = true; // enables debug callbacks, break points etc
+bool dbCallBack = true; // enables debug callbacks, break points etc (--no-debug-callback), XenonState is synced before every instruction
 bool dumpIRConsole = false;
+bool annotateIR = false; // !ppc metadata on the IR of every instruction (--annotate-ir)
 uint32_t overAddr = 0x82060150;
 
+// Options
+uint32_t decodeThreads = 0; // 0 = one per hardware thread, 1 = serial decode
+bool flowDiscovery = false; // recursive descent from the entry point instead of the bounds heuristics
+bool promoteRegisters = false; // guest registers in function locals, flushed to XenonState at calls / returns / debug callbacks
+bool lazyCR = true; // CR bits in function locals, packed at mfcr / calls / returns / debug callbacks (--packed-cr turns it off)
+bool useAnalysisCache = true; // reuse the decode / flow results of an unchanged image
+std::string analysisCachePath = "NaiveAnalysis.cache";
+std::string tracePath = "NaiveTrace.json"; // Chrome trace written when profiling is on (--profile)
+OptLevel optLevel = OPT_FAST; // pipeline run over the module before it is written (-O0..-O3, --opt fast)
+#define DECODE_CHUNK_INSTRS 0x4000 // instructions per decode work item
+bool emitPartitions = false; // emit on worker threads into one module per partition (--emit-partitions)
+uint32_t emitThreads = 0; // partition workers, 0 = one per hardware thread
+#define EMIT_PARTITION_FUNCS 512 // functions per partition, the output doesn't depend on the thread count
+bool irText = false; // output.ll instead of output.bc (--ir-text)
+bool splitSections = false; // one IR file per executable section (--split-sections)
+CodegenPreset codegenPreset = CODEGEN_NONE; // native objects next to the IR (--obj fast|default|release)
+uint32_t codegenThreads = 0; // split module codegen of the single module output, 0 = one per hardware thread
+bool jitMode = false; // run the image in process, functions compiled on first call (--jit)
+bool ignoreHashMismatch = false; // load an image whose compressed blocks fail the hash check (--ignore-hash)
+
 // Benchmark / static analysis
 uint32_t instCount = 0;
 
@@ -121,20 +157,6 @@ struct pDataInfo
     };
 };
 
-IRFunc* isInFuncBound(uint32_t addr)
-{
-    for (const auto& pair : g_irGen->m_function_map)
-    {
-        IRFunc* func = pair.second;
-        if (addr > func->start_address && addr < func->end_address)
-        {
-            return func;
-        }
-    }
-    return nullptr;
-}
-
-
 void flow_pData()
 {
     Section* pData = findSection(".pdata");
@@ -160,7 +182,7 @@ void flow_pData()
             info.info = SwapInstrBytes(*(uint32_t*)(stride + (i * 8) + 4));
 
             IRFunc* func = g_irGen->getCreateFuncInMap(info.funcAddr);
-            func->end_address = (info.funcAddr + (info.funcLength * 4) - 4);
+            g_irGen->setFuncEnd(func, (info.funcAddr + (info.funcLength * 4) - 4));
             infoList.push_back(info);
         }
 
@@ -171,198 +193,6 @@ void flow_pData()
 }
 
 
-//
-// find and promote save/rest to functions
-//
-void flow_promoteSaveRest(uint32_t start, uint32_t end)
-{
-    while (start < end)
-    {
-        if (start == end - 4) break;
-        Instruction instr = g_irGen->instrsList.at(start);
-        Instruction instrAfter = g_irGen->instrsList.at(start + 4);
-
-        //
-        // savegprlr_14
-        //
-        if (instr.instrWord == 0xf9c1ff68)
-        {
-            printf("savegprlr_14 Found at: %08X\n", instr.address);
-            for (size_t i = 14; i < 32; i++)
-            {
-                IRFunc* func = g_irGen->getCreateFuncInMap(instr.address + (i - 14) * 4);
-                func->end_address = func->start_address + ((32 - i) * 4) + 4;
-            }
-        }
-
-        //
-        // restgprlr_14
-        //
-        if (instr.instrWord == 0xe9c1ff68)
-        {
-            printf("restgprlr_14 Found at: %08X\n", instr.address);
-            for (size_t i = 14; i < 32; i++)
-            {
-                IRFunc* func = g_irGen->getCreateFuncInMap(instr.address + (i - 14) * 4);
-                func->end_address = func->start_address + ((32 - i) * 4) + 8;
-            }
-        }
-
-        //
-        // savefpr_14
-        //
-        if (instr.instrWord == 0xd9ccff70)
-        {
-            printf("savefpr_14 Found at: %08X\n", instr.address);
-            DebugBreak();
-        }
-       //
-       // restfpr_14
-       //
-        if (instr.instrWord == 0xc9ccff70)
-        {
-            printf("restfpr_14 Found at: %08X\n", instr.address);
-            DebugBreak();
-        }
-
-        //
-        // savevmx_14
-        //
-        if (instr.instrWord == 0x3960fee0)
-        {
-            if (instrAfter.instrWord == 0x7dcb61ce)
-            {
-                printf("savevmx_14 Found at: %08X\n", instr.address);
-                DebugBreak();
-            }
-        }
-        //
-        // restvmx_14
-        //
-        if (instr.instrWord == 0x3960fee0)
-        {
-            if (instrAfter.instrWord == 0x7dcb60ce)
-            {
-                printf("restvmx_14 Found at: %08X\n", instr.address);
-                DebugBreak();
-            }
-        }
-
-        //
-        // savevmx_64
-        //
-        if (instr.instrWord == 0x3960fc00)
-        {
-            if (instrAfter.instrWord == 0x100b61cb)
-            {
-                printf("savevmx_64 Found at: %08X\n", instr.address);
-                DebugBreak();
-            }
-        }
-        //
-        // restvmx_64
-        //
-        if (instr.instrWord == 0x3960fc00)
-        {
-            if (instrAfter.instrWord == 0x100b60cb)
-            {
-                printf("restvmx_64 Found at: %08X\n", instr.address);
-                DebugBreak();
-            }
-        }
-
-
-        start += 4;
-    }
-}
-
-//
-// this flow pass find every function prologue that are jumped from BL instructions
-//
-void flow_blJumps(uint32_t start, uint32_t end)
-{
-    while (start < end)
-    {
-        Instruction instr = g_irGen->instrsList.at(start);
-        if (strcmp(instr.opcName.c_str(), "bl") == 0)
-        {
-            uint32_t target = instr.address + signExtend(instr.ops[0], 24);
-            if (!g_irGen->isIRFuncinMap(target))
-            {
-                printf("{flow_blJumps} Found new start of function bounds at: %08X\n", target);
-                g_irGen->getCreateFuncInMap(target);
-            }
-        }
-
-        start += 4;
-    }
-}
-
-//
-// this flow pass search every prolouge with mfspr R12 LR 
-// and since i know that if it save the LR the epilogue will restore it with
-// mtspr (check epilogue passes) so i set a metadata flag
-//
-void flow_mfsprProl(uint32_t start, uint32_t end)
-{
-    while (start < end)
-    {
-        Instruction instr = g_irGen->instrsList.at(start);
-        if (instr.instrWord == 0x7d8802a6)              // mfspr r12, LR
-        {
-            if (!g_irGen->isIRFuncinMap(start))
-                printf("{flow_mfsprProl} Found new start of function bounds at: %08X\n", start);
-            IRFunc* func = g_irGen->getCreateFuncInMap(start);
-            func->startW_MFSPR_LR = true;
-        }
-
-        start += 4;
-    }
-}
-
-void flow_stackInitProl(uint32_t start, uint32_t end)
-{
-    bool first = true;
-    while (start < end)
-    {
-        if (start == end - 4) break;
-        Instruction instr = g_irGen->instrsList.at(start);
-        Instruction nextInstr = g_irGen->instrsList.at(start + 4);;
-        Instruction prevInstr;
-        if(first)
-        {
-            prevInstr = Instruction{ start, 0x0, std::string{"nop"}, std::vector<uint32_t>{0, 0, 0} };
-            first = false;
-        }
-        else
-        {
-            prevInstr = g_irGen->instrsList.at(start - 4);
-        }
-        if (strcmp(instr.opcName.c_str(), "stw") == 0 && instr.ops[2] == 1)
-        {
-            if((strcmp(prevInstr.opcName.c_str(), "bclr") == 0 && instr.ops[2] == 1) ||
-                (strcmp(prevInstr.opcName.c_str(), "nop") == 0))
-            {
-                if (!g_irGen->isIRFuncinMap(start))
-                {
-                    printf("{flow_stackInitProl} Found new start of function bounds at: %08X\n", start);
-                    g_irGen->getCreateFuncInMap(start);
-                }
-
-                if ((strcmp(nextInstr.opcName.c_str(), "stw") == 0 && instr.ops[2] == 1))
-                {
-                    start += 8;
-                    continue;
-                }
-            }
-            start += 4;
-            continue;
-        }
-
-        start += 4;
-    }
-}
-
 void flow_aftBclrProl(uint32_t start, uint32_t end)
 {
     while (start < end)
@@ -370,10 +200,10 @@ void flow_aftBclrProl(uint32_t start, uint32_t end)
         if (start == end - 4) break;
         Instruction instr = g_irGen->instrsList.at(start);
         Instruction instrAfter;
-        if (strcmp(instr.opcName.c_str(), "bclr") == 0)
+        if (instr.opcode == OP_bclr)
         {
             instrAfter = g_irGen->instrsList.at(start + 4);
-            if(strcmp(instrAfter.opcName.c_str(), "stw") == 0 && instrAfter.ops[2] == 1)
+            if(instrAfter.opcode == OP_stw && instrAfter.ops[2] == 1)
             {
                 if (g_irGen->isIRFuncinMap(instrAfter.address))
                 {
@@ -391,7 +221,7 @@ void flow_aftBclrProl(uint32_t start, uint32_t end)
             {
                 instrAfter = g_irGen->instrsList.at(off);
                 off += 4;
-            } while (strcmp(instrAfter.opcName.c_str(), "nop") == 0);
+            } while (instrAfter.opcode == OP_nop);
 
             if (g_irGen->isIRFuncinMap(instrAfter.address))
             {
@@ -407,106 +237,6 @@ void flow_aftBclrProl(uint32_t start, uint32_t end)
     }
 }
 
-void flow_promoteTailProl(uint32_t start, uint32_t end)
-{
-    while (start < end)
-    {
-        if (start == end - 4) break;
-        Instruction instr = g_irGen->instrsList.at(start);
-        Instruction instrAfter = g_irGen->instrsList.at(start + 4);
-        if (strcmp(instr.opcName.c_str(), "b") == 0)
-        {
-            uint32_t target = instr.address + signExtend(instr.ops[0], 24);
-			if (strcmp(instrAfter.opcName.c_str(), "nop") == 0 && instr.ops[0] > 0x40) // treshold of distance to be considered a tail call
-            {
-                // promote branched address to function if not in map
-                if (!g_irGen->isIRFuncinMap(target))
-                {
-                    printf("{flow_bclrAndTailEpil} Promoted new function at: %08X\n", target);
-                    IRFunc* func = g_irGen->getCreateFuncInMap(target);
-                    func->is_promotion = true;
-                }
-                start += 4;
-                continue;
-            }
-
-            // it's a tail call 100%
-            if (g_irGen->isIRFuncinMap(start + 4))
-            {
-                // promote branched address to function if not in map
-                if (!g_irGen->isIRFuncinMap(target)) // probably the actual end
-                {
-                    printf("{flow_bclrAndTailEpil} Promoted new function at: %08X\n", target);
-                    g_irGen->getCreateFuncInMap(target);
-                    IRFunc* func = g_irGen->getCreateFuncInMap(target);
-                    func->is_promotion = true;
-                }
-                start += 4;
-                continue;
-            }
-        }
-
-        /*
-        bge LAB_82013ab0
-        b  FUN_820150d0     // Tail call
-        LAB_82013ab0
-        addi  ...*/
-        if (strcmp(instr.opcName.c_str(), "bc") == 0 &&
-            strcmp(instrAfter.opcName.c_str(), "b") == 0)
-        {
-            if (instr.address + (int16_t)(instr.ops[2] << 2) == instrAfter.address + 4)
-            {
-                uint32_t targetAft = instrAfter.address + signExtend(instrAfter.ops[0], 24);
-                if (!g_irGen->isIRFuncinMap(targetAft))
-                {
-                    printf("{flow_bclrAndTailEpil} Promoted new function at: %08X\n", targetAft);
-                    g_irGen->getCreateFuncInMap(targetAft);
-                    IRFunc* func = g_irGen->getCreateFuncInMap(targetAft);
-                    func->is_promotion = true;
-                }
-                start += 4;
-                continue;
-            }
-        }
-
-
-        start += 4;
-    }
-}
-
-void flow_mtsprEpil(uint32_t start, uint32_t end)
-{
-    for (const auto& pair : g_irGen->m_function_map)
-    {
-        IRFunc* func = pair.second;
-        if (func->startW_MFSPR_LR && func->end_address == 0)
-        {
-            start = func->start_address;
-            while (start < end)
-            {
-                Instruction instr = g_irGen->instrsList.at(start);
-                if (instr.instrWord == 0x7d8803a6)            // mtspr LR, r12
-                {
-
-                    // this account for cases where there's some LD instructions
-                    uint32_t off = start + 4;
-                    do
-                    {
-                        instr = g_irGen->instrsList.at(off);
-                        off += 4;
-                    } while (strcmp(instr.opcName.c_str(), "bclr") != 0);
-
-                    func->end_address = off - 4;
-                    printf("{flow_mtsprEpil} Found new end of function bounds at: %08X\n", func->end_address);
-                    break;
-                }
-
-                start += 4;
-            }
-        }
-    }
-}
-
 void flow_undiscovered(uint32_t start, uint32_t end)
 {
     for (const auto& pair : g_irGen->m_function_map)
@@ -516,13 +246,13 @@ void flow_undiscovered(uint32_t start, uint32_t end)
         if(func->end_address != 0)
         {
             uint32_t addr = func->end_address + 4;
-            if (g_irGen->instrsList.find(addr) == g_irGen->instrsList.end()) break;
-            while (strcmp(g_irGen->instrsList.at(addr).opcName.c_str(), "nop") == 0)
+            if (!g_irGen->instrsList.contains(addr)) break;
+            while (g_irGen->instrsList.at(addr).opcode == OP_nop)
             {
                 addr += 4;
             }
 
-            if (!g_irGen->isIRFuncinMap(addr) && isInFuncBound(addr) == nullptr)
+            if (!g_irGen->isIRFuncinMap(addr) && g_irGen->findFuncContaining(addr) == nullptr)
             {
                 printf("{flow_undiscovered} Found new function at: %08X\n", addr);
                 g_irGen->getCreateFuncInMap(addr);
@@ -535,246 +265,83 @@ void flow_undiscovered(uint32_t start, uint32_t end)
         IRFunc* func = pair.second;
         if (func->end_address == 0)
         {
-            uint32_t addr = func->start_address + 4;
-            while (!g_irGen->isIRFuncinMap(addr))
-            {
-                if (addr == end)
-                {
-                    func->end_address = addr;
-                    return;
-                }
-                addr += 4;
-            }
-			func->end_address = addr - 4;
-        }
-    }
-}
-
-void flow_fixIfAddresses(uint32_t start, uint32_t end)
-{
-    for (const auto& pair : g_irGen->m_function_map)
-    {
-
-        IRFunc* func = pair.second;
-        if (func->end_address != 0)
-        {
-
-            
-            if (func->end_address == end) continue;
-            Instruction instr = g_irGen->instrsList.at(func->end_address);
-            if (strcmp(instr.opcName.c_str(), "lwz") == 0 && g_irGen->m_xexImage->getSectionByAddressBounds(instr.instrWord) != nullptr
-                && (((instr.instrWord & 0x82000000) >> 24) & 0x82) == 0x82)
+            // runs up to the next function, or to the end of the section if there is none
+            IRFunc* next = g_irGen->findNextFunc(func->start_address + 4);
+            if (next == nullptr || next->start_address > end)
             {
-                Instruction instrBef;
-                uint32_t off = func->end_address;
-                do
-                {
-                    off -= 4;
-                    instrBef = g_irGen->instrsList.at(off);
-                } while (strcmp(instrBef.opcName.c_str(), "b") != 0 &&
-                         strcmp(instrBef.opcName.c_str(), "bclr") != 0 &&
-                         strcmp(instrBef.opcName.c_str(), "bc") != 0);
-                printf("{flow_fixIfAddresses} Fixed func end at: %08X\n", instrBef.address);
-                func->end_address = instrBef.address;
+                g_irGen->setFuncEnd(func, end);
+                return;
             }
-        }
-    }
-}
-
-void flow_demoteInBounds(uint32_t start, uint32_t end)
-{
-    for (const auto& pair : g_irGen->m_function_map)
-    {
-        IRFunc* func = pair.second;
-        if(func->is_promotion)
-        {
-            IRFunc* out = isInFuncBound(func->start_address);
-            if(out != nullptr)
-            {
-                printf("{flow_demoteInBounds} Func demoted at: %08X\n", func->start_address);
-                g_irGen->m_function_map.erase(func->start_address);
-            }
-        }
-    }
-}
-
-void flow_dataSecAdr(uint32_t start, uint32_t end)
-{
-    Section* pData = findSection(".data");
-
-    if (pData)
-    {
-        const auto baseAddress = loadedXex->GetBaseAddress();
-        const auto sectionBaseAddress = baseAddress + pData->GetVirtualOffset();
-        const auto endAddress = sectionBaseAddress + pData->GetVirtualSize();
-        const auto address = sectionBaseAddress;
-        const uint8_t* m_imageDataPtr = pData->GetImage()->GetMemory() +
-            (pData->GetVirtualOffset() - pData->GetImage()->GetBaseAddress());
-        const uint64_t offset = address - pData->GetVirtualOffset();
-        const uint8_t* stride = m_imageDataPtr + offset;
-
-        const uint32_t size = pData->GetVirtualSize() / 4;
-
-        for (uint32_t i = 0; i < size; i++)
-        {
-			uint32_t val = SwapInstrBytes(*(uint32_t*)(stride + (i * 4)));
-			if (val >= start && val <= end)
-			{
-                IRFunc* func = g_irGen->getCreateFuncInMap(val);
-                printf("Function address found in .Data\n");
-			}
-
+            g_irGen->setFuncEnd(func, next->start_address - 4);
         }
     }
 }
 
 void flow_jumpTables(uint32_t start, uint32_t end)
 {
+    // one sweep of the section for every form, then each function takes the tables inside it
+    std::vector<JTMatch> matches;
+    JumpTableMatcher::Get().Scan(g_irGen->instrsList.opcodeData(start), start, (end - start) / 4, matches);
+    if (matches.empty()) return;
+
+    std::vector<JTMatch> inside;
 	for (const auto& pair : g_irGen->m_function_map)
 	{
 		IRFunc* func = pair.second;
         if (func->emission_done) continue;
-        for (JTVariant variant : jtVariantTypes)
-        {
-			uint32_t addr = func->start_address;
-            while (addr <= func->end_address)
-            {
-                for (size_t i = 0; i < variant.pattern.size(); i++)
-                {
-                    uint32_t off = addr + (i * 4);
-                    Instruction instr = g_irGen->instrsList.at(off);
-                    if(!(strcmp(instr.opcName.c_str(), variant.pattern[i]) == 0))
-                    {
-						break;
-                    }
-					if (i == variant.pattern.size() - 1)
-					{
-						JumpTable* jt = new JumpTable();
-						jt->start_Address = addr;
-						jt->end_Address = addr + (variant.pattern.size() * 4);
-						jt->variant = variant;
-                        jt->ComputeTargets(func->m_irGen);
-						func->jumpTables.push_back(jt);
-						printf("{flow_jumpTables} Found new jump table at: %08X\n", addr);
-						func->has_jumpTable = true;
-					}
-                }
+        if (func->start_address < start || func->start_address >= end) continue;
 
-                addr += 4;
-            }
+        auto it = std::lower_bound(matches.begin(), matches.end(), func->start_address,
+            [](const JTMatch& match, uint32_t address) { return match.address < address; });
+        inside.clear();
+        for (; it != matches.end() && it->address <= func->end_address; ++it)
+        {
+            inside.push_back(*it);
         }
+        // grouped by form like they always were
+        std::stable_sort(inside.begin(), inside.end(), [](const JTMatch& a, const JTMatch& b) { return a.variant < b.variant; });
 
-        
+        for (const JTMatch& match : inside)
+        {
+            const JTVariant& variant = jtVariantTypes[match.variant];
+			JumpTable* jt = new JumpTable();
+			jt->start_Address = match.address;
+			jt->end_Address = match.address + (variant.pattern.size() * 4);
+			jt->variant = variant;
+            jt->ComputeTargets(func->m_irGen);
+			func->jumpTables.push_back(jt);
+			printf("{flow_jumpTables} Found new jump table at: %08X\n", match.address);
+			func->has_jumpTable = true;
+        }
 	}
 }
 
-void flow_detectIncomplete(uint32_t start, uint32_t end)
+//
+// the CFG of every function, once the bounds and the jump tables are final
+//
+void flow_buildCFGs()
 {
+    size_t blocks = 0;
+    size_t loops = 0;
     for (const auto& pair : g_irGen->m_function_map)
     {
         IRFunc* func = pair.second;
-        if (func->end_address == 0)
-        {
-            DebugBreak();
-        }
+        if (func->emission_done) continue;
+        func->cfg.Build(g_irGen, func);
+        blocks += func->cfg.blocks().size();
+        loops += func->cfg.loops().size();
     }
+    printf("%zu blocks and %zu loops in %zu functions\n", blocks, loops, g_irGen->m_function_map.size());
 }
 
-void flow_bclrAndTailEpil(uint32_t start, uint32_t end)
+void flow_detectIncomplete(uint32_t start, uint32_t end)
 {
     for (const auto& pair : g_irGen->m_function_map)
     {
         IRFunc* func = pair.second;
         if (func->end_address == 0)
         {
-            start = func->start_address;
-            while (start < end)
-            {
-                if (start == end - 4)
-                {
-                    func->end_address = start;
-                    printf("{flow_bclrAndTailEpil} Found new end of function bounds at: %08X\n", func->end_address);
-                    break;
-                }
-
-                Instruction instr = g_irGen->instrsList.at(start);
-                Instruction instrAfter = g_irGen->instrsList.at(start + 4);
-                if (strcmp(instr.opcName.c_str(), "b") == 0)
-                {
-
-                    uint32_t target = instr.address + signExtend(instr.ops[0], 24);
-
-                    // check if "instruction" is addr, and fix the end
-                    if (strcmp(instrAfter.opcName.c_str(), "lwz") == 0 && g_irGen->m_xexImage->getSectionByAddressBounds(instrAfter.instrWord) != nullptr
-                        && (((instrAfter.instrWord & 0x82000000) >> 24) & 0x82) == 0x82)
-                    {
-                        func->end_address = instr.address;
-                        printf("{flow_bclrAndTailEpil} Fixed bound becasue of Addr: %08X\n", func->end_address);
-                        break;
-                    }
-
-
-                    if (strcmp(instrAfter.opcName.c_str(), "nop") == 0)
-                    {
-                        uint32_t offf = start + 4;
-                        while (!g_irGen->isIRFuncinMap(offf))
-                        {
-                            offf += 4;
-                        }
-                        func->end_address = offf - 4;
-                        printf("{flow_bclrAndTailEpil} Found new end of function bounds at: %08X\n", func->end_address);
-                        break;
-                    }
-
-                    if (g_irGen->isIRFuncinMap(target))
-                    {
-                        func->end_address = start;
-                        if (g_irGen->isIRFuncinMap(start + 4)) // probably the actual end
-                        {
-                            printf("{flow_bclrAndTailEpil} Found new end of function bounds at: %08X\n", func->end_address);
-                            break;
-                        }
-                    }
-
-                    // if it detects no function in map, it checks if the next address is a function, if it is
-                    // then it's the epilogue of the current one, and is indeed a tail call
-                    if (g_irGen->isIRFuncinMap(start + 4))
-                    {
-                        func->end_address = start;
-                        printf("{flow_bclrAndTailEpil} Found new end of function bounds at: %08X\n", func->end_address);
-                        break;
-                    }
-                }
-
-                if (strcmp(instr.opcName.c_str(), "bclr") == 0)
-                {
-                    // check if "instruction" is addr, and fix the end
-                    if (strcmp(instrAfter.opcName.c_str(), "lwz") == 0 && g_irGen->m_xexImage->getSectionByAddressBounds(instrAfter.instrWord) != nullptr
-                        && (((instrAfter.instrWord & 0x82000000) >> 24) & 0x82) == 0x82)
-                    {
-                        func->end_address = instr.address;
-                        printf("{flow_bclrAndTailEpil} Fixed bound becasue of Addr: %08X\n", func->end_address);
-                        break;
-                    }
-
-                    func->end_address = start;
-                    if (strcmp(instrAfter.opcName.c_str(), "nop") == 0)
-                    {
-                        func->end_address = start;
-                        printf("{flow_bclrAndTailEpil} Found new end of function bounds at: %08X\n", func->end_address);
-                        break;
-                    }
-                    
-                    if (g_irGen->isIRFuncinMap(start + 4))
-                    {
-                        func->end_address = start;
-                        printf("{flow_bclrAndTailEpil} Found new end of function bounds at: %08X\n", func->end_address);
-                        break;
-                    }
-                }
-
-                start += 4;
-            }
+            DebugBreak();
         }
     }
 }
@@ -793,12 +360,12 @@ void flow_stdTailDEpil(uint32_t start, uint32_t end)
             while (start < end)
             {
                 Instruction instr = g_irGen->instrsList.at(start);
-                if (strcmp(instr.opcName.c_str(), "b") == 0)
+                if (instr.opcode == OP_b)
                 {
                     uint32_t target = instr.address + signExtend(instr.ops[0], 24);
                     if(g_irGen->isIRFuncinMap(target))
                     {
-                        func->end_address = start;
+                        g_irGen->setFuncEnd(func, start);
                         if (g_irGen->isIRFuncinMap(start + 4)) // probably the actual end
                         {
                             printf("{flow_stdTailDEpil} Found new end of function bounds at: %08X\n", func->end_address);
@@ -814,7 +381,7 @@ void flow_stdTailDEpil(uint32_t start, uint32_t end)
     }
 }
 
-void serializeDBMapData(const std::unordered_map<uint32_t, Instruction>& map, const std::string& filename)
+void serializeDBMapData(const InstructionStore& store, const std::string& filename)
 {
     std::ofstream ofs(filename, std::ios::binary);
     if (!ofs.is_open()) {
@@ -822,28 +389,24 @@ void serializeDBMapData(const std::unordered_map<uint32_t, Instruction>& map, co
         return;
     }
 
-    // sort by address
-    std::vector<Instruction> sorted_instructions;
-    for (const auto& entry : map) {
-        sorted_instructions.push_back(entry.second);
-    }
-    std::sort(sorted_instructions.begin(), sorted_instructions.end(),
-        [](const Instruction& a, const Instruction& b) { return a.address < b.address; });
+    // the store is already sorted by address
+    for (const InstructionStore::SectionRange& section : store.sections())
+    for (const Instruction inst : store.range(section.base, section.end)) {
+        if (inst.opcode == OP_invalid) continue; // failed to decode
 
-    // serialize
-    for (const Instruction& inst : sorted_instructions) {
         // address, instrWord
         ofs.write(reinterpret_cast<const char*>(&inst.address), sizeof(inst.address));
         ofs.write(reinterpret_cast<const char*>(&inst.instrWord), sizeof(inst.instrWord));
         // opcName
-        uint32_t nameLength = inst.opcName.size();
+        const char* name = inst.GetName();
+        uint32_t nameLength = (uint32_t)strlen(name);
         ofs.write(reinterpret_cast<const char*>(&nameLength), sizeof(nameLength)); 
-        ofs.write(inst.opcName.c_str(), nameLength + 1); 
+        ofs.write(name, nameLength + 1); 
         // operands 
-        uint32_t opsSize = inst.ops.size();
+        uint32_t opsSize = inst.opsCount;
         ofs.write(reinterpret_cast<const char*>(&opsSize), sizeof(opsSize));
         if (opsSize > 0) {
-            ofs.write(reinterpret_cast<const char*>(inst.ops.data()), opsSize * sizeof(uint32_t));
+            ofs.write(reinterpret_cast<const char*>(inst.ops), opsSize * sizeof(uint32_t));
         }
     }
 
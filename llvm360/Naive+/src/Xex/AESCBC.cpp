@@ -0,0 +1,177 @@
+#include "AESCBC.h"
+#include <cstring>
+#include "misc/Utils.h"
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define AESCBC_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#define AESCBC_TARGET(x)
+#else
+#define AESCBC_TARGET(x) __attribute__((target(x)))
+#endif
+#endif
+
+#ifdef AESCBC_X86
+AESCBC_TARGET("aes,sse2")
+static __m128i ExpandStep(__m128i key, __m128i assist) {
+  assist = _mm_shuffle_epi32(assist, 0xFF);
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  return _mm_xor_si128(key, assist);
+}
+
+// AES-128 key expansion, then aesimc on the middle round keys for aesdec
+AESCBC_TARGET("aes,sse2")
+static void ExpandDecryptKeys(const uint8_t key[16], uint8_t decKeys[11][16]) {
+  __m128i enc[11];
+  enc[0] = _mm_loadu_si128((const __m128i *)key);
+  enc[1] = ExpandStep(enc[0], _mm_aeskeygenassist_si128(enc[0], 0x01));
+  enc[2] = ExpandStep(enc[1], _mm_aeskeygenassist_si128(enc[1], 0x02));
+  enc[3] = ExpandStep(enc[2], _mm_aeskeygenassist_si128(enc[2], 0x04));
+  enc[4] = ExpandStep(enc[3], _mm_aeskeygenassist_si128(enc[3], 0x08));
+  enc[5] = ExpandStep(enc[4], _mm_aeskeygenassist_si128(enc[4], 0x10));
+  enc[6] = ExpandStep(enc[5], _mm_aeskeygenassist_si128(enc[5], 0x20));
+  enc[7] = ExpandStep(enc[6], _mm_aeskeygenassist_si128(enc[6], 0x40));
+  enc[8] = ExpandStep(enc[7], _mm_aeskeygenassist_si128(enc[7], 0x80));
+  enc[9] = ExpandStep(enc[8], _mm_aeskeygenassist_si128(enc[8], 0x1B));
+  enc[10] = ExpandStep(enc[9], _mm_aeskeygenassist_si128(enc[9], 0x36));
+
+  _mm_storeu_si128((__m128i *)decKeys[0], enc[10]);
+  for (int i = 1; i < 10; i++)
+    _mm_storeu_si128((__m128i *)decKeys[i], _mm_aesimc_si128(enc[10 - i]));
+  _mm_storeu_si128((__m128i *)decKeys[10], enc[0]);
+}
+
+AESCBC_TARGET("aes,sse2")
+static size_t DecryptAESNI(const uint8_t decKeys[11][16], uint8_t ivec[16], const uint8_t *src, uint8_t *dst, size_t blocks) {
+  __m128i k[11];
+  for (int i = 0; i < 11; i++)
+    k[i] = _mm_loadu_si128((const __m128i *)decKeys[i]);
+  __m128i prev = _mm_loadu_si128((const __m128i *)ivec);
+
+  size_t b = 0;
+  for (; b + 8 <= blocks; b += 8) {
+    __m128i ct[8], x[8];
+    for (int j = 0; j < 8; j++) {
+      ct[j] = _mm_loadu_si128((const __m128i *)(src + (b + j) * 16));
+      x[j] = _mm_xor_si128(ct[j], k[0]);
+    }
+    for (int r = 1; r < 10; r++) {
+      for (int j = 0; j < 8; j++)
+        x[j] = _mm_aesdec_si128(x[j], k[r]);
+    }
+    for (int j = 0; j < 8; j++) {
+      x[j] = _mm_aesdeclast_si128(x[j], k[10]);
+      x[j] = _mm_xor_si128(x[j], j == 0 ? prev : ct[j - 1]);
+      _mm_storeu_si128((__m128i *)(dst + (b + j) * 16), x[j]);
+    }
+    prev = ct[7];
+  }
+
+  for (; b < blocks; b++) {
+    const __m128i ct = _mm_loadu_si128((const __m128i *)(src + b * 16));
+    __m128i x = _mm_xor_si128(ct, k[0]);
+    for (int r = 1; r < 10; r++)
+      x = _mm_aesdec_si128(x, k[r]);
+    x = _mm_xor_si128(_mm_aesdeclast_si128(x, k[10]), prev);
+    _mm_storeu_si128((__m128i *)(dst + b * 16), x);
+    prev = ct;
+  }
+
+  _mm_storeu_si128((__m128i *)ivec, prev);
+  return blocks;
+}
+
+// same as above with two blocks per ymm register, 4 registers in flight
+AESCBC_TARGET("vaes,avx2,aes")
+static size_t DecryptVAES(const uint8_t decKeys[11][16], uint8_t ivec[16], const uint8_t *src, uint8_t *dst, size_t blocks) {
+  __m256i k[11];
+  for (int i = 0; i < 11; i++)
+    k[i] = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)decKeys[i]));
+
+  size_t b = 0;
+  for (; b + 8 <= blocks; b += 8) {
+    __m256i ct[4], prev[4], x[4];
+    for (int j = 0; j < 4; j++) {
+      ct[j] = _mm256_loadu_si256((const __m256i *)(src + (b + j * 2) * 16));
+      x[j] = _mm256_xor_si256(ct[j], k[0]);
+    }
+    // previous ciphertext blocks, block b-1 comes from the chaining state
+    prev[0] = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)ivec)),
+      _mm256_castsi256_si128(ct[0]), 1);
+    for (int j = 1; j < 4; j++)
+      prev[j] = _mm256_loadu_si256((const __m256i *)(src + (b + j * 2 - 1) * 16));
+
+    for (int r = 1; r < 10; r++) {
+      for (int j = 0; j < 4; j++)
+        x[j] = _mm256_aesdec_epi128(x[j], k[r]);
+    }
+    for (int j = 0; j < 4; j++) {
+      x[j] = _mm256_xor_si256(_mm256_aesdeclast_epi128(x[j], k[10]), prev[j]);
+    }
+    // stored after all the loads so src == dst works
+    _mm_storeu_si128((__m128i *)ivec, _mm256_extracti128_si256(ct[3], 1));
+    for (int j = 0; j < 4; j++)
+      _mm256_storeu_si256((__m256i *)(dst + (b + j * 2) * 16), x[j]);
+  }
+  return b;
+}
+#endif
+
+AesCbcDecryptor::AesCbcDecryptor(const uint8_t key[16]) {
+  m_nr = rijndaelKeySetupDec(m_rk, key, 128);
+  m_backend = AES_BACKEND_RIJNDAEL;
+
+#ifdef AESCBC_X86
+  const CpuFeatures &cpu = GetCpuFeatures();
+  if (cpu.aesni) {
+    ExpandDecryptKeys(key, m_decKeys);
+    m_backend = cpu.vaes ? AES_BACKEND_VAES : AES_BACKEND_AESNI;
+  }
+#endif
+}
+
+const char *AesCbcDecryptor::GetBackendName() const {
+  switch (m_backend) {
+  case AES_BACKEND_AESNI:
+    return "AES-NI";
+  case AES_BACKEND_VAES:
+    return "VAES";
+  default:
+    return "Rijndael";
+  }
+}
+
+void AesCbcDecryptor::Decrypt(const uint8_t *src, uint8_t *dst, size_t size) {
+  size_t blocks = size / 16;
+
+#ifdef AESCBC_X86
+  if (m_backend == AES_BACKEND_VAES) {
+    const size_t done = DecryptVAES(m_decKeys, m_ivec, src, dst, blocks);
+    src += done * 16;
+    dst += done * 16;
+    blocks -= done;
+  }
+  if (m_backend != AES_BACKEND_RIJNDAEL) {
+    DecryptAESNI(m_decKeys, m_ivec, src, dst, blocks);
+    return;
+  }
+#endif
+
+  // portable path
+  for (size_t b = 0; b < blocks; b++, src += 16, dst += 16) {
+    uint8_t ct[16];
+    memcpy(ct, src, 16);
+
+    // Decrypt 16 uint8_ts from input -> output.
+    rijndaelDecrypt(m_rk, m_nr, ct, dst);
+
+    // XOR with previous
+    for (uint32_t i = 0; i < 16; i++) {
+      dst[i] ^= m_ivec[i];
+      m_ivec[i] = ct[i];
+    }
+  }
+}
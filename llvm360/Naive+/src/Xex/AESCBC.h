@@ -0,0 +1,42 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include "AES.h"
+
+//
+// AES-128 CBC decryption used for the XEX image data.
+// CBC decryption of block i only needs ciphertext blocks i and i-1, so the AES-NI / VAES
+// kernels keep 8 blocks in flight. The Rijndael tables in AES.cpp stay as the fallback
+// for hosts without AES-NI.
+//
+class AesCbcDecryptor {
+public:
+  enum Backend {
+    AES_BACKEND_RIJNDAEL,
+    AES_BACKEND_AESNI,
+    AES_BACKEND_VAES,
+  };
+
+  // iv is zero for XEX images
+  AesCbcDecryptor(const uint8_t key[16]);
+
+  // decrypt `size` bytes (whole 16 byte blocks only), the chaining state carries over
+  // between calls. src and dst may be the same buffer
+  void Decrypt(const uint8_t *src, uint8_t *dst, size_t size);
+
+  inline Backend GetBackend() const {
+    return m_backend;
+  }
+  const char *GetBackendName() const;
+
+private:
+  Backend m_backend;
+  alignas(16) uint8_t m_ivec[16] = {};
+
+  // Rijndael fallback
+  u32 m_rk[4 * (MAXNR + 1)];
+  int m_nr = 0;
+
+  // AES-NI decryption round keys (equivalent inverse cipher order)
+  alignas(16) uint8_t m_decKeys[11][16];
+};
@@ -1,2600 +1,2622 @@
 #pragma once
 #include "Xex/XexLoader.h"
+#include <array>
+#include <cstring>
 
-std::vector<Import*> import_table;
-
-static inline void loadImport(XboxLibrary lib, std::string name, uint32_t ordinal, ImportType type)
+//
+// Known exports of the system libraries.
+// The table is a constexpr array, per library ordinal indices are built from it at compile time
+// so startup allocates nothing and a lookup is a single array read.
+//
+struct KnownImport
 {
-    Import* imp = new Import(lib, type, name, ordinal);
-    import_table.push_back(imp);
-}
-
-#define LOAD_IMPORT(lib, ord, type, name) loadImport(lib, name, ord, type)
-
-
-static inline Import* findImport_FromLib(std::string libName, uint32_t ordinal)
-{
-    bool libFound = false;
-    bool ordFound = false;
-
-    if(strcmp(libName.c_str(), "xboxkrnl.exe") == 0)
-    {
-        for (Import* imp : import_table)
-        {
-            if (imp->lib == XboxKrnl)
-            {
-                libFound = true;
-
-                if(imp->ordinal == ordinal)
-                {
-                    ordFound = true;
-                    return imp;
-                }
-            }
-        }
-    }
-
-    if (strcmp(libName.c_str(), "xam.xex") == 0)
-    {
-        for (Import* imp : import_table)
-        {
-            if (imp->lib == Xam)
-            {
-                libFound = true;
+    XboxLibrary lib;
+    uint16_t ordinal;
+    ImportType type;
+    const char* name;
+};
 
-                if (imp->ordinal == ordinal)
-                {
-                    ordFound = true;
-                    return imp;
-                }
-            }
-        }
-    }
-
-    if(!libFound)
-    {
-        printf("No Lib with name: s% found\n", libName);
-        return nullptr;
-    }
+#define LOAD_IMPORT(lib, ord, type, name) KnownImport{ lib, ord, type, name },
 
-    if (!ordFound)
-    {
-        printf("No Import in Lib: s% with ordinal i% found\n", libName.c_str(), ordinal);
-        return nullptr;
-    }
-}
-
-
-static inline void initImportTable()
+static constexpr KnownImport s_knownImports[] =
 {
     //
     // Xapi
     // 
 
-    LOAD_IMPORT(Xapi, 0x0001, VARIABLE, "XapiProcessHeap");
-    LOAD_IMPORT(Xapi, 0x0002, VARIABLE, "_locktable");
-    LOAD_IMPORT(Xapi, 0x0003, VARIABLE, "__tlsindexXapi");
-    LOAD_IMPORT(Xapi, 0x0004, FUNCTION, "XapiTermHeapNoop");
-    LOAD_IMPORT(Xapi, 0x0005, VARIABLE, "XapiDebugHeap");
+    LOAD_IMPORT(Xapi, 0x0001, VARIABLE, "XapiProcessHeap")
+    LOAD_IMPORT(Xapi, 0x0002, VARIABLE, "_locktable")
+    LOAD_IMPORT(Xapi, 0x0003, VARIABLE, "__tlsindexXapi")
+    LOAD_IMPORT(Xapi, 0x0004, FUNCTION, "XapiTermHeapNoop")
+    LOAD_IMPORT(Xapi, 0x0005, VARIABLE, "XapiDebugHeap")
 
     //
     // Xam
     //
 
-    LOAD_IMPORT(Xam, 0x0001, FUNCTION, "NetDll_WSAStartup");
-    LOAD_IMPORT(Xam, 0x0002, FUNCTION, "NetDll_WSACleanup");
-    LOAD_IMPORT(Xam, 0x0003, FUNCTION, "NetDll_socket");
-    LOAD_IMPORT(Xam, 0x0004, FUNCTION, "NetDll_closesocket");
-    LOAD_IMPORT(Xam, 0x0005, FUNCTION, "NetDll_shutdown");
-    LOAD_IMPORT(Xam, 0x0006, FUNCTION, "NetDll_ioctlsocket");
-    LOAD_IMPORT(Xam, 0x0007, FUNCTION, "NetDll_setsockopt");
-    LOAD_IMPORT(Xam, 0x0008, FUNCTION, "NetDll_getsockopt");
-    LOAD_IMPORT(Xam, 0x0009, FUNCTION, "NetDll_getsockname");
-    LOAD_IMPORT(Xam, 0x000A, FUNCTION, "NetDll_getpeername");
-    LOAD_IMPORT(Xam, 0x000B, FUNCTION, "NetDll_bind");
-    LOAD_IMPORT(Xam, 0x000C, FUNCTION, "NetDll_connect");
-    LOAD_IMPORT(Xam, 0x000D, FUNCTION, "NetDll_listen");
-    LOAD_IMPORT(Xam, 0x000E, FUNCTION, "NetDll_accept");
-    LOAD_IMPORT(Xam, 0x000F, FUNCTION, "NetDll_select");
-    LOAD_IMPORT(Xam, 0x0010, FUNCTION, "NetDll_WSAGetOverlappedResult");
-    LOAD_IMPORT(Xam, 0x0011, FUNCTION, "NetDll_WSACancelOverlappedIO");
-    LOAD_IMPORT(Xam, 0x0012, FUNCTION, "NetDll_recv");
-    LOAD_IMPORT(Xam, 0x0013, FUNCTION, "NetDll_WSARecv");
-    LOAD_IMPORT(Xam, 0x0014, FUNCTION, "NetDll_recvfrom");
-    LOAD_IMPORT(Xam, 0x0015, FUNCTION, "NetDll_WSARecvFrom");
-    LOAD_IMPORT(Xam, 0x0016, FUNCTION, "NetDll_send");
-    LOAD_IMPORT(Xam, 0x0017, FUNCTION, "NetDll_WSASend");
-    LOAD_IMPORT(Xam, 0x0018, FUNCTION, "NetDll_sendto");
-    LOAD_IMPORT(Xam, 0x0019, FUNCTION, "NetDll_WSASendTo");
-    LOAD_IMPORT(Xam, 0x001A, FUNCTION, "NetDll_inet_addr");
-    LOAD_IMPORT(Xam, 0x001B, FUNCTION, "NetDll_WSAGetLastError");
-    LOAD_IMPORT(Xam, 0x001C, FUNCTION, "NetDll_WSASetLastError");
-    LOAD_IMPORT(Xam, 0x001D, FUNCTION, "NetDll_WSACreateEvent");
-    LOAD_IMPORT(Xam, 0x001E, FUNCTION, "NetDll_WSACloseEvent");
-    LOAD_IMPORT(Xam, 0x001F, FUNCTION, "NetDll_WSASetEvent");
-    LOAD_IMPORT(Xam, 0x0020, FUNCTION, "NetDll_WSAResetEvent");
-    LOAD_IMPORT(Xam, 0x0021, FUNCTION, "NetDll_WSAWaitForMultipleEvents");
-    LOAD_IMPORT(Xam, 0x0022, FUNCTION, "NetDll___WSAFDIsSet");
-    LOAD_IMPORT(Xam, 0x0023, FUNCTION, "NetDll_WSAEventSelect");
-    LOAD_IMPORT(Xam, 0x0024, FUNCTION, "NetDll_WSAStartupEx");
-    LOAD_IMPORT(Xam, 0x0033, FUNCTION, "NetDll_XNetStartup");
-    LOAD_IMPORT(Xam, 0x0034, FUNCTION, "NetDll_XNetCleanup");
-    LOAD_IMPORT(Xam, 0x0035, FUNCTION, "NetDll_XNetRandom");
-    LOAD_IMPORT(Xam, 0x0036, FUNCTION, "NetDll_XNetCreateKey");
-    LOAD_IMPORT(Xam, 0x0037, FUNCTION, "NetDll_XNetRegisterKey");
-    LOAD_IMPORT(Xam, 0x0038, FUNCTION, "NetDll_XNetUnregisterKey");
-    LOAD_IMPORT(Xam, 0x0039, FUNCTION, "NetDll_XNetXnAddrToInAddr");
-    LOAD_IMPORT(Xam, 0x003A, FUNCTION, "NetDll_XNetServerToInAddr");
-    LOAD_IMPORT(Xam, 0x003B, FUNCTION, "NetDll_XNetTsAddrToInAddr");
-    LOAD_IMPORT(Xam, 0x003C, FUNCTION, "NetDll_XNetInAddrToXnAddr");
-    LOAD_IMPORT(Xam, 0x003D, FUNCTION, "NetDll_XNetInAddrToServer");
-    LOAD_IMPORT(Xam, 0x003E, FUNCTION, "NetDll_XNetInAddrToString");
-    LOAD_IMPORT(Xam, 0x003F, FUNCTION, "NetDll_XNetUnregisterInAddr");
-    LOAD_IMPORT(Xam, 0x0040, FUNCTION, "NetDll_XNetXnAddrToMachineId");
-    LOAD_IMPORT(Xam, 0x0041, FUNCTION, "NetDll_XNetConnect");
-    LOAD_IMPORT(Xam, 0x0042, FUNCTION, "NetDll_XNetGetConnectStatus");
-    LOAD_IMPORT(Xam, 0x0043, FUNCTION, "NetDll_XNetDnsLookup");
-    LOAD_IMPORT(Xam, 0x0044, FUNCTION, "NetDll_XNetDnsRelease");
-    LOAD_IMPORT(Xam, 0x0045, FUNCTION, "NetDll_XNetQosListen");
-    LOAD_IMPORT(Xam, 0x0046, FUNCTION, "NetDll_XNetQosLookup");
-    LOAD_IMPORT(Xam, 0x0047, FUNCTION, "NetDll_XNetQosServiceLookup");
-    LOAD_IMPORT(Xam, 0x0048, FUNCTION, "NetDll_XNetQosRelease");
-    LOAD_IMPORT(Xam, 0x0049, FUNCTION, "NetDll_XNetGetTitleXnAddr");
-    LOAD_IMPORT(Xam, 0x004A, FUNCTION, "NetDll_XNetGetDebugXnAddr");
-    LOAD_IMPORT(Xam, 0x004B, FUNCTION, "NetDll_XNetGetEthernetLinkStatus");
-    LOAD_IMPORT(Xam, 0x004C, FUNCTION, "NetDll_XNetGetBroadcastVersionStatus");
-    LOAD_IMPORT(Xam, 0x004D, FUNCTION, "NetDll_XNetQosGetListenStats");
-    LOAD_IMPORT(Xam, 0x004E, FUNCTION, "NetDll_XNetGetOpt");
-    LOAD_IMPORT(Xam, 0x004F, FUNCTION, "NetDll_XNetSetOpt");
-    LOAD_IMPORT(Xam, 0x0050, FUNCTION, "NetDll_XNetStartupEx");
-    LOAD_IMPORT(Xam, 0x0051, FUNCTION, "NetDll_XNetReplaceKey");
-    LOAD_IMPORT(Xam, 0x0052, FUNCTION, "NetDll_XNetGetXnAddrPlatform");
-    LOAD_IMPORT(Xam, 0x0053, FUNCTION, "NetDll_XNetGetSystemLinkPort");
-    LOAD_IMPORT(Xam, 0x0054, FUNCTION, "NetDll_XNetSetSystemLinkPort");
-    LOAD_IMPORT(Xam, 0x0065, FUNCTION, "NetDll_XnpLoadConfigParams");
-    LOAD_IMPORT(Xam, 0x0066, FUNCTION, "NetDll_XnpSaveConfigParams");
-    LOAD_IMPORT(Xam, 0x0067, FUNCTION, "NetDll_XnpConfigUPnP");
-    LOAD_IMPORT(Xam, 0x0068, FUNCTION, "NetDll_XnpConfig");
-    LOAD_IMPORT(Xam, 0x0069, FUNCTION, "NetDll_XnpGetConfigStatus");
-    LOAD_IMPORT(Xam, 0x006A, FUNCTION, "NetDll_XnpLoadMachineAccount");
-    LOAD_IMPORT(Xam, 0x006B, FUNCTION, "NetDll_XnpSaveMachineAccount");
-    LOAD_IMPORT(Xam, 0x006C, FUNCTION, "NetDll_XnpCapture");
-    LOAD_IMPORT(Xam, 0x006D, FUNCTION, "NetDll_XnpEthernetInterceptSetCallbacks");
-    LOAD_IMPORT(Xam, 0x006E, FUNCTION, "NetDll_XnpEthernetInterceptXmit");
-    LOAD_IMPORT(Xam, 0x006F, FUNCTION, "NetDll_XnpEthernetInterceptRecv");
-    LOAD_IMPORT(Xam, 0x0070, FUNCTION, "NetDll_XnpLogonGetStatus");
-    LOAD_IMPORT(Xam, 0x0071, FUNCTION, "NetDll_XnpLogonGetQFlags");
-    LOAD_IMPORT(Xam, 0x0072, FUNCTION, "NetDll_XnpLogonSetQFlags");
-    LOAD_IMPORT(Xam, 0x0073, FUNCTION, "NetDll_XnpLogonSetQEvent");
-    LOAD_IMPORT(Xam, 0x0074, FUNCTION, "NetDll_XnpLogonClearQEvent");
-    LOAD_IMPORT(Xam, 0x0075, FUNCTION, "NetDll_XnpLogonGetQVals");
-    LOAD_IMPORT(Xam, 0x0076, FUNCTION, "NetDll_XnpLogonSetQVals");
-    LOAD_IMPORT(Xam, 0x0077, FUNCTION, "NetDll_XnpLogonSetPState");
-    LOAD_IMPORT(Xam, 0x0078, FUNCTION, "NetDll_XnpGetVlanXboxName");
-    LOAD_IMPORT(Xam, 0x0079, FUNCTION, "NetDll_XnpSetVlanXboxName");
-    LOAD_IMPORT(Xam, 0x007A, FUNCTION, "NetDll_XnpGetActiveSocketList");
-    LOAD_IMPORT(Xam, 0x007B, FUNCTION, "NetDll_XnpNoteSystemTime");
-    LOAD_IMPORT(Xam, 0x007C, FUNCTION, "NetDll_XnpRegisterKeyForCallerType");
-    LOAD_IMPORT(Xam, 0x007D, FUNCTION, "NetDll_XnpUnregisterKeyForCallerType");
-    LOAD_IMPORT(Xam, 0x007E, FUNCTION, "NetDll_XnpLogonGetChallenge");
-    LOAD_IMPORT(Xam, 0x007F, FUNCTION, "NetDll_XnpLogonClearChallenge");
-    LOAD_IMPORT(Xam, 0x0080, FUNCTION, "NetDll_XnpLogonSetChallengeResponse");
-    LOAD_IMPORT(Xam, 0x0081, FUNCTION, "NetDll_XnpGetSecAssocList");
-    LOAD_IMPORT(Xam, 0x0082, FUNCTION, "NetDll_XnpGetKeyList");
-    LOAD_IMPORT(Xam, 0x0083, FUNCTION, "NetDll_XnpGetQosLookupList");
-    LOAD_IMPORT(Xam, 0x0084, FUNCTION, "NetDll_XnpPersistTitleState");
-    LOAD_IMPORT(Xam, 0x0085, FUNCTION, "NetDll_XnpReplaceKeyForCallerType");
-    LOAD_IMPORT(Xam, 0x0086, FUNCTION, "NetDll_XnpEthernetInterceptSetExtendedReceiveCallback");
-    LOAD_IMPORT(Xam, 0x0087, FUNCTION, "NetDll_XnpQosHistoryLoad");
-    LOAD_IMPORT(Xam, 0x0088, FUNCTION, "NetDll_XnpQosHistorySaveMeasurements");
-    LOAD_IMPORT(Xam, 0x0089, FUNCTION, "NetDll_XnpQosHistoryGetEntries");
-    LOAD_IMPORT(Xam, 0x008A, FUNCTION, "NetDll_XnpQosHistoryGetAggregateMeasurement");
-    LOAD_IMPORT(Xam, 0x008B, FUNCTION, "NetDll_XnpToolSetCallbacks");
-    LOAD_IMPORT(Xam, 0x008C, FUNCTION, "NetDll_XnpToolIpProxyInject");
-    LOAD_IMPORT(Xam, 0x008D, FUNCTION, "NetDll_XnpUpdateConfigParams");
-    LOAD_IMPORT(Xam, 0x008E, FUNCTION, "NetDll_XnpEthernetInterceptXmitAsIp");
-    LOAD_IMPORT(Xam, 0x0097, FUNCTION, "NetDll_XmlDownloadStart");
-    LOAD_IMPORT(Xam, 0x0098, FUNCTION, "NetDll_XmlDownloadContinue");
-    LOAD_IMPORT(Xam, 0x0099, FUNCTION, "NetDll_XmlDownloadStop");
-    LOAD_IMPORT(Xam, 0x009A, FUNCTION, "NetDll_XmlDownloadGetParseTime");
-    LOAD_IMPORT(Xam, 0x009B, FUNCTION, "NetDll_XmlDownloadGetReceivedDataSize");
-    LOAD_IMPORT(Xam, 0x00C6, FUNCTION, "XnpGetXwppMemoryLogSnapshot");
-    LOAD_IMPORT(Xam, 0x00C7, FUNCTION, "XnpGetXwppRuntimeFilter");
-    LOAD_IMPORT(Xam, 0x00C9, FUNCTION, "NetDll_XHttpStartup");
-    LOAD_IMPORT(Xam, 0x00CA, FUNCTION, "NetDll_XHttpShutdown");
-    LOAD_IMPORT(Xam, 0x00CB, FUNCTION, "NetDll_XHttpOpen");
-    LOAD_IMPORT(Xam, 0x00CC, FUNCTION, "NetDll_XHttpCloseHandle");
-    LOAD_IMPORT(Xam, 0x00CD, FUNCTION, "NetDll_XHttpConnect");
-    LOAD_IMPORT(Xam, 0x00CE, FUNCTION, "NetDll_XHttpSetStatusCallback");
-    LOAD_IMPORT(Xam, 0x00CF, FUNCTION, "NetDll_XHttpOpenRequest");
-    LOAD_IMPORT(Xam, 0x00D0, FUNCTION, "NetDll_XHttpOpenRequestUsingMemory");
-    LOAD_IMPORT(Xam, 0x00D1, FUNCTION, "NetDll_XHttpSendRequest");
-    LOAD_IMPORT(Xam, 0x00D2, FUNCTION, "NetDll_XHttpReceiveResponse");
-    LOAD_IMPORT(Xam, 0x00D3, FUNCTION, "NetDll_XHttpQueryHeaders");
-    LOAD_IMPORT(Xam, 0x00D4, FUNCTION, "NetDll_XHttpReadData");
-    LOAD_IMPORT(Xam, 0x00D5, FUNCTION, "NetDll_XHttpWriteData");
-    LOAD_IMPORT(Xam, 0x00D6, FUNCTION, "NetDll_XHttpQueryOption");
-    LOAD_IMPORT(Xam, 0x00D7, FUNCTION, "NetDll_XHttpSetOption");
-    LOAD_IMPORT(Xam, 0x00D8, FUNCTION, "NetDll_XHttpDoWork");
-    LOAD_IMPORT(Xam, 0x00D9, FUNCTION, "NetDll_XHttpSetCredentials");
-    LOAD_IMPORT(Xam, 0x00DA, FUNCTION, "NetDll_XHttpQueryAuthSchemes");
-    LOAD_IMPORT(Xam, 0x00DB, FUNCTION, "NetDll_XHttpCrackUrl");
-    LOAD_IMPORT(Xam, 0x00FB, FUNCTION, "NetDll_UpnpStartup");
-    LOAD_IMPORT(Xam, 0x00FC, FUNCTION, "NetDll_UpnpCleanup");
-    LOAD_IMPORT(Xam, 0x00FD, FUNCTION, "NetDll_UpnpSearchCreate");
-    LOAD_IMPORT(Xam, 0x00FE, FUNCTION, "NetDll_UpnpSearchGetDevices");
-    LOAD_IMPORT(Xam, 0x00FF, FUNCTION, "NetDll_UpnpDescribeCreate");
-    LOAD_IMPORT(Xam, 0x0100, FUNCTION, "NetDll_UpnpDescribeGetResults");
-    LOAD_IMPORT(Xam, 0x0101, FUNCTION, "NetDll_UpnpActionCalculateWorkBufferSize");
-    LOAD_IMPORT(Xam, 0x0102, FUNCTION, "NetDll_UpnpActionCreate");
-    LOAD_IMPORT(Xam, 0x0103, FUNCTION, "NetDll_UpnpActionGetResults");
-    LOAD_IMPORT(Xam, 0x0104, FUNCTION, "NetDll_UpnpEventCreate");
-    LOAD_IMPORT(Xam, 0x0105, FUNCTION, "NetDll_UpnpEventGetCurrentState");
-    LOAD_IMPORT(Xam, 0x0106, FUNCTION, "NetDll_UpnpEventUnsubscribe");
-    LOAD_IMPORT(Xam, 0x0107, FUNCTION, "NetDll_UpnpDoWork");
-    LOAD_IMPORT(Xam, 0x0108, FUNCTION, "NetDll_UpnpCloseHandle");
-    LOAD_IMPORT(Xam, 0x012D, FUNCTION, "XNetLogonGetLoggedOnUsers");
-    LOAD_IMPORT(Xam, 0x012E, FUNCTION, "XNetLogonGetNatType");
-    LOAD_IMPORT(Xam, 0x012F, FUNCTION, "XNetLogonTaskStart");
-    LOAD_IMPORT(Xam, 0x0130, FUNCTION, "XNetLogonTaskClose");
-    LOAD_IMPORT(Xam, 0x0131, FUNCTION, "XNetLogonTaskContinue");
-    LOAD_IMPORT(Xam, 0x0132, FUNCTION, "XNetLogonGetServiceInfo");
-    LOAD_IMPORT(Xam, 0x0133, FUNCTION, "XNetLogonGetUserPrivileges");
-    LOAD_IMPORT(Xam, 0x0134, FUNCTION, "XNetLogonSetConsoleCertificate");
-    LOAD_IMPORT(Xam, 0x0135, FUNCTION, "XNetLogonGetMachineID");
-    LOAD_IMPORT(Xam, 0x0136, FUNCTION, "XNetLogonGetTitleID");
-    LOAD_IMPORT(Xam, 0x0137, FUNCTION, "XNetLogonGetTitleVersion");
-    LOAD_IMPORT(Xam, 0x0138, FUNCTION, "XNetLogonGetServiceNetworkID");
-    LOAD_IMPORT(Xam, 0x0139, FUNCTION, "XNetLogonGetDnsString");
-    LOAD_IMPORT(Xam, 0x013A, FUNCTION, "XNetLogonSetTitleID");
-    LOAD_IMPORT(Xam, 0x013B, FUNCTION, "XNetLogonGetExtendedStatus");
-    LOAD_IMPORT(Xam, 0x013C, FUNCTION, "XNetLogonClearTicketCaches");
-    LOAD_IMPORT(Xam, 0x013D, FUNCTION, "XNetLogonInitOverrideInfo");
-    LOAD_IMPORT(Xam, 0x013E, FUNCTION, "XNetLogonGetLastUPnPStatus");
-    LOAD_IMPORT(Xam, 0x013F, FUNCTION, "XNetLogonGetFlowToken");
-    LOAD_IMPORT(Xam, 0x0140, FUNCTION, "XNetLogonGetTicketOpt");
-    LOAD_IMPORT(Xam, 0x0141, FUNCTION, "XNetLogonSetTicketOpt");
-    LOAD_IMPORT(Xam, 0x0190, FUNCTION, "XamInputGetCapabilities");
-    LOAD_IMPORT(Xam, 0x0191, FUNCTION, "XamInputGetState");
-    LOAD_IMPORT(Xam, 0x0192, FUNCTION, "XamInputSetState");
-    LOAD_IMPORT(Xam, 0x0193, FUNCTION, "XamInputGetKeystroke");
-    LOAD_IMPORT(Xam, 0x0194, FUNCTION, "XamInputEnableAutobind");
-    LOAD_IMPORT(Xam, 0x0195, FUNCTION, "XamInputRawState");
-    LOAD_IMPORT(Xam, 0x0196, FUNCTION, "XamEnableSystemAppInput");
-    LOAD_IMPORT(Xam, 0x0197, FUNCTION, "XamInputGetDeviceStats");
-    LOAD_IMPORT(Xam, 0x0198, FUNCTION, "XamInputGetKeystrokeEx");
-    LOAD_IMPORT(Xam, 0x0199, FUNCTION, "XamInputGetKeystrokeHud");
-    LOAD_IMPORT(Xam, 0x019A, FUNCTION, "XamInputSetLayoutKeyboard");
-    LOAD_IMPORT(Xam, 0x019B, FUNCTION, "XamInputToggleKeyLocks");
-    LOAD_IMPORT(Xam, 0x019C, FUNCTION, "XamInputResetLayoutKeyboard");
-    LOAD_IMPORT(Xam, 0x019D, FUNCTION, "XamInputGetKeystrokeHudEx");
-    LOAD_IMPORT(Xam, 0x019E, FUNCTION, "XamInputSetKeyboardTranslationHud");
-    LOAD_IMPORT(Xam, 0x019F, FUNCTION, "XamSetInactivityTime");
-    LOAD_IMPORT(Xam, 0x01A0, FUNCTION, "XamEnableInactivityProcessing");
-    LOAD_IMPORT(Xam, 0x01A1, FUNCTION, "XamResetInactivity");
-    LOAD_IMPORT(Xam, 0x01A2, FUNCTION, "XamSetInactivityTimeFromConfig");
-    LOAD_IMPORT(Xam, 0x01A3, FUNCTION, "XamLoaderGetMediaInfo");
-    LOAD_IMPORT(Xam, 0x01A4, FUNCTION, "XamLoaderLaunchTitle");
-    LOAD_IMPORT(Xam, 0x01A5, FUNCTION, "XamLoaderLaunchTitleEx");
-    LOAD_IMPORT(Xam, 0x01A6, FUNCTION, "XamLoaderSetLaunchData");
-    LOAD_IMPORT(Xam, 0x01A7, FUNCTION, "XamLoaderGetLaunchDataSize");
-    LOAD_IMPORT(Xam, 0x01A8, FUNCTION, "XamLoaderGetLaunchData");
-    LOAD_IMPORT(Xam, 0x01A9, FUNCTION, "XamLoaderTerminateTitle");
-    LOAD_IMPORT(Xam, 0x01AA, FUNCTION, "XamLoaderGetDvdTrayState");
-    LOAD_IMPORT(Xam, 0x01AB, FUNCTION, "XamLoaderGetGameInfo");
-    LOAD_IMPORT(Xam, 0x01AC, FUNCTION, "XamLoaderLaunchTitleOnDvd");
-    LOAD_IMPORT(Xam, 0x01AD, FUNCTION, "XamLoaderSetSpindleSpeed");
-    LOAD_IMPORT(Xam, 0x01AE, FUNCTION, "XamTaskCreateQueue");
-    LOAD_IMPORT(Xam, 0x01AF, FUNCTION, "XamTaskSchedule");
-    LOAD_IMPORT(Xam, 0x01B0, FUNCTION, "XamTaskReschedule");
-    LOAD_IMPORT(Xam, 0x01B1, FUNCTION, "XamTaskCloseHandle");
-    LOAD_IMPORT(Xam, 0x01B2, FUNCTION, "XamTaskCancel");
-    LOAD_IMPORT(Xam, 0x01B3, FUNCTION, "XamTaskShouldExit");
-    LOAD_IMPORT(Xam, 0x01B4, FUNCTION, "XamTaskWaitOnCompletion");
-    LOAD_IMPORT(Xam, 0x01B5, FUNCTION, "XamTaskModify");
-    LOAD_IMPORT(Xam, 0x01B6, FUNCTION, "XamTaskGetCurrentTask");
-    LOAD_IMPORT(Xam, 0x01B7, FUNCTION, "XamTaskGetAttributes");
-    LOAD_IMPORT(Xam, 0x01B8, FUNCTION, "XamExecutingOnBehalfOfTitle");
-    LOAD_IMPORT(Xam, 0x01B9, FUNCTION, "XamInputSendStayAliveRequest");
-    LOAD_IMPORT(Xam, 0x01BA, FUNCTION, "XamInputGetUserVibrationLevel");
-    LOAD_IMPORT(Xam, 0x01BB, FUNCTION, "XamIsSystemTitleId");
-    LOAD_IMPORT(Xam, 0x01BC, FUNCTION, "XamLoaderIsTitleTerminatePending");
-    LOAD_IMPORT(Xam, 0x01BD, FUNCTION, "XamInputSetTextMessengerIndicator");
-    LOAD_IMPORT(Xam, 0x01BE, FUNCTION, "XamLoaderGetPriorTitleId");
-    LOAD_IMPORT(Xam, 0x01BF, FUNCTION, "XamIsXbox1TitleId");
-    LOAD_IMPORT(Xam, 0x01C0, FUNCTION, "XamInputSetKeyLocks");
-    LOAD_IMPORT(Xam, 0x01C1, FUNCTION, "XamInputGetKeyLocks");
-    LOAD_IMPORT(Xam, 0x01C2, FUNCTION, "XamTaskGetStatus");
-    LOAD_IMPORT(Xam, 0x01C3, FUNCTION, "XamGetRootObj");
-    LOAD_IMPORT(Xam, 0x01C4, FUNCTION, "XamDevAuthSetFault");
-    LOAD_IMPORT(Xam, 0x01C5, FUNCTION, "XamGetDefaultSystemImage");
-    LOAD_IMPORT(Xam, 0x01C6, FUNCTION, "XamGetWCNConfigFile");
-    LOAD_IMPORT(Xam, 0x01C7, FUNCTION, "XamSetPowerMode");
-    LOAD_IMPORT(Xam, 0x01C8, FUNCTION, "XamExecuteChallenge");
-    LOAD_IMPORT(Xam, 0x01C9, FUNCTION, "XamGetDefaultImage");
-    LOAD_IMPORT(Xam, 0x01CA, FUNCTION, "XamMuteSound");
-    LOAD_IMPORT(Xam, 0x01CB, FUNCTION, "XamGetOnlineSchema");
-    LOAD_IMPORT(Xam, 0x01CC, FUNCTION, "XamSetDashContext");
-    LOAD_IMPORT(Xam, 0x01CD, FUNCTION, "XamGetDashContext");
-    LOAD_IMPORT(Xam, 0x01CE, FUNCTION, "XamIsCurrentTitleDash");
-    LOAD_IMPORT(Xam, 0x01CF, FUNCTION, "XamGetCurrentTitleId");
-    LOAD_IMPORT(Xam, 0x01D0, FUNCTION, "XamSetCurrentTitleDash");
-    LOAD_IMPORT(Xam, 0x01D1, FUNCTION, "XamAllocHeapFreeSpace");
-    LOAD_IMPORT(Xam, 0x01D2, FUNCTION, "XamSetDashContextEx");
-    LOAD_IMPORT(Xam, 0x01D3, FUNCTION, "XamGetDashContextEx");
-    LOAD_IMPORT(Xam, 0x01D4, FUNCTION, "XamSetHudContext");
-    LOAD_IMPORT(Xam, 0x01D5, FUNCTION, "XamGetHudContext");
-    LOAD_IMPORT(Xam, 0x01D6, FUNCTION, "XCustomGetBannerImage");
-    LOAD_IMPORT(Xam, 0x01D7, FUNCTION, "Refresh");
-    LOAD_IMPORT(Xam, 0x01D8, FUNCTION, "XCustomSetAction");
-    LOAD_IMPORT(Xam, 0x01D9, FUNCTION, "XCustomGetLastActionPress");
-    LOAD_IMPORT(Xam, 0x01DA, FUNCTION, "XCustomSetDynamicActions");
-    LOAD_IMPORT(Xam, 0x01DB, FUNCTION, "XCustomBroadcastActionEvent");
-    LOAD_IMPORT(Xam, 0x01DC, FUNCTION, "XCustomGetLastActionPressEx");
-    LOAD_IMPORT(Xam, 0x01DD, FUNCTION, "XCustomRegisterDynamicActions");
-    LOAD_IMPORT(Xam, 0x01DE, FUNCTION, "XCustomUnregisterDynamicActions");
-    LOAD_IMPORT(Xam, 0x01DF, FUNCTION, "XCustomGetCurrentGamercard");
-    LOAD_IMPORT(Xam, 0x01E0, FUNCTION, "XamDbgPrint");
-    LOAD_IMPORT(Xam, 0x01E1, FUNCTION, "XamDbgSetOutputLevel");
-    LOAD_IMPORT(Xam, 0x01E2, FUNCTION, "XamDbgSetBreakLevel");
-    LOAD_IMPORT(Xam, 0x01E3, FUNCTION, "XamLoaderGetMediaInfoEx");
-    LOAD_IMPORT(Xam, 0x01E4, FUNCTION, "XamLoaderSetGameInfo");
-    LOAD_IMPORT(Xam, 0x01E5, FUNCTION, "XamFormatMessage");
-    LOAD_IMPORT(Xam, 0x01E6, FUNCTION, "XamUniSortCmpString");
-    LOAD_IMPORT(Xam, 0x01E7, FUNCTION, "XamFormatTimeString");
-    LOAD_IMPORT(Xam, 0x01E8, FUNCTION, "XamFormatDateString");
-    LOAD_IMPORT(Xam, 0x01E9, FUNCTION, "XamGetLocaleDateFormat");
-    LOAD_IMPORT(Xam, 0x01EA, FUNCTION, "XamAlloc");
-    LOAD_IMPORT(Xam, 0x01EB, FUNCTION, "XamAllocEx");
-    LOAD_IMPORT(Xam, 0x01EC, FUNCTION, "XamFree");
-    LOAD_IMPORT(Xam, 0x01ED, FUNCTION, "XamAllocSize");
-    LOAD_IMPORT(Xam, 0x01EE, FUNCTION, "XamAllocMountIPTVHeap");
-    LOAD_IMPORT(Xam, 0x01EF, FUNCTION, "XamAllocUnmountIPTVHeap");
-    LOAD_IMPORT(Xam, 0x01F0, FUNCTION, "XamAllocFreeIPTVHeap");
-    LOAD_IMPORT(Xam, 0x01F1, FUNCTION, "XamDeviceRemap");
-    LOAD_IMPORT(Xam, 0x01F2, FUNCTION, "XamLoaderGetClearCache");
-    LOAD_IMPORT(Xam, 0x01F3, FUNCTION, "XamLoaderSetClearCache");
-    LOAD_IMPORT(Xam, 0x01F4, FUNCTION, "XMsgInProcessCall");
-    LOAD_IMPORT(Xam, 0x01F5, FUNCTION, "XMsgCompleteIORequest");
-    LOAD_IMPORT(Xam, 0x01F6, FUNCTION, "XMsgSystemProcessCall");
-    LOAD_IMPORT(Xam, 0x01F7, FUNCTION, "XMsgStartIORequest");
-    LOAD_IMPORT(Xam, 0x01F8, FUNCTION, "XMsgCancelIORequest");
-    LOAD_IMPORT(Xam, 0x01F9, FUNCTION, "XMsgAcquireAsyncMessageFromOverlapped");
-    LOAD_IMPORT(Xam, 0x01FA, FUNCTION, "XMsgReleaseAsyncMessageToOverlapped");
-    LOAD_IMPORT(Xam, 0x01FB, FUNCTION, "XamGetOverlappedResult");
-    LOAD_IMPORT(Xam, 0x01FC, FUNCTION, "XMsgStartIORequestEx");
-    LOAD_IMPORT(Xam, 0x01FD, FUNCTION, "XamAppAllocateInterappWorkspace");
-    LOAD_IMPORT(Xam, 0x01FE, FUNCTION, "XamAppGetInterappWorkspace");
-    LOAD_IMPORT(Xam, 0x01FF, FUNCTION, "XamAppFreeInterappWorkspace");
-    LOAD_IMPORT(Xam, 0x0200, FUNCTION, "XamFeatureEnabled");
-    LOAD_IMPORT(Xam, 0x0201, FUNCTION, "XamFeatureEnforceImageBudget");
-    LOAD_IMPORT(Xam, 0x0202, FUNCTION, "XamFeatureSetMask");
-    LOAD_IMPORT(Xam, 0x0203, FUNCTION, "XamFeatureEnableDisable");
-    LOAD_IMPORT(Xam, 0x0204, FUNCTION, "XuiControlSetItemAssociation");
-    LOAD_IMPORT(Xam, 0x0205, FUNCTION, "XamGetTitleGlobalStorageValue");
-    LOAD_IMPORT(Xam, 0x0206, FUNCTION, "XamSetTitleGlobalStorageValue");
-    LOAD_IMPORT(Xam, 0x0207, FUNCTION, "XamUserValidateAvatarManifest");
-    LOAD_IMPORT(Xam, 0x0208, FUNCTION, "XamUserGetDeviceContext");
-    LOAD_IMPORT(Xam, 0x0209, FUNCTION, "XamUserLookupDevice");
-    LOAD_IMPORT(Xam, 0x020A, FUNCTION, "XamUserGetXUID");
-    LOAD_IMPORT(Xam, 0x020B, FUNCTION, "XamUserLogon");
-    LOAD_IMPORT(Xam, 0x020C, FUNCTION, "XamUserGetGamerTag");
-    LOAD_IMPORT(Xam, 0x020D, FUNCTION, "XamUserGetUserIndexMask");
-    LOAD_IMPORT(Xam, 0x020E, FUNCTION, "XamUserGetName");
-    LOAD_IMPORT(Xam, 0x020F, FUNCTION, "XamLookupCommonStringByIndex");
-    LOAD_IMPORT(Xam, 0x0210, FUNCTION, "XamUserGetSigninState");
-    LOAD_IMPORT(Xam, 0x0211, FUNCTION, "XamUserGetIndexFromXUID");
-    LOAD_IMPORT(Xam, 0x0212, FUNCTION, "XamUserCheckPrivilege");
-    LOAD_IMPORT(Xam, 0x0213, FUNCTION, "XamUserAreUsersFriends");
-    LOAD_IMPORT(Xam, 0x0214, FUNCTION, "XamSetUserPresetPresenceState");
-    LOAD_IMPORT(Xam, 0x0215, FUNCTION, "XamGetUserPresetPresenceState");
-    LOAD_IMPORT(Xam, 0x0216, FUNCTION, "XamUserGetUserFlagsFromXUID");
-    LOAD_IMPORT(Xam, 0x0217, FUNCTION, "XamUserGetMembershipTierFromXUID");
-    LOAD_IMPORT(Xam, 0x0218, FUNCTION, "XamUserGetOnlineCountryFromXUID");
-    LOAD_IMPORT(Xam, 0x0219, FUNCTION, "XamUserReadProfileSettings");
-    LOAD_IMPORT(Xam, 0x021A, FUNCTION, "XamUserWriteProfileSettings");
-    LOAD_IMPORT(Xam, 0x021B, FUNCTION, "XamUserGetMembershipTier");
-    LOAD_IMPORT(Xam, 0x021C, FUNCTION, "XamUserGetUserFlags");
-    LOAD_IMPORT(Xam, 0x021D, FUNCTION, "XamUserGetRequestedUserIndexMask");
-    LOAD_IMPORT(Xam, 0x021E, FUNCTION, "XamUserIsGuest");
-    LOAD_IMPORT(Xam, 0x021F, FUNCTION, "XamUserProfileSync");
-    LOAD_IMPORT(Xam, 0x0220, FUNCTION, "XamUserFlushLogonQueue");
-    LOAD_IMPORT(Xam, 0x0221, FUNCTION, "XamUserIsOnlineEnabled");
-    LOAD_IMPORT(Xam, 0x0222, FUNCTION, "XamUserGetCachedUserFlags");
-    LOAD_IMPORT(Xam, 0x0223, FUNCTION, "XamAreMixedAccountsSignedIn");
-    LOAD_IMPORT(Xam, 0x0224, FUNCTION, "XamUserLogonEx");
-    LOAD_IMPORT(Xam, 0x0225, FUNCTION, "XamSetUserShowMessengerFriends");
-    LOAD_IMPORT(Xam, 0x0226, FUNCTION, "XamGetUserShowMessengerFriends");
-    LOAD_IMPORT(Xam, 0x0227, FUNCTION, "XamUserGetSigninInfo");
-    LOAD_IMPORT(Xam, 0x0228, FUNCTION, "XamUserIsPartial");
-    LOAD_IMPORT(Xam, 0x0229, FUNCTION, "XamUserGetOnlineLanguageFromXUID");
-    LOAD_IMPORT(Xam, 0x022A, FUNCTION, "XamUserReadProfileSettingsEx");
-    LOAD_IMPORT(Xam, 0x022B, FUNCTION, "XamSystemUpdaterLogon");
-    LOAD_IMPORT(Xam, 0x022C, FUNCTION, "XamUserGetUsersMissingAvatars");
-    LOAD_IMPORT(Xam, 0x022D, FUNCTION, "XamIsChildAccountSignedIn");
-    LOAD_IMPORT(Xam, 0x022E, FUNCTION, "XamUserPrefetchProfileSettings");
-    LOAD_IMPORT(Xam, 0x022F, FUNCTION, "XamUserInvalidateProfileSetting");
-    LOAD_IMPORT(Xam, 0x0230, FUNCTION, "XamProfileCreate");
-    LOAD_IMPORT(Xam, 0x0231, FUNCTION, "XamProfileCreateEnumerator");
-    LOAD_IMPORT(Xam, 0x0232, FUNCTION, "XamProfileEnumerate");
-    LOAD_IMPORT(Xam, 0x0233, FUNCTION, "XamProfileDelete");
-    LOAD_IMPORT(Xam, 0x0234, FUNCTION, "XamProfileGetCreationStatus");
-    LOAD_IMPORT(Xam, 0x0235, FUNCTION, "XamProfileFindAccount");
-    LOAD_IMPORT(Xam, 0x0236, FUNCTION, "XamProfileRenameAccount");
-    LOAD_IMPORT(Xam, 0x0237, FUNCTION, "XamProfileOpen");
-    LOAD_IMPORT(Xam, 0x0238, FUNCTION, "XamProfileClose");
-    LOAD_IMPORT(Xam, 0x0239, FUNCTION, "XamProfileSaveAccountInfo");
-    LOAD_IMPORT(Xam, 0x023A, FUNCTION, "XamProfileLoadAccountInfo");
-    LOAD_IMPORT(Xam, 0x023B, FUNCTION, "XamProfileRecoverTitle");
-    LOAD_IMPORT(Xam, 0x023C, FUNCTION, "XamProfileSaveWindowsLiveCredentials");
-    LOAD_IMPORT(Xam, 0x023D, FUNCTION, "XamProfileLoadWindowsLiveCredentials");
-    LOAD_IMPORT(Xam, 0x023E, FUNCTION, "XamProfileIsSaveWindowsLiveCredsEnabled");
-    LOAD_IMPORT(Xam, 0x023F, FUNCTION, "XamProfileSetSaveWindowsLiveCredsEnabled");
-    LOAD_IMPORT(Xam, 0x0240, FUNCTION, "XamSetProfileReadTestHook");
-    LOAD_IMPORT(Xam, 0x0241, FUNCTION, "XamProfileGetLastSync");
-    LOAD_IMPORT(Xam, 0x0242, FUNCTION, "XamAccountRecoveryRecoverTitle");
-    LOAD_IMPORT(Xam, 0x0243, FUNCTION, "XamProfileControlPec");
-    LOAD_IMPORT(Xam, 0x0244, FUNCTION, "XamAppLoad");
-    LOAD_IMPORT(Xam, 0x0245, FUNCTION, "XamAppUnloadSelf");
-    LOAD_IMPORT(Xam, 0x0246, FUNCTION, "XamAppUnloadStack");
-    LOAD_IMPORT(Xam, 0x0247, FUNCTION, "XamSendMessageToLoadedApps");
-    LOAD_IMPORT(Xam, 0x0248, FUNCTION, "XamAppRequestLoad");
-    LOAD_IMPORT(Xam, 0x0249, FUNCTION, "XamAppUnrequestLoad");
-    LOAD_IMPORT(Xam, 0x024A, FUNCTION, "XamNavigate");
-    LOAD_IMPORT(Xam, 0x024B, FUNCTION, "XamRegisterSysApp");
-    LOAD_IMPORT(Xam, 0x024C, FUNCTION, "XamUnregisterSysApp");
-    LOAD_IMPORT(Xam, 0x024D, FUNCTION, "XamAppReinitialize");
-    LOAD_IMPORT(Xam, 0x024E, FUNCTION, "XamCreateEnumeratorHandle");
-    LOAD_IMPORT(Xam, 0x024F, FUNCTION, "XamGetPrivateEnumStructureFromHandle");
-    LOAD_IMPORT(Xam, 0x0250, FUNCTION, "XamEnumerate");
-    LOAD_IMPORT(Xam, 0x0251, FUNCTION, "XamLoadSysApp");
-    LOAD_IMPORT(Xam, 0x0252, FUNCTION, "XamUnloadSysApp");
-    LOAD_IMPORT(Xam, 0x0253, FUNCTION, "XamReloadSysApp");
-    LOAD_IMPORT(Xam, 0x0254, FUNCTION, "XamAppLoadPass2SysApps");
-    LOAD_IMPORT(Xam, 0x0255, FUNCTION, "XamProfileGetLiveLegalLocale");
-    LOAD_IMPORT(Xam, 0x0256, FUNCTION, "XamUserIsParentalControlled");
-    LOAD_IMPORT(Xam, 0x0257, FUNCTION, "XamContentLaunchImageFromFileInternal");
-    LOAD_IMPORT(Xam, 0x0258, FUNCTION, "XamContentCreate");
-    LOAD_IMPORT(Xam, 0x0259, FUNCTION, "XamContentCreateEx");
-    LOAD_IMPORT(Xam, 0x025A, FUNCTION, "XamContentClose");
-    LOAD_IMPORT(Xam, 0x025B, FUNCTION, "XamContentDelete");
-    LOAD_IMPORT(Xam, 0x025C, FUNCTION, "XamContentCreateEnumerator");
-    LOAD_IMPORT(Xam, 0x025D, FUNCTION, "XamContentCreateDeviceEnumerator");
-    LOAD_IMPORT(Xam, 0x025E, FUNCTION, "XamContentGetDeviceData");
-    LOAD_IMPORT(Xam, 0x025F, FUNCTION, "XamContentGetDeviceName");
-    LOAD_IMPORT(Xam, 0x0260, FUNCTION, "XamContentSetThumbnail");
-    LOAD_IMPORT(Xam, 0x0261, FUNCTION, "XamContentGetThumbnail");
-    LOAD_IMPORT(Xam, 0x0262, FUNCTION, "XamContentGetCreator");
-    LOAD_IMPORT(Xam, 0x0263, FUNCTION, "XamContentLaunchImage");
-    LOAD_IMPORT(Xam, 0x0264, FUNCTION, "XamContentGetAttributes");
-    LOAD_IMPORT(Xam, 0x0265, FUNCTION, "XamContentGetDeviceState");
-    LOAD_IMPORT(Xam, 0x0266, FUNCTION, "XamContentGetLicenseMask");
-    LOAD_IMPORT(Xam, 0x0267, FUNCTION, "XamContentFlush");
-    LOAD_IMPORT(Xam, 0x0268, FUNCTION, "XamContentResolve");
-    LOAD_IMPORT(Xam, 0x0269, FUNCTION, "XamContentOpenFile");
-    LOAD_IMPORT(Xam, 0x026A, FUNCTION, "XamContentInstall");
-    LOAD_IMPORT(Xam, 0x026B, FUNCTION, "XamContentLockUnlockPackageHeaders");
-    LOAD_IMPORT(Xam, 0x026C, FUNCTION, "XamContentCopyInternal");
-    LOAD_IMPORT(Xam, 0x026D, FUNCTION, "XamContentMoveInternal");
-    LOAD_IMPORT(Xam, 0x026E, FUNCTION, "XamContentGetMetaDataInternal");
-    LOAD_IMPORT(Xam, 0x026F, FUNCTION, "XamContentCreateEnumeratorInternal");
-    LOAD_IMPORT(Xam, 0x0270, FUNCTION, "XamContentDeleteInternal");
-    LOAD_IMPORT(Xam, 0x0271, FUNCTION, "XamContentCreateInternal");
-    LOAD_IMPORT(Xam, 0x0272, FUNCTION, "XamContentSetThumbnailInternal");
-    LOAD_IMPORT(Xam, 0x0273, FUNCTION, "XamContentLaunchImageInternal");
-    LOAD_IMPORT(Xam, 0x0274, FUNCTION, "XamContentWritePackageHeader");
-    LOAD_IMPORT(Xam, 0x0275, FUNCTION, "XamContentDismountAndClosePackage");
-    LOAD_IMPORT(Xam, 0x0276, FUNCTION, "XamContentResolveInternal");
-    LOAD_IMPORT(Xam, 0x0277, FUNCTION, "XamContentGetAttributesInternal");
-    LOAD_IMPORT(Xam, 0x0278, FUNCTION, "XamContentOpenFileInternal");
-    LOAD_IMPORT(Xam, 0x0279, FUNCTION, "XamContentAggregateCreateEnumerator");
-    LOAD_IMPORT(Xam, 0x027A, FUNCTION, "XamContentCreateAndMountPackage");
-    LOAD_IMPORT(Xam, 0x027B, FUNCTION, "XamContentOpenPackageFile");
-    LOAD_IMPORT(Xam, 0x027C, FUNCTION, "XamContentMountPackage");
-    LOAD_IMPORT(Xam, 0x027D, FUNCTION, "XamContentFlushPackage");
-    LOAD_IMPORT(Xam, 0x027E, FUNCTION, "XamContentClosePackageFile");
-    LOAD_IMPORT(Xam, 0x027F, FUNCTION, "XamContentDuplicateFileHandle");
-    LOAD_IMPORT(Xam, 0x0280, FUNCTION, "XamGetExecutionId");
-    LOAD_IMPORT(Xam, 0x0281, FUNCTION, "XamGetGameRatings");
-    LOAD_IMPORT(Xam, 0x0282, FUNCTION, "XamGetSystemVersion");
-    LOAD_IMPORT(Xam, 0x0283, FUNCTION, "XamContentGetLocalizedString");
-    LOAD_IMPORT(Xam, 0x0284, FUNCTION, "XamContentGetDefaultDevice");
-    LOAD_IMPORT(Xam, 0x0285, FUNCTION, "XamContentInstallInternal");
-    LOAD_IMPORT(Xam, 0x0286, FUNCTION, "XamContentSetMediaMetaDataInternal");
-    LOAD_IMPORT(Xam, 0x0287, FUNCTION, "XamContentGetDeviceSerialNumber");
-    LOAD_IMPORT(Xam, 0x0288, FUNCTION, "XamContentGetMountedPackageByRootName");
-    LOAD_IMPORT(Xam, 0x0289, FUNCTION, "XamContentRegisterChangeCallback");
-    LOAD_IMPORT(Xam, 0x028A, FUNCTION, "XamNotifyCreateListener");
-    LOAD_IMPORT(Xam, 0x028B, FUNCTION, "XNotifyGetNext");
-    LOAD_IMPORT(Xam, 0x028C, FUNCTION, "XNotifyPositionUI");
-    LOAD_IMPORT(Xam, 0x028D, FUNCTION, "XNotifyDelayUI");
-    LOAD_IMPORT(Xam, 0x028E, FUNCTION, "XNotifyBroadcast");
-    LOAD_IMPORT(Xam, 0x028F, FUNCTION, "XNotifyRegisterArea");
-    LOAD_IMPORT(Xam, 0x0290, FUNCTION, "XNotifyQueueUI");
-    LOAD_IMPORT(Xam, 0x0291, FUNCTION, "XamNotifyCreateListenerInternal");
-    LOAD_IMPORT(Xam, 0x0292, FUNCTION, "XNotifyUISetOptions");
-    LOAD_IMPORT(Xam, 0x0293, FUNCTION, "XNotifyUIGetOptions");
-    LOAD_IMPORT(Xam, 0x0294, FUNCTION, "XamContentLaunchImageInternalEx");
-    LOAD_IMPORT(Xam, 0x0295, FUNCTION, "XamShutdown");
-    LOAD_IMPORT(Xam, 0x0296, FUNCTION, "XamAllocDevkitHeapAvailable");
-    LOAD_IMPORT(Xam, 0x0297, FUNCTION, "XamNotifyCreateListenerRangeInternal");
-    LOAD_IMPORT(Xam, 0x0298, FUNCTION, "XNotifyQueueUIEx");
-    LOAD_IMPORT(Xam, 0x0299, FUNCTION, "XamAppRequestLoadEx");
-    LOAD_IMPORT(Xam, 0x029A, FUNCTION, "XuiPNGTextureLoader");
-    LOAD_IMPORT(Xam, 0x029B, FUNCTION, "XuiRenderGetXuiDevice");
-    LOAD_IMPORT(Xam, 0x029C, FUNCTION, "XuiDefault_False");
-    LOAD_IMPORT(Xam, 0x029D, FUNCTION, "XamUserGetReportingInfo");
-    LOAD_IMPORT(Xam, 0x029E, FUNCTION, "XamUpdateStart");
-    LOAD_IMPORT(Xam, 0x029F, FUNCTION, "XamUpdateGetProgress");
-    LOAD_IMPORT(Xam, 0x02A0, FUNCTION, "XamUpdateGetExtenderInstance");
-    LOAD_IMPORT(Xam, 0x02A1, FUNCTION, "XamUpdateFinish");
-    LOAD_IMPORT(Xam, 0x02A2, FUNCTION, "XamUpdateAttachExtenderInstance");
-    LOAD_IMPORT(Xam, 0x02A3, FUNCTION, "XamUpdateAllocateExtenderBuffer");
-    LOAD_IMPORT(Xam, 0x02A4, FUNCTION, "XamRestartTitleLoadAfterUpdate");
-    LOAD_IMPORT(Xam, 0x02A5, FUNCTION, "XamUIThreadDisableFontPatching");
-    LOAD_IMPORT(Xam, 0x02A6, FUNCTION, "XamUpdateGetBaseSystemVersion");
-    LOAD_IMPORT(Xam, 0x02A7, FUNCTION, "XamUpdateGetCurrentSystemVersion");
-    LOAD_IMPORT(Xam, 0x02A8, FUNCTION, "XamUIThreadEnableFontPatching");
-    LOAD_IMPORT(Xam, 0x02A9, FUNCTION, "XamTerminateTitleForUpdate");
-    LOAD_IMPORT(Xam, 0x02AA, FUNCTION, "XamSystemUpdateInstallLocal");
-    LOAD_IMPORT(Xam, 0x02AB, FUNCTION, "XamUpdateChainPass3FromPass2");
-    LOAD_IMPORT(Xam, 0x02AD, FUNCTION, "XamInputGetCapabilitiesEx");
-    LOAD_IMPORT(Xam, 0x02AE, FUNCTION, "XamUserIsUnsafeProgrammingAllowed");
-    LOAD_IMPORT(Xam, 0x02AF, FUNCTION, "XamDevAuthSetFaultEx");
-    LOAD_IMPORT(Xam, 0x02B0, FUNCTION, "XamUpdateGetData");
-    LOAD_IMPORT(Xam, 0x02B1, FUNCTION, "XamCacheIntegrityCheck");
-    LOAD_IMPORT(Xam, 0x02B2, FUNCTION, "XamCacheStoreFile");
-    LOAD_IMPORT(Xam, 0x02B3, FUNCTION, "XamCacheFetchFile");
-    LOAD_IMPORT(Xam, 0x02B4, FUNCTION, "XamCacheOpenFile");
-    LOAD_IMPORT(Xam, 0x02B5, FUNCTION, "XamCacheCloseFile");
-    LOAD_IMPORT(Xam, 0x02B6, FUNCTION, "XamGetCachedTitleName");
-    LOAD_IMPORT(Xam, 0x02B7, FUNCTION, "XamCacheReset");
-    LOAD_IMPORT(Xam, 0x02B8, FUNCTION, "XamGetCachedGamerTag");
-    LOAD_IMPORT(Xam, 0x02B9, FUNCTION, "XamGetCachedGamerTagW");
-    LOAD_IMPORT(Xam, 0x02BA, FUNCTION, "XamCacheDeleteFile");
-    LOAD_IMPORT(Xam, 0x02BB, FUNCTION, "XamCacheRenameFile");
-    LOAD_IMPORT(Xam, 0x02BC, FUNCTION, "XamShowSigninUI");
-    LOAD_IMPORT(Xam, 0x02BD, FUNCTION, "XamShowSigninUIEx");
-    LOAD_IMPORT(Xam, 0x02BE, FUNCTION, "XamShowSigninUIp");
-    LOAD_IMPORT(Xam, 0x02BF, FUNCTION, "XamShowFriendsUI");
-    LOAD_IMPORT(Xam, 0x02C0, FUNCTION, "XamShowMessagesUI");
-    LOAD_IMPORT(Xam, 0x02C1, FUNCTION, "XamShowKeyboardUI");
-    LOAD_IMPORT(Xam, 0x02C2, FUNCTION, "XamShowQuickChatUI");
-    LOAD_IMPORT(Xam, 0x02C3, FUNCTION, "XamShowVoiceMailUI");
-    LOAD_IMPORT(Xam, 0x02C4, FUNCTION, "XamShowGamerCardUI");
-    LOAD_IMPORT(Xam, 0x02C5, FUNCTION, "XamShowAchievementsUI");
-    LOAD_IMPORT(Xam, 0x02C6, FUNCTION, "XamShowPlayerReviewUI");
-    LOAD_IMPORT(Xam, 0x02C7, FUNCTION, "XamShowMarketplaceUI");
-    LOAD_IMPORT(Xam, 0x02C8, FUNCTION, "XamShowPlayersUI");
-    LOAD_IMPORT(Xam, 0x02C9, FUNCTION, "XamShowUpdaterUI");
-    LOAD_IMPORT(Xam, 0x02CA, FUNCTION, "XamShowMessageBoxUI");
-    LOAD_IMPORT(Xam, 0x02CB, FUNCTION, "XamShowDeviceSelectorUI");
-    LOAD_IMPORT(Xam, 0x02CC, FUNCTION, "XamShowMessageComposeUI");
-    LOAD_IMPORT(Xam, 0x02CD, FUNCTION, "XamShowGameInviteUI");
-    LOAD_IMPORT(Xam, 0x02CE, FUNCTION, "XamShowFriendRequestUI");
-    LOAD_IMPORT(Xam, 0x02CF, FUNCTION, "XamShowCreateProfileUI");
-    LOAD_IMPORT(Xam, 0x02D0, FUNCTION, "XamShowGamesUI");
-    LOAD_IMPORT(Xam, 0x02D1, FUNCTION, "XamShowLiveSignupUI");
-    LOAD_IMPORT(Xam, 0x02D2, FUNCTION, "XamShowFriendsUIp");
-    LOAD_IMPORT(Xam, 0x02D3, FUNCTION, "XamShowComplaintUI");
-    LOAD_IMPORT(Xam, 0x02D4, FUNCTION, "XamShowReputationUI");
-    LOAD_IMPORT(Xam, 0x02D5, FUNCTION, "XamShowGamerCardUIForXUID");
-    LOAD_IMPORT(Xam, 0x02D6, FUNCTION, "XamShowForcedNameChangeUI");
-    LOAD_IMPORT(Xam, 0x02D7, FUNCTION, "XamShowLiveUpsellUI");
-    LOAD_IMPORT(Xam, 0x02D8, FUNCTION, "XamShowPasscodeVerifyUI");
-    LOAD_IMPORT(Xam, 0x02D9, FUNCTION, "XamShowDirtyDiscErrorUI");
-    LOAD_IMPORT(Xam, 0x02DA, FUNCTION, "XamShowSignupCreditCardUI");
-    LOAD_IMPORT(Xam, 0x02DB, FUNCTION, "XamShowPrivateChatInviteUI");
-    LOAD_IMPORT(Xam, 0x02DC, FUNCTION, "XamShowMessageBoxUIEx");
-    LOAD_IMPORT(Xam, 0x02DD, FUNCTION, "XamShowRecentMessageUI");
-    LOAD_IMPORT(Xam, 0x02DE, FUNCTION, "XamShowRecentMessageUIEx");
-    LOAD_IMPORT(Xam, 0x02DF, FUNCTION, "XamShowMessagesUIEx");
-    LOAD_IMPORT(Xam, 0x02E0, FUNCTION, "XamShowAchievementDetailsUI");
-    LOAD_IMPORT(Xam, 0x02E1, FUNCTION, "XamShowPersonalizationUI");
-    LOAD_IMPORT(Xam, 0x02E2, FUNCTION, "XamShowChangeGamerTileUI");
-    LOAD_IMPORT(Xam, 0x02E3, FUNCTION, "XamShowVoiceSettingsUI");
-    LOAD_IMPORT(Xam, 0x02E4, FUNCTION, "XamShowVideoChatInviteUI");
-    LOAD_IMPORT(Xam, 0x02E5, FUNCTION, "XamShowCustomMessageComposeUI");
-    LOAD_IMPORT(Xam, 0x02E6, FUNCTION, "XamShowCustomPlayerListUI");
-    LOAD_IMPORT(Xam, 0x02E7, FUNCTION, "XamShowMarketplaceDownloadItemsUI");
-    LOAD_IMPORT(Xam, 0x02E8, FUNCTION, "XamShowMarketplaceUIEx");
-    LOAD_IMPORT(Xam, 0x02E9, FUNCTION, "XamShowMessageBox");
-    LOAD_IMPORT(Xam, 0x02EA, FUNCTION, "XamIsSysUiInvokedByXenonButton");
-    LOAD_IMPORT(Xam, 0x02EB, FUNCTION, "XamIsSysUiInvokedByTitle");
-    LOAD_IMPORT(Xam, 0x02EC, FUNCTION, "XamIsUIActive");
-    LOAD_IMPORT(Xam, 0x02ED, FUNCTION, "XamSysUiDisableAutoClose");
-    LOAD_IMPORT(Xam, 0x02EE, FUNCTION, "XamUserCreateAchievementEnumerator");
-    LOAD_IMPORT(Xam, 0x02EF, FUNCTION, "XamReadTile");
-    LOAD_IMPORT(Xam, 0x02F0, FUNCTION, "XamWriteGamerTile");
-    LOAD_IMPORT(Xam, 0x02F1, FUNCTION, "XamWriteTile");
-    LOAD_IMPORT(Xam, 0x02F2, FUNCTION, "XamReadImage");
-    LOAD_IMPORT(Xam, 0x02F3, FUNCTION, "XamUserCreateTitlesPlayedEnumerator");
-    LOAD_IMPORT(Xam, 0x02F4, FUNCTION, "XamDecompressPNGToTexture");
-    LOAD_IMPORT(Xam, 0x02F5, FUNCTION, "XamReadTileToTexture");
-    LOAD_IMPORT(Xam, 0x02F6, FUNCTION, "XamReadString");
-    LOAD_IMPORT(Xam, 0x02F7, FUNCTION, "XamUserCreateStatsEnumerator");
-    LOAD_IMPORT(Xam, 0x02F8, FUNCTION, "XamPrepareGamerTiles");
-    LOAD_IMPORT(Xam, 0x02F9, FUNCTION, "XamClearTitle");
-    LOAD_IMPORT(Xam, 0x02FA, FUNCTION, "XamReadStrings");
-    LOAD_IMPORT(Xam, 0x02FB, FUNCTION, "XamWriteGamerTileEx");
-    LOAD_IMPORT(Xam, 0x02FC, FUNCTION, "XamReadTileEx");
-    LOAD_IMPORT(Xam, 0x02FD, FUNCTION, "XamReadTileToTextureEx");
-    LOAD_IMPORT(Xam, 0x02FE, FUNCTION, "XamShowMessengerUI");
-    LOAD_IMPORT(Xam, 0x02FF, FUNCTION, "XamShowKeyboardUIMessenger");
-    LOAD_IMPORT(Xam, 0x0300, FUNCTION, "XamShowLiveUpsellUIEx");
-    LOAD_IMPORT(Xam, 0x0301, FUNCTION, "XamShowJoinSessionInProgressUI");
-    LOAD_IMPORT(Xam, 0x0302, FUNCTION, "XamShowGraduateUserUI");
-    LOAD_IMPORT(Xam, 0x0303, FUNCTION, "XamShowGamerCardUIForXUIDp");
-    LOAD_IMPORT(Xam, 0x0304, FUNCTION, "XamShowGuideUI");
-    LOAD_IMPORT(Xam, 0x0305, FUNCTION, "XamShowPartyUI");
-    LOAD_IMPORT(Xam, 0x0306, FUNCTION, "XamShowPartyInviteUI");
-    LOAD_IMPORT(Xam, 0x0307, FUNCTION, "XamUserAddRecentPlayer");
-    LOAD_IMPORT(Xam, 0x0308, FUNCTION, "XamUserUpdateRecentPlayer");
-    LOAD_IMPORT(Xam, 0x0309, FUNCTION, "XamUserCreatePlayerEnumerator");
-    LOAD_IMPORT(Xam, 0x030A, FUNCTION, "XamParseGamerTileKey");
-    LOAD_IMPORT(Xam, 0x030B, FUNCTION, "XamShowCommunitySessionsUI");
-    LOAD_IMPORT(Xam, 0x030C, FUNCTION, "XamVoiceCreate");
-    LOAD_IMPORT(Xam, 0x030D, FUNCTION, "XamVoiceHeadsetPresent");
-    LOAD_IMPORT(Xam, 0x030E, FUNCTION, "XamVoiceSubmitPacket");
-    LOAD_IMPORT(Xam, 0x030F, FUNCTION, "XamVoiceClose");
-    LOAD_IMPORT(Xam, 0x0310, FUNCTION, "XamVoiceGetBatteryStatus");
-    LOAD_IMPORT(Xam, 0x0311, FUNCTION, "Refresh");
-    LOAD_IMPORT(Xam, 0x0312, FUNCTION, "Refresh");
-    LOAD_IMPORT(Xam, 0x0313, FUNCTION, "XamShowJoinSessionByIdInProgressUI");
-    LOAD_IMPORT(Xam, 0x0314, FUNCTION, "XamShowPartyJoinInProgressUI");
-    LOAD_IMPORT(Xam, 0x0315, FUNCTION, "XamBuildSharedSystemResourceLocator");
-    LOAD_IMPORT(Xam, 0x0316, FUNCTION, "XamSessionCreateHandle");
-    LOAD_IMPORT(Xam, 0x0317, FUNCTION, "XamSessionRefObjByHandle");
-    LOAD_IMPORT(Xam, 0x0318, FUNCTION, "XamVoiceGetMicArrayStatus");
-    LOAD_IMPORT(Xam, 0x0319, FUNCTION, "XamVoiceSetAudioCaptureRoutine");
-    LOAD_IMPORT(Xam, 0x031A, FUNCTION, "XamVoiceGetDirectionalData");
-    LOAD_IMPORT(Xam, 0x031B, FUNCTION, "XamBuildResourceLocator");
-    LOAD_IMPORT(Xam, 0x031C, FUNCTION, "XamBuildLegacySystemResourceLocator");
-    LOAD_IMPORT(Xam, 0x031D, FUNCTION, "XamBuildGamercardResourceLocator");
-    LOAD_IMPORT(Xam, 0x031E, FUNCTION, "XamBuildDynamicResourceLocator");
-    LOAD_IMPORT(Xam, 0x031F, FUNCTION, "XamBuildXamResourceLocator");
-    LOAD_IMPORT(Xam, 0x0320, FUNCTION, "XuiAnimRun");
-    LOAD_IMPORT(Xam, 0x0321, FUNCTION, "XuiApplyLocale");
-    LOAD_IMPORT(Xam, 0x0322, FUNCTION, "XuiBubbleMessage");
-    LOAD_IMPORT(Xam, 0x0323, FUNCTION, "XuiControlIsBackButton");
-    LOAD_IMPORT(Xam, 0x0324, FUNCTION, "XuiControlIsNavButton");
-    LOAD_IMPORT(Xam, 0x0325, FUNCTION, "XuiCreateObject");
-    LOAD_IMPORT(Xam, 0x0326, FUNCTION, "XuiDestroyObject");
-    LOAD_IMPORT(Xam, 0x0327, FUNCTION, "XuiDynamicCast");
-    LOAD_IMPORT(Xam, 0x0328, FUNCTION, "XuiElementAddChild");
-    LOAD_IMPORT(Xam, 0x0329, FUNCTION, "XuiElementFindNamedFrame");
-    LOAD_IMPORT(Xam, 0x032A, FUNCTION, "XuiElementGetChildById");
-    LOAD_IMPORT(Xam, 0x032B, FUNCTION, "XuiElementGetFirstChild");
-    LOAD_IMPORT(Xam, 0x032C, FUNCTION, "XuiElementGetFocus");
-    LOAD_IMPORT(Xam, 0x032D, FUNCTION, "XuiElementGetFocusUser");
-    LOAD_IMPORT(Xam, 0x032E, FUNCTION, "XuiElementGetId");
-    LOAD_IMPORT(Xam, 0x032F, FUNCTION, "XuiElementGetLastChild");
-    LOAD_IMPORT(Xam, 0x0330, FUNCTION, "XuiElementGetNext");
-    LOAD_IMPORT(Xam, 0x0331, FUNCTION, "XuiElementGetParent");
-    LOAD_IMPORT(Xam, 0x0332, FUNCTION, "XuiElementGetUserFocus");
-    LOAD_IMPORT(Xam, 0x0333, FUNCTION, "XuiElementInitFocus");
-    LOAD_IMPORT(Xam, 0x0334, FUNCTION, "XuiElementInitUserFocus");
-    LOAD_IMPORT(Xam, 0x0335, FUNCTION, "XuiElementPlayTimeline");
-    LOAD_IMPORT(Xam, 0x0336, FUNCTION, "XuiElementSetBounds");
-    LOAD_IMPORT(Xam, 0x0337, FUNCTION, "XuiElementSetFocus");
-    LOAD_IMPORT(Xam, 0x0338, FUNCTION, "XuiElementSetUserFocus");
-    LOAD_IMPORT(Xam, 0x0339, FUNCTION, "XuiElementTreeGetFocus");
-    LOAD_IMPORT(Xam, 0x033A, FUNCTION, "XuiFindClass");
-    LOAD_IMPORT(Xam, 0x033B, FUNCTION, "XuiFreeStringTable");
-    LOAD_IMPORT(Xam, 0x033C, FUNCTION, "XuiGetBaseObject");
-    LOAD_IMPORT(Xam, 0x033D, FUNCTION, "XuiGetClass");
-    LOAD_IMPORT(Xam, 0x033E, FUNCTION, "XuiGetObjectClass");
-    LOAD_IMPORT(Xam, 0x033F, FUNCTION, "XuiGetOuter");
-    LOAD_IMPORT(Xam, 0x0340, FUNCTION, "XuiInit");
-    LOAD_IMPORT(Xam, 0x0341, FUNCTION, "XuiLoadFromBinary");
-    LOAD_IMPORT(Xam, 0x0342, FUNCTION, "XuiLoadStringTableFromFile");
-    LOAD_IMPORT(Xam, 0x0343, FUNCTION, "XuiVisualGetBasePath");
-    LOAD_IMPORT(Xam, 0x0344, FUNCTION, "XuiLookupStringTable");
-    LOAD_IMPORT(Xam, 0x0345, FUNCTION, "XuiNavButtonGetPressPath");
-    LOAD_IMPORT(Xam, 0x0346, FUNCTION, "XuiObjectFromHandle");
-    LOAD_IMPORT(Xam, 0x0347, FUNCTION, "XuiObjectGetProperty");
-    LOAD_IMPORT(Xam, 0x0348, FUNCTION, "XuiObjectGetPropertyId");
-    LOAD_IMPORT(Xam, 0x0349, FUNCTION, "XuiProcessInput");
-    LOAD_IMPORT(Xam, 0x034A, FUNCTION, "XuiRegisterClass");
-    LOAD_IMPORT(Xam, 0x034B, FUNCTION, "XuiRenderBegin");
-    LOAD_IMPORT(Xam, 0x034C, FUNCTION, "XuiRenderCreateDC");
-    LOAD_IMPORT(Xam, 0x034D, FUNCTION, "XuiRenderDCDeviceChanged");
-    LOAD_IMPORT(Xam, 0x034E, FUNCTION, "XuiRenderDestroyDC");
-    LOAD_IMPORT(Xam, 0x034F, FUNCTION, "XuiRenderEnd");
-    LOAD_IMPORT(Xam, 0x0350, FUNCTION, "XuiRenderGetBackBufferSize");
-    LOAD_IMPORT(Xam, 0x0351, FUNCTION, "XuiRenderInit");
-    LOAD_IMPORT(Xam, 0x0352, FUNCTION, "XuiRenderInitShared");
-    LOAD_IMPORT(Xam, 0x0353, FUNCTION, "XuiRenderPresent");
-    LOAD_IMPORT(Xam, 0x0354, FUNCTION, "XuiRenderSetViewTransform");
-    LOAD_IMPORT(Xam, 0x0355, FUNCTION, "XuiRenderUninit");
-    LOAD_IMPORT(Xam, 0x0356, FUNCTION, "XamShowNuiGuideUI");
-    LOAD_IMPORT(Xam, 0x0357, FUNCTION, "XuiSceneCreate");
-    LOAD_IMPORT(Xam, 0x0358, FUNCTION, "XuiSceneNavigateBack");
-    LOAD_IMPORT(Xam, 0x0359, FUNCTION, "XuiSceneNavigateFirst");
-    LOAD_IMPORT(Xam, 0x035A, FUNCTION, "XuiSceneNavigateForward");
-    LOAD_IMPORT(Xam, 0x035B, FUNCTION, "XuiScenePlayBackFromTransition");
-    LOAD_IMPORT(Xam, 0x035C, FUNCTION, "XuiScenePlayBackToTransition");
-    LOAD_IMPORT(Xam, 0x035D, FUNCTION, "XuiScenePlayFromTransition");
-    LOAD_IMPORT(Xam, 0x035E, FUNCTION, "XuiScenePlayToTransition");
-    LOAD_IMPORT(Xam, 0x035F, FUNCTION, "XuiSendMessage");
-    LOAD_IMPORT(Xam, 0x0360, FUNCTION, "XuiSetLocale");
-    LOAD_IMPORT(Xam, 0x0361, FUNCTION, "XuiUninit");
-    LOAD_IMPORT(Xam, 0x0362, FUNCTION, "XuiUnregisterClass");
-    LOAD_IMPORT(Xam, 0x0363, FUNCTION, "XuiTextElementSetText");
-    LOAD_IMPORT(Xam, 0x0364, FUNCTION, "XuiSetTimer");
-    LOAD_IMPORT(Xam, 0x0365, FUNCTION, "XuiTimersRun");
-    LOAD_IMPORT(Xam, 0x0366, FUNCTION, "XuiTextElementGetText");
-    LOAD_IMPORT(Xam, 0x0367, FUNCTION, "XuiVisualSetBasePath");
-    LOAD_IMPORT(Xam, 0x0368, FUNCTION, "XuiHandleIsValid");
-    LOAD_IMPORT(Xam, 0x0369, FUNCTION, "XuiAlloc");
-    LOAD_IMPORT(Xam, 0x036A, FUNCTION, "XuiFree");
-    LOAD_IMPORT(Xam, 0x036B, FUNCTION, "XuiDefault_True");
-    LOAD_IMPORT(Xam, 0x036C, FUNCTION, "XuiDefault_EmptyString");
-    LOAD_IMPORT(Xam, 0x036D, FUNCTION, "XuiDefault_IntegerZero");
-    LOAD_IMPORT(Xam, 0x036E, FUNCTION, "XuiCopyString");
-    LOAD_IMPORT(Xam, 0x036F, FUNCTION, "XuiRealloc");
-    LOAD_IMPORT(Xam, 0x0370, FUNCTION, "XuiControlPlayOptionalVisual");
-    LOAD_IMPORT(Xam, 0x0371, FUNCTION, "XuiKillTimer");
-    LOAD_IMPORT(Xam, 0x0372, FUNCTION, "XuiElementEnableInput");
-    LOAD_IMPORT(Xam, 0x0373, FUNCTION, "XuiElementInputEnabled");
-    LOAD_IMPORT(Xam, 0x0374, FUNCTION, "XuiIsInstanceOf");
-    LOAD_IMPORT(Xam, 0x0375, FUNCTION, "XuiResourceComposeLocator");
-    LOAD_IMPORT(Xam, 0x0376, FUNCTION, "XuiResourceLocatorIsAbsolute");
-    LOAD_IMPORT(Xam, 0x0377, FUNCTION, "XuiBroadcastMessage");
-    LOAD_IMPORT(Xam, 0x0378, FUNCTION, "XuiElementDisallowRecursiveTimelineControl");
-    LOAD_IMPORT(Xam, 0x0379, FUNCTION, "XUIElementPropVal_Construct");
-    LOAD_IMPORT(Xam, 0x037A, FUNCTION, "XUIElementPropVal_Destruct");
-    LOAD_IMPORT(Xam, 0x037B, FUNCTION, "XUIElementPropVal_SetString");
-    LOAD_IMPORT(Xam, 0x037C, FUNCTION, "XuiObjectSetProperty");
-    LOAD_IMPORT(Xam, 0x037D, FUNCTION, "XuiElementGetOpacity");
-    LOAD_IMPORT(Xam, 0x037E, FUNCTION, "XuiElementSetOpacity");
-    LOAD_IMPORT(Xam, 0x037F, FUNCTION, "XuiEditSetTextLimit");
-    LOAD_IMPORT(Xam, 0x0380, FUNCTION, "XuiEditGetTextLimit");
-    LOAD_IMPORT(Xam, 0x0381, FUNCTION, "XuiSliderSetValue");
-    LOAD_IMPORT(Xam, 0x0382, FUNCTION, "XuiSliderGetValue");
-    LOAD_IMPORT(Xam, 0x0383, FUNCTION, "XuiSliderSetRange");
-    LOAD_IMPORT(Xam, 0x0384, FUNCTION, "XuiElementUnlink");
-    LOAD_IMPORT(Xam, 0x0385, FUNCTION, "XuiElementInsertChild");
-    LOAD_IMPORT(Xam, 0x0386, FUNCTION, "XuiSceneNavigateBackToFirst");
-    LOAD_IMPORT(Xam, 0x0387, FUNCTION, "XuiProgressBarSetRange");
-    LOAD_IMPORT(Xam, 0x0388, FUNCTION, "XuiProgressBarSetValue");
-    LOAD_IMPORT(Xam, 0x0389, FUNCTION, "XuiProgressBarGetValue");
-    LOAD_IMPORT(Xam, 0x038A, FUNCTION, "XuiControlAttachVisual");
-    LOAD_IMPORT(Xam, 0x038B, FUNCTION, "XuiCreateTextureBrush");
-    LOAD_IMPORT(Xam, 0x038C, FUNCTION, "XuiDestroyBrush");
-    LOAD_IMPORT(Xam, 0x038D, FUNCTION, "XUIElementPropVal_SetColorFromUint");
-    LOAD_IMPORT(Xam, 0x038E, FUNCTION, "XuiFigureSetFill");
-    LOAD_IMPORT(Xam, 0x038F, FUNCTION, "XuiSliderGetRange");
-    LOAD_IMPORT(Xam, 0x0390, FUNCTION, "XuiFigureSetTexture");
-    LOAD_IMPORT(Xam, 0x0391, FUNCTION, "XuiControlGetItemAssociation");
-    LOAD_IMPORT(Xam, 0x0392, FUNCTION, "XuiResourceLoadAll");
-    LOAD_IMPORT(Xam, 0x0393, FUNCTION, "XuiImageElementSetImagePath");
-    LOAD_IMPORT(Xam, 0x0394, FUNCTION, "XuiImageElementGetImagePath");
-    LOAD_IMPORT(Xam, 0x0395, FUNCTION, "XuiControlGetVisual");
-    LOAD_IMPORT(Xam, 0x0396, FUNCTION, "XuiControlGetNavigation");
-    LOAD_IMPORT(Xam, 0x0397, FUNCTION, "XuiLookupStringTableByIndex");
-    LOAD_IMPORT(Xam, 0x0398, FUNCTION, "XUIElementPropVal_SetBool");
-    LOAD_IMPORT(Xam, 0x0399, FUNCTION, "XuiElementHasFocus");
-    LOAD_IMPORT(Xam, 0x039A, FUNCTION, "XUIElementPropVal_SetUint");
-    LOAD_IMPORT(Xam, 0x039B, FUNCTION, "XUIElementPropVal_Clear");
-    LOAD_IMPORT(Xam, 0x039C, FUNCTION, "XuiEditSetTextFormatInfo");
-    LOAD_IMPORT(Xam, 0x039D, FUNCTION, "XuiCreateSolidBrush");
-    LOAD_IMPORT(Xam, 0x039E, FUNCTION, "XuiSceneInterruptTransitions");
-    LOAD_IMPORT(Xam, 0x039F, FUNCTION, "XuiResourceOpen");
-    LOAD_IMPORT(Xam, 0x03A0, FUNCTION, "XuiResourceRead");
-    LOAD_IMPORT(Xam, 0x03A1, FUNCTION, "XuiResourceClose");
-    LOAD_IMPORT(Xam, 0x03A2, FUNCTION, "XuiVisualCreateInstance");
-    LOAD_IMPORT(Xam, 0x03A3, FUNCTION, "XuiElementGetTimeline");
-    LOAD_IMPORT(Xam, 0x03A4, FUNCTION, "GetCodecVersion");
-    LOAD_IMPORT(Xam, 0x03A5, FUNCTION, "XuiElementIsDescendant");
-    LOAD_IMPORT(Xam, 0x03A6, FUNCTION, "XuiSetMessageFilter");
-    LOAD_IMPORT(Xam, 0x03A7, FUNCTION, "XuiAttachTextureBrush");
-    LOAD_IMPORT(Xam, 0x03A8, FUNCTION, "XuiElementBeginRender");
-    LOAD_IMPORT(Xam, 0x03A9, FUNCTION, "XuiElementEndRender");
-    LOAD_IMPORT(Xam, 0x03AA, FUNCTION, "XuiDrawShape");
-    LOAD_IMPORT(Xam, 0x03AB, FUNCTION, "XuiSelectBrushEx");
-    LOAD_IMPORT(Xam, 0x03AC, FUNCTION, "XuiFigureGetShape");
-    LOAD_IMPORT(Xam, 0x03AD, FUNCTION, "XuiFillRect");
-    LOAD_IMPORT(Xam, 0x03AE, FUNCTION, "XuiVec2TransformCoord");
-    LOAD_IMPORT(Xam, 0x03AF, FUNCTION, "XuiMatrixMultiply");
-    LOAD_IMPORT(Xam, 0x03B0, FUNCTION, "XuiElementGetXForm");
-    LOAD_IMPORT(Xam, 0x03B1, FUNCTION, "XuiElementSetPosition");
-    LOAD_IMPORT(Xam, 0x03B2, FUNCTION, "XuiSelectBrush");
-    LOAD_IMPORT(Xam, 0x03B3, FUNCTION, "XuiElementRenderChildren");
-    LOAD_IMPORT(Xam, 0x03B4, FUNCTION, "XuiFreeUnusedTextures");
-    LOAD_IMPORT(Xam, 0x03B5, FUNCTION, "XuiListEnableItemOverride");
-    LOAD_IMPORT(Xam, 0x03B6, FUNCTION, "XuiListGetDefaultItemSize");
-    LOAD_IMPORT(Xam, 0x03B7, FUNCTION, "XuiResourceSeek");
-    LOAD_IMPORT(Xam, 0x03B8, FUNCTION, "XuiElementDiscardResources");
-    LOAD_IMPORT(Xam, 0x03B9, FUNCTION, "XuiTabSceneGoto");
-    LOAD_IMPORT(Xam, 0x03BA, FUNCTION, "XuiTabSceneGetCurrentTab");
-    LOAD_IMPORT(Xam, 0x03BB, FUNCTION, "XamShowWhatsOnUI");
-    LOAD_IMPORT(Xam, 0x03BC, FUNCTION, "XamShowEditProfileUI");
-    LOAD_IMPORT(Xam, 0x03BD, FUNCTION, "XamShowStorePickerUI");
-    LOAD_IMPORT(Xam, 0x03BE, FUNCTION, "XamShowTermsOfUseUI");
-    LOAD_IMPORT(Xam, 0x03BF, FUNCTION, "XamShowJoinPartyUI");
-    LOAD_IMPORT(Xam, 0x03C0, FUNCTION, "XamShowWordRegisterUI");
-    LOAD_IMPORT(Xam, 0x03C1, FUNCTION, "XamOverrideHudOpenType");
-    LOAD_IMPORT(Xam, 0x03C2, FUNCTION, "XamShowAchievementsUIEx");
-    LOAD_IMPORT(Xam, 0x03C3, FUNCTION, "XamUserGetUserTenure");
-    LOAD_IMPORT(Xam, 0x03C4, FUNCTION, "XamUserGetSubscriptionType");
-    LOAD_IMPORT(Xam, 0x03C5, FUNCTION, "XamShowGameVoiceChannelUI");
-    LOAD_IMPORT(Xam, 0x03C6, FUNCTION, "XamShowAvatarAwardsUI");
-    LOAD_IMPORT(Xam, 0x03C7, FUNCTION, "XamShowAvatarAwardGamesUI");
-    LOAD_IMPORT(Xam, 0x03C8, FUNCTION, "XamShowVideoRichPresenceUI");
-    LOAD_IMPORT(Xam, 0x03C9, FUNCTION, "XamHudGetUserIndex");
-    LOAD_IMPORT(Xam, 0x03CA, FUNCTION, "XGetAudioFlags");
-    LOAD_IMPORT(Xam, 0x03CB, FUNCTION, "XGetAVPack");
-    LOAD_IMPORT(Xam, 0x03CC, FUNCTION, "XGetGameRegion");
-    LOAD_IMPORT(Xam, 0x03CD, FUNCTION, "XGetLanguage");
-    LOAD_IMPORT(Xam, 0x03CE, FUNCTION, "XapipGetLocale");
-    LOAD_IMPORT(Xam, 0x03CF, FUNCTION, "XGetVideoFlags");
-    LOAD_IMPORT(Xam, 0x03D0, FUNCTION, "XGetVideoStandard");
-    LOAD_IMPORT(Xam, 0x03D1, FUNCTION, "XGetVideoMode");
-    LOAD_IMPORT(Xam, 0x03D2, FUNCTION, "XamGetLanguage");
-    LOAD_IMPORT(Xam, 0x03D3, FUNCTION, "XUITimeline_Run");
-    LOAD_IMPORT(Xam, 0x03D4, FUNCTION, "XamSetAutomation");
-    LOAD_IMPORT(Xam, 0x03D5, FUNCTION, "XAutomationpBindController");
-    LOAD_IMPORT(Xam, 0x03D6, FUNCTION, "XAutomationpUnbindController");
-    LOAD_IMPORT(Xam, 0x03D7, FUNCTION, "XAutomationpInputXenonButton");
-    LOAD_IMPORT(Xam, 0x03D8, FUNCTION, "XAutomationpInputPress");
-    LOAD_IMPORT(Xam, 0x03D9, FUNCTION, "XAutomationpInputSetState");
-    LOAD_IMPORT(Xam, 0x03DA, FUNCTION, "XamEnableOverdraw");
-    LOAD_IMPORT(Xam, 0x03DB, VARIABLE, "g_XuiAutomation");
-    LOAD_IMPORT(Xam, 0x03DC, FUNCTION, "XamVoiceGetMicArrayAudio");
-    LOAD_IMPORT(Xam, 0x03DD, FUNCTION, "XampSystemInput");
-    LOAD_IMPORT(Xam, 0x03DE, FUNCTION, "XamInputControl");
-    LOAD_IMPORT(Xam, 0x03DF, FUNCTION, "XuiElementGetPosition");
-    LOAD_IMPORT(Xam, 0x03E0, FUNCTION, "XamIsMessageBoxActive");
-    LOAD_IMPORT(Xam, 0x03E1, FUNCTION, "XamIsBackgroundSceneInTransition");
-    LOAD_IMPORT(Xam, 0x03E2, FUNCTION, "XuiElementTreeHasFocus");
-    LOAD_IMPORT(Xam, 0x03E3, FUNCTION, "XuiFigureClose");
-    LOAD_IMPORT(Xam, 0x03E4, FUNCTION, "GamerCardStartup");
-    LOAD_IMPORT(Xam, 0x03E5, FUNCTION, "GamerCardCleanup");
-    LOAD_IMPORT(Xam, 0x03E6, FUNCTION, "GamerCardRegisterControls");
-    LOAD_IMPORT(Xam, 0x03E7, FUNCTION, "GamerCardUnregisterControls");
-    LOAD_IMPORT(Xam, 0x03E8, FUNCTION, "RtlFindFirstFile");
-    LOAD_IMPORT(Xam, 0x03E9, FUNCTION, "RtlFindNextFile");
-    LOAD_IMPORT(Xam, 0x03EA, FUNCTION, "RtlGetModuleFileName");
-    LOAD_IMPORT(Xam, 0x03EB, FUNCTION, "RtlOutputDebugString");
-    LOAD_IMPORT(Xam, 0x03EC, FUNCTION, "RtlRemoveDirectory");
-    LOAD_IMPORT(Xam, 0x03ED, FUNCTION, "RtlSleep");
-    LOAD_IMPORT(Xam, 0x03EE, FUNCTION, "RtlGetLastError");
-    LOAD_IMPORT(Xam, 0x03EF, FUNCTION, "RtlSetLastError");
-    LOAD_IMPORT(Xam, 0x03F0, FUNCTION, "RtlSetLastNTError");
-    LOAD_IMPORT(Xam, 0x03F1, FUNCTION, "RtlDebugPrint");
-    LOAD_IMPORT(Xam, 0x03F2, FUNCTION, "RtlDebugError");
-    LOAD_IMPORT(Xam, 0x03F3, FUNCTION, "XDebugWarning");
-    LOAD_IMPORT(Xam, 0x03F4, FUNCTION, "RtlDebugTrace");
-    LOAD_IMPORT(Xam, 0x03F5, FUNCTION, "RtlDebugEntry");
-    LOAD_IMPORT(Xam, 0x03F6, FUNCTION, "RtlDebugExit");
-    LOAD_IMPORT(Xam, 0x03F7, FUNCTION, "RtlGetAttributesOnHeapAlloc");
-    LOAD_IMPORT(Xam, 0x03F8, FUNCTION, "RtlSetAttributesOnHeapAlloc");
-    LOAD_IMPORT(Xam, 0x03F9, FUNCTION, "XuiFigureSetShape");
-    LOAD_IMPORT(Xam, 0x03FA, FUNCTION, "RtlCreateHeap");
-    LOAD_IMPORT(Xam, 0x03FB, FUNCTION, "RtlDestroyHeap");
-    LOAD_IMPORT(Xam, 0x03FC, FUNCTION, "RtlAllocateHeap");
-    LOAD_IMPORT(Xam, 0x03FD, FUNCTION, "RtlAllocateHeapSlowly");
-    LOAD_IMPORT(Xam, 0x03FE, FUNCTION, "RtlReAllocateHeap");
-    LOAD_IMPORT(Xam, 0x03FF, FUNCTION, "RtlFreeHeap");
-    LOAD_IMPORT(Xam, 0x0400, FUNCTION, "RtlFreeHeapSlowly");
-    LOAD_IMPORT(Xam, 0x0401, FUNCTION, "RtlSizeHeap");
-    LOAD_IMPORT(Xam, 0x0402, FUNCTION, "RtlZeroHeap");
-    LOAD_IMPORT(Xam, 0x0403, FUNCTION, "RtlDebugWalkHeap");
-    LOAD_IMPORT(Xam, 0x0404, FUNCTION, "RtlWalkHeap");
-    LOAD_IMPORT(Xam, 0x0405, FUNCTION, "RtlLockHeap");
-    LOAD_IMPORT(Xam, 0x0406, FUNCTION, "RtlUnlockHeap");
-    LOAD_IMPORT(Xam, 0x0407, FUNCTION, "RtlValidateHeap");
-    LOAD_IMPORT(Xam, 0x0408, FUNCTION, "RtlDebugCompactHeap");
-    LOAD_IMPORT(Xam, 0x0409, FUNCTION, "RtlCompactHeap");
-    LOAD_IMPORT(Xam, 0x040A, FUNCTION, "XamAppSetTestOption");
-    LOAD_IMPORT(Xam, 0x040B, FUNCTION, "XamAppReportError");
-    LOAD_IMPORT(Xam, 0x040C, FUNCTION, "XamIsNuiUIActive");
-    LOAD_IMPORT(Xam, 0x040D, FUNCTION, "XamVerifyPasscode");
-    LOAD_IMPORT(Xam, 0x040E, FUNCTION, "OutputDebugStringA");
-    LOAD_IMPORT(Xam, 0x040F, FUNCTION, "DebugBreak");
-    LOAD_IMPORT(Xam, 0x0410, FUNCTION, "GetCurrentThreadId");
-    LOAD_IMPORT(Xam, 0x0411, FUNCTION, "XDebugError");
-    LOAD_IMPORT(Xam, 0x0412, FUNCTION, "XDebugWarning");
-    LOAD_IMPORT(Xam, 0x0413, FUNCTION, "RtlDebugSetLevel");
-    LOAD_IMPORT(Xam, 0x0414, FUNCTION, "CloseHandle");
-    LOAD_IMPORT(Xam, 0x0415, FUNCTION, "GetTickCount");
-    LOAD_IMPORT(Xam, 0x0416, FUNCTION, "GetLastError");
-    LOAD_IMPORT(Xam, 0x0417, FUNCTION, "SetFilePointer");
-    LOAD_IMPORT(Xam, 0x0418, FUNCTION, "SetFilePointerEx");
-    LOAD_IMPORT(Xam, 0x0419, FUNCTION, "SetLastError");
-    LOAD_IMPORT(Xam, 0x041A, FUNCTION, "MultiByteToWideChar");
-    LOAD_IMPORT(Xam, 0x041B, FUNCTION, "WideCharToMultiByte");
-    LOAD_IMPORT(Xam, 0x041C, FUNCTION, "ReadFile");
-    LOAD_IMPORT(Xam, 0x041D, FUNCTION, "FlushFileBuffers");
-    LOAD_IMPORT(Xam, 0x041E, FUNCTION, "WriteFile");
-    LOAD_IMPORT(Xam, 0x041F, FUNCTION, "OutputDebugStringW");
-    LOAD_IMPORT(Xam, 0x0420, FUNCTION, "SetEvent");
-    LOAD_IMPORT(Xam, 0x0421, FUNCTION, "XapiFormatTimeOut");
-    LOAD_IMPORT(Xam, 0x0422, FUNCTION, "CreateMutexA");
-    LOAD_IMPORT(Xam, 0x0423, FUNCTION, "OpenMutexA");
-    LOAD_IMPORT(Xam, 0x0424, FUNCTION, "ReleaseMutex");
-    LOAD_IMPORT(Xam, 0x0425, FUNCTION, "WaitForSingleObject");
-    LOAD_IMPORT(Xam, 0x0426, FUNCTION, "WaitForSingleObjectEx");
-    LOAD_IMPORT(Xam, 0x0427, FUNCTION, "GetFileSize");
-    LOAD_IMPORT(Xam, 0x0428, FUNCTION, "GetFileSizeEx");
-    LOAD_IMPORT(Xam, 0x0429, FUNCTION, "XapiDirectoryInformationToFindData");
-    LOAD_IMPORT(Xam, 0x042A, FUNCTION, "XapiFormatObjectAttributes");
-    LOAD_IMPORT(Xam, 0x042B, FUNCTION, "ResetEvent");
-    LOAD_IMPORT(Xam, 0x042C, FUNCTION, "wsprintfA");
-    LOAD_IMPORT(Xam, 0x042D, FUNCTION, "wsprintfW");
-    LOAD_IMPORT(Xam, 0x042E, FUNCTION, "GetOverlappedResult");
-    LOAD_IMPORT(Xam, 0x042F, FUNCTION, "QueryPerformanceCounter");
-    LOAD_IMPORT(Xam, 0x0430, FUNCTION, "QueryPerformanceFrequency");
-    LOAD_IMPORT(Xam, 0x0431, FUNCTION, "LocalAlloc");
-    LOAD_IMPORT(Xam, 0x0432, FUNCTION, "LocalFree");
-    LOAD_IMPORT(Xam, 0x0433, FUNCTION, "RaiseException");
-    LOAD_IMPORT(Xam, 0x0434, FUNCTION, "RtlUniform");
-    LOAD_IMPORT(Xam, 0x0435, FUNCTION, "RtlRandom");
-    LOAD_IMPORT(Xam, 0x0436, FUNCTION, "Sleep");
-    LOAD_IMPORT(Xam, 0x0437, FUNCTION, "SleepEx");
-    LOAD_IMPORT(Xam, 0x0438, FUNCTION, "XMemSet");
-    LOAD_IMPORT(Xam, 0x0439, FUNCTION, "XRegisterThreadNotifyRoutine");
-    LOAD_IMPORT(Xam, 0x043A, FUNCTION, "XGetOverlappedExtendedError");
-    LOAD_IMPORT(Xam, 0x043B, FUNCTION, "XGetOverlappedResult");
-    LOAD_IMPORT(Xam, 0x043C, FUNCTION, "CreateThread");
-    LOAD_IMPORT(Xam, 0x043D, FUNCTION, "ResumeThread");
-    LOAD_IMPORT(Xam, 0x043E, FUNCTION, "ExitThread");
-    LOAD_IMPORT(Xam, 0x043F, FUNCTION, "GetTimeZoneInformation");
-    LOAD_IMPORT(Xam, 0x0440, FUNCTION, "GetSystemTimeAsFileTime");
-    LOAD_IMPORT(Xam, 0x0441, FUNCTION, "SystemTimeToFileTime");
-    LOAD_IMPORT(Xam, 0x0442, FUNCTION, "FileTimeToSystemTime");
-    LOAD_IMPORT(Xam, 0x0443, FUNCTION, "GetSystemTime");
-    LOAD_IMPORT(Xam, 0x0444, FUNCTION, "GetLocalTime");
-    LOAD_IMPORT(Xam, 0x0445, FUNCTION, "CreateDirectoryA");
-    LOAD_IMPORT(Xam, 0x0446, FUNCTION, "CreateEventA");
-    LOAD_IMPORT(Xam, 0x0447, FUNCTION, "CreateFileA");
-    LOAD_IMPORT(Xam, 0x0448, FUNCTION, "DeleteFileA");
-    LOAD_IMPORT(Xam, 0x0449, FUNCTION, "FindFirstFileA");
-    LOAD_IMPORT(Xam, 0x044A, FUNCTION, "FindNextFileA");
-    LOAD_IMPORT(Xam, 0x044B, FUNCTION, "GetFileAttributesA");
-    LOAD_IMPORT(Xam, 0x044C, FUNCTION, "XamLoaderGetCurrentTitleD3DVersion");
-    LOAD_IMPORT(Xam, 0x044D, FUNCTION, "GetFileAttributesExA");
-    LOAD_IMPORT(Xam, 0x044E, FUNCTION, "GetModuleHandleA");
-    LOAD_IMPORT(Xam, 0x044F, FUNCTION, "GetDiskFreeSpaceExA");
-    LOAD_IMPORT(Xam, 0x0450, FUNCTION, "CopyFileA");
-    LOAD_IMPORT(Xam, 0x0451, FUNCTION, "SetEndOfFile");
-    LOAD_IMPORT(Xam, 0x0452, FUNCTION, "XamFamilyAddParentalExemptionToList");
-    LOAD_IMPORT(Xam, 0x0453, FUNCTION, "XamFamilyIsParentalValidationRequired");
-    LOAD_IMPORT(Xam, 0x0454, FUNCTION, "PIXBeginCapture");
-    LOAD_IMPORT(Xam, 0x0455, FUNCTION, "PIXEndCapture");
-    LOAD_IMPORT(Xam, 0x0456, FUNCTION, "PIXAddCounter");
-    LOAD_IMPORT(Xam, 0x0457, FUNCTION, "PIXGetGPUSlot");
-    LOAD_IMPORT(Xam, 0x0458, FUNCTION, "SetWaitableTimer");
-    LOAD_IMPORT(Xam, 0x0459, FUNCTION, "CancelWaitableTimer");
-    LOAD_IMPORT(Xam, 0x045A, FUNCTION, "CreateWaitableTimerA");
-    LOAD_IMPORT(Xam, 0x045B, FUNCTION, "DuplicateHandle");
-    LOAD_IMPORT(Xam, 0x045C, FUNCTION, "XapipCreateThread");
-    LOAD_IMPORT(Xam, 0x045D, FUNCTION, "lstrcpyA");
-    LOAD_IMPORT(Xam, 0x045E, FUNCTION, "lstrcpyW");
-    LOAD_IMPORT(Xam, 0x045F, FUNCTION, "lstrcpynA");
-    LOAD_IMPORT(Xam, 0x0460, FUNCTION, "lstrcpynW");
-    LOAD_IMPORT(Xam, 0x0461, FUNCTION, "lstrcatA");
-    LOAD_IMPORT(Xam, 0x0462, FUNCTION, "lstrcatW");
-    LOAD_IMPORT(Xam, 0x0463, FUNCTION, "lstrlenA");
-    LOAD_IMPORT(Xam, 0x0464, FUNCTION, "lstrlenW");
-    LOAD_IMPORT(Xam, 0x0465, FUNCTION, "IsBadReadPtr");
-    LOAD_IMPORT(Xam, 0x0466, FUNCTION, "IsBadWritePtr");
-    LOAD_IMPORT(Xam, 0x0467, FUNCTION, "FileTimeToLocalFileTime");
-    LOAD_IMPORT(Xam, 0x0468, FUNCTION, "XMemCpy");
-    LOAD_IMPORT(Xam, 0x0469, FUNCTION, "XMemCpyStreaming");
-    LOAD_IMPORT(Xam, 0x046A, FUNCTION, "XamHudSetUserIndex");
-    LOAD_IMPORT(Xam, 0x046B, FUNCTION, "XamShowNuiTroubleshooterUI");
-    LOAD_IMPORT(Xam, 0x046C, FUNCTION, "XamTestShowNuiTroubleshooterUI");
-    LOAD_IMPORT(Xam, 0x046D, FUNCTION, "XamShowPasscodeVerifyUIEx");
-    LOAD_IMPORT(Xam, 0x046E, FUNCTION, "XamShowNuiAchievementsUI");
-    LOAD_IMPORT(Xam, 0x046F, FUNCTION, "XamShowNuiCommunitySessionsUI");
-    LOAD_IMPORT(Xam, 0x0470, FUNCTION, "XamShowNuiDeviceSelectorUI");
-    LOAD_IMPORT(Xam, 0x0471, FUNCTION, "XamShowNuiDirtyDiscErrorUI");
-    LOAD_IMPORT(Xam, 0x0472, FUNCTION, "XamShowNuiFriendsUI");
-    LOAD_IMPORT(Xam, 0x0473, FUNCTION, "XamShowNuiGameInviteUI");
-    LOAD_IMPORT(Xam, 0x0474, FUNCTION, "XamShowNuiGamerCardUIForXUID");
-    LOAD_IMPORT(Xam, 0x0475, FUNCTION, "XamShowNuiMarketplaceDownloadItemsUI");
-    LOAD_IMPORT(Xam, 0x0476, FUNCTION, "XamShowNuiMarketplaceUI");
-    LOAD_IMPORT(Xam, 0x0477, FUNCTION, "XamShowNuiMessageBoxUI");
-    LOAD_IMPORT(Xam, 0x0478, FUNCTION, "XamShowNuiPartyUI");
-    LOAD_IMPORT(Xam, 0x0479, FUNCTION, "XamShowNuiFriendRequestUI");
-    LOAD_IMPORT(Xam, 0x047A, FUNCTION, "XamShowNuiSigninUI");
-    LOAD_IMPORT(Xam, 0x047B, FUNCTION, "XamShowNuiControllerRequiredUI");
-    LOAD_IMPORT(Xam, 0x047C, FUNCTION, "XamShowNuiGamesUI");
-    LOAD_IMPORT(Xam, 0x047D, FUNCTION, "XamShowNuiHardwareRequiredUI");
-    LOAD_IMPORT(Xam, 0x047E, FUNCTION, "XamCacheStoreFileByString");
-    LOAD_IMPORT(Xam, 0x047F, FUNCTION, "XamCacheFetchFileByString");
-    LOAD_IMPORT(Xam, 0x0480, FUNCTION, "XamCacheDeleteFileByString");
-    LOAD_IMPORT(Xam, 0x0481, FUNCTION, "XamGetCachedTitleNameEx");
-    LOAD_IMPORT(Xam, 0x0482, FUNCTION, "XamXlfsInitializeUploadQueue");
-    LOAD_IMPORT(Xam, 0x0483, FUNCTION, "XamXlfsUninitializeUploadQueue");
-    LOAD_IMPORT(Xam, 0x0484, FUNCTION, "XamXlfsMountUploadQueueInstance");
-    LOAD_IMPORT(Xam, 0x0485, FUNCTION, "XamXlfsUnmountUploadQueueInstance");
-    LOAD_IMPORT(Xam, 0x0486, FUNCTION, "XamVoiceRecordUserPrivileges");
-    LOAD_IMPORT(Xam, 0x0487, FUNCTION, "XamXlfsInitializeUploadQueueWithTestHooks");
-    LOAD_IMPORT(Xam, 0x0488, FUNCTION, "XamXlfsNotifyContentDeletion");
-    LOAD_IMPORT(Xam, 0x0489, FUNCTION, "XMemAlloc");
-    LOAD_IMPORT(Xam, 0x048A, FUNCTION, "XMemFree");
-    LOAD_IMPORT(Xam, 0x048B, FUNCTION, "XMemSize");
-    LOAD_IMPORT(Xam, 0x048C, FUNCTION, "XamVoiceSetMicArrayIdleUsers");
-    LOAD_IMPORT(Xam, 0x048D, FUNCTION, "XamVoiceMuteMicArray");
-    LOAD_IMPORT(Xam, 0x048E, FUNCTION, "XamVoiceGetMicArrayUnderrunStatus");
-    LOAD_IMPORT(Xam, 0x048F, FUNCTION, "XuiSceneEnableTransitionDependency");
-    LOAD_IMPORT(Xam, 0x0490, FUNCTION, "XamVoiceGetMicArrayAudioEx");
-    LOAD_IMPORT(Xam, 0x0491, FUNCTION, "XamVoiceDisableMicArray");
-    LOAD_IMPORT(Xam, 0x0497, FUNCTION, "XamVoiceIsActiveProcess");
-    LOAD_IMPORT(Xam, 0x04B0, FUNCTION, "XMPRegisterCodec");
-    LOAD_IMPORT(Xam, 0x0514, FUNCTION, "XamIsCurrentTitleIptv");
-    LOAD_IMPORT(Xam, 0x0515, FUNCTION, "XamIsIptvEnabled");
-    LOAD_IMPORT(Xam, 0x0516, FUNCTION, "XamIsDvrRecording");
-    LOAD_IMPORT(Xam, 0x0517, FUNCTION, "XamIptvUninstall");
-    LOAD_IMPORT(Xam, 0x0518, FUNCTION, "XamGetDvrStorage");
-    LOAD_IMPORT(Xam, 0x0519, FUNCTION, "XamSetDvrStorage");
-    LOAD_IMPORT(Xam, 0x051A, FUNCTION, "XamIptvGetServiceName");
-    LOAD_IMPORT(Xam, 0x051B, FUNCTION, "XamNuiHudGetEngagedEnrollmentIndex");
-    LOAD_IMPORT(Xam, 0x0578, FUNCTION, "XamReminderGetItems");
-    LOAD_IMPORT(Xam, 0x0579, FUNCTION, "XamReminderClearItems");
-    LOAD_IMPORT(Xam, 0x057A, FUNCTION, "XamReminderItemAdd");
-    LOAD_IMPORT(Xam, 0x057B, FUNCTION, "XamReminderItemRemove");
-    LOAD_IMPORT(Xam, 0x057C, FUNCTION, "XamReminderGetNextItem");
-    LOAD_IMPORT(Xam, 0x057D, FUNCTION, "XamReminderGetModifiedTime");
-    LOAD_IMPORT(Xam, 0x057E, FUNCTION, "XamReminderClearCache");
-    LOAD_IMPORT(Xam, 0x05DC, FUNCTION, "XamAvatarInitialize");
-    LOAD_IMPORT(Xam, 0x05DD, FUNCTION, "XamAvatarShutdown");
-    LOAD_IMPORT(Xam, 0x05DE, FUNCTION, "XamAvatarGetManifestLocalUser");
-    LOAD_IMPORT(Xam, 0x05DF, FUNCTION, "XamAvatarGetManifestsByXuid");
-    LOAD_IMPORT(Xam, 0x05E0, FUNCTION, "XamAvatarGetAssetsResultSize");
-    LOAD_IMPORT(Xam, 0x05E1, FUNCTION, "XamAvatarGetAssets");
-    LOAD_IMPORT(Xam, 0x05E2, FUNCTION, "XamAvatarGenerateMipMaps");
-    LOAD_IMPORT(Xam, 0x05E3, FUNCTION, "XamAvatarSetCustomAsset");
-    LOAD_IMPORT(Xam, 0x05E4, FUNCTION, "XamAvatarSetManifest");
-    LOAD_IMPORT(Xam, 0x05E5, FUNCTION, "EnumerateMediaObjects");
-    LOAD_IMPORT(Xam, 0x05E6, FUNCTION, "EnumerateMediaObjects");
-    LOAD_IMPORT(Xam, 0x05E7, FUNCTION, "XamAvatarLoadAnimation");
-    LOAD_IMPORT(Xam, 0x05E8, FUNCTION, "XamAvatarBeginEnumAssets");
-    LOAD_IMPORT(Xam, 0x05E9, FUNCTION, "XamAvatarEndEnumAssets");
-    LOAD_IMPORT(Xam, 0x05EA, FUNCTION, "XamAvatarEnumAssets");
-    LOAD_IMPORT(Xam, 0x05EB, FUNCTION, "XamAvatarGetMetadataRandom");
-    LOAD_IMPORT(Xam, 0x05EC, FUNCTION, "EnumerateMediaObjects");
-    LOAD_IMPORT(Xam, 0x05ED, FUNCTION, "EnumerateMediaObjects");
-    LOAD_IMPORT(Xam, 0x05EE, FUNCTION, "XamAvatarGetMetadataSignedOutProfileCount");
-    LOAD_IMPORT(Xam, 0x05EF, FUNCTION, "XamAvatarGetMetadataSignedOutProfile");
-    LOAD_IMPORT(Xam, 0x05F0, FUNCTION, "EnumerateMediaObjects");
-    LOAD_IMPORT(Xam, 0x05F1, FUNCTION, "XamAvatarManifestGetBodyType");
-    LOAD_IMPORT(Xam, 0x05F2, FUNCTION, "XamAvatarGetInstrumentation");
-    LOAD_IMPORT(Xam, 0x05F3, FUNCTION, "XamAvatarGetAssetIcon");
-    LOAD_IMPORT(Xam, 0x05F4, FUNCTION, "XamAvatarWearNow");
-    LOAD_IMPORT(Xam, 0x05F5, FUNCTION, "XamAvatarGetAssetBinary");
-    LOAD_IMPORT(Xam, 0x05F6, FUNCTION, "XamAvatarReinstallAwardedAsset");
-    LOAD_IMPORT(Xam, 0x05F7, FUNCTION, "XamAvatarGetInstalledAssetPackageDescription");
-    LOAD_IMPORT(Xam, 0x05F8, FUNCTION, "XamAvatarSetMocks");
-    LOAD_IMPORT(Xam, 0x060E, FUNCTION, "XamContentMountInstalledGame");
-    LOAD_IMPORT(Xam, 0x060F, FUNCTION, "XamContentIsGameInstalledToHDD");
-    LOAD_IMPORT(Xam, 0x0610, FUNCTION, "XamContentQueryLicenseInternal");
-    LOAD_IMPORT(Xam, 0x0611, FUNCTION, "XamContentGetDeviceVolumePath");
-    LOAD_IMPORT(Xam, 0x0612, FUNCTION, "XamContentDeviceCheckUpdates");
-    LOAD_IMPORT(Xam, 0x0613, FUNCTION, "XamContentGetHeaderInternal");
-    LOAD_IMPORT(Xam, 0x0640, FUNCTION, "XamPackageManagerFindPackageContainingIndexedXEX");
-    LOAD_IMPORT(Xam, 0x0641, FUNCTION, "XamPackageManagerReinitialize");
-    LOAD_IMPORT(Xam, 0x0642, FUNCTION, "XamPackageManagerGetAuthoritativeManifestVersion");
-    LOAD_IMPORT(Xam, 0x0643, FUNCTION, "XamGetCurrentSystemOnlineManifestRevision");
-    LOAD_IMPORT(Xam, 0x0644, FUNCTION, "XamPackageManagerDeleteExtendedPartition");
-    LOAD_IMPORT(Xam, 0x0645, FUNCTION, "XamPackageManagerHasExtendedPartition");
-    LOAD_IMPORT(Xam, 0x0646, FUNCTION, "XamPackageManagerGetExperienceMode");
-    LOAD_IMPORT(Xam, 0x0647, FUNCTION, "XamPackageManagerGetFeatureRequiresUpdateStrings");
-    LOAD_IMPORT(Xam, 0x0648, FUNCTION, "XamPackageManagerGetFileSize");
-    LOAD_IMPORT(Xam, 0x0649, FUNCTION, "XampDemandUpdateGetAttributes");
-    LOAD_IMPORT(Xam, 0x064A, FUNCTION, "XampDemandUpdateGetExtendedAttributes");
-    LOAD_IMPORT(Xam, 0x064B, FUNCTION, "XampDemandUpdateGetInstance");
-    LOAD_IMPORT(Xam, 0x064C, FUNCTION, "XampDemandUpdateSetRefreshTestFlags");
-    LOAD_IMPORT(Xam, 0x064D, FUNCTION, "XampDemandUpdateIsRefreshTestFlagSet");
-    LOAD_IMPORT(Xam, 0x064E, FUNCTION, "XampDemandUpdateGetManifestLocalPath");
-    LOAD_IMPORT(Xam, 0x064F, FUNCTION, "XampDemandUpdateRefreshManifest");
-    LOAD_IMPORT(Xam, 0x0650, FUNCTION, "XdfInitialize");
-    LOAD_IMPORT(Xam, 0x0651, FUNCTION, "XdfShutdown");
-    LOAD_IMPORT(Xam, 0x0652, FUNCTION, "XdfGetExpectedDownloadSize");
-    LOAD_IMPORT(Xam, 0x0653, FUNCTION, "XdfGetItem");
-    LOAD_IMPORT(Xam, 0x0654, FUNCTION, "XdfCacheItem");
-    LOAD_IMPORT(Xam, 0x0655, FUNCTION, "XdfLoadXexFromCache");
-    LOAD_IMPORT(Xam, 0x0656, FUNCTION, "XdfLoadXex");
-    LOAD_IMPORT(Xam, 0x0657, FUNCTION, "XdfCancelRequest");
-    LOAD_IMPORT(Xam, 0x0658, FUNCTION, "XdfResumeDelayedItem");
-    LOAD_IMPORT(Xam, 0x0659, FUNCTION, "XdfLaunchNewImageFromCache");
-    LOAD_IMPORT(Xam, 0x065A, FUNCTION, "XampDemandUpdateRefreshManifestDuringLogon");
-    LOAD_IMPORT(Xam, 0x065B, FUNCTION, "XampDemandUpdateCheckOnlineManifestChanged");
-    LOAD_IMPORT(Xam, 0x065C, FUNCTION, "XampDemandUpdateRunCacheCleaner");
-    LOAD_IMPORT(Xam, 0x0686, FUNCTION, "XamXStudioRequest");
-    LOAD_IMPORT(Xam, 0x06A4, FUNCTION, "XamShowAvatarMiniCreatorUI");
-    LOAD_IMPORT(Xam, 0x06A5, FUNCTION, "XamShowGoldUpgradeUI");
-    LOAD_IMPORT(Xam, 0x06A6, FUNCTION, "XamResumeUpdaterUI");
-    LOAD_IMPORT(Xam, 0x06A7, FUNCTION, "XamShowDirectAcquireUI");
-    LOAD_IMPORT(Xam, 0x06A8, FUNCTION, "XamShowPaymentOptionsUI");
-    LOAD_IMPORT(Xam, 0x0708, FUNCTION, "XamGetLiveHiveValueA");
-    LOAD_IMPORT(Xam, 0x0709, FUNCTION, "XamGetLiveHiveValueW");
-    LOAD_IMPORT(Xam, 0x070A, FUNCTION, "XamGetLiveHiveValueDuringLogonAttemptA");
-    LOAD_IMPORT(Xam, 0x076C, FUNCTION, "XamDownloadMarketplaceStoresList");
-    LOAD_IMPORT(Xam, 0x076D, FUNCTION, "XamGetStoreFront");
-    LOAD_IMPORT(Xam, 0x076E, FUNCTION, "XamSetStagingMode");
-    LOAD_IMPORT(Xam, 0x076F, FUNCTION, "XamGetStagingMode");
-    LOAD_IMPORT(Xam, 0x0770, FUNCTION, "XamAppGetSessionId");
-    LOAD_IMPORT(Xam, 0x07D0, FUNCTION, "XamDoesOmniNeedConfiguration");
-    LOAD_IMPORT(Xam, 0x07D1, FUNCTION, "XamFirstRunExperienceShouldRun");
-    LOAD_IMPORT(Xam, 0x07D2, FUNCTION, "GetProcessHeap");
-    LOAD_IMPORT(Xam, 0x07D3, FUNCTION, "UnhandledExceptionFilter");
-    LOAD_IMPORT(Xam, 0x07D4, FUNCTION, "SetUnhandledExceptionFilter");
-    LOAD_IMPORT(Xam, 0x07D5, FUNCTION, "XamIsOptionalMediaUpdateInstalled");
-    LOAD_IMPORT(Xam, 0x07D6, FUNCTION, "XamShowOptionalMediaUpdateRequiredUI");
-    LOAD_IMPORT(Xam, 0x07D7, FUNCTION, "XamShowOptionalMediaUpdateRequiredUIEx");
-    LOAD_IMPORT(Xam, 0x07D8, FUNCTION, "XamShowFirstRunWelcomeUI");
-    LOAD_IMPORT(Xam, 0x07D9, FUNCTION, "XamTaskCreateQueueEx");
-    LOAD_IMPORT(Xam, 0x07DA, FUNCTION, "XamSetDashBackstackData");
-    LOAD_IMPORT(Xam, 0x07DB, FUNCTION, "XamLaunchAvatarEditor");
-    LOAD_IMPORT(Xam, 0x07DC, FUNCTION, "XamGetDashBackstackData");
-    LOAD_IMPORT(Xam, 0x07DD, FUNCTION, "XamGetDashBackstackNodesCount");
-    LOAD_IMPORT(Xam, 0x07DE, FUNCTION, "XamSetLastActiveUserData");
-    LOAD_IMPORT(Xam, 0x07DF, FUNCTION, "XamGetLastActiveUserData");
-    LOAD_IMPORT(Xam, 0x07E0, FUNCTION, "XamSetActiveDashAppInfo");
-    LOAD_IMPORT(Xam, 0x07E1, FUNCTION, "XamGetActiveDashAppInfo");
-    LOAD_IMPORT(Xam, 0x0802, FUNCTION, "XamUserCreateAvatarAssetEnumerator");
-    LOAD_IMPORT(Xam, 0x0803, FUNCTION, "XamInitializeGameTileCache");
-    LOAD_IMPORT(Xam, 0x0804, FUNCTION, "XamDestroyGameTileCache");
-    LOAD_IMPORT(Xam, 0x0805, FUNCTION, "XamReadGameTileImage");
-    LOAD_IMPORT(Xam, 0x0806, FUNCTION, "XamShouldThrottleAccountInfoCall");
-    LOAD_IMPORT(Xam, 0x0807, FUNCTION, "XuiClassDerivesFrom");
-    LOAD_IMPORT(Xam, 0x0808, FUNCTION, "XuiFreeVisuals");
-    LOAD_IMPORT(Xam, 0x0809, FUNCTION, "XuiGetBaseClass");
-    LOAD_IMPORT(Xam, 0x080A, FUNCTION, "XuiLoadVisualFromBinary");
-    LOAD_IMPORT(Xam, 0x080B, FUNCTION, "XuiResourceGetBuffer");
-    LOAD_IMPORT(Xam, 0x080C, FUNCTION, "XuiResourceGetTotalSize");
-    LOAD_IMPORT(Xam, 0x080D, FUNCTION, "XuiElementGetUserData");
-    LOAD_IMPORT(Xam, 0x080E, FUNCTION, "XuiElementSetUserData");
-    LOAD_IMPORT(Xam, 0x080F, FUNCTION, "XuiTabSceneGetCount");
-    LOAD_IMPORT(Xam, 0x0810, FUNCTION, "XuiSliderGetStep");
-    LOAD_IMPORT(Xam, 0x0811, FUNCTION, "XuiSliderSetStep");
-    LOAD_IMPORT(Xam, 0x0812, FUNCTION, "XuiProgressBarGetRange");
-    LOAD_IMPORT(Xam, 0x0813, FUNCTION, "XuiElementSetHittable");
-    LOAD_IMPORT(Xam, 0x0814, FUNCTION, "XuiElementPlayNamedFrames");
-    LOAD_IMPORT(Xam, 0x0815, FUNCTION, "XuiElementGetPivot");
-    LOAD_IMPORT(Xam, 0x0816, FUNCTION, "XuiElementGetPrev");
-    LOAD_IMPORT(Xam, 0x0817, FUNCTION, "XuiElementGetScale");
-    LOAD_IMPORT(Xam, 0x0818, FUNCTION, "XuiElementSetPivot");
-    LOAD_IMPORT(Xam, 0x0819, FUNCTION, "XuiElementSetRotation");
-    LOAD_IMPORT(Xam, 0x081A, FUNCTION, "XuiElementSetScale");
-    LOAD_IMPORT(Xam, 0x081B, FUNCTION, "XuiControlWantsUnfocusedInput");
-    LOAD_IMPORT(Xam, 0x081C, FUNCTION, "XuiResourceOpenNoLoc");
-    LOAD_IMPORT(Xam, 0x081D, FUNCTION, "XuiResourceReleasePackage");
-    LOAD_IMPORT(Xam, 0x081E, FUNCTION, "XuiResourceGetPackageEntryInfo");
-    LOAD_IMPORT(Xam, 0x081F, FUNCTION, "XuiResourceGetPackageEntryCount");
-    LOAD_IMPORT(Xam, 0x0820, FUNCTION, "XuiResourceOpenPackage");
-    LOAD_IMPORT(Xam, 0x0821, FUNCTION, "XamCodeCoverageFileOpen");
-    LOAD_IMPORT(Xam, 0x0822, FUNCTION, "XamCodeCoverageFileClose");
-    LOAD_IMPORT(Xam, 0x0823, FUNCTION, "XamCodeCoverageFileLseek");
-    LOAD_IMPORT(Xam, 0x0824, FUNCTION, "XamCodeCoverageFileRead");
-    LOAD_IMPORT(Xam, 0x0825, FUNCTION, "XamCodeCoverageFileWrite");
-    LOAD_IMPORT(Xam, 0x0826, FUNCTION, "Refresh");
-    LOAD_IMPORT(Xam, 0x0827, FUNCTION, "XampHeapGetInfo");
-    LOAD_IMPORT(Xam, 0x0828, FUNCTION, "XampHeapGetCount");
-    LOAD_IMPORT(Xam, 0x0829, FUNCTION, "XamShowPamUI");
-    LOAD_IMPORT(Xam, 0x082A, FUNCTION, "XuiElementLayoutTree");
-    LOAD_IMPORT(Xam, 0x082B, FUNCTION, "XamRegisterScreenSaverCallback");
-    LOAD_IMPORT(Xam, 0x082C, FUNCTION, "XUIElementPropVal_SetInt");
-    LOAD_IMPORT(Xam, 0x082D, FUNCTION, "XUIElementPropVal_SetFloat");
-    LOAD_IMPORT(Xam, 0x082E, FUNCTION, "XuiObjectGetPropertyDef");
-    LOAD_IMPORT(Xam, 0x082F, FUNCTION, "XuiRenderGetDevice");
-    LOAD_IMPORT(Xam, 0x0830, FUNCTION, "XuiRenderRestoreState");
-    LOAD_IMPORT(Xam, 0x0831, FUNCTION, "XuiElementGetFullXForm");
-    LOAD_IMPORT(Xam, 0x0832, FUNCTION, "XuiRenderGetViewTransform");
-    LOAD_IMPORT(Xam, 0x0833, FUNCTION, "XuiRenderGetColorSpace");
-    LOAD_IMPORT(Xam, 0x0834, FUNCTION, "XamPngEncode");
-    LOAD_IMPORT(Xam, 0x0835, FUNCTION, "XamPngDecode");
-    LOAD_IMPORT(Xam, 0x0836, FUNCTION, "XamPngEncodeEx");
-    LOAD_IMPORT(Xam, 0x0837, FUNCTION, "XuiTextElementMeasureText");
-    LOAD_IMPORT(Xam, 0x0838, FUNCTION, "XamLoaderShouldConfirmReboot");
-    LOAD_IMPORT(Xam, 0x0839, FUNCTION, "XamLoaderRebootToDash");
-    LOAD_IMPORT(Xam, 0x083A, FUNCTION, "XamNuiHudGetEngagedTrackingID");
-    LOAD_IMPORT(Xam, 0x083B, FUNCTION, "XamLoaderLaunchTitleForReason");
-    LOAD_IMPORT(Xam, 0x083C, FUNCTION, "XamNuiHudSetEngagedTrackingID");
-    LOAD_IMPORT(Xam, 0x083E, FUNCTION, "XamSetupTexture");
-    LOAD_IMPORT(Xam, 0x0841, FUNCTION, "XamSetupCameraPreviewStuff");
-    LOAD_IMPORT(Xam, 0x0842, FUNCTION, "XamReleaseCameraPreviewStuff");
-    LOAD_IMPORT(Xam, 0x0843, FUNCTION, "XamRenderCameraPreviewStuff");
-    LOAD_IMPORT(Xam, 0x0848, FUNCTION, "XamAccountRecoveryGetSetTitleSyncTime");
-    LOAD_IMPORT(Xam, 0x0849, FUNCTION, "XamReadBiometricData");
-    LOAD_IMPORT(Xam, 0x084A, FUNCTION, "XamWriteBiometricData");
-    LOAD_IMPORT(Xam, 0x084B, FUNCTION, "XamD3DResourceDescriptorCreate");
-    LOAD_IMPORT(Xam, 0x084C, FUNCTION, "XamD3DResourceDescriptorAddRef");
-    LOAD_IMPORT(Xam, 0x084D, FUNCTION, "XamD3DResourceDescriptorRelease");
-    LOAD_IMPORT(Xam, 0x084E, FUNCTION, "XamD3DResourceAddRef");
-    LOAD_IMPORT(Xam, 0x084F, FUNCTION, "XamD3DResourceSet");
-    LOAD_IMPORT(Xam, 0x0850, FUNCTION, "XamD3DResourceIsBusy");
-    LOAD_IMPORT(Xam, 0x0851, FUNCTION, "XamD3DResourceRelease");
-    LOAD_IMPORT(Xam, 0x085E, FUNCTION, "XamNuiEnableChatMic");
-    LOAD_IMPORT(Xam, 0x085F, FUNCTION, "XamNuiIsChatMicEnabled");
-    LOAD_IMPORT(Xam, 0x0860, FUNCTION, "XamNuiGetDepthCalibration");
-    LOAD_IMPORT(Xam, 0x0861, FUNCTION, "XamNuiStoreDepthCalibration");
-    LOAD_IMPORT(Xam, 0x0862, FUNCTION, "XamUserNuiIsBiometricEnabled");
-    LOAD_IMPORT(Xam, 0x0863, FUNCTION, "XamUserNuiEnableBiometric");
-    LOAD_IMPORT(Xam, 0x0864, FUNCTION, "XamNuiCameraSetFlags");
-    LOAD_IMPORT(Xam, 0x0865, FUNCTION, "XamNuiCameraRememberFloor");
-    LOAD_IMPORT(Xam, 0x0866, FUNCTION, "XamUserNuiGetUserIndexForBind");
-    LOAD_IMPORT(Xam, 0x0867, FUNCTION, "XamUserNuiGetUserIndexForSignin");
-    LOAD_IMPORT(Xam, 0x0868, FUNCTION, "XamUserNuiBind");
-    LOAD_IMPORT(Xam, 0x0869, FUNCTION, "XamUserNuiGetUserIndex");
-    LOAD_IMPORT(Xam, 0x086A, FUNCTION, "XamUserNuiGetEnrollmentIndex");
-    LOAD_IMPORT(Xam, 0x086B, FUNCTION, "XamUserNuiUnbind");
-    LOAD_IMPORT(Xam, 0x086C, FUNCTION, "XamNuiIdentityGetQualityFlagsMessage");
-    LOAD_IMPORT(Xam, 0x086D, FUNCTION, "XamNuiCameraTiltSetCallback");
-    LOAD_IMPORT(Xam, 0x086E, FUNCTION, "XamNuiHudIsEnabled");
-    LOAD_IMPORT(Xam, 0x086F, FUNCTION, "XamNuiCameraGetTiltControllerType");
-    LOAD_IMPORT(Xam, 0x0870, FUNCTION, "XamNuiCameraTiltGetStatus");
-    LOAD_IMPORT(Xam, 0x0871, FUNCTION, "XamNuiIdentityGetQualityFlags");
-    LOAD_IMPORT(Xam, 0x0872, FUNCTION, "XamNuiIdentityEnrollForSignIn");
-    LOAD_IMPORT(Xam, 0x0873, FUNCTION, "XamNuiIdentityGetSessionId");
-    LOAD_IMPORT(Xam, 0x0874, FUNCTION, "XamNuiIdentityIdentifyWithBiometric");
-    LOAD_IMPORT(Xam, 0x0875, FUNCTION, "ControlPackGetHandleManager");
-    LOAD_IMPORT(Xam, 0x0876, FUNCTION, "XamEnableNuiAutomation");
-    LOAD_IMPORT(Xam, 0x0877, FUNCTION, "XamNuiGetSystemGestureControl");
-    LOAD_IMPORT(Xam, 0x0878, FUNCTION, "XamGetPasscodeKeyFromVirtualKey");
-    LOAD_IMPORT(Xam, 0x0879, FUNCTION, "XamEnableNatalPlayback");
-    LOAD_IMPORT(Xam, 0x087A, FUNCTION, "XamIsNuiAutomationEnabled");
-    LOAD_IMPORT(Xam, 0x087B, FUNCTION, "XamIsNatalPlaybackEnabled");
-    LOAD_IMPORT(Xam, 0x087C, FUNCTION, "XamNuiHudInterpretFrame");
-    LOAD_IMPORT(Xam, 0x087D, FUNCTION, "XamNuiHudEnableInputFilter");
-    LOAD_IMPORT(Xam, 0x087E, FUNCTION, "ControlpackNuiCursorSetTrackingId");
-    LOAD_IMPORT(Xam, 0x087F, FUNCTION, "XamNuiHudGetInitializeFlags");
-    LOAD_IMPORT(Xam, 0x0880, FUNCTION, "XamNuiCameraElevationSetAngle");
-    LOAD_IMPORT(Xam, 0x0881, FUNCTION, "XamNuiCameraElevationGetAngle");
-    LOAD_IMPORT(Xam, 0x0882, FUNCTION, "XamNuiCameraElevationAutoTilt");
-    LOAD_IMPORT(Xam, 0x0883, FUNCTION, "XamNuiCameraElevationStopMovement");
-    LOAD_IMPORT(Xam, 0x0884, FUNCTION, "XamNuiCameraElevationSetCallback");
-    LOAD_IMPORT(Xam, 0x0885, FUNCTION, "XamNuiGetDeviceStatus");
-    LOAD_IMPORT(Xam, 0x0886, FUNCTION, "XamNuiNatalCameraUpdateStarting");
-    LOAD_IMPORT(Xam, 0x0887, FUNCTION, "XamNuiNatalCameraUpdateComplete");
-    LOAD_IMPORT(Xam, 0x0888, FUNCTION, "XamNuiHudGetVersions");
-    LOAD_IMPORT(Xam, 0x0889, FUNCTION, "XamGetHUDElementByPath");
-    LOAD_IMPORT(Xam, 0x088A, FUNCTION, "XamGetHUDElementByAutoId");
-    LOAD_IMPORT(Xam, 0x088B, FUNCTION, "XuiElementGetScreenPositionCenter");
-    LOAD_IMPORT(Xam, 0x088C, FUNCTION, "XamNuiCameraElevationReverseAutoTilt");
-    LOAD_IMPORT(Xam, 0x088D, FUNCTION, "ControlPackSimpleCursorGetRayFromScreenPosition");
-    LOAD_IMPORT(Xam, 0x088E, FUNCTION, "ControlPackSideNavControlGetNuiHandle");
-    LOAD_IMPORT(Xam, 0x088F, FUNCTION, "XamFindHUDElementByXuiId");
-    LOAD_IMPORT(Xam, 0x0890, FUNCTION, "XamNuiIsDeviceReady");
-    LOAD_IMPORT(Xam, 0x0891, FUNCTION, "XamNuiSetForceDeviceOff");
-    LOAD_IMPORT(Xam, 0x0892, FUNCTION, "XamNuiPlayerEngagementUpdate");
-    LOAD_IMPORT(Xam, 0x0893, FUNCTION, "XamNuiSkeletonGetBestSkeletonIndex");
-    LOAD_IMPORT(Xam, 0x0894, FUNCTION, "XamNuiSkeletonScoreUpdate");
-    LOAD_IMPORT(Xam, 0x0895, FUNCTION, "XamNuiCameraTiltReportStatus");
-    LOAD_IMPORT(Xam, 0x0896, FUNCTION, "XamNuiCameraAdjustTilt");
-    LOAD_IMPORT(Xam, 0x0898, FUNCTION, "D3DDevice_CreateVertexShader");
-    LOAD_IMPORT(Xam, 0x0899, FUNCTION, "D3DDevice_CreatePixelShader");
-    LOAD_IMPORT(Xam, 0x089A, FUNCTION, "D3DDevice_CreateTexture");
-    LOAD_IMPORT(Xam, 0x089B, FUNCTION, "D3DDevice_CreateVertexBuffer");
-    LOAD_IMPORT(Xam, 0x089C, FUNCTION, "D3DDevice_CreateIndexBuffer");
-    LOAD_IMPORT(Xam, 0x089D, FUNCTION, "D3DDevice_CreateVertexDeclaration");
-    LOAD_IMPORT(Xam, 0x089E, FUNCTION, "D3DVertexBuffer_Unlock");
-    LOAD_IMPORT(Xam, 0x089F, FUNCTION, "D3DVertexBuffer_Lock");
-    LOAD_IMPORT(Xam, 0x08A0, FUNCTION, "D3DIndexBuffer_Unlock");
-    LOAD_IMPORT(Xam, 0x08A1, FUNCTION, "D3DIndexBuffer_Lock");
-    LOAD_IMPORT(Xam, 0x08A2, FUNCTION, "D3DTexture_UnlockRect");
-    LOAD_IMPORT(Xam, 0x08A3, FUNCTION, "D3DTexture_LockRect");
-    LOAD_IMPORT(Xam, 0x08A4, FUNCTION, "D3DDevice_Clear");
-    LOAD_IMPORT(Xam, 0x08A5, FUNCTION, "D3DDevice_SetViewport");
-    LOAD_IMPORT(Xam, 0x08A6, FUNCTION, "D3DDevice_GetViewport");
-    LOAD_IMPORT(Xam, 0x08A7, FUNCTION, "D3DVertexShader_Release");
-    LOAD_IMPORT(Xam, 0x08A8, FUNCTION, "D3DPixelShader_Release");
-    LOAD_IMPORT(Xam, 0x08A9, FUNCTION, "D3DVertexDeclaration_Release");
-    LOAD_IMPORT(Xam, 0x08AA, FUNCTION, "D3DResource_Release");
-    LOAD_IMPORT(Xam, 0x08AB, FUNCTION, "D3DDevice_Release");
-    LOAD_IMPORT(Xam, 0x08AC, FUNCTION, "D3DDevice_SetVertexShader");
-    LOAD_IMPORT(Xam, 0x08AD, FUNCTION, "D3DDevice_SetPixelShader");
-    LOAD_IMPORT(Xam, 0x08AE, FUNCTION, "D3DDevice_SetTexture");
-    LOAD_IMPORT(Xam, 0x08AF, FUNCTION, "D3DDevice_SetVertexDeclaration");
-    LOAD_IMPORT(Xam, 0x08B0, FUNCTION, "D3DDevice_SetIndices");
-    LOAD_IMPORT(Xam, 0x08B1, FUNCTION, "D3DDevice_SetStreamSource");
-    LOAD_IMPORT(Xam, 0x08B2, FUNCTION, "D3DDevice_DrawVertices");
-    LOAD_IMPORT(Xam, 0x08B3, FUNCTION, "D3DDevice_DrawVerticesUP");
-    LOAD_IMPORT(Xam, 0x08B4, FUNCTION, "D3DDevice_DrawIndexedVertices");
-    LOAD_IMPORT(Xam, 0x08B5, FUNCTION, "D3DDevice_DrawIndexedVerticesUP");
-    LOAD_IMPORT(Xam, 0x08B6, FUNCTION, "D3DDevice_SetVertexShaderConstantF_ParameterCheck");
-    LOAD_IMPORT(Xam, 0x08B7, FUNCTION, "D3DDevice_SetPixelShaderConstantF_ParameterCheck");
-    LOAD_IMPORT(Xam, 0x08B8, FUNCTION, "D3DDevice_SetSamplerState_ParameterCheck");
-    LOAD_IMPORT(Xam, 0x08B9, FUNCTION, "D3DDevice_SetRenderState_ParameterCheck");
-    LOAD_IMPORT(Xam, 0x08BA, FUNCTION, "D3DDevice_GetRenderState_ParameterCheck");
-    LOAD_IMPORT(Xam, 0x08BB, FUNCTION, "D3DDevice_SetVertexShaderConstantFN");
-    LOAD_IMPORT(Xam, 0x08BC, FUNCTION, "D3DDevice_SetPixelShaderConstantFN");
-    LOAD_IMPORT(Xam, 0x08BD, FUNCTION, "D3DDevice_GetRenderState_ZEnable");
-    LOAD_IMPORT(Xam, 0x08BE, FUNCTION, "D3DDevice_GetRenderState_CullMode");
-    LOAD_IMPORT(Xam, 0x08BF, FUNCTION, "D3DDevice_GetRenderState_AlphaBlendEnable");
-    LOAD_IMPORT(Xam, 0x08C0, FUNCTION, "D3DDevice_GetRenderState_SrcBlendAlpha");
-    LOAD_IMPORT(Xam, 0x08C1, FUNCTION, "D3DDevice_GetRenderState_DestBlendAlpha");
-    LOAD_IMPORT(Xam, 0x08C2, FUNCTION, "D3DDevice_GetRenderState_BlendOp");
-    LOAD_IMPORT(Xam, 0x08C3, FUNCTION, "D3DDevice_GetRenderState_ViewportEnable");
-    LOAD_IMPORT(Xam, 0x08C4, FUNCTION, "D3DDevice_SetRenderState_ZEnable");
-    LOAD_IMPORT(Xam, 0x08C5, FUNCTION, "D3DDevice_SetRenderState_CullMode");
-    LOAD_IMPORT(Xam, 0x08C6, FUNCTION, "D3DDevice_SetRenderState_AlphaBlendEnable");
-    LOAD_IMPORT(Xam, 0x08C7, FUNCTION, "D3DDevice_SetRenderState_SrcBlendAlpha");
-    LOAD_IMPORT(Xam, 0x08C8, FUNCTION, "D3DDevice_SetRenderState_DestBlendAlpha");
-    LOAD_IMPORT(Xam, 0x08C9, FUNCTION, "D3DDevice_SetRenderState_BlendOp");
-    LOAD_IMPORT(Xam, 0x08CA, FUNCTION, "D3DDevice_SetRenderState_ViewportEnable");
-    LOAD_IMPORT(Xam, 0x08CB, FUNCTION, "D3DDevice_SetSamplerState_MagFilter");
-    LOAD_IMPORT(Xam, 0x08CC, FUNCTION, "D3DDevice_SetSamplerState_MinFilter");
-    LOAD_IMPORT(Xam, 0x08CD, FUNCTION, "D3DDevice_SetSamplerState_AddressU");
-    LOAD_IMPORT(Xam, 0x08CE, FUNCTION, "D3DDevice_SetSamplerState_AddressV");
-    LOAD_IMPORT(Xam, 0x08CF, FUNCTION, "XGSetTextureHeader");
-    LOAD_IMPORT(Xam, 0x08D0, FUNCTION, "XGGetTextureDesc");
-    LOAD_IMPORT(Xam, 0x08D1, FUNCTION, "XGOffsetResourceAddress");
-    LOAD_IMPORT(Xam, 0x08D2, FUNCTION, "D3DResource_AddRef");
-    LOAD_IMPORT(Xam, 0x08D3, FUNCTION, "D3DVertexShader_AddRef");
-    LOAD_IMPORT(Xam, 0x08D4, FUNCTION, "D3DPixelShader_AddRef");
-    LOAD_IMPORT(Xam, 0x08D5, FUNCTION, "D3DVertexDeclaration_AddRef");
-    LOAD_IMPORT(Xam, 0x08D6, FUNCTION, "XGSetTextureHeaderEx");
-    LOAD_IMPORT(Xam, 0x08D7, FUNCTION, "D3DDevice_GetRenderTarget");
-    LOAD_IMPORT(Xam, 0x08D8, FUNCTION, "D3DDevice_SetRenderTarget");
-    LOAD_IMPORT(Xam, 0x08D9, FUNCTION, "D3DDevice_GetDepthStencilSurface");
-    LOAD_IMPORT(Xam, 0x08DA, FUNCTION, "D3DDevice_SetDepthStencilSurface");
-    LOAD_IMPORT(Xam, 0x08DB, FUNCTION, "D3DDevice_Resolve");
-    LOAD_IMPORT(Xam, 0x08DC, FUNCTION, "D3DDevice_SetPixelShaderConstantB");
-    LOAD_IMPORT(Xam, 0x08DD, FUNCTION, "XamNuiGetDeviceSerialNumber");
-    LOAD_IMPORT(Xam, 0x08FC, FUNCTION, "XamXtwManagerGetVariableCount");
-    LOAD_IMPORT(Xam, 0x08FD, FUNCTION, "XamXtwManagerGetId");
-    LOAD_IMPORT(Xam, 0x08FE, FUNCTION, "XamXtwManagerGetValue");
-    LOAD_IMPORT(Xam, 0x08FF, FUNCTION, "XamXtwManagerSetValue");
-    LOAD_IMPORT(Xam, 0x0900, FUNCTION, "XamXtwManagerIncrement");
-    LOAD_IMPORT(Xam, 0x0901, FUNCTION, "XamXtwManagerDecrement");
-    LOAD_IMPORT(Xam, 0x0902, FUNCTION, "XamXtwManagerResetValue");
-    LOAD_IMPORT(Xam, 0x0903, FUNCTION, "XamXtwManagerResetAll");
-    LOAD_IMPORT(Xam, 0x0904, FUNCTION, "XamXtwManagerGetDataFilePath");
-    LOAD_IMPORT(Xam, 0x0905, FUNCTION, "XamXtwManagerDeleteDataFile");
-    LOAD_IMPORT(Xam, 0x0906, FUNCTION, "XamXtwManagerSave");
-    LOAD_IMPORT(Xam, 0x0907, FUNCTION, "XamXtwManagerLoad");
-    LOAD_IMPORT(Xam, 0x0908, FUNCTION, "XamGetXTweakManager");
-    LOAD_IMPORT(Xam, 0x09C4, FUNCTION, "XamBackgroundDownloadSetMode");
-    LOAD_IMPORT(Xam, 0x09C5, FUNCTION, "XamBackgroundDownloadIsEnabled");
-    LOAD_IMPORT(Xam, 0x09C6, FUNCTION, "XamBackgroundDownloadGetActiveItem");
-    LOAD_IMPORT(Xam, 0x09C7, FUNCTION, "XamBackgroundDownloadGetItems");
-    LOAD_IMPORT(Xam, 0x09C8, FUNCTION, "XamBackgroundDownloadClearItems");
-    LOAD_IMPORT(Xam, 0x09C9, FUNCTION, "XamBackgroundDownloadItemAdd");
-    LOAD_IMPORT(Xam, 0x09CA, FUNCTION, "XamBackgroundDownloadItemRemove");
-    LOAD_IMPORT(Xam, 0x09CB, FUNCTION, "XamBackgroundDownloadItemMakeFirst");
-    LOAD_IMPORT(Xam, 0x09CC, FUNCTION, "XamBackgroundDownloadSetForegroundPriority");
-    LOAD_IMPORT(Xam, 0x09CD, FUNCTION, "XamBackgroundDownloadGetForegroundPriority");
-    LOAD_IMPORT(Xam, 0x09CE, FUNCTION, "XamBackgroundDownloadItemToContentData");
-    LOAD_IMPORT(Xam, 0x09CF, FUNCTION, "XamBackgroundDownloadItemGetStatus");
-    LOAD_IMPORT(Xam, 0x09D0, FUNCTION, "XamBackgroundDownloadHistoryGetItem");
-    LOAD_IMPORT(Xam, 0x09D1, FUNCTION, "XamBackgroundDownloadItemGetHistoryStatus");
-    LOAD_IMPORT(Xam, 0x09D2, FUNCTION, "XamBackgroundDownloadItemSetHistoryStatus");
-    LOAD_IMPORT(Xam, 0x09D3, FUNCTION, "XamBackgroundDownloadItemGetStatusAsync");
-    LOAD_IMPORT(Xam, 0x09D4, FUNCTION, "XamBackgroundDownloadItemGetStatusEx");
-    LOAD_IMPORT(Xam, 0x09D5, FUNCTION, "XamBackgroundDownloadItemGetHistoryStatusEx");
-    LOAD_IMPORT(Xam, 0x09D6, FUNCTION, "XamBackgroundDownloadBindItems");
-    LOAD_IMPORT(Xam, 0x09D7, FUNCTION, "XamBackgroundDownloadSetPollingActive");
-    LOAD_IMPORT(Xam, 0x09D8, FUNCTION, "XamBackgroundDownloadGetPollingActive");
-    LOAD_IMPORT(Xam, 0x09D9, FUNCTION, "XamBackgroundDownloadGetMode");
-    LOAD_IMPORT(Xam, 0x09DA, FUNCTION, "XamBackgroundDownloadGetUnexpectedChangeCount");
-    LOAD_IMPORT(Xam, 0x09DB, FUNCTION, "XamBackgroundDownloadIsItemForThisConsole");
-    LOAD_IMPORT(Xam, 0x09DC, FUNCTION, "XamBackgroundDownloadSelectDevice");
-    LOAD_IMPORT(Xam, 0x09DD, FUNCTION, "XamBackgroundDownloadItemModify");
-    LOAD_IMPORT(Xam, 0x09DE, FUNCTION, "XamBackgroundDownloadCacheLegacyMappingInfo");
-    LOAD_IMPORT(Xam, 0x09DF, FUNCTION, "XamBackgroundDownloadGetLegacyMappingInfo");
-    LOAD_IMPORT(Xam, 0x09E0, FUNCTION, "XamBackgroundDownloadGetLegacyId");
-    LOAD_IMPORT(Xam, 0x09E1, FUNCTION, "XamBackgroundDownloadDoFail");
-    LOAD_IMPORT(Xam, 0x0A28, FUNCTION, "XamSwapDisc");
-    LOAD_IMPORT(Xam, 0x0A29, VARIABLE, "XamSwapDiscPatchAddress");
-    LOAD_IMPORT(Xam, 0x0A2A, FUNCTION, "XamSwapCancel");
-    LOAD_IMPORT(Xam, 0x0A32, FUNCTION, "XamRamDriveCreate");
-    LOAD_IMPORT(Xam, 0x0A33, FUNCTION, "XamRamDriveDestroy");
-    LOAD_IMPORT(Xam, 0x0A5A, FUNCTION, "XamPlayTimerGetData");
-    LOAD_IMPORT(Xam, 0x0A5B, FUNCTION, "XamPlayTimerSetData");
-    LOAD_IMPORT(Xam, 0x0A5C, FUNCTION, "XamPlayTimerResume");
-    LOAD_IMPORT(Xam, 0x0A5D, FUNCTION, "XamPlayTimerSuspend");
-    LOAD_IMPORT(Xam, 0x0A5E, FUNCTION, "XamPlayTimerIsRunning");
-    LOAD_IMPORT(Xam, 0x0A5F, FUNCTION, "XamPlayTimerIsEnabled");
-    LOAD_IMPORT(Xam, 0x0A60, FUNCTION, "XamPlayTimerGetNextResetDate");
-    LOAD_IMPORT(Xam, 0x0A61, FUNCTION, "XamPlayTimerFormatDurationString");
-    LOAD_IMPORT(Xam, 0x0A62, FUNCTION, "XamPlayTimerGetTimeRemaining");
-    LOAD_IMPORT(Xam, 0x0A63, FUNCTION, "XamPlayTimerUpdateTimeRemaining");
-    LOAD_IMPORT(Xam, 0x0A64, FUNCTION, "XamPlayTimerForceNotification");
-    LOAD_IMPORT(Xam, 0x0A65, FUNCTION, "XamPlayTimerRefreshResetDate");
-    LOAD_IMPORT(Xam, 0x0A6E, FUNCTION, "UpnpAVServerSearchInitialize");
-    LOAD_IMPORT(Xam, 0x0A6F, FUNCTION, "UpnpAVServerSearchDestroy");
-    LOAD_IMPORT(Xam, 0x0A70, FUNCTION, "UpnpAVServerSearchStart");
-    LOAD_IMPORT(Xam, 0x0A71, FUNCTION, "Destroy");
-    LOAD_IMPORT(Xam, 0x0A72, FUNCTION, "UpnpAVServerSearchDoWork");
-    LOAD_IMPORT(Xam, 0x0A73, FUNCTION, "UpnpAVServerSearchGetNextServer");
-    LOAD_IMPORT(Xam, 0x0A8C, FUNCTION, "XCustomBroadcastGamercardEvent");
-    LOAD_IMPORT(Xam, 0x0A8D, FUNCTION, "XamCustomGetCurrentActions");
-    LOAD_IMPORT(Xam, 0x0AA0, FUNCTION, "XamInstrumentationLogEvent");
-    LOAD_IMPORT(Xam, 0x0AA1, FUNCTION, "XamRegisterSMCNotification");
-    LOAD_IMPORT(Xam, 0x0AAA, FUNCTION, "XamInstrumentationLogEventEx");
-    LOAD_IMPORT(Xam, 0x0AAB, FUNCTION, "XamInstrumentationGetSourceConfig");
-    LOAD_IMPORT(Xam, 0x0AAC, FUNCTION, "XamInstrumentationDebugConfig");
-    LOAD_IMPORT(Xam, 0x0ADC, FUNCTION, "CurlCreateCacheEntry");
-    LOAD_IMPORT(Xam, 0x0ADD, FUNCTION, "CurlOpenCacheEntry");
-    LOAD_IMPORT(Xam, 0x0ADE, FUNCTION, "CurlSetCacheEntryExpireTime");
-    LOAD_IMPORT(Xam, 0x0ADF, FUNCTION, "CurlReadCacheEntryHeaders");
-    LOAD_IMPORT(Xam, 0x0AE0, FUNCTION, "CurlReadCacheEntryContent");
-    LOAD_IMPORT(Xam, 0x0AE1, FUNCTION, "CurlWriteCacheEntryContent");
-    LOAD_IMPORT(Xam, 0x0AE2, FUNCTION, "CurlCloseCacheEntry");
-    LOAD_IMPORT(Xam, 0x0AE3, FUNCTION, "CurlEnumerateCacheEntry");
-    LOAD_IMPORT(Xam, 0x0AE5, FUNCTION, "CurlWipeBackingFiles");
-    LOAD_IMPORT(Xam, 0x0AE7, FUNCTION, "CurlOpenTitleBackingFile");
-    LOAD_IMPORT(Xam, 0x0AF0, FUNCTION, "XamSetSecurityViolationDetected");
-    LOAD_IMPORT(Xam, 0x0AF1, FUNCTION, "XamIsSecurityViolationDetected");
-    LOAD_IMPORT(Xam, 0x0AF2, FUNCTION, "XamIsAnySecurityViolationDetected");
-    LOAD_IMPORT(Xam, 0x0AF3, FUNCTION, "XamGetSecurityViolationsDetected");
-    LOAD_IMPORT(Xam, 0x0AF4, FUNCTION, "XamActivateCounterMeasure");
-    LOAD_IMPORT(Xam, 0x0AF5, FUNCTION, "XamDeactivateCounterMeasure");
-    LOAD_IMPORT(Xam, 0x0AF6, FUNCTION, "XamIsCounterMeasureActivated");
-    LOAD_IMPORT(Xam, 0x0AF7, FUNCTION, "XamGetActiveCounterMeasures");
-    LOAD_IMPORT(Xam, 0x0AFC, FUNCTION, "XamPartyCreate");
-    LOAD_IMPORT(Xam, 0x0AFD, FUNCTION, "XamPartyLeave");
-    LOAD_IMPORT(Xam, 0x0AFE, FUNCTION, "XamPartySendInviteDeprecated");
-    LOAD_IMPORT(Xam, 0x0AFF, FUNCTION, "XamPartyGetUserList");
-    LOAD_IMPORT(Xam, 0x0B00, FUNCTION, "XamPartySendGameInvites");
-    LOAD_IMPORT(Xam, 0x0B01, FUNCTION, "XamPartyJoin");
-    LOAD_IMPORT(Xam, 0x0B02, FUNCTION, "XamPartyKickUser");
-    LOAD_IMPORT(Xam, 0x0B03, FUNCTION, "XamPartyAddLocalUsers");
-    LOAD_IMPORT(Xam, 0x0B04, FUNCTION, "XamConvertEmoticons");
-    LOAD_IMPORT(Xam, 0x0B05, FUNCTION, "XamGetLocaleTimeFormat");
-    LOAD_IMPORT(Xam, 0x0B06, FUNCTION, "XamPartyRemoveLocalUsers");
-    LOAD_IMPORT(Xam, 0x0B07, FUNCTION, "XamPartyGetUserListInternal");
-    LOAD_IMPORT(Xam, 0x0B08, FUNCTION, "XamPartySetJoinable");
-    LOAD_IMPORT(Xam, 0x0B09, FUNCTION, "XamPartyGetJoinable");
-    LOAD_IMPORT(Xam, 0x0B0A, FUNCTION, "XamPartyGetInfo");
-    LOAD_IMPORT(Xam, 0x0B0B, FUNCTION, "XamPartySetCustomData");
-    LOAD_IMPORT(Xam, 0x0B0C, FUNCTION, "XamPartySetConnectivityGraph");
-    LOAD_IMPORT(Xam, 0x0B0D, FUNCTION, "XamPartyGetRoutingTable");
-    LOAD_IMPORT(Xam, 0x0B0E, FUNCTION, "XamPartyAutomationInprocCall");
-    LOAD_IMPORT(Xam, 0x0B0F, FUNCTION, "XamPartyGetState");
-    LOAD_IMPORT(Xam, 0x0B10, FUNCTION, "XamPartyGetBandwidth");
-    LOAD_IMPORT(Xam, 0x0B11, FUNCTION, "XamPartyGetNetworkCounters");
-    LOAD_IMPORT(Xam, 0x0B12, FUNCTION, "XamShowQuickLaunchUI");
-    LOAD_IMPORT(Xam, 0x0B13, FUNCTION, "XamPartyIsCoordinator");
-    LOAD_IMPORT(Xam, 0x0B14, FUNCTION, "XamPartyGetFormation");
-    LOAD_IMPORT(Xam, 0x0B15, FUNCTION, "XamPartySendInvite");
-    LOAD_IMPORT(Xam, 0x0B16, FUNCTION, "XamPartySetTestDelay");
-    LOAD_IMPORT(Xam, 0x0B17, FUNCTION, "XamPartyOverrideNatType");
-    LOAD_IMPORT(Xam, 0x0B18, FUNCTION, "XamPartyGetAccessLevel");
-    LOAD_IMPORT(Xam, 0x0B19, FUNCTION, "XamPartySetTestFlags");
-    LOAD_IMPORT(Xam, 0x0B1A, FUNCTION, "XamIsSystemExperienceTitleId");
-    LOAD_IMPORT(Xam, 0x0B22, FUNCTION, "XamTaskSetCancelSubTasks");
-    LOAD_IMPORT(Xam, 0x0B23, FUNCTION, "XamTaskGetCompletionStatus");
-    LOAD_IMPORT(Xam, 0x0B24, FUNCTION, "XamTaskCancelWaitAndCloseWaitTask");
-    LOAD_IMPORT(Xam, 0x0B2C, FUNCTION, "XamWebInstrumentationCreateReport");
-    LOAD_IMPORT(Xam, 0x0B2D, FUNCTION, "XamWebInstrumentationSetUserVar");
-    LOAD_IMPORT(Xam, 0x0B2E, FUNCTION, "XamWebInstrumentationSetUserVarNoEscape");
-    LOAD_IMPORT(Xam, 0x0B2F, FUNCTION, "XamWebInstrumentationGetURL");
-    LOAD_IMPORT(Xam, 0x0B30, FUNCTION, "XamWebInstrumentationSendReport");
-    LOAD_IMPORT(Xam, 0x0B31, FUNCTION, "XamWebInstrumentationDestroyReport");
-    LOAD_IMPORT(Xam, 0x0B32, FUNCTION, "XamWebInstrumentationCreateSampledReport");
-    LOAD_IMPORT(Xam, 0x0B33, FUNCTION, "XampSetSamplingRandomValue");
-    LOAD_IMPORT(Xam, 0x0B34, FUNCTION, "XampWebInstrumentationSetProfileCounts");
-    LOAD_IMPORT(Xam, 0x0B35, FUNCTION, "XamWebInstrumentationGetURLEx");
-    LOAD_IMPORT(Xam, 0x0B36, FUNCTION, "XampSetOmnitureCallbackFunction");
-    LOAD_IMPORT(Xam, 0x0B37, FUNCTION, "XamShowQuickChatUIp");
-    LOAD_IMPORT(Xam, 0x0B4A, FUNCTION, "XamVerifyXSignerSignature");
+    LOAD_IMPORT(Xam, 0x0001, FUNCTION, "NetDll_WSAStartup")
+    LOAD_IMPORT(Xam, 0x0002, FUNCTION, "NetDll_WSACleanup")
+    LOAD_IMPORT(Xam, 0x0003, FUNCTION, "NetDll_socket")
+    LOAD_IMPORT(Xam, 0x0004, FUNCTION, "NetDll_closesocket")
+    LOAD_IMPORT(Xam, 0x0005, FUNCTION, "NetDll_shutdown")
+    LOAD_IMPORT(Xam, 0x0006, FUNCTION, "NetDll_ioctlsocket")
+    LOAD_IMPORT(Xam, 0x0007, FUNCTION, "NetDll_setsockopt")
+    LOAD_IMPORT(Xam, 0x0008, FUNCTION, "NetDll_getsockopt")
+    LOAD_IMPORT(Xam, 0x0009, FUNCTION, "NetDll_getsockname")
+    LOAD_IMPORT(Xam, 0x000A, FUNCTION, "NetDll_getpeername")
+    LOAD_IMPORT(Xam, 0x000B, FUNCTION, "NetDll_bind")
+    LOAD_IMPORT(Xam, 0x000C, FUNCTION, "NetDll_connect")
+    LOAD_IMPORT(Xam, 0x000D, FUNCTION, "NetDll_listen")
+    LOAD_IMPORT(Xam, 0x000E, FUNCTION, "NetDll_accept")
+    LOAD_IMPORT(Xam, 0x000F, FUNCTION, "NetDll_select")
+    LOAD_IMPORT(Xam, 0x0010, FUNCTION, "NetDll_WSAGetOverlappedResult")
+    LOAD_IMPORT(Xam, 0x0011, FUNCTION, "NetDll_WSACancelOverlappedIO")
+    LOAD_IMPORT(Xam, 0x0012, FUNCTION, "NetDll_recv")
+    LOAD_IMPORT(Xam, 0x0013, FUNCTION, "NetDll_WSARecv")
+    LOAD_IMPORT(Xam, 0x0014, FUNCTION, "NetDll_recvfrom")
+    LOAD_IMPORT(Xam, 0x0015, FUNCTION, "NetDll_WSARecvFrom")
+    LOAD_IMPORT(Xam, 0x0016, FUNCTION, "NetDll_send")
+    LOAD_IMPORT(Xam, 0x0017, FUNCTION, "NetDll_WSASend")
+    LOAD_IMPORT(Xam, 0x0018, FUNCTION, "NetDll_sendto")
+    LOAD_IMPORT(Xam, 0x0019, FUNCTION, "NetDll_WSASendTo")
+    LOAD_IMPORT(Xam, 0x001A, FUNCTION, "NetDll_inet_addr")
+    LOAD_IMPORT(Xam, 0x001B, FUNCTION, "NetDll_WSAGetLastError")
+    LOAD_IMPORT(Xam, 0x001C, FUNCTION, "NetDll_WSASetLastError")
+    LOAD_IMPORT(Xam, 0x001D, FUNCTION, "NetDll_WSACreateEvent")
+    LOAD_IMPORT(Xam, 0x001E, FUNCTION, "NetDll_WSACloseEvent")
+    LOAD_IMPORT(Xam, 0x001F, FUNCTION, "NetDll_WSASetEvent")
+    LOAD_IMPORT(Xam, 0x0020, FUNCTION, "NetDll_WSAResetEvent")
+    LOAD_IMPORT(Xam, 0x0021, FUNCTION, "NetDll_WSAWaitForMultipleEvents")
+    LOAD_IMPORT(Xam, 0x0022, FUNCTION, "NetDll___WSAFDIsSet")
+    LOAD_IMPORT(Xam, 0x0023, FUNCTION, "NetDll_WSAEventSelect")
+    LOAD_IMPORT(Xam, 0x0024, FUNCTION, "NetDll_WSAStartupEx")
+    LOAD_IMPORT(Xam, 0x0033, FUNCTION, "NetDll_XNetStartup")
+    LOAD_IMPORT(Xam, 0x0034, FUNCTION, "NetDll_XNetCleanup")
+    LOAD_IMPORT(Xam, 0x0035, FUNCTION, "NetDll_XNetRandom")
+    LOAD_IMPORT(Xam, 0x0036, FUNCTION, "NetDll_XNetCreateKey")
+    LOAD_IMPORT(Xam, 0x0037, FUNCTION, "NetDll_XNetRegisterKey")
+    LOAD_IMPORT(Xam, 0x0038, FUNCTION, "NetDll_XNetUnregisterKey")
+    LOAD_IMPORT(Xam, 0x0039, FUNCTION, "NetDll_XNetXnAddrToInAddr")
+    LOAD_IMPORT(Xam, 0x003A, FUNCTION, "NetDll_XNetServerToInAddr")
+    LOAD_IMPORT(Xam, 0x003B, FUNCTION, "NetDll_XNetTsAddrToInAddr")
+    LOAD_IMPORT(Xam, 0x003C, FUNCTION, "NetDll_XNetInAddrToXnAddr")
+    LOAD_IMPORT(Xam, 0x003D, FUNCTION, "NetDll_XNetInAddrToServer")
+    LOAD_IMPORT(Xam, 0x003E, FUNCTION, "NetDll_XNetInAddrToString")
+    LOAD_IMPORT(Xam, 0x003F, FUNCTION, "NetDll_XNetUnregisterInAddr")
+    LOAD_IMPORT(Xam, 0x0040, FUNCTION, "NetDll_XNetXnAddrToMachineId")
+    LOAD_IMPORT(Xam, 0x0041, FUNCTION, "NetDll_XNetConnect")
+    LOAD_IMPORT(Xam, 0x0042, FUNCTION, "NetDll_XNetGetConnectStatus")
+    LOAD_IMPORT(Xam, 0x0043, FUNCTION, "NetDll_XNetDnsLookup")
+    LOAD_IMPORT(Xam, 0x0044, FUNCTION, "NetDll_XNetDnsRelease")
+    LOAD_IMPORT(Xam, 0x0045, FUNCTION, "NetDll_XNetQosListen")
+    LOAD_IMPORT(Xam, 0x0046, FUNCTION, "NetDll_XNetQosLookup")
+    LOAD_IMPORT(Xam, 0x0047, FUNCTION, "NetDll_XNetQosServiceLookup")
+    LOAD_IMPORT(Xam, 0x0048, FUNCTION, "NetDll_XNetQosRelease")
+    LOAD_IMPORT(Xam, 0x0049, FUNCTION, "NetDll_XNetGetTitleXnAddr")
+    LOAD_IMPORT(Xam, 0x004A, FUNCTION, "NetDll_XNetGetDebugXnAddr")
+    LOAD_IMPORT(Xam, 0x004B, FUNCTION, "NetDll_XNetGetEthernetLinkStatus")
+    LOAD_IMPORT(Xam, 0x004C, FUNCTION, "NetDll_XNetGetBroadcastVersionStatus")
+    LOAD_IMPORT(Xam, 0x004D, FUNCTION, "NetDll_XNetQosGetListenStats")
+    LOAD_IMPORT(Xam, 0x004E, FUNCTION, "NetDll_XNetGetOpt")
+    LOAD_IMPORT(Xam, 0x004F, FUNCTION, "NetDll_XNetSetOpt")
+    LOAD_IMPORT(Xam, 0x0050, FUNCTION, "NetDll_XNetStartupEx")
+    LOAD_IMPORT(Xam, 0x0051, FUNCTION, "NetDll_XNetReplaceKey")
+    LOAD_IMPORT(Xam, 0x0052, FUNCTION, "NetDll_XNetGetXnAddrPlatform")
+    LOAD_IMPORT(Xam, 0x0053, FUNCTION, "NetDll_XNetGetSystemLinkPort")
+    LOAD_IMPORT(Xam, 0x0054, FUNCTION, "NetDll_XNetSetSystemLinkPort")
+    LOAD_IMPORT(Xam, 0x0065, FUNCTION, "NetDll_XnpLoadConfigParams")
+    LOAD_IMPORT(Xam, 0x0066, FUNCTION, "NetDll_XnpSaveConfigParams")
+    LOAD_IMPORT(Xam, 0x0067, FUNCTION, "NetDll_XnpConfigUPnP")
+    LOAD_IMPORT(Xam, 0x0068, FUNCTION, "NetDll_XnpConfig")
+    LOAD_IMPORT(Xam, 0x0069, FUNCTION, "NetDll_XnpGetConfigStatus")
+    LOAD_IMPORT(Xam, 0x006A, FUNCTION, "NetDll_XnpLoadMachineAccount")
+    LOAD_IMPORT(Xam, 0x006B, FUNCTION, "NetDll_XnpSaveMachineAccount")
+    LOAD_IMPORT(Xam, 0x006C, FUNCTION, "NetDll_XnpCapture")
+    LOAD_IMPORT(Xam, 0x006D, FUNCTION, "NetDll_XnpEthernetInterceptSetCallbacks")
+    LOAD_IMPORT(Xam, 0x006E, FUNCTION, "NetDll_XnpEthernetInterceptXmit")
+    LOAD_IMPORT(Xam, 0x006F, FUNCTION, "NetDll_XnpEthernetInterceptRecv")
+    LOAD_IMPORT(Xam, 0x0070, FUNCTION, "NetDll_XnpLogonGetStatus")
+    LOAD_IMPORT(Xam, 0x0071, FUNCTION, "NetDll_XnpLogonGetQFlags")
+    LOAD_IMPORT(Xam, 0x0072, FUNCTION, "NetDll_XnpLogonSetQFlags")
+    LOAD_IMPORT(Xam, 0x0073, FUNCTION, "NetDll_XnpLogonSetQEvent")
+    LOAD_IMPORT(Xam, 0x0074, FUNCTION, "NetDll_XnpLogonClearQEvent")
+    LOAD_IMPORT(Xam, 0x0075, FUNCTION, "NetDll_XnpLogonGetQVals")
+    LOAD_IMPORT(Xam, 0x0076, FUNCTION, "NetDll_XnpLogonSetQVals")
+    LOAD_IMPORT(Xam, 0x0077, FUNCTION, "NetDll_XnpLogonSetPState")
+    LOAD_IMPORT(Xam, 0x0078, FUNCTION, "NetDll_XnpGetVlanXboxName")
+    LOAD_IMPORT(Xam, 0x0079, FUNCTION, "NetDll_XnpSetVlanXboxName")
+    LOAD_IMPORT(Xam, 0x007A, FUNCTION, "NetDll_XnpGetActiveSocketList")
+    LOAD_IMPORT(Xam, 0x007B, FUNCTION, "NetDll_XnpNoteSystemTime")
+    LOAD_IMPORT(Xam, 0x007C, FUNCTION, "NetDll_XnpRegisterKeyForCallerType")
+    LOAD_IMPORT(Xam, 0x007D, FUNCTION, "NetDll_XnpUnregisterKeyForCallerType")
+    LOAD_IMPORT(Xam, 0x007E, FUNCTION, "NetDll_XnpLogonGetChallenge")
+    LOAD_IMPORT(Xam, 0x007F, FUNCTION, "NetDll_XnpLogonClearChallenge")
+    LOAD_IMPORT(Xam, 0x0080, FUNCTION, "NetDll_XnpLogonSetChallengeResponse")
+    LOAD_IMPORT(Xam, 0x0081, FUNCTION, "NetDll_XnpGetSecAssocList")
+    LOAD_IMPORT(Xam, 0x0082, FUNCTION, "NetDll_XnpGetKeyList")
+    LOAD_IMPORT(Xam, 0x0083, FUNCTION, "NetDll_XnpGetQosLookupList")
+    LOAD_IMPORT(Xam, 0x0084, FUNCTION, "NetDll_XnpPersistTitleState")
+    LOAD_IMPORT(Xam, 0x0085, FUNCTION, "NetDll_XnpReplaceKeyForCallerType")
+    LOAD_IMPORT(Xam, 0x0086, FUNCTION, "NetDll_XnpEthernetInterceptSetExtendedReceiveCallback")
+    LOAD_IMPORT(Xam, 0x0087, FUNCTION, "NetDll_XnpQosHistoryLoad")
+    LOAD_IMPORT(Xam, 0x0088, FUNCTION, "NetDll_XnpQosHistorySaveMeasurements")
+    LOAD_IMPORT(Xam, 0x0089, FUNCTION, "NetDll_XnpQosHistoryGetEntries")
+    LOAD_IMPORT(Xam, 0x008A, FUNCTION, "NetDll_XnpQosHistoryGetAggregateMeasurement")
+    LOAD_IMPORT(Xam, 0x008B, FUNCTION, "NetDll_XnpToolSetCallbacks")
+    LOAD_IMPORT(Xam, 0x008C, FUNCTION, "NetDll_XnpToolIpProxyInject")
+    LOAD_IMPORT(Xam, 0x008D, FUNCTION, "NetDll_XnpUpdateConfigParams")
+    LOAD_IMPORT(Xam, 0x008E, FUNCTION, "NetDll_XnpEthernetInterceptXmitAsIp")
+    LOAD_IMPORT(Xam, 0x0097, FUNCTION, "NetDll_XmlDownloadStart")
+    LOAD_IMPORT(Xam, 0x0098, FUNCTION, "NetDll_XmlDownloadContinue")
+    LOAD_IMPORT(Xam, 0x0099, FUNCTION, "NetDll_XmlDownloadStop")
+    LOAD_IMPORT(Xam, 0x009A, FUNCTION, "NetDll_XmlDownloadGetParseTime")
+    LOAD_IMPORT(Xam, 0x009B, FUNCTION, "NetDll_XmlDownloadGetReceivedDataSize")
+    LOAD_IMPORT(Xam, 0x00C6, FUNCTION, "XnpGetXwppMemoryLogSnapshot")
+    LOAD_IMPORT(Xam, 0x00C7, FUNCTION, "XnpGetXwppRuntimeFilter")
+    LOAD_IMPORT(Xam, 0x00C9, FUNCTION, "NetDll_XHttpStartup")
+    LOAD_IMPORT(Xam, 0x00CA, FUNCTION, "NetDll_XHttpShutdown")
+    LOAD_IMPORT(Xam, 0x00CB, FUNCTION, "NetDll_XHttpOpen")
+    LOAD_IMPORT(Xam, 0x00CC, FUNCTION, "NetDll_XHttpCloseHandle")
+    LOAD_IMPORT(Xam, 0x00CD, FUNCTION, "NetDll_XHttpConnect")
+    LOAD_IMPORT(Xam, 0x00CE, FUNCTION, "NetDll_XHttpSetStatusCallback")
+    LOAD_IMPORT(Xam, 0x00CF, FUNCTION, "NetDll_XHttpOpenRequest")
+    LOAD_IMPORT(Xam, 0x00D0, FUNCTION, "NetDll_XHttpOpenRequestUsingMemory")
+    LOAD_IMPORT(Xam, 0x00D1, FUNCTION, "NetDll_XHttpSendRequest")
+    LOAD_IMPORT(Xam, 0x00D2, FUNCTION, "NetDll_XHttpReceiveResponse")
+    LOAD_IMPORT(Xam, 0x00D3, FUNCTION, "NetDll_XHttpQueryHeaders")
+    LOAD_IMPORT(Xam, 0x00D4, FUNCTION, "NetDll_XHttpReadData")
+    LOAD_IMPORT(Xam, 0x00D5, FUNCTION, "NetDll_XHttpWriteData")
+    LOAD_IMPORT(Xam, 0x00D6, FUNCTION, "NetDll_XHttpQueryOption")
+    LOAD_IMPORT(Xam, 0x00D7, FUNCTION, "NetDll_XHttpSetOption")
+    LOAD_IMPORT(Xam, 0x00D8, FUNCTION, "NetDll_XHttpDoWork")
+    LOAD_IMPORT(Xam, 0x00D9, FUNCTION, "NetDll_XHttpSetCredentials")
+    LOAD_IMPORT(Xam, 0x00DA, FUNCTION, "NetDll_XHttpQueryAuthSchemes")
+    LOAD_IMPORT(Xam, 0x00DB, FUNCTION, "NetDll_XHttpCrackUrl")
+    LOAD_IMPORT(Xam, 0x00FB, FUNCTION, "NetDll_UpnpStartup")
+    LOAD_IMPORT(Xam, 0x00FC, FUNCTION, "NetDll_UpnpCleanup")
+    LOAD_IMPORT(Xam, 0x00FD, FUNCTION, "NetDll_UpnpSearchCreate")
+    LOAD_IMPORT(Xam, 0x00FE, FUNCTION, "NetDll_UpnpSearchGetDevices")
+    LOAD_IMPORT(Xam, 0x00FF, FUNCTION, "NetDll_UpnpDescribeCreate")
+    LOAD_IMPORT(Xam, 0x0100, FUNCTION, "NetDll_UpnpDescribeGetResults")
+    LOAD_IMPORT(Xam, 0x0101, FUNCTION, "NetDll_UpnpActionCalculateWorkBufferSize")
+    LOAD_IMPORT(Xam, 0x0102, FUNCTION, "NetDll_UpnpActionCreate")
+    LOAD_IMPORT(Xam, 0x0103, FUNCTION, "NetDll_UpnpActionGetResults")
+    LOAD_IMPORT(Xam, 0x0104, FUNCTION, "NetDll_UpnpEventCreate")
+    LOAD_IMPORT(Xam, 0x0105, FUNCTION, "NetDll_UpnpEventGetCurrentState")
+    LOAD_IMPORT(Xam, 0x0106, FUNCTION, "NetDll_UpnpEventUnsubscribe")
+    LOAD_IMPORT(Xam, 0x0107, FUNCTION, "NetDll_UpnpDoWork")
+    LOAD_IMPORT(Xam, 0x0108, FUNCTION, "NetDll_UpnpCloseHandle")
+    LOAD_IMPORT(Xam, 0x012D, FUNCTION, "XNetLogonGetLoggedOnUsers")
+    LOAD_IMPORT(Xam, 0x012E, FUNCTION, "XNetLogonGetNatType")
+    LOAD_IMPORT(Xam, 0x012F, FUNCTION, "XNetLogonTaskStart")
+    LOAD_IMPORT(Xam, 0x0130, FUNCTION, "XNetLogonTaskClose")
+    LOAD_IMPORT(Xam, 0x0131, FUNCTION, "XNetLogonTaskContinue")
+    LOAD_IMPORT(Xam, 0x0132, FUNCTION, "XNetLogonGetServiceInfo")
+    LOAD_IMPORT(Xam, 0x0133, FUNCTION, "XNetLogonGetUserPrivileges")
+    LOAD_IMPORT(Xam, 0x0134, FUNCTION, "XNetLogonSetConsoleCertificate")
+    LOAD_IMPORT(Xam, 0x0135, FUNCTION, "XNetLogonGetMachineID")
+    LOAD_IMPORT(Xam, 0x0136, FUNCTION, "XNetLogonGetTitleID")
+    LOAD_IMPORT(Xam, 0x0137, FUNCTION, "XNetLogonGetTitleVersion")
+    LOAD_IMPORT(Xam, 0x0138, FUNCTION, "XNetLogonGetServiceNetworkID")
+    LOAD_IMPORT(Xam, 0x0139, FUNCTION, "XNetLogonGetDnsString")
+    LOAD_IMPORT(Xam, 0x013A, FUNCTION, "XNetLogonSetTitleID")
+    LOAD_IMPORT(Xam, 0x013B, FUNCTION, "XNetLogonGetExtendedStatus")
+    LOAD_IMPORT(Xam, 0x013C, FUNCTION, "XNetLogonClearTicketCaches")
+    LOAD_IMPORT(Xam, 0x013D, FUNCTION, "XNetLogonInitOverrideInfo")
+    LOAD_IMPORT(Xam, 0x013E, FUNCTION, "XNetLogonGetLastUPnPStatus")
+    LOAD_IMPORT(Xam, 0x013F, FUNCTION, "XNetLogonGetFlowToken")
+    LOAD_IMPORT(Xam, 0x0140, FUNCTION, "XNetLogonGetTicketOpt")
+    LOAD_IMPORT(Xam, 0x0141, FUNCTION, "XNetLogonSetTicketOpt")
+    LOAD_IMPORT(Xam, 0x0190, FUNCTION, "XamInputGetCapabilities")
+    LOAD_IMPORT(Xam, 0x0191, FUNCTION, "XamInputGetState")
+    LOAD_IMPORT(Xam, 0x0192, FUNCTION, "XamInputSetState")
+    LOAD_IMPORT(Xam, 0x0193, FUNCTION, "XamInputGetKeystroke")
+    LOAD_IMPORT(Xam, 0x0194, FUNCTION, "XamInputEnableAutobind")
+    LOAD_IMPORT(Xam, 0x0195, FUNCTION, "XamInputRawState")
+    LOAD_IMPORT(Xam, 0x0196, FUNCTION, "XamEnableSystemAppInput")
+    LOAD_IMPORT(Xam, 0x0197, FUNCTION, "XamInputGetDeviceStats")
+    LOAD_IMPORT(Xam, 0x0198, FUNCTION, "XamInputGetKeystrokeEx")
+    LOAD_IMPORT(Xam, 0x0199, FUNCTION, "XamInputGetKeystrokeHud")
+    LOAD_IMPORT(Xam, 0x019A, FUNCTION, "XamInputSetLayoutKeyboard")
+    LOAD_IMPORT(Xam, 0x019B, FUNCTION, "XamInputToggleKeyLocks")
+    LOAD_IMPORT(Xam, 0x019C, FUNCTION, "XamInputResetLayoutKeyboard")
+    LOAD_IMPORT(Xam, 0x019D, FUNCTION, "XamInputGetKeystrokeHudEx")
+    LOAD_IMPORT(Xam, 0x019E, FUNCTION, "XamInputSetKeyboardTranslationHud")
+    LOAD_IMPORT(Xam, 0x019F, FUNCTION, "XamSetInactivityTime")
+    LOAD_IMPORT(Xam, 0x01A0, FUNCTION, "XamEnableInactivityProcessing")
+    LOAD_IMPORT(Xam, 0x01A1, FUNCTION, "XamResetInactivity")
+    LOAD_IMPORT(Xam, 0x01A2, FUNCTION, "XamSetInactivityTimeFromConfig")
+    LOAD_IMPORT(Xam, 0x01A3, FUNCTION, "XamLoaderGetMediaInfo")
+    LOAD_IMPORT(Xam, 0x01A4, FUNCTION, "XamLoaderLaunchTitle")
+    LOAD_IMPORT(Xam, 0x01A5, FUNCTION, "XamLoaderLaunchTitleEx")
+    LOAD_IMPORT(Xam, 0x01A6, FUNCTION, "XamLoaderSetLaunchData")
+    LOAD_IMPORT(Xam, 0x01A7, FUNCTION, "XamLoaderGetLaunchDataSize")
+    LOAD_IMPORT(Xam, 0x01A8, FUNCTION, "XamLoaderGetLaunchData")
+    LOAD_IMPORT(Xam, 0x01A9, FUNCTION, "XamLoaderTerminateTitle")
+    LOAD_IMPORT(Xam, 0x01AA, FUNCTION, "XamLoaderGetDvdTrayState")
+    LOAD_IMPORT(Xam, 0x01AB, FUNCTION, "XamLoaderGetGameInfo")
+    LOAD_IMPORT(Xam, 0x01AC, FUNCTION, "XamLoaderLaunchTitleOnDvd")
+    LOAD_IMPORT(Xam, 0x01AD, FUNCTION, "XamLoaderSetSpindleSpeed")
+    LOAD_IMPORT(Xam, 0x01AE, FUNCTION, "XamTaskCreateQueue")
+    LOAD_IMPORT(Xam, 0x01AF, FUNCTION, "XamTaskSchedule")
+    LOAD_IMPORT(Xam, 0x01B0, FUNCTION, "XamTaskReschedule")
+    LOAD_IMPORT(Xam, 0x01B1, FUNCTION, "XamTaskCloseHandle")
+    LOAD_IMPORT(Xam, 0x01B2, FUNCTION, "XamTaskCancel")
+    LOAD_IMPORT(Xam, 0x01B3, FUNCTION, "XamTaskShouldExit")
+    LOAD_IMPORT(Xam, 0x01B4, FUNCTION, "XamTaskWaitOnCompletion")
+    LOAD_IMPORT(Xam, 0x01B5, FUNCTION, "XamTaskModify")
+    LOAD_IMPORT(Xam, 0x01B6, FUNCTION, "XamTaskGetCurrentTask")
+    LOAD_IMPORT(Xam, 0x01B7, FUNCTION, "XamTaskGetAttributes")
+    LOAD_IMPORT(Xam, 0x01B8, FUNCTION, "XamExecutingOnBehalfOfTitle")
+    LOAD_IMPORT(Xam, 0x01B9, FUNCTION, "XamInputSendStayAliveRequest")
+    LOAD_IMPORT(Xam, 0x01BA, FUNCTION, "XamInputGetUserVibrationLevel")
+    LOAD_IMPORT(Xam, 0x01BB, FUNCTION, "XamIsSystemTitleId")
+    LOAD_IMPORT(Xam, 0x01BC, FUNCTION, "XamLoaderIsTitleTerminatePending")
+    LOAD_IMPORT(Xam, 0x01BD, FUNCTION, "XamInputSetTextMessengerIndicator")
+    LOAD_IMPORT(Xam, 0x01BE, FUNCTION, "XamLoaderGetPriorTitleId")
+    LOAD_IMPORT(Xam, 0x01BF, FUNCTION, "XamIsXbox1TitleId")
+    LOAD_IMPORT(Xam, 0x01C0, FUNCTION, "XamInputSetKeyLocks")
+    LOAD_IMPORT(Xam, 0x01C1, FUNCTION, "XamInputGetKeyLocks")
+    LOAD_IMPORT(Xam, 0x01C2, FUNCTION, "XamTaskGetStatus")
+    LOAD_IMPORT(Xam, 0x01C3, FUNCTION, "XamGetRootObj")
+    LOAD_IMPORT(Xam, 0x01C4, FUNCTION, "XamDevAuthSetFault")
+    LOAD_IMPORT(Xam, 0x01C5, FUNCTION, "XamGetDefaultSystemImage")
+    LOAD_IMPORT(Xam, 0x01C6, FUNCTION, "XamGetWCNConfigFile")
+    LOAD_IMPORT(Xam, 0x01C7, FUNCTION, "XamSetPowerMode")
+    LOAD_IMPORT(Xam, 0x01C8, FUNCTION, "XamExecuteChallenge")
+    LOAD_IMPORT(Xam, 0x01C9, FUNCTION, "XamGetDefaultImage")
+    LOAD_IMPORT(Xam, 0x01CA, FUNCTION, "XamMuteSound")
+    LOAD_IMPORT(Xam, 0x01CB, FUNCTION, "XamGetOnlineSchema")
+    LOAD_IMPORT(Xam, 0x01CC, FUNCTION, "XamSetDashContext")
+    LOAD_IMPORT(Xam, 0x01CD, FUNCTION, "XamGetDashContext")
+    LOAD_IMPORT(Xam, 0x01CE, FUNCTION, "XamIsCurrentTitleDash")
+    LOAD_IMPORT(Xam, 0x01CF, FUNCTION, "XamGetCurrentTitleId")
+    LOAD_IMPORT(Xam, 0x01D0, FUNCTION, "XamSetCurrentTitleDash")
+    LOAD_IMPORT(Xam, 0x01D1, FUNCTION, "XamAllocHeapFreeSpace")
+    LOAD_IMPORT(Xam, 0x01D2, FUNCTION, "XamSetDashContextEx")
+    LOAD_IMPORT(Xam, 0x01D3, FUNCTION, "XamGetDashContextEx")
+    LOAD_IMPORT(Xam, 0x01D4, FUNCTION, "XamSetHudContext")
+    LOAD_IMPORT(Xam, 0x01D5, FUNCTION, "XamGetHudContext")
+    LOAD_IMPORT(Xam, 0x01D6, FUNCTION, "XCustomGetBannerImage")
+    LOAD_IMPORT(Xam, 0x01D7, FUNCTION, "Refresh")
+    LOAD_IMPORT(Xam, 0x01D8, FUNCTION, "XCustomSetAction")
+    LOAD_IMPORT(Xam, 0x01D9, FUNCTION, "XCustomGetLastActionPress")
+    LOAD_IMPORT(Xam, 0x01DA, FUNCTION, "XCustomSetDynamicActions")
+    LOAD_IMPORT(Xam, 0x01DB, FUNCTION, "XCustomBroadcastActionEvent")
+    LOAD_IMPORT(Xam, 0x01DC, FUNCTION, "XCustomGetLastActionPressEx")
+    LOAD_IMPORT(Xam, 0x01DD, FUNCTION, "XCustomRegisterDynamicActions")
+    LOAD_IMPORT(Xam, 0x01DE, FUNCTION, "XCustomUnregisterDynamicActions")
+    LOAD_IMPORT(Xam, 0x01DF, FUNCTION, "XCustomGetCurrentGamercard")
+    LOAD_IMPORT(Xam, 0x01E0, FUNCTION, "XamDbgPrint")
+    LOAD_IMPORT(Xam, 0x01E1, FUNCTION, "XamDbgSetOutputLevel")
+    LOAD_IMPORT(Xam, 0x01E2, FUNCTION, "XamDbgSetBreakLevel")
+    LOAD_IMPORT(Xam, 0x01E3, FUNCTION, "XamLoaderGetMediaInfoEx")
+    LOAD_IMPORT(Xam, 0x01E4, FUNCTION, "XamLoaderSetGameInfo")
+    LOAD_IMPORT(Xam, 0x01E5, FUNCTION, "XamFormatMessage")
+    LOAD_IMPORT(Xam, 0x01E6, FUNCTION, "XamUniSortCmpString")
+    LOAD_IMPORT(Xam, 0x01E7, FUNCTION, "XamFormatTimeString")
+    LOAD_IMPORT(Xam, 0x01E8, FUNCTION, "XamFormatDateString")
+    LOAD_IMPORT(Xam, 0x01E9, FUNCTION, "XamGetLocaleDateFormat")
+    LOAD_IMPORT(Xam, 0x01EA, FUNCTION, "XamAlloc")
+    LOAD_IMPORT(Xam, 0x01EB, FUNCTION, "XamAllocEx")
+    LOAD_IMPORT(Xam, 0x01EC, FUNCTION, "XamFree")
+    LOAD_IMPORT(Xam, 0x01ED, FUNCTION, "XamAllocSize")
+    LOAD_IMPORT(Xam, 0x01EE, FUNCTION, "XamAllocMountIPTVHeap")
+    LOAD_IMPORT(Xam, 0x01EF, FUNCTION, "XamAllocUnmountIPTVHeap")
+    LOAD_IMPORT(Xam, 0x01F0, FUNCTION, "XamAllocFreeIPTVHeap")
+    LOAD_IMPORT(Xam, 0x01F1, FUNCTION, "XamDeviceRemap")
+    LOAD_IMPORT(Xam, 0x01F2, FUNCTION, "XamLoaderGetClearCache")
+    LOAD_IMPORT(Xam, 0x01F3, FUNCTION, "XamLoaderSetClearCache")
+    LOAD_IMPORT(Xam, 0x01F4, FUNCTION, "XMsgInProcessCall")
+    LOAD_IMPORT(Xam, 0x01F5, FUNCTION, "XMsgCompleteIORequest")
+    LOAD_IMPORT(Xam, 0x01F6, FUNCTION, "XMsgSystemProcessCall")
+    LOAD_IMPORT(Xam, 0x01F7, FUNCTION, "XMsgStartIORequest")
+    LOAD_IMPORT(Xam, 0x01F8, FUNCTION, "XMsgCancelIORequest")
+    LOAD_IMPORT(Xam, 0x01F9, FUNCTION, "XMsgAcquireAsyncMessageFromOverlapped")
+    LOAD_IMPORT(Xam, 0x01FA, FUNCTION, "XMsgReleaseAsyncMessageToOverlapped")
+    LOAD_IMPORT(Xam, 0x01FB, FUNCTION, "XamGetOverlappedResult")
+    LOAD_IMPORT(Xam, 0x01FC, FUNCTION, "XMsgStartIORequestEx")
+    LOAD_IMPORT(Xam, 0x01FD, FUNCTION, "XamAppAllocateInterappWorkspace")
+    LOAD_IMPORT(Xam, 0x01FE, FUNCTION, "XamAppGetInterappWorkspace")
+    LOAD_IMPORT(Xam, 0x01FF, FUNCTION, "XamAppFreeInterappWorkspace")
+    LOAD_IMPORT(Xam, 0x0200, FUNCTION, "XamFeatureEnabled")
+    LOAD_IMPORT(Xam, 0x0201, FUNCTION, "XamFeatureEnforceImageBudget")
+    LOAD_IMPORT(Xam, 0x0202, FUNCTION, "XamFeatureSetMask")
+    LOAD_IMPORT(Xam, 0x0203, FUNCTION, "XamFeatureEnableDisable")
+    LOAD_IMPORT(Xam, 0x0204, FUNCTION, "XuiControlSetItemAssociation")
+    LOAD_IMPORT(Xam, 0x0205, FUNCTION, "XamGetTitleGlobalStorageValue")
+    LOAD_IMPORT(Xam, 0x0206, FUNCTION, "XamSetTitleGlobalStorageValue")
+    LOAD_IMPORT(Xam, 0x0207, FUNCTION, "XamUserValidateAvatarManifest")
+    LOAD_IMPORT(Xam, 0x0208, FUNCTION, "XamUserGetDeviceContext")
+    LOAD_IMPORT(Xam, 0x0209, FUNCTION, "XamUserLookupDevice")
+    LOAD_IMPORT(Xam, 0x020A, FUNCTION, "XamUserGetXUID")
+    LOAD_IMPORT(Xam, 0x020B, FUNCTION, "XamUserLogon")
+    LOAD_IMPORT(Xam, 0x020C, FUNCTION, "XamUserGetGamerTag")
+    LOAD_IMPORT(Xam, 0x020D, FUNCTION, "XamUserGetUserIndexMask")
+    LOAD_IMPORT(Xam, 0x020E, FUNCTION, "XamUserGetName")
+    LOAD_IMPORT(Xam, 0x020F, FUNCTION, "XamLookupCommonStringByIndex")
+    LOAD_IMPORT(Xam, 0x0210, FUNCTION, "XamUserGetSigninState")
+    LOAD_IMPORT(Xam, 0x0211, FUNCTION, "XamUserGetIndexFromXUID")
+    LOAD_IMPORT(Xam, 0x0212, FUNCTION, "XamUserCheckPrivilege")
+    LOAD_IMPORT(Xam, 0x0213, FUNCTION, "XamUserAreUsersFriends")
+    LOAD_IMPORT(Xam, 0x0214, FUNCTION, "XamSetUserPresetPresenceState")
+    LOAD_IMPORT(Xam, 0x0215, FUNCTION, "XamGetUserPresetPresenceState")
+    LOAD_IMPORT(Xam, 0x0216, FUNCTION, "XamUserGetUserFlagsFromXUID")
+    LOAD_IMPORT(Xam, 0x0217, FUNCTION, "XamUserGetMembershipTierFromXUID")
+    LOAD_IMPORT(Xam, 0x0218, FUNCTION, "XamUserGetOnlineCountryFromXUID")
+    LOAD_IMPORT(Xam, 0x0219, FUNCTION, "XamUserReadProfileSettings")
+    LOAD_IMPORT(Xam, 0x021A, FUNCTION, "XamUserWriteProfileSettings")
+    LOAD_IMPORT(Xam, 0x021B, FUNCTION, "XamUserGetMembershipTier")
+    LOAD_IMPORT(Xam, 0x021C, FUNCTION, "XamUserGetUserFlags")
+    LOAD_IMPORT(Xam, 0x021D, FUNCTION, "XamUserGetRequestedUserIndexMask")
+    LOAD_IMPORT(Xam, 0x021E, FUNCTION, "XamUserIsGuest")
+    LOAD_IMPORT(Xam, 0x021F, FUNCTION, "XamUserProfileSync")
+    LOAD_IMPORT(Xam, 0x0220, FUNCTION, "XamUserFlushLogonQueue")
+    LOAD_IMPORT(Xam, 0x0221, FUNCTION, "XamUserIsOnlineEnabled")
+    LOAD_IMPORT(Xam, 0x0222, FUNCTION, "XamUserGetCachedUserFlags")
+    LOAD_IMPORT(Xam, 0x0223, FUNCTION, "XamAreMixedAccountsSignedIn")
+    LOAD_IMPORT(Xam, 0x0224, FUNCTION, "XamUserLogonEx")
+    LOAD_IMPORT(Xam, 0x0225, FUNCTION, "XamSetUserShowMessengerFriends")
+    LOAD_IMPORT(Xam, 0x0226, FUNCTION, "XamGetUserShowMessengerFriends")
+    LOAD_IMPORT(Xam, 0x0227, FUNCTION, "XamUserGetSigninInfo")
+    LOAD_IMPORT(Xam, 0x0228, FUNCTION, "XamUserIsPartial")
+    LOAD_IMPORT(Xam, 0x0229, FUNCTION, "XamUserGetOnlineLanguageFromXUID")
+    LOAD_IMPORT(Xam, 0x022A, FUNCTION, "XamUserReadProfileSettingsEx")
+    LOAD_IMPORT(Xam, 0x022B, FUNCTION, "XamSystemUpdaterLogon")
+    LOAD_IMPORT(Xam, 0x022C, FUNCTION, "XamUserGetUsersMissingAvatars")
+    LOAD_IMPORT(Xam, 0x022D, FUNCTION, "XamIsChildAccountSignedIn")
+    LOAD_IMPORT(Xam, 0x022E, FUNCTION, "XamUserPrefetchProfileSettings")
+    LOAD_IMPORT(Xam, 0x022F, FUNCTION, "XamUserInvalidateProfileSetting")
+    LOAD_IMPORT(Xam, 0x0230, FUNCTION, "XamProfileCreate")
+    LOAD_IMPORT(Xam, 0x0231, FUNCTION, "XamProfileCreateEnumerator")
+    LOAD_IMPORT(Xam, 0x0232, FUNCTION, "XamProfileEnumerate")
+    LOAD_IMPORT(Xam, 0x0233, FUNCTION, "XamProfileDelete")
+    LOAD_IMPORT(Xam, 0x0234, FUNCTION, "XamProfileGetCreationStatus")
+    LOAD_IMPORT(Xam, 0x0235, FUNCTION, "XamProfileFindAccount")
+    LOAD_IMPORT(Xam, 0x0236, FUNCTION, "XamProfileRenameAccount")
+    LOAD_IMPORT(Xam, 0x0237, FUNCTION, "XamProfileOpen")
+    LOAD_IMPORT(Xam, 0x0238, FUNCTION, "XamProfileClose")
+    LOAD_IMPORT(Xam, 0x0239, FUNCTION, "XamProfileSaveAccountInfo")
+    LOAD_IMPORT(Xam, 0x023A, FUNCTION, "XamProfileLoadAccountInfo")
+    LOAD_IMPORT(Xam, 0x023B, FUNCTION, "XamProfileRecoverTitle")
+    LOAD_IMPORT(Xam, 0x023C, FUNCTION, "XamProfileSaveWindowsLiveCredentials")
+    LOAD_IMPORT(Xam, 0x023D, FUNCTION, "XamProfileLoadWindowsLiveCredentials")
+    LOAD_IMPORT(Xam, 0x023E, FUNCTION, "XamProfileIsSaveWindowsLiveCredsEnabled")
+    LOAD_IMPORT(Xam, 0x023F, FUNCTION, "XamProfileSetSaveWindowsLiveCredsEnabled")
+    LOAD_IMPORT(Xam, 0x0240, FUNCTION, "XamSetProfileReadTestHook")
+    LOAD_IMPORT(Xam, 0x0241, FUNCTION, "XamProfileGetLastSync")
+    LOAD_IMPORT(Xam, 0x0242, FUNCTION, "XamAccountRecoveryRecoverTitle")
+    LOAD_IMPORT(Xam, 0x0243, FUNCTION, "XamProfileControlPec")
+    LOAD_IMPORT(Xam, 0x0244, FUNCTION, "XamAppLoad")
+    LOAD_IMPORT(Xam, 0x0245, FUNCTION, "XamAppUnloadSelf")
+    LOAD_IMPORT(Xam, 0x0246, FUNCTION, "XamAppUnloadStack")
+    LOAD_IMPORT(Xam, 0x0247, FUNCTION, "XamSendMessageToLoadedApps")
+    LOAD_IMPORT(Xam, 0x0248, FUNCTION, "XamAppRequestLoad")
+    LOAD_IMPORT(Xam, 0x0249, FUNCTION, "XamAppUnrequestLoad")
+    LOAD_IMPORT(Xam, 0x024A, FUNCTION, "XamNavigate")
+    LOAD_IMPORT(Xam, 0x024B, FUNCTION, "XamRegisterSysApp")
+    LOAD_IMPORT(Xam, 0x024C, FUNCTION, "XamUnregisterSysApp")
+    LOAD_IMPORT(Xam, 0x024D, FUNCTION, "XamAppReinitialize")
+    LOAD_IMPORT(Xam, 0x024E, FUNCTION, "XamCreateEnumeratorHandle")
+    LOAD_IMPORT(Xam, 0x024F, FUNCTION, "XamGetPrivateEnumStructureFromHandle")
+    LOAD_IMPORT(Xam, 0x0250, FUNCTION, "XamEnumerate")
+    LOAD_IMPORT(Xam, 0x0251, FUNCTION, "XamLoadSysApp")
+    LOAD_IMPORT(Xam, 0x0252, FUNCTION, "XamUnloadSysApp")
+    LOAD_IMPORT(Xam, 0x0253, FUNCTION, "XamReloadSysApp")
+    LOAD_IMPORT(Xam, 0x0254, FUNCTION, "XamAppLoadPass2SysApps")
+    LOAD_IMPORT(Xam, 0x0255, FUNCTION, "XamProfileGetLiveLegalLocale")
+    LOAD_IMPORT(Xam, 0x0256, FUNCTION, "XamUserIsParentalControlled")
+    LOAD_IMPORT(Xam, 0x0257, FUNCTION, "XamContentLaunchImageFromFileInternal")
+    LOAD_IMPORT(Xam, 0x0258, FUNCTION, "XamContentCreate")
+    LOAD_IMPORT(Xam, 0x0259, FUNCTION, "XamContentCreateEx")
+    LOAD_IMPORT(Xam, 0x025A, FUNCTION, "XamContentClose")
+    LOAD_IMPORT(Xam, 0x025B, FUNCTION, "XamContentDelete")
+    LOAD_IMPORT(Xam, 0x025C, FUNCTION, "XamContentCreateEnumerator")
+    LOAD_IMPORT(Xam, 0x025D, FUNCTION, "XamContentCreateDeviceEnumerator")
+    LOAD_IMPORT(Xam, 0x025E, FUNCTION, "XamContentGetDeviceData")
+    LOAD_IMPORT(Xam, 0x025F, FUNCTION, "XamContentGetDeviceName")
+    LOAD_IMPORT(Xam, 0x0260, FUNCTION, "XamContentSetThumbnail")
+    LOAD_IMPORT(Xam, 0x0261, FUNCTION, "XamContentGetThumbnail")
+    LOAD_IMPORT(Xam, 0x0262, FUNCTION, "XamContentGetCreator")
+    LOAD_IMPORT(Xam, 0x0263, FUNCTION, "XamContentLaunchImage")
+    LOAD_IMPORT(Xam, 0x0264, FUNCTION, "XamContentGetAttributes")
+    LOAD_IMPORT(Xam, 0x0265, FUNCTION, "XamContentGetDeviceState")
+    LOAD_IMPORT(Xam, 0x0266, FUNCTION, "XamContentGetLicenseMask")
+    LOAD_IMPORT(Xam, 0x0267, FUNCTION, "XamContentFlush")
+    LOAD_IMPORT(Xam, 0x0268, FUNCTION, "XamContentResolve")
+    LOAD_IMPORT(Xam, 0x0269, FUNCTION, "XamContentOpenFile")
+    LOAD_IMPORT(Xam, 0x026A, FUNCTION, "XamContentInstall")
+    LOAD_IMPORT(Xam, 0x026B, FUNCTION, "XamContentLockUnlockPackageHeaders")
+    LOAD_IMPORT(Xam, 0x026C, FUNCTION, "XamContentCopyInternal")
+    LOAD_IMPORT(Xam, 0x026D, FUNCTION, "XamContentMoveInternal")
+    LOAD_IMPORT(Xam, 0x026E, FUNCTION, "XamContentGetMetaDataInternal")
+    LOAD_IMPORT(Xam, 0x026F, FUNCTION, "XamContentCreateEnumeratorInternal")
+    LOAD_IMPORT(Xam, 0x0270, FUNCTION, "XamContentDeleteInternal")
+    LOAD_IMPORT(Xam, 0x0271, FUNCTION, "XamContentCreateInternal")
+    LOAD_IMPORT(Xam, 0x0272, FUNCTION, "XamContentSetThumbnailInternal")
+    LOAD_IMPORT(Xam, 0x0273, FUNCTION, "XamContentLaunchImageInternal")
+    LOAD_IMPORT(Xam, 0x0274, FUNCTION, "XamContentWritePackageHeader")
+    LOAD_IMPORT(Xam, 0x0275, FUNCTION, "XamContentDismountAndClosePackage")
+    LOAD_IMPORT(Xam, 0x0276, FUNCTION, "XamContentResolveInternal")
+    LOAD_IMPORT(Xam, 0x0277, FUNCTION, "XamContentGetAttributesInternal")
+    LOAD_IMPORT(Xam, 0x0278, FUNCTION, "XamContentOpenFileInternal")
+    LOAD_IMPORT(Xam, 0x0279, FUNCTION, "XamContentAggregateCreateEnumerator")
+    LOAD_IMPORT(Xam, 0x027A, FUNCTION, "XamContentCreateAndMountPackage")
+    LOAD_IMPORT(Xam, 0x027B, FUNCTION, "XamContentOpenPackageFile")
+    LOAD_IMPORT(Xam, 0x027C, FUNCTION, "XamContentMountPackage")
+    LOAD_IMPORT(Xam, 0x027D, FUNCTION, "XamContentFlushPackage")
+    LOAD_IMPORT(Xam, 0x027E, FUNCTION, "XamContentClosePackageFile")
+    LOAD_IMPORT(Xam, 0x027F, FUNCTION, "XamContentDuplicateFileHandle")
+    LOAD_IMPORT(Xam, 0x0280, FUNCTION, "XamGetExecutionId")
+    LOAD_IMPORT(Xam, 0x0281, FUNCTION, "XamGetGameRatings")
+    LOAD_IMPORT(Xam, 0x0282, FUNCTION, "XamGetSystemVersion")
+    LOAD_IMPORT(Xam, 0x0283, FUNCTION, "XamContentGetLocalizedString")
+    LOAD_IMPORT(Xam, 0x0284, FUNCTION, "XamContentGetDefaultDevice")
+    LOAD_IMPORT(Xam, 0x0285, FUNCTION, "XamContentInstallInternal")
+    LOAD_IMPORT(Xam, 0x0286, FUNCTION, "XamContentSetMediaMetaDataInternal")
+    LOAD_IMPORT(Xam, 0x0287, FUNCTION, "XamContentGetDeviceSerialNumber")
+    LOAD_IMPORT(Xam, 0x0288, FUNCTION, "XamContentGetMountedPackageByRootName")
+    LOAD_IMPORT(Xam, 0x0289, FUNCTION, "XamContentRegisterChangeCallback")
+    LOAD_IMPORT(Xam, 0x028A, FUNCTION, "XamNotifyCreateListener")
+    LOAD_IMPORT(Xam, 0x028B, FUNCTION, "XNotifyGetNext")
+    LOAD_IMPORT(Xam, 0x028C, FUNCTION, "XNotifyPositionUI")
+    LOAD_IMPORT(Xam, 0x028D, FUNCTION, "XNotifyDelayUI")
+    LOAD_IMPORT(Xam, 0x028E, FUNCTION, "XNotifyBroadcast")
+    LOAD_IMPORT(Xam, 0x028F, FUNCTION, "XNotifyRegisterArea")
+    LOAD_IMPORT(Xam, 0x0290, FUNCTION, "XNotifyQueueUI")
+    LOAD_IMPORT(Xam, 0x0291, FUNCTION, "XamNotifyCreateListenerInternal")
+    LOAD_IMPORT(Xam, 0x0292, FUNCTION, "XNotifyUISetOptions")
+    LOAD_IMPORT(Xam, 0x0293, FUNCTION, "XNotifyUIGetOptions")
+    LOAD_IMPORT(Xam, 0x0294, FUNCTION, "XamContentLaunchImageInternalEx")
+    LOAD_IMPORT(Xam, 0x0295, FUNCTION, "XamShutdown")
+    LOAD_IMPORT(Xam, 0x0296, FUNCTION, "XamAllocDevkitHeapAvailable")
+    LOAD_IMPORT(Xam, 0x0297, FUNCTION, "XamNotifyCreateListenerRangeInternal")
+    LOAD_IMPORT(Xam, 0x0298, FUNCTION, "XNotifyQueueUIEx")
+    LOAD_IMPORT(Xam, 0x0299, FUNCTION, "XamAppRequestLoadEx")
+    LOAD_IMPORT(Xam, 0x029A, FUNCTION, "XuiPNGTextureLoader")
+    LOAD_IMPORT(Xam, 0x029B, FUNCTION, "XuiRenderGetXuiDevice")
+    LOAD_IMPORT(Xam, 0x029C, FUNCTION, "XuiDefault_False")
+    LOAD_IMPORT(Xam, 0x029D, FUNCTION, "XamUserGetReportingInfo")
+    LOAD_IMPORT(Xam, 0x029E, FUNCTION, "XamUpdateStart")
+    LOAD_IMPORT(Xam, 0x029F, FUNCTION, "XamUpdateGetProgress")
+    LOAD_IMPORT(Xam, 0x02A0, FUNCTION, "XamUpdateGetExtenderInstance")
+    LOAD_IMPORT(Xam, 0x02A1, FUNCTION, "XamUpdateFinish")
+    LOAD_IMPORT(Xam, 0x02A2, FUNCTION, "XamUpdateAttachExtenderInstance")
+    LOAD_IMPORT(Xam, 0x02A3, FUNCTION, "XamUpdateAllocateExtenderBuffer")
+    LOAD_IMPORT(Xam, 0x02A4, FUNCTION, "XamRestartTitleLoadAfterUpdate")
+    LOAD_IMPORT(Xam, 0x02A5, FUNCTION, "XamUIThreadDisableFontPatching")
+    LOAD_IMPORT(Xam, 0x02A6, FUNCTION, "XamUpdateGetBaseSystemVersion")
+    LOAD_IMPORT(Xam, 0x02A7, FUNCTION, "XamUpdateGetCurrentSystemVersion")
+    LOAD_IMPORT(Xam, 0x02A8, FUNCTION, "XamUIThreadEnableFontPatching")
+    LOAD_IMPORT(Xam, 0x02A9, FUNCTION, "XamTerminateTitleForUpdate")
+    LOAD_IMPORT(Xam, 0x02AA, FUNCTION, "XamSystemUpdateInstallLocal")
+    LOAD_IMPORT(Xam, 0x02AB, FUNCTION, "XamUpdateChainPass3FromPass2")
+    LOAD_IMPORT(Xam, 0x02AD, FUNCTION, "XamInputGetCapabilitiesEx")
+    LOAD_IMPORT(Xam, 0x02AE, FUNCTION, "XamUserIsUnsafeProgrammingAllowed")
+    LOAD_IMPORT(Xam, 0x02AF, FUNCTION, "XamDevAuthSetFaultEx")
+    LOAD_IMPORT(Xam, 0x02B0, FUNCTION, "XamUpdateGetData")
+    LOAD_IMPORT(Xam, 0x02B1, FUNCTION, "XamCacheIntegrityCheck")
+    LOAD_IMPORT(Xam, 0x02B2, FUNCTION, "XamCacheStoreFile")
+    LOAD_IMPORT(Xam, 0x02B3, FUNCTION, "XamCacheFetchFile")
+    LOAD_IMPORT(Xam, 0x02B4, FUNCTION, "XamCacheOpenFile")
+    LOAD_IMPORT(Xam, 0x02B5, FUNCTION, "XamCacheCloseFile")
+    LOAD_IMPORT(Xam, 0x02B6, FUNCTION, "XamGetCachedTitleName")
+    LOAD_IMPORT(Xam, 0x02B7, FUNCTION, "XamCacheReset")
+    LOAD_IMPORT(Xam, 0x02B8, FUNCTION, "XamGetCachedGamerTag")
+    LOAD_IMPORT(Xam, 0x02B9, FUNCTION, "XamGetCachedGamerTagW")
+    LOAD_IMPORT(Xam, 0x02BA, FUNCTION, "XamCacheDeleteFile")
+    LOAD_IMPORT(Xam, 0x02BB, FUNCTION, "XamCacheRenameFile")
+    LOAD_IMPORT(Xam, 0x02BC, FUNCTION, "XamShowSigninUI")
+    LOAD_IMPORT(Xam, 0x02BD, FUNCTION, "XamShowSigninUIEx")
+    LOAD_IMPORT(Xam, 0x02BE, FUNCTION, "XamShowSigninUIp")
+    LOAD_IMPORT(Xam, 0x02BF, FUNCTION, "XamShowFriendsUI")
+    LOAD_IMPORT(Xam, 0x02C0, FUNCTION, "XamShowMessagesUI")
+    LOAD_IMPORT(Xam, 0x02C1, FUNCTION, "XamShowKeyboardUI")
+    LOAD_IMPORT(Xam, 0x02C2, FUNCTION, "XamShowQuickChatUI")
+    LOAD_IMPORT(Xam, 0x02C3, FUNCTION, "XamShowVoiceMailUI")
+    LOAD_IMPORT(Xam, 0x02C4, FUNCTION, "XamShowGamerCardUI")
+    LOAD_IMPORT(Xam, 0x02C5, FUNCTION, "XamShowAchievementsUI")
+    LOAD_IMPORT(Xam, 0x02C6, FUNCTION, "XamShowPlayerReviewUI")
+    LOAD_IMPORT(Xam, 0x02C7, FUNCTION, "XamShowMarketplaceUI")
+    LOAD_IMPORT(Xam, 0x02C8, FUNCTION, "XamShowPlayersUI")
+    LOAD_IMPORT(Xam, 0x02C9, FUNCTION, "XamShowUpdaterUI")
+    LOAD_IMPORT(Xam, 0x02CA, FUNCTION, "XamShowMessageBoxUI")
+    LOAD_IMPORT(Xam, 0x02CB, FUNCTION, "XamShowDeviceSelectorUI")
+    LOAD_IMPORT(Xam, 0x02CC, FUNCTION, "XamShowMessageComposeUI")
+    LOAD_IMPORT(Xam, 0x02CD, FUNCTION, "XamShowGameInviteUI")
+    LOAD_IMPORT(Xam, 0x02CE, FUNCTION, "XamShowFriendRequestUI")
+    LOAD_IMPORT(Xam, 0x02CF, FUNCTION, "XamShowCreateProfileUI")
+    LOAD_IMPORT(Xam, 0x02D0, FUNCTION, "XamShowGamesUI")
+    LOAD_IMPORT(Xam, 0x02D1, FUNCTION, "XamShowLiveSignupUI")
+    LOAD_IMPORT(Xam, 0x02D2, FUNCTION, "XamShowFriendsUIp")
+    LOAD_IMPORT(Xam, 0x02D3, FUNCTION, "XamShowComplaintUI")
+    LOAD_IMPORT(Xam, 0x02D4, FUNCTION, "XamShowReputationUI")
+    LOAD_IMPORT(Xam, 0x02D5, FUNCTION, "XamShowGamerCardUIForXUID")
+    LOAD_IMPORT(Xam, 0x02D6, FUNCTION, "XamShowForcedNameChangeUI")
+    LOAD_IMPORT(Xam, 0x02D7, FUNCTION, "XamShowLiveUpsellUI")
+    LOAD_IMPORT(Xam, 0x02D8, FUNCTION, "XamShowPasscodeVerifyUI")
+    LOAD_IMPORT(Xam, 0x02D9, FUNCTION, "XamShowDirtyDiscErrorUI")
+    LOAD_IMPORT(Xam, 0x02DA, FUNCTION, "XamShowSignupCreditCardUI")
+    LOAD_IMPORT(Xam, 0x02DB, FUNCTION, "XamShowPrivateChatInviteUI")
+    LOAD_IMPORT(Xam, 0x02DC, FUNCTION, "XamShowMessageBoxUIEx")
+    LOAD_IMPORT(Xam, 0x02DD, FUNCTION, "XamShowRecentMessageUI")
+    LOAD_IMPORT(Xam, 0x02DE, FUNCTION, "XamShowRecentMessageUIEx")
+    LOAD_IMPORT(Xam, 0x02DF, FUNCTION, "XamShowMessagesUIEx")
+    LOAD_IMPORT(Xam, 0x02E0, FUNCTION, "XamShowAchievementDetailsUI")
+    LOAD_IMPORT(Xam, 0x02E1, FUNCTION, "XamShowPersonalizationUI")
+    LOAD_IMPORT(Xam, 0x02E2, FUNCTION, "XamShowChangeGamerTileUI")
+    LOAD_IMPORT(Xam, 0x02E3, FUNCTION, "XamShowVoiceSettingsUI")
+    LOAD_IMPORT(Xam, 0x02E4, FUNCTION, "XamShowVideoChatInviteUI")
+    LOAD_IMPORT(Xam, 0x02E5, FUNCTION, "XamShowCustomMessageComposeUI")
+    LOAD_IMPORT(Xam, 0x02E6, FUNCTION, "XamShowCustomPlayerListUI")
+    LOAD_IMPORT(Xam, 0x02E7, FUNCTION, "XamShowMarketplaceDownloadItemsUI")
+    LOAD_IMPORT(Xam, 0x02E8, FUNCTION, "XamShowMarketplaceUIEx")
+    LOAD_IMPORT(Xam, 0x02E9, FUNCTION, "XamShowMessageBox")
+    LOAD_IMPORT(Xam, 0x02EA, FUNCTION, "XamIsSysUiInvokedByXenonButton")
+    LOAD_IMPORT(Xam, 0x02EB, FUNCTION, "XamIsSysUiInvokedByTitle")
+    LOAD_IMPORT(Xam, 0x02EC, FUNCTION, "XamIsUIActive")
+    LOAD_IMPORT(Xam, 0x02ED, FUNCTION, "XamSysUiDisableAutoClose")
+    LOAD_IMPORT(Xam, 0x02EE, FUNCTION, "XamUserCreateAchievementEnumerator")
+    LOAD_IMPORT(Xam, 0x02EF, FUNCTION, "XamReadTile")
+    LOAD_IMPORT(Xam, 0x02F0, FUNCTION, "XamWriteGamerTile")
+    LOAD_IMPORT(Xam, 0x02F1, FUNCTION, "XamWriteTile")
+    LOAD_IMPORT(Xam, 0x02F2, FUNCTION, "XamReadImage")
+    LOAD_IMPORT(Xam, 0x02F3, FUNCTION, "XamUserCreateTitlesPlayedEnumerator")
+    LOAD_IMPORT(Xam, 0x02F4, FUNCTION, "XamDecompressPNGToTexture")
+    LOAD_IMPORT(Xam, 0x02F5, FUNCTION, "XamReadTileToTexture")
+    LOAD_IMPORT(Xam, 0x02F6, FUNCTION, "XamReadString")
+    LOAD_IMPORT(Xam, 0x02F7, FUNCTION, "XamUserCreateStatsEnumerator")
+    LOAD_IMPORT(Xam, 0x02F8, FUNCTION, "XamPrepareGamerTiles")
+    LOAD_IMPORT(Xam, 0x02F9, FUNCTION, "XamClearTitle")
+    LOAD_IMPORT(Xam, 0x02FA, FUNCTION, "XamReadStrings")
+    LOAD_IMPORT(Xam, 0x02FB, FUNCTION, "XamWriteGamerTileEx")
+    LOAD_IMPORT(Xam, 0x02FC, FUNCTION, "XamReadTileEx")
+    LOAD_IMPORT(Xam, 0x02FD, FUNCTION, "XamReadTileToTextureEx")
+    LOAD_IMPORT(Xam, 0x02FE, FUNCTION, "XamShowMessengerUI")
+    LOAD_IMPORT(Xam, 0x02FF, FUNCTION, "XamShowKeyboardUIMessenger")
+    LOAD_IMPORT(Xam, 0x0300, FUNCTION, "XamShowLiveUpsellUIEx")
+    LOAD_IMPORT(Xam, 0x0301, FUNCTION, "XamShowJoinSessionInProgressUI")
+    LOAD_IMPORT(Xam, 0x0302, FUNCTION, "XamShowGraduateUserUI")
+    LOAD_IMPORT(Xam, 0x0303, FUNCTION, "XamShowGamerCardUIForXUIDp")
+    LOAD_IMPORT(Xam, 0x0304, FUNCTION, "XamShowGuideUI")
+    LOAD_IMPORT(Xam, 0x0305, FUNCTION, "XamShowPartyUI")
+    LOAD_IMPORT(Xam, 0x0306, FUNCTION, "XamShowPartyInviteUI")
+    LOAD_IMPORT(Xam, 0x0307, FUNCTION, "XamUserAddRecentPlayer")
+    LOAD_IMPORT(Xam, 0x0308, FUNCTION, "XamUserUpdateRecentPlayer")
+    LOAD_IMPORT(Xam, 0x0309, FUNCTION, "XamUserCreatePlayerEnumerator")
+    LOAD_IMPORT(Xam, 0x030A, FUNCTION, "XamParseGamerTileKey")
+    LOAD_IMPORT(Xam, 0x030B, FUNCTION, "XamShowCommunitySessionsUI")
+    LOAD_IMPORT(Xam, 0x030C, FUNCTION, "XamVoiceCreate")
+    LOAD_IMPORT(Xam, 0x030D, FUNCTION, "XamVoiceHeadsetPresent")
+    LOAD_IMPORT(Xam, 0x030E, FUNCTION, "XamVoiceSubmitPacket")
+    LOAD_IMPORT(Xam, 0x030F, FUNCTION, "XamVoiceClose")
+    LOAD_IMPORT(Xam, 0x0310, FUNCTION, "XamVoiceGetBatteryStatus")
+    LOAD_IMPORT(Xam, 0x0311, FUNCTION, "Refresh")
+    LOAD_IMPORT(Xam, 0x0312, FUNCTION, "Refresh")
+    LOAD_IMPORT(Xam, 0x0313, FUNCTION, "XamShowJoinSessionByIdInProgressUI")
+    LOAD_IMPORT(Xam, 0x0314, FUNCTION, "XamShowPartyJoinInProgressUI")
+    LOAD_IMPORT(Xam, 0x0315, FUNCTION, "XamBuildSharedSystemResourceLocator")
+    LOAD_IMPORT(Xam, 0x0316, FUNCTION, "XamSessionCreateHandle")
+    LOAD_IMPORT(Xam, 0x0317, FUNCTION, "XamSessionRefObjByHandle")
+    LOAD_IMPORT(Xam, 0x0318, FUNCTION, "XamVoiceGetMicArrayStatus")
+    LOAD_IMPORT(Xam, 0x0319, FUNCTION, "XamVoiceSetAudioCaptureRoutine")
+    LOAD_IMPORT(Xam, 0x031A, FUNCTION, "XamVoiceGetDirectionalData")
+    LOAD_IMPORT(Xam, 0x031B, FUNCTION, "XamBuildResourceLocator")
+    LOAD_IMPORT(Xam, 0x031C, FUNCTION, "XamBuildLegacySystemResourceLocator")
+    LOAD_IMPORT(Xam, 0x031D, FUNCTION, "XamBuildGamercardResourceLocator")
+    LOAD_IMPORT(Xam, 0x031E, FUNCTION, "XamBuildDynamicResourceLocator")
+    LOAD_IMPORT(Xam, 0x031F, FUNCTION, "XamBuildXamResourceLocator")
+    LOAD_IMPORT(Xam, 0x0320, FUNCTION, "XuiAnimRun")
+    LOAD_IMPORT(Xam, 0x0321, FUNCTION, "XuiApplyLocale")
+    LOAD_IMPORT(Xam, 0x0322, FUNCTION, "XuiBubbleMessage")
+    LOAD_IMPORT(Xam, 0x0323, FUNCTION, "XuiControlIsBackButton")
+    LOAD_IMPORT(Xam, 0x0324, FUNCTION, "XuiControlIsNavButton")
+    LOAD_IMPORT(Xam, 0x0325, FUNCTION, "XuiCreateObject")
+    LOAD_IMPORT(Xam, 0x0326, FUNCTION, "XuiDestroyObject")
+    LOAD_IMPORT(Xam, 0x0327, FUNCTION, "XuiDynamicCast")
+    LOAD_IMPORT(Xam, 0x0328, FUNCTION, "XuiElementAddChild")
+    LOAD_IMPORT(Xam, 0x0329, FUNCTION, "XuiElementFindNamedFrame")
+    LOAD_IMPORT(Xam, 0x032A, FUNCTION, "XuiElementGetChildById")
+    LOAD_IMPORT(Xam, 0x032B, FUNCTION, "XuiElementGetFirstChild")
+    LOAD_IMPORT(Xam, 0x032C, FUNCTION, "XuiElementGetFocus")
+    LOAD_IMPORT(Xam, 0x032D, FUNCTION, "XuiElementGetFocusUser")
+    LOAD_IMPORT(Xam, 0x032E, FUNCTION, "XuiElementGetId")
+    LOAD_IMPORT(Xam, 0x032F, FUNCTION, "XuiElementGetLastChild")
+    LOAD_IMPORT(Xam, 0x0330, FUNCTION, "XuiElementGetNext")
+    LOAD_IMPORT(Xam, 0x0331, FUNCTION, "XuiElementGetParent")
+    LOAD_IMPORT(Xam, 0x0332, FUNCTION, "XuiElementGetUserFocus")
+    LOAD_IMPORT(Xam, 0x0333, FUNCTION, "XuiElementInitFocus")
+    LOAD_IMPORT(Xam, 0x0334, FUNCTION, "XuiElementInitUserFocus")
+    LOAD_IMPORT(Xam, 0x0335, FUNCTION, "XuiElementPlayTimeline")
+    LOAD_IMPORT(Xam, 0x0336, FUNCTION, "XuiElementSetBounds")
+    LOAD_IMPORT(Xam, 0x0337, FUNCTION, "XuiElementSetFocus")
+    LOAD_IMPORT(Xam, 0x0338, FUNCTION, "XuiElementSetUserFocus")
+    LOAD_IMPORT(Xam, 0x0339, FUNCTION, "XuiElementTreeGetFocus")
+    LOAD_IMPORT(Xam, 0x033A, FUNCTION, "XuiFindClass")
+    LOAD_IMPORT(Xam, 0x033B, FUNCTION, "XuiFreeStringTable")
+    LOAD_IMPORT(Xam, 0x033C, FUNCTION, "XuiGetBaseObject")
+    LOAD_IMPORT(Xam, 0x033D, FUNCTION, "XuiGetClass")
+    LOAD_IMPORT(Xam, 0x033E, FUNCTION, "XuiGetObjectClass")
+    LOAD_IMPORT(Xam, 0x033F, FUNCTION, "XuiGetOuter")
+    LOAD_IMPORT(Xam, 0x0340, FUNCTION, "XuiInit")
+    LOAD_IMPORT(Xam, 0x0341, FUNCTION, "XuiLoadFromBinary")
+    LOAD_IMPORT(Xam, 0x0342, FUNCTION, "XuiLoadStringTableFromFile")
+    LOAD_IMPORT(Xam, 0x0343, FUNCTION, "XuiVisualGetBasePath")
+    LOAD_IMPORT(Xam, 0x0344, FUNCTION, "XuiLookupStringTable")
+    LOAD_IMPORT(Xam, 0x0345, FUNCTION, "XuiNavButtonGetPressPath")
+    LOAD_IMPORT(Xam, 0x0346, FUNCTION, "XuiObjectFromHandle")
+    LOAD_IMPORT(Xam, 0x0347, FUNCTION, "XuiObjectGetProperty")
+    LOAD_IMPORT(Xam, 0x0348, FUNCTION, "XuiObjectGetPropertyId")
+    LOAD_IMPORT(Xam, 0x0349, FUNCTION, "XuiProcessInput")
+    LOAD_IMPORT(Xam, 0x034A, FUNCTION, "XuiRegisterClass")
+    LOAD_IMPORT(Xam, 0x034B, FUNCTION, "XuiRenderBegin")
+    LOAD_IMPORT(Xam, 0x034C, FUNCTION, "XuiRenderCreateDC")
+    LOAD_IMPORT(Xam, 0x034D, FUNCTION, "XuiRenderDCDeviceChanged")
+    LOAD_IMPORT(Xam, 0x034E, FUNCTION, "XuiRenderDestroyDC")
+    LOAD_IMPORT(Xam, 0x034F, FUNCTION, "XuiRenderEnd")
+    LOAD_IMPORT(Xam, 0x0350, FUNCTION, "XuiRenderGetBackBufferSize")
+    LOAD_IMPORT(Xam, 0x0351, FUNCTION, "XuiRenderInit")
+    LOAD_IMPORT(Xam, 0x0352, FUNCTION, "XuiRenderInitShared")
+    LOAD_IMPORT(Xam, 0x0353, FUNCTION, "XuiRenderPresent")
+    LOAD_IMPORT(Xam, 0x0354, FUNCTION, "XuiRenderSetViewTransform")
+    LOAD_IMPORT(Xam, 0x0355, FUNCTION, "XuiRenderUninit")
+    LOAD_IMPORT(Xam, 0x0356, FUNCTION, "XamShowNuiGuideUI")
+    LOAD_IMPORT(Xam, 0x0357, FUNCTION, "XuiSceneCreate")
+    LOAD_IMPORT(Xam, 0x0358, FUNCTION, "XuiSceneNavigateBack")
+    LOAD_IMPORT(Xam, 0x0359, FUNCTION, "XuiSceneNavigateFirst")
+    LOAD_IMPORT(Xam, 0x035A, FUNCTION, "XuiSceneNavigateForward")
+    LOAD_IMPORT(Xam, 0x035B, FUNCTION, "XuiScenePlayBackFromTransition")
+    LOAD_IMPORT(Xam, 0x035C, FUNCTION, "XuiScenePlayBackToTransition")
+    LOAD_IMPORT(Xam, 0x035D, FUNCTION, "XuiScenePlayFromTransition")
+    LOAD_IMPORT(Xam, 0x035E, FUNCTION, "XuiScenePlayToTransition")
+    LOAD_IMPORT(Xam, 0x035F, FUNCTION, "XuiSendMessage")
+    LOAD_IMPORT(Xam, 0x0360, FUNCTION, "XuiSetLocale")
+    LOAD_IMPORT(Xam, 0x0361, FUNCTION, "XuiUninit")
+    LOAD_IMPORT(Xam, 0x0362, FUNCTION, "XuiUnregisterClass")
+    LOAD_IMPORT(Xam, 0x0363, FUNCTION, "XuiTextElementSetText")
+    LOAD_IMPORT(Xam, 0x0364, FUNCTION, "XuiSetTimer")
+    LOAD_IMPORT(Xam, 0x0365, FUNCTION, "XuiTimersRun")
+    LOAD_IMPORT(Xam, 0x0366, FUNCTION, "XuiTextElementGetText")
+    LOAD_IMPORT(Xam, 0x0367, FUNCTION, "XuiVisualSetBasePath")
+    LOAD_IMPORT(Xam, 0x0368, FUNCTION, "XuiHandleIsValid")
+    LOAD_IMPORT(Xam, 0x0369, FUNCTION, "XuiAlloc")
+    LOAD_IMPORT(Xam, 0x036A, FUNCTION, "XuiFree")
+    LOAD_IMPORT(Xam, 0x036B, FUNCTION, "XuiDefault_True")
+    LOAD_IMPORT(Xam, 0x036C, FUNCTION, "XuiDefault_EmptyString")
+    LOAD_IMPORT(Xam, 0x036D, FUNCTION, "XuiDefault_IntegerZero")
+    LOAD_IMPORT(Xam, 0x036E, FUNCTION, "XuiCopyString")
+    LOAD_IMPORT(Xam, 0x036F, FUNCTION, "XuiRealloc")
+    LOAD_IMPORT(Xam, 0x0370, FUNCTION, "XuiControlPlayOptionalVisual")
+    LOAD_IMPORT(Xam, 0x0371, FUNCTION, "XuiKillTimer")
+    LOAD_IMPORT(Xam, 0x0372, FUNCTION, "XuiElementEnableInput")
+    LOAD_IMPORT(Xam, 0x0373, FUNCTION, "XuiElementInputEnabled")
+    LOAD_IMPORT(Xam, 0x0374, FUNCTION, "XuiIsInstanceOf")
+    LOAD_IMPORT(Xam, 0x0375, FUNCTION, "XuiResourceComposeLocator")
+    LOAD_IMPORT(Xam, 0x0376, FUNCTION, "XuiResourceLocatorIsAbsolute")
+    LOAD_IMPORT(Xam, 0x0377, FUNCTION, "XuiBroadcastMessage")
+    LOAD_IMPORT(Xam, 0x0378, FUNCTION, "XuiElementDisallowRecursiveTimelineControl")
+    LOAD_IMPORT(Xam, 0x0379, FUNCTION, "XUIElementPropVal_Construct")
+    LOAD_IMPORT(Xam, 0x037A, FUNCTION, "XUIElementPropVal_Destruct")
+    LOAD_IMPORT(Xam, 0x037B, FUNCTION, "XUIElementPropVal_SetString")
+    LOAD_IMPORT(Xam, 0x037C, FUNCTION, "XuiObjectSetProperty")
+    LOAD_IMPORT(Xam, 0x037D, FUNCTION, "XuiElementGetOpacity")
+    LOAD_IMPORT(Xam, 0x037E, FUNCTION, "XuiElementSetOpacity")
+    LOAD_IMPORT(Xam, 0x037F, FUNCTION, "XuiEditSetTextLimit")
+    LOAD_IMPORT(Xam, 0x0380, FUNCTION, "XuiEditGetTextLimit")
+    LOAD_IMPORT(Xam, 0x0381, FUNCTION, "XuiSliderSetValue")
+    LOAD_IMPORT(Xam, 0x0382, FUNCTION, "XuiSliderGetValue")
+    LOAD_IMPORT(Xam, 0x0383, FUNCTION, "XuiSliderSetRange")
+    LOAD_IMPORT(Xam, 0x0384, FUNCTION, "XuiElementUnlink")
+    LOAD_IMPORT(Xam, 0x0385, FUNCTION, "XuiElementInsertChild")
+    LOAD_IMPORT(Xam, 0x0386, FUNCTION, "XuiSceneNavigateBackToFirst")
+    LOAD_IMPORT(Xam, 0x0387, FUNCTION, "XuiProgressBarSetRange")
+    LOAD_IMPORT(Xam, 0x0388, FUNCTION, "XuiProgressBarSetValue")
+    LOAD_IMPORT(Xam, 0x0389, FUNCTION, "XuiProgressBarGetValue")
+    LOAD_IMPORT(Xam, 0x038A, FUNCTION, "XuiControlAttachVisual")
+    LOAD_IMPORT(Xam, 0x038B, FUNCTION, "XuiCreateTextureBrush")
+    LOAD_IMPORT(Xam, 0x038C, FUNCTION, "XuiDestroyBrush")
+    LOAD_IMPORT(Xam, 0x038D, FUNCTION, "XUIElementPropVal_SetColorFromUint")
+    LOAD_IMPORT(Xam, 0x038E, FUNCTION, "XuiFigureSetFill")
+    LOAD_IMPORT(Xam, 0x038F, FUNCTION, "XuiSliderGetRange")
+    LOAD_IMPORT(Xam, 0x0390, FUNCTION, "XuiFigureSetTexture")
+    LOAD_IMPORT(Xam, 0x0391, FUNCTION, "XuiControlGetItemAssociation")
+    LOAD_IMPORT(Xam, 0x0392, FUNCTION, "XuiResourceLoadAll")
+    LOAD_IMPORT(Xam, 0x0393, FUNCTION, "XuiImageElementSetImagePath")
+    LOAD_IMPORT(Xam, 0x0394, FUNCTION, "XuiImageElementGetImagePath")
+    LOAD_IMPORT(Xam, 0x0395, FUNCTION, "XuiControlGetVisual")
+    LOAD_IMPORT(Xam, 0x0396, FUNCTION, "XuiControlGetNavigation")
+    LOAD_IMPORT(Xam, 0x0397, FUNCTION, "XuiLookupStringTableByIndex")
+    LOAD_IMPORT(Xam, 0x0398, FUNCTION, "XUIElementPropVal_SetBool")
+    LOAD_IMPORT(Xam, 0x0399, FUNCTION, "XuiElementHasFocus")
+    LOAD_IMPORT(Xam, 0x039A, FUNCTION, "XUIElementPropVal_SetUint")
+    LOAD_IMPORT(Xam, 0x039B, FUNCTION, "XUIElementPropVal_Clear")
+    LOAD_IMPORT(Xam, 0x039C, FUNCTION, "XuiEditSetTextFormatInfo")
+    LOAD_IMPORT(Xam, 0x039D, FUNCTION, "XuiCreateSolidBrush")
+    LOAD_IMPORT(Xam, 0x039E, FUNCTION, "XuiSceneInterruptTransitions")
+    LOAD_IMPORT(Xam, 0x039F, FUNCTION, "XuiResourceOpen")
+    LOAD_IMPORT(Xam, 0x03A0, FUNCTION, "XuiResourceRead")
+    LOAD_IMPORT(Xam, 0x03A1, FUNCTION, "XuiResourceClose")
+    LOAD_IMPORT(Xam, 0x03A2, FUNCTION, "XuiVisualCreateInstance")
+    LOAD_IMPORT(Xam, 0x03A3, FUNCTION, "XuiElementGetTimeline")
+    LOAD_IMPORT(Xam, 0x03A4, FUNCTION, "GetCodecVersion")
+    LOAD_IMPORT(Xam, 0x03A5, FUNCTION, "XuiElementIsDescendant")
+    LOAD_IMPORT(Xam, 0x03A6, FUNCTION, "XuiSetMessageFilter")
+    LOAD_IMPORT(Xam, 0x03A7, FUNCTION, "XuiAttachTextureBrush")
+    LOAD_IMPORT(Xam, 0x03A8, FUNCTION, "XuiElementBeginRender")
+    LOAD_IMPORT(Xam, 0x03A9, FUNCTION, "XuiElementEndRender")
+    LOAD_IMPORT(Xam, 0x03AA, FUNCTION, "XuiDrawShape")
+    LOAD_IMPORT(Xam, 0x03AB, FUNCTION, "XuiSelectBrushEx")
+    LOAD_IMPORT(Xam, 0x03AC, FUNCTION, "XuiFigureGetShape")
+    LOAD_IMPORT(Xam, 0x03AD, FUNCTION, "XuiFillRect")
+    LOAD_IMPORT(Xam, 0x03AE, FUNCTION, "XuiVec2TransformCoord")
+    LOAD_IMPORT(Xam, 0x03AF, FUNCTION, "XuiMatrixMultiply")
+    LOAD_IMPORT(Xam, 0x03B0, FUNCTION, "XuiElementGetXForm")
+    LOAD_IMPORT(Xam, 0x03B1, FUNCTION, "XuiElementSetPosition")
+    LOAD_IMPORT(Xam, 0x03B2, FUNCTION, "XuiSelectBrush")
+    LOAD_IMPORT(Xam, 0x03B3, FUNCTION, "XuiElementRenderChildren")
+    LOAD_IMPORT(Xam, 0x03B4, FUNCTION, "XuiFreeUnusedTextures")
+    LOAD_IMPORT(Xam, 0x03B5, FUNCTION, "XuiListEnableItemOverride")
+    LOAD_IMPORT(Xam, 0x03B6, FUNCTION, "XuiListGetDefaultItemSize")
+    LOAD_IMPORT(Xam, 0x03B7, FUNCTION, "XuiResourceSeek")
+    LOAD_IMPORT(Xam, 0x03B8, FUNCTION, "XuiElementDiscardResources")
+    LOAD_IMPORT(Xam, 0x03B9, FUNCTION, "XuiTabSceneGoto")
+    LOAD_IMPORT(Xam, 0x03BA, FUNCTION, "XuiTabSceneGetCurrentTab")
+    LOAD_IMPORT(Xam, 0x03BB, FUNCTION, "XamShowWhatsOnUI")
+    LOAD_IMPORT(Xam, 0x03BC, FUNCTION, "XamShowEditProfileUI")
+    LOAD_IMPORT(Xam, 0x03BD, FUNCTION, "XamShowStorePickerUI")
+    LOAD_IMPORT(Xam, 0x03BE, FUNCTION, "XamShowTermsOfUseUI")
+    LOAD_IMPORT(Xam, 0x03BF, FUNCTION, "XamShowJoinPartyUI")
+    LOAD_IMPORT(Xam, 0x03C0, FUNCTION, "XamShowWordRegisterUI")
+    LOAD_IMPORT(Xam, 0x03C1, FUNCTION, "XamOverrideHudOpenType")
+    LOAD_IMPORT(Xam, 0x03C2, FUNCTION, "XamShowAchievementsUIEx")
+    LOAD_IMPORT(Xam, 0x03C3, FUNCTION, "XamUserGetUserTenure")
+    LOAD_IMPORT(Xam, 0x03C4, FUNCTION, "XamUserGetSubscriptionType")
+    LOAD_IMPORT(Xam, 0x03C5, FUNCTION, "XamShowGameVoiceChannelUI")
+    LOAD_IMPORT(Xam, 0x03C6, FUNCTION, "XamShowAvatarAwardsUI")
+    LOAD_IMPORT(Xam, 0x03C7, FUNCTION, "XamShowAvatarAwardGamesUI")
+    LOAD_IMPORT(Xam, 0x03C8, FUNCTION, "XamShowVideoRichPresenceUI")
+    LOAD_IMPORT(Xam, 0x03C9, FUNCTION, "XamHudGetUserIndex")
+    LOAD_IMPORT(Xam, 0x03CA, FUNCTION, "XGetAudioFlags")
+    LOAD_IMPORT(Xam, 0x03CB, FUNCTION, "XGetAVPack")
+    LOAD_IMPORT(Xam, 0x03CC, FUNCTION, "XGetGameRegion")
+    LOAD_IMPORT(Xam, 0x03CD, FUNCTION, "XGetLanguage")
+    LOAD_IMPORT(Xam, 0x03CE, FUNCTION, "XapipGetLocale")
+    LOAD_IMPORT(Xam, 0x03CF, FUNCTION, "XGetVideoFlags")
+    LOAD_IMPORT(Xam, 0x03D0, FUNCTION, "XGetVideoStandard")
+    LOAD_IMPORT(Xam, 0x03D1, FUNCTION, "XGetVideoMode")
+    LOAD_IMPORT(Xam, 0x03D2, FUNCTION, "XamGetLanguage")
+    LOAD_IMPORT(Xam, 0x03D3, FUNCTION, "XUITimeline_Run")
+    LOAD_IMPORT(Xam, 0x03D4, FUNCTION, "XamSetAutomation")
+    LOAD_IMPORT(Xam, 0x03D5, FUNCTION, "XAutomationpBindController")
+    LOAD_IMPORT(Xam, 0x03D6, FUNCTION, "XAutomationpUnbindController")
+    LOAD_IMPORT(Xam, 0x03D7, FUNCTION, "XAutomationpInputXenonButton")
+    LOAD_IMPORT(Xam, 0x03D8, FUNCTION, "XAutomationpInputPress")
+    LOAD_IMPORT(Xam, 0x03D9, FUNCTION, "XAutomationpInputSetState")
+    LOAD_IMPORT(Xam, 0x03DA, FUNCTION, "XamEnableOverdraw")
+    LOAD_IMPORT(Xam, 0x03DB, VARIABLE, "g_XuiAutomation")
+    LOAD_IMPORT(Xam, 0x03DC, FUNCTION, "XamVoiceGetMicArrayAudio")
+    LOAD_IMPORT(Xam, 0x03DD, FUNCTION, "XampSystemInput")
+    LOAD_IMPORT(Xam, 0x03DE, FUNCTION, "XamInputControl")
+    LOAD_IMPORT(Xam, 0x03DF, FUNCTION, "XuiElementGetPosition")
+    LOAD_IMPORT(Xam, 0x03E0, FUNCTION, "XamIsMessageBoxActive")
+    LOAD_IMPORT(Xam, 0x03E1, FUNCTION, "XamIsBackgroundSceneInTransition")
+    LOAD_IMPORT(Xam, 0x03E2, FUNCTION, "XuiElementTreeHasFocus")
+    LOAD_IMPORT(Xam, 0x03E3, FUNCTION, "XuiFigureClose")
+    LOAD_IMPORT(Xam, 0x03E4, FUNCTION, "GamerCardStartup")
+    LOAD_IMPORT(Xam, 0x03E5, FUNCTION, "GamerCardCleanup")
+    LOAD_IMPORT(Xam, 0x03E6, FUNCTION, "GamerCardRegisterControls")
+    LOAD_IMPORT(Xam, 0x03E7, FUNCTION, "GamerCardUnregisterControls")
+    LOAD_IMPORT(Xam, 0x03E8, FUNCTION, "RtlFindFirstFile")
+    LOAD_IMPORT(Xam, 0x03E9, FUNCTION, "RtlFindNextFile")
+    LOAD_IMPORT(Xam, 0x03EA, FUNCTION, "RtlGetModuleFileName")
+    LOAD_IMPORT(Xam, 0x03EB, FUNCTION, "RtlOutputDebugString")
+    LOAD_IMPORT(Xam, 0x03EC, FUNCTION, "RtlRemoveDirectory")
+    LOAD_IMPORT(Xam, 0x03ED, FUNCTION, "RtlSleep")
+    LOAD_IMPORT(Xam, 0x03EE, FUNCTION, "RtlGetLastError")
+    LOAD_IMPORT(Xam, 0x03EF, FUNCTION, "RtlSetLastError")
+    LOAD_IMPORT(Xam, 0x03F0, FUNCTION, "RtlSetLastNTError")
+    LOAD_IMPORT(Xam, 0x03F1, FUNCTION, "RtlDebugPrint")
+    LOAD_IMPORT(Xam, 0x03F2, FUNCTION, "RtlDebugError")
+    LOAD_IMPORT(Xam, 0x03F3, FUNCTION, "XDebugWarning")
+    LOAD_IMPORT(Xam, 0x03F4, FUNCTION, "RtlDebugTrace")
+    LOAD_IMPORT(Xam, 0x03F5, FUNCTION, "RtlDebugEntry")
+    LOAD_IMPORT(Xam, 0x03F6, FUNCTION, "RtlDebugExit")
+    LOAD_IMPORT(Xam, 0x03F7, FUNCTION, "RtlGetAttributesOnHeapAlloc")
+    LOAD_IMPORT(Xam, 0x03F8, FUNCTION, "RtlSetAttributesOnHeapAlloc")
+    LOAD_IMPORT(Xam, 0x03F9, FUNCTION, "XuiFigureSetShape")
+    LOAD_IMPORT(Xam, 0x03FA, FUNCTION, "RtlCreateHeap")
+    LOAD_IMPORT(Xam, 0x03FB, FUNCTION, "RtlDestroyHeap")
+    LOAD_IMPORT(Xam, 0x03FC, FUNCTION, "RtlAllocateHeap")
+    LOAD_IMPORT(Xam, 0x03FD, FUNCTION, "RtlAllocateHeapSlowly")
+    LOAD_IMPORT(Xam, 0x03FE, FUNCTION, "RtlReAllocateHeap")
+    LOAD_IMPORT(Xam, 0x03FF, FUNCTION, "RtlFreeHeap")
+    LOAD_IMPORT(Xam, 0x0400, FUNCTION, "RtlFreeHeapSlowly")
+    LOAD_IMPORT(Xam, 0x0401, FUNCTION, "RtlSizeHeap")
+    LOAD_IMPORT(Xam, 0x0402, FUNCTION, "RtlZeroHeap")
+    LOAD_IMPORT(Xam, 0x0403, FUNCTION, "RtlDebugWalkHeap")
+    LOAD_IMPORT(Xam, 0x0404, FUNCTION, "RtlWalkHeap")
+    LOAD_IMPORT(Xam, 0x0405, FUNCTION, "RtlLockHeap")
+    LOAD_IMPORT(Xam, 0x0406, FUNCTION, "RtlUnlockHeap")
+    LOAD_IMPORT(Xam, 0x0407, FUNCTION, "RtlValidateHeap")
+    LOAD_IMPORT(Xam, 0x0408, FUNCTION, "RtlDebugCompactHeap")
+    LOAD_IMPORT(Xam, 0x0409, FUNCTION, "RtlCompactHeap")
+    LOAD_IMPORT(Xam, 0x040A, FUNCTION, "XamAppSetTestOption")
+    LOAD_IMPORT(Xam, 0x040B, FUNCTION, "XamAppReportError")
+    LOAD_IMPORT(Xam, 0x040C, FUNCTION, "XamIsNuiUIActive")
+    LOAD_IMPORT(Xam, 0x040D, FUNCTION, "XamVerifyPasscode")
+    LOAD_IMPORT(Xam, 0x040E, FUNCTION, "OutputDebugStringA")
+    LOAD_IMPORT(Xam, 0x040F, FUNCTION, "DebugBreak")
+    LOAD_IMPORT(Xam, 0x0410, FUNCTION, "GetCurrentThreadId")
+    LOAD_IMPORT(Xam, 0x0411, FUNCTION, "XDebugError")
+    LOAD_IMPORT(Xam, 0x0412, FUNCTION, "XDebugWarning")
+    LOAD_IMPORT(Xam, 0x0413, FUNCTION, "RtlDebugSetLevel")
+    LOAD_IMPORT(Xam, 0x0414, FUNCTION, "CloseHandle")
+    LOAD_IMPORT(Xam, 0x0415, FUNCTION, "GetTickCount")
+    LOAD_IMPORT(Xam, 0x0416, FUNCTION, "GetLastError")
+    LOAD_IMPORT(Xam, 0x0417, FUNCTION, "SetFilePointer")
+    LOAD_IMPORT(Xam, 0x0418, FUNCTION, "SetFilePointerEx")
+    LOAD_IMPORT(Xam, 0x0419, FUNCTION, "SetLastError")
+    LOAD_IMPORT(Xam, 0x041A, FUNCTION, "MultiByteToWideChar")
+    LOAD_IMPORT(Xam, 0x041B, FUNCTION, "WideCharToMultiByte")
+    LOAD_IMPORT(Xam, 0x041C, FUNCTION, "ReadFile")
+    LOAD_IMPORT(Xam, 0x041D, FUNCTION, "FlushFileBuffers")
+    LOAD_IMPORT(Xam, 0x041E, FUNCTION, "WriteFile")
+    LOAD_IMPORT(Xam, 0x041F, FUNCTION, "OutputDebugStringW")
+    LOAD_IMPORT(Xam, 0x0420, FUNCTION, "SetEvent")
+    LOAD_IMPORT(Xam, 0x0421, FUNCTION, "XapiFormatTimeOut")
+    LOAD_IMPORT(Xam, 0x0422, FUNCTION, "CreateMutexA")
+    LOAD_IMPORT(Xam, 0x0423, FUNCTION, "OpenMutexA")
+    LOAD_IMPORT(Xam, 0x0424, FUNCTION, "ReleaseMutex")
+    LOAD_IMPORT(Xam, 0x0425, FUNCTION, "WaitForSingleObject")
+    LOAD_IMPORT(Xam, 0x0426, FUNCTION, "WaitForSingleObjectEx")
+    LOAD_IMPORT(Xam, 0x0427, FUNCTION, "GetFileSize")
+    LOAD_IMPORT(Xam, 0x0428, FUNCTION, "GetFileSizeEx")
+    LOAD_IMPORT(Xam, 0x0429, FUNCTION, "XapiDirectoryInformationToFindData")
+    LOAD_IMPORT(Xam, 0x042A, FUNCTION, "XapiFormatObjectAttributes")
+    LOAD_IMPORT(Xam, 0x042B, FUNCTION, "ResetEvent")
+    LOAD_IMPORT(Xam, 0x042C, FUNCTION, "wsprintfA")
+    LOAD_IMPORT(Xam, 0x042D, FUNCTION, "wsprintfW")
+    LOAD_IMPORT(Xam, 0x042E, FUNCTION, "GetOverlappedResult")
+    LOAD_IMPORT(Xam, 0x042F, FUNCTION, "QueryPerformanceCounter")
+    LOAD_IMPORT(Xam, 0x0430, FUNCTION, "QueryPerformanceFrequency")
+    LOAD_IMPORT(Xam, 0x0431, FUNCTION, "LocalAlloc")
+    LOAD_IMPORT(Xam, 0x0432, FUNCTION, "LocalFree")
+    LOAD_IMPORT(Xam, 0x0433, FUNCTION, "RaiseException")
+    LOAD_IMPORT(Xam, 0x0434, FUNCTION, "RtlUniform")
+    LOAD_IMPORT(Xam, 0x0435, FUNCTION, "RtlRandom")
+    LOAD_IMPORT(Xam, 0x0436, FUNCTION, "Sleep")
+    LOAD_IMPORT(Xam, 0x0437, FUNCTION, "SleepEx")
+    LOAD_IMPORT(Xam, 0x0438, FUNCTION, "XMemSet")
+    LOAD_IMPORT(Xam, 0x0439, FUNCTION, "XRegisterThreadNotifyRoutine")
+    LOAD_IMPORT(Xam, 0x043A, FUNCTION, "XGetOverlappedExtendedError")
+    LOAD_IMPORT(Xam, 0x043B, FUNCTION, "XGetOverlappedResult")
+    LOAD_IMPORT(Xam, 0x043C, FUNCTION, "CreateThread")
+    LOAD_IMPORT(Xam, 0x043D, FUNCTION, "ResumeThread")
+    LOAD_IMPORT(Xam, 0x043E, FUNCTION, "ExitThread")
+    LOAD_IMPORT(Xam, 0x043F, FUNCTION, "GetTimeZoneInformation")
+    LOAD_IMPORT(Xam, 0x0440, FUNCTION, "GetSystemTimeAsFileTime")
+    LOAD_IMPORT(Xam, 0x0441, FUNCTION, "SystemTimeToFileTime")
+    LOAD_IMPORT(Xam, 0x0442, FUNCTION, "FileTimeToSystemTime")
+    LOAD_IMPORT(Xam, 0x0443, FUNCTION, "GetSystemTime")
+    LOAD_IMPORT(Xam, 0x0444, FUNCTION, "GetLocalTime")
+    LOAD_IMPORT(Xam, 0x0445, FUNCTION, "CreateDirectoryA")
+    LOAD_IMPORT(Xam, 0x0446, FUNCTION, "CreateEventA")
+    LOAD_IMPORT(Xam, 0x0447, FUNCTION, "CreateFileA")
+    LOAD_IMPORT(Xam, 0x0448, FUNCTION, "DeleteFileA")
+    LOAD_IMPORT(Xam, 0x0449, FUNCTION, "FindFirstFileA")
+    LOAD_IMPORT(Xam, 0x044A, FUNCTION, "FindNextFileA")
+    LOAD_IMPORT(Xam, 0x044B, FUNCTION, "GetFileAttributesA")
+    LOAD_IMPORT(Xam, 0x044C, FUNCTION, "XamLoaderGetCurrentTitleD3DVersion")
+    LOAD_IMPORT(Xam, 0x044D, FUNCTION, "GetFileAttributesExA")
+    LOAD_IMPORT(Xam, 0x044E, FUNCTION, "GetModuleHandleA")
+    LOAD_IMPORT(Xam, 0x044F, FUNCTION, "GetDiskFreeSpaceExA")
+    LOAD_IMPORT(Xam, 0x0450, FUNCTION, "CopyFileA")
+    LOAD_IMPORT(Xam, 0x0451, FUNCTION, "SetEndOfFile")
+    LOAD_IMPORT(Xam, 0x0452, FUNCTION, "XamFamilyAddParentalExemptionToList")
+    LOAD_IMPORT(Xam, 0x0453, FUNCTION, "XamFamilyIsParentalValidationRequired")
+    LOAD_IMPORT(Xam, 0x0454, FUNCTION, "PIXBeginCapture")
+    LOAD_IMPORT(Xam, 0x0455, FUNCTION, "PIXEndCapture")
+    LOAD_IMPORT(Xam, 0x0456, FUNCTION, "PIXAddCounter")
+    LOAD_IMPORT(Xam, 0x0457, FUNCTION, "PIXGetGPUSlot")
+    LOAD_IMPORT(Xam, 0x0458, FUNCTION, "SetWaitableTimer")
+    LOAD_IMPORT(Xam, 0x0459, FUNCTION, "CancelWaitableTimer")
+    LOAD_IMPORT(Xam, 0x045A, FUNCTION, "CreateWaitableTimerA")
+    LOAD_IMPORT(Xam, 0x045B, FUNCTION, "DuplicateHandle")
+    LOAD_IMPORT(Xam, 0x045C, FUNCTION, "XapipCreateThread")
+    LOAD_IMPORT(Xam, 0x045D, FUNCTION, "lstrcpyA")
+    LOAD_IMPORT(Xam, 0x045E, FUNCTION, "lstrcpyW")
+    LOAD_IMPORT(Xam, 0x045F, FUNCTION, "lstrcpynA")
+    LOAD_IMPORT(Xam, 0x0460, FUNCTION, "lstrcpynW")
+    LOAD_IMPORT(Xam, 0x0461, FUNCTION, "lstrcatA")
+    LOAD_IMPORT(Xam, 0x0462, FUNCTION, "lstrcatW")
+    LOAD_IMPORT(Xam, 0x0463, FUNCTION, "lstrlenA")
+    LOAD_IMPORT(Xam, 0x0464, FUNCTION, "lstrlenW")
+    LOAD_IMPORT(Xam, 0x0465, FUNCTION, "IsBadReadPtr")
+    LOAD_IMPORT(Xam, 0x0466, FUNCTION, "IsBadWritePtr")
+    LOAD_IMPORT(Xam, 0x0467, FUNCTION, "FileTimeToLocalFileTime")
+    LOAD_IMPORT(Xam, 0x0468, FUNCTION, "XMemCpy")
+    LOAD_IMPORT(Xam, 0x0469, FUNCTION, "XMemCpyStreaming")
+    LOAD_IMPORT(Xam, 0x046A, FUNCTION, "XamHudSetUserIndex")
+    LOAD_IMPORT(Xam, 0x046B, FUNCTION, "XamShowNuiTroubleshooterUI")
+    LOAD_IMPORT(Xam, 0x046C, FUNCTION, "XamTestShowNuiTroubleshooterUI")
+    LOAD_IMPORT(Xam, 0x046D, FUNCTION, "XamShowPasscodeVerifyUIEx")
+    LOAD_IMPORT(Xam, 0x046E, FUNCTION, "XamShowNuiAchievementsUI")
+    LOAD_IMPORT(Xam, 0x046F, FUNCTION, "XamShowNuiCommunitySessionsUI")
+    LOAD_IMPORT(Xam, 0x0470, FUNCTION, "XamShowNuiDeviceSelectorUI")
+    LOAD_IMPORT(Xam, 0x0471, FUNCTION, "XamShowNuiDirtyDiscErrorUI")
+    LOAD_IMPORT(Xam, 0x0472, FUNCTION, "XamShowNuiFriendsUI")
+    LOAD_IMPORT(Xam, 0x0473, FUNCTION, "XamShowNuiGameInviteUI")
+    LOAD_IMPORT(Xam, 0x0474, FUNCTION, "XamShowNuiGamerCardUIForXUID")
+    LOAD_IMPORT(Xam, 0x0475, FUNCTION, "XamShowNuiMarketplaceDownloadItemsUI")
+    LOAD_IMPORT(Xam, 0x0476, FUNCTION, "XamShowNuiMarketplaceUI")
+    LOAD_IMPORT(Xam, 0x0477, FUNCTION, "XamShowNuiMessageBoxUI")
+    LOAD_IMPORT(Xam, 0x0478, FUNCTION, "XamShowNuiPartyUI")
+    LOAD_IMPORT(Xam, 0x0479, FUNCTION, "XamShowNuiFriendRequestUI")
+    LOAD_IMPORT(Xam, 0x047A, FUNCTION, "XamShowNuiSigninUI")
+    LOAD_IMPORT(Xam, 0x047B, FUNCTION, "XamShowNuiControllerRequiredUI")
+    LOAD_IMPORT(Xam, 0x047C, FUNCTION, "XamShowNuiGamesUI")
+    LOAD_IMPORT(Xam, 0x047D, FUNCTION, "XamShowNuiHardwareRequiredUI")
+    LOAD_IMPORT(Xam, 0x047E, FUNCTION, "XamCacheStoreFileByString")
+    LOAD_IMPORT(Xam, 0x047F, FUNCTION, "XamCacheFetchFileByString")
+    LOAD_IMPORT(Xam, 0x0480, FUNCTION, "XamCacheDeleteFileByString")
+    LOAD_IMPORT(Xam, 0x0481, FUNCTION, "XamGetCachedTitleNameEx")
+    LOAD_IMPORT(Xam, 0x0482, FUNCTION, "XamXlfsInitializeUploadQueue")
+    LOAD_IMPORT(Xam, 0x0483, FUNCTION, "XamXlfsUninitializeUploadQueue")
+    LOAD_IMPORT(Xam, 0x0484, FUNCTION, "XamXlfsMountUploadQueueInstance")
+    LOAD_IMPORT(Xam, 0x0485, FUNCTION, "XamXlfsUnmountUploadQueueInstance")
+    LOAD_IMPORT(Xam, 0x0486, FUNCTION, "XamVoiceRecordUserPrivileges")
+    LOAD_IMPORT(Xam, 0x0487, FUNCTION, "XamXlfsInitializeUploadQueueWithTestHooks")
+    LOAD_IMPORT(Xam, 0x0488, FUNCTION, "XamXlfsNotifyContentDeletion")
+    LOAD_IMPORT(Xam, 0x0489, FUNCTION, "XMemAlloc")
+    LOAD_IMPORT(Xam, 0x048A, FUNCTION, "XMemFree")
+    LOAD_IMPORT(Xam, 0x048B, FUNCTION, "XMemSize")
+    LOAD_IMPORT(Xam, 0x048C, FUNCTION, "XamVoiceSetMicArrayIdleUsers")
+    LOAD_IMPORT(Xam, 0x048D, FUNCTION, "XamVoiceMuteMicArray")
+    LOAD_IMPORT(Xam, 0x048E, FUNCTION, "XamVoiceGetMicArrayUnderrunStatus")
+    LOAD_IMPORT(Xam, 0x048F, FUNCTION, "XuiSceneEnableTransitionDependency")
+    LOAD_IMPORT(Xam, 0x0490, FUNCTION, "XamVoiceGetMicArrayAudioEx")
+    LOAD_IMPORT(Xam, 0x0491, FUNCTION, "XamVoiceDisableMicArray")
+    LOAD_IMPORT(Xam, 0x0497, FUNCTION, "XamVoiceIsActiveProcess")
+    LOAD_IMPORT(Xam, 0x04B0, FUNCTION, "XMPRegisterCodec")
+    LOAD_IMPORT(Xam, 0x0514, FUNCTION, "XamIsCurrentTitleIptv")
+    LOAD_IMPORT(Xam, 0x0515, FUNCTION, "XamIsIptvEnabled")
+    LOAD_IMPORT(Xam, 0x0516, FUNCTION, "XamIsDvrRecording")
+    LOAD_IMPORT(Xam, 0x0517, FUNCTION, "XamIptvUninstall")
+    LOAD_IMPORT(Xam, 0x0518, FUNCTION, "XamGetDvrStorage")
+    LOAD_IMPORT(Xam, 0x0519, FUNCTION, "XamSetDvrStorage")
+    LOAD_IMPORT(Xam, 0x051A, FUNCTION, "XamIptvGetServiceName")
+    LOAD_IMPORT(Xam, 0x051B, FUNCTION, "XamNuiHudGetEngagedEnrollmentIndex")
+    LOAD_IMPORT(Xam, 0x0578, FUNCTION, "XamReminderGetItems")
+    LOAD_IMPORT(Xam, 0x0579, FUNCTION, "XamReminderClearItems")
+    LOAD_IMPORT(Xam, 0x057A, FUNCTION, "XamReminderItemAdd")
+    LOAD_IMPORT(Xam, 0x057B, FUNCTION, "XamReminderItemRemove")
+    LOAD_IMPORT(Xam, 0x057C, FUNCTION, "XamReminderGetNextItem")
+    LOAD_IMPORT(Xam, 0x057D, FUNCTION, "XamReminderGetModifiedTime")
+    LOAD_IMPORT(Xam, 0x057E, FUNCTION, "XamReminderClearCache")
+    LOAD_IMPORT(Xam, 0x05DC, FUNCTION, "XamAvatarInitialize")
+    LOAD_IMPORT(Xam, 0x05DD, FUNCTION, "XamAvatarShutdown")
+    LOAD_IMPORT(Xam, 0x05DE, FUNCTION, "XamAvatarGetManifestLocalUser")
+    LOAD_IMPORT(Xam, 0x05DF, FUNCTION, "XamAvatarGetManifestsByXuid")
+    LOAD_IMPORT(Xam, 0x05E0, FUNCTION, "XamAvatarGetAssetsResultSize")
+    LOAD_IMPORT(Xam, 0x05E1, FUNCTION, "XamAvatarGetAssets")
+    LOAD_IMPORT(Xam, 0x05E2, FUNCTION, "XamAvatarGenerateMipMaps")
+    LOAD_IMPORT(Xam, 0x05E3, FUNCTION, "XamAvatarSetCustomAsset")
+    LOAD_IMPORT(Xam, 0x05E4, FUNCTION, "XamAvatarSetManifest")
+    LOAD_IMPORT(Xam, 0x05E5, FUNCTION, "EnumerateMediaObjects")
+    LOAD_IMPORT(Xam, 0x05E6, FUNCTION, "EnumerateMediaObjects")
+    LOAD_IMPORT(Xam, 0x05E7, FUNCTION, "XamAvatarLoadAnimation")
+    LOAD_IMPORT(Xam, 0x05E8, FUNCTION, "XamAvatarBeginEnumAssets")
+    LOAD_IMPORT(Xam, 0x05E9, FUNCTION, "XamAvatarEndEnumAssets")
+    LOAD_IMPORT(Xam, 0x05EA, FUNCTION, "XamAvatarEnumAssets")
+    LOAD_IMPORT(Xam, 0x05EB, FUNCTION, "XamAvatarGetMetadataRandom")
+    LOAD_IMPORT(Xam, 0x05EC, FUNCTION, "EnumerateMediaObjects")
+    LOAD_IMPORT(Xam, 0x05ED, FUNCTION, "EnumerateMediaObjects")
+    LOAD_IMPORT(Xam, 0x05EE, FUNCTION, "XamAvatarGetMetadataSignedOutProfileCount")
+    LOAD_IMPORT(Xam, 0x05EF, FUNCTION, "XamAvatarGetMetadataSignedOutProfile")
+    LOAD_IMPORT(Xam, 0x05F0, FUNCTION, "EnumerateMediaObjects")
+    LOAD_IMPORT(Xam, 0x05F1, FUNCTION, "XamAvatarManifestGetBodyType")
+    LOAD_IMPORT(Xam, 0x05F2, FUNCTION, "XamAvatarGetInstrumentation")
+    LOAD_IMPORT(Xam, 0x05F3, FUNCTION, "XamAvatarGetAssetIcon")
+    LOAD_IMPORT(Xam, 0x05F4, FUNCTION, "XamAvatarWearNow")
+    LOAD_IMPORT(Xam, 0x05F5, FUNCTION, "XamAvatarGetAssetBinary")
+    LOAD_IMPORT(Xam, 0x05F6, FUNCTION, "XamAvatarReinstallAwardedAsset")
+    LOAD_IMPORT(Xam, 0x05F7, FUNCTION, "XamAvatarGetInstalledAssetPackageDescription")
+    LOAD_IMPORT(Xam, 0x05F8, FUNCTION, "XamAvatarSetMocks")
+    LOAD_IMPORT(Xam, 0x060E, FUNCTION, "XamContentMountInstalledGame")
+    LOAD_IMPORT(Xam, 0x060F, FUNCTION, "XamContentIsGameInstalledToHDD")
+    LOAD_IMPORT(Xam, 0x0610, FUNCTION, "XamContentQueryLicenseInternal")
+    LOAD_IMPORT(Xam, 0x0611, FUNCTION, "XamContentGetDeviceVolumePath")
+    LOAD_IMPORT(Xam, 0x0612, FUNCTION, "XamContentDeviceCheckUpdates")
+    LOAD_IMPORT(Xam, 0x0613, FUNCTION, "XamContentGetHeaderInternal")
+    LOAD_IMPORT(Xam, 0x0640, FUNCTION, "XamPackageManagerFindPackageContainingIndexedXEX")
+    LOAD_IMPORT(Xam, 0x0641, FUNCTION, "XamPackageManagerReinitialize")
+    LOAD_IMPORT(Xam, 0x0642, FUNCTION, "XamPackageManagerGetAuthoritativeManifestVersion")
+    LOAD_IMPORT(Xam, 0x0643, FUNCTION, "XamGetCurrentSystemOnlineManifestRevision")
+    LOAD_IMPORT(Xam, 0x0644, FUNCTION, "XamPackageManagerDeleteExtendedPartition")
+    LOAD_IMPORT(Xam, 0x0645, FUNCTION, "XamPackageManagerHasExtendedPartition")
+    LOAD_IMPORT(Xam, 0x0646, FUNCTION, "XamPackageManagerGetExperienceMode")
+    LOAD_IMPORT(Xam, 0x0647, FUNCTION, "XamPackageManagerGetFeatureRequiresUpdateStrings")
+    LOAD_IMPORT(Xam, 0x0648, FUNCTION, "XamPackageManagerGetFileSize")
+    LOAD_IMPORT(Xam, 0x0649, FUNCTION, "XampDemandUpdateGetAttributes")
+    LOAD_IMPORT(Xam, 0x064A, FUNCTION, "XampDemandUpdateGetExtendedAttributes")
+    LOAD_IMPORT(Xam, 0x064B, FUNCTION, "XampDemandUpdateGetInstance")
+    LOAD_IMPORT(Xam, 0x064C, FUNCTION, "XampDemandUpdateSetRefreshTestFlags")
+    LOAD_IMPORT(Xam, 0x064D, FUNCTION, "XampDemandUpdateIsRefreshTestFlagSet")
+    LOAD_IMPORT(Xam, 0x064E, FUNCTION, "XampDemandUpdateGetManifestLocalPath")
+    LOAD_IMPORT(Xam, 0x064F, FUNCTION, "XampDemandUpdateRefreshManifest")
+    LOAD_IMPORT(Xam, 0x0650, FUNCTION, "XdfInitialize")
+    LOAD_IMPORT(Xam, 0x0651, FUNCTION, "XdfShutdown")
+    LOAD_IMPORT(Xam, 0x0652, FUNCTION, "XdfGetExpectedDownloadSize")
+    LOAD_IMPORT(Xam, 0x0653, FUNCTION, "XdfGetItem")
+    LOAD_IMPORT(Xam, 0x0654, FUNCTION, "XdfCacheItem")
+    LOAD_IMPORT(Xam, 0x0655, FUNCTION, "XdfLoadXexFromCache")
+    LOAD_IMPORT(Xam, 0x0656, FUNCTION, "XdfLoadXex")
+    LOAD_IMPORT(Xam, 0x0657, FUNCTION, "XdfCancelRequest")
+    LOAD_IMPORT(Xam, 0x0658, FUNCTION, "XdfResumeDelayedItem")
+    LOAD_IMPORT(Xam, 0x0659, FUNCTION, "XdfLaunchNewImageFromCache")
+    LOAD_IMPORT(Xam, 0x065A, FUNCTION, "XampDemandUpdateRefreshManifestDuringLogon")
+    LOAD_IMPORT(Xam, 0x065B, FUNCTION, "XampDemandUpdateCheckOnlineManifestChanged")
+    LOAD_IMPORT(Xam, 0x065C, FUNCTION, "XampDemandUpdateRunCacheCleaner")
+    LOAD_IMPORT(Xam, 0x0686, FUNCTION, "XamXStudioRequest")
+    LOAD_IMPORT(Xam, 0x06A4, FUNCTION, "XamShowAvatarMiniCreatorUI")
+    LOAD_IMPORT(Xam, 0x06A5, FUNCTION, "XamShowGoldUpgradeUI")
+    LOAD_IMPORT(Xam, 0x06A6, FUNCTION, "XamResumeUpdaterUI")
+    LOAD_IMPORT(Xam, 0x06A7, FUNCTION, "XamShowDirectAcquireUI")
+    LOAD_IMPORT(Xam, 0x06A8, FUNCTION, "XamShowPaymentOptionsUI")
+    LOAD_IMPORT(Xam, 0x0708, FUNCTION, "XamGetLiveHiveValueA")
+    LOAD_IMPORT(Xam, 0x0709, FUNCTION, "XamGetLiveHiveValueW")
+    LOAD_IMPORT(Xam, 0x070A, FUNCTION, "XamGetLiveHiveValueDuringLogonAttemptA")
+    LOAD_IMPORT(Xam, 0x076C, FUNCTION, "XamDownloadMarketplaceStoresList")
+    LOAD_IMPORT(Xam, 0x076D, FUNCTION, "XamGetStoreFront")
+    LOAD_IMPORT(Xam, 0x076E, FUNCTION, "XamSetStagingMode")
+    LOAD_IMPORT(Xam, 0x076F, FUNCTION, "XamGetStagingMode")
+    LOAD_IMPORT(Xam, 0x0770, FUNCTION, "XamAppGetSessionId")
+    LOAD_IMPORT(Xam, 0x07D0, FUNCTION, "XamDoesOmniNeedConfiguration")
+    LOAD_IMPORT(Xam, 0x07D1, FUNCTION, "XamFirstRunExperienceShouldRun")
+    LOAD_IMPORT(Xam, 0x07D2, FUNCTION, "GetProcessHeap")
+    LOAD_IMPORT(Xam, 0x07D3, FUNCTION, "UnhandledExceptionFilter")
+    LOAD_IMPORT(Xam, 0x07D4, FUNCTION, "SetUnhandledExceptionFilter")
+    LOAD_IMPORT(Xam, 0x07D5, FUNCTION, "XamIsOptionalMediaUpdateInstalled")
+    LOAD_IMPORT(Xam, 0x07D6, FUNCTION, "XamShowOptionalMediaUpdateRequiredUI")
+    LOAD_IMPORT(Xam, 0x07D7, FUNCTION, "XamShowOptionalMediaUpdateRequiredUIEx")
+    LOAD_IMPORT(Xam, 0x07D8, FUNCTION, "XamShowFirstRunWelcomeUI")
+    LOAD_IMPORT(Xam, 0x07D9, FUNCTION, "XamTaskCreateQueueEx")
+    LOAD_IMPORT(Xam, 0x07DA, FUNCTION, "XamSetDashBackstackData")
+    LOAD_IMPORT(Xam, 0x07DB, FUNCTION, "XamLaunchAvatarEditor")
+    LOAD_IMPORT(Xam, 0x07DC, FUNCTION, "XamGetDashBackstackData")
+    LOAD_IMPORT(Xam, 0x07DD, FUNCTION, "XamGetDashBackstackNodesCount")
+    LOAD_IMPORT(Xam, 0x07DE, FUNCTION, "XamSetLastActiveUserData")
+    LOAD_IMPORT(Xam, 0x07DF, FUNCTION, "XamGetLastActiveUserData")
+    LOAD_IMPORT(Xam, 0x07E0, FUNCTION, "XamSetActiveDashAppInfo")
+    LOAD_IMPORT(Xam, 0x07E1, FUNCTION, "XamGetActiveDashAppInfo")
+    LOAD_IMPORT(Xam, 0x0802, FUNCTION, "XamUserCreateAvatarAssetEnumerator")
+    LOAD_IMPORT(Xam, 0x0803, FUNCTION, "XamInitializeGameTileCache")
+    LOAD_IMPORT(Xam, 0x0804, FUNCTION, "XamDestroyGameTileCache")
+    LOAD_IMPORT(Xam, 0x0805, FUNCTION, "XamReadGameTileImage")
+    LOAD_IMPORT(Xam, 0x0806, FUNCTION, "XamShouldThrottleAccountInfoCall")
+    LOAD_IMPORT(Xam, 0x0807, FUNCTION, "XuiClassDerivesFrom")
+    LOAD_IMPORT(Xam, 0x0808, FUNCTION, "XuiFreeVisuals")
+    LOAD_IMPORT(Xam, 0x0809, FUNCTION, "XuiGetBaseClass")
+    LOAD_IMPORT(Xam, 0x080A, FUNCTION, "XuiLoadVisualFromBinary")
+    LOAD_IMPORT(Xam, 0x080B, FUNCTION, "XuiResourceGetBuffer")
+    LOAD_IMPORT(Xam, 0x080C, FUNCTION, "XuiResourceGetTotalSize")
+    LOAD_IMPORT(Xam, 0x080D, FUNCTION, "XuiElementGetUserData")
+    LOAD_IMPORT(Xam, 0x080E, FUNCTION, "XuiElementSetUserData")
+    LOAD_IMPORT(Xam, 0x080F, FUNCTION, "XuiTabSceneGetCount")
+    LOAD_IMPORT(Xam, 0x0810, FUNCTION, "XuiSliderGetStep")
+    LOAD_IMPORT(Xam, 0x0811, FUNCTION, "XuiSliderSetStep")
+    LOAD_IMPORT(Xam, 0x0812, FUNCTION, "XuiProgressBarGetRange")
+    LOAD_IMPORT(Xam, 0x0813, FUNCTION, "XuiElementSetHittable")
+    LOAD_IMPORT(Xam, 0x0814, FUNCTION, "XuiElementPlayNamedFrames")
+    LOAD_IMPORT(Xam, 0x0815, FUNCTION, "XuiElementGetPivot")
+    LOAD_IMPORT(Xam, 0x0816, FUNCTION, "XuiElementGetPrev")
+    LOAD_IMPORT(Xam, 0x0817, FUNCTION, "XuiElementGetScale")
+    LOAD_IMPORT(Xam, 0x0818, FUNCTION, "XuiElementSetPivot")
+    LOAD_IMPORT(Xam, 0x0819, FUNCTION, "XuiElementSetRotation")
+    LOAD_IMPORT(Xam, 0x081A, FUNCTION, "XuiElementSetScale")
+    LOAD_IMPORT(Xam, 0x081B, FUNCTION, "XuiControlWantsUnfocusedInput")
+    LOAD_IMPORT(Xam, 0x081C, FUNCTION, "XuiResourceOpenNoLoc")
+    LOAD_IMPORT(Xam, 0x081D, FUNCTION, "XuiResourceReleasePackage")
+    LOAD_IMPORT(Xam, 0x081E, FUNCTION, "XuiResourceGetPackageEntryInfo")
+    LOAD_IMPORT(Xam, 0x081F, FUNCTION, "XuiResourceGetPackageEntryCount")
+    LOAD_IMPORT(Xam, 0x0820, FUNCTION, "XuiResourceOpenPackage")
+    LOAD_IMPORT(Xam, 0x0821, FUNCTION, "XamCodeCoverageFileOpen")
+    LOAD_IMPORT(Xam, 0x0822, FUNCTION, "XamCodeCoverageFileClose")
+    LOAD_IMPORT(Xam, 0x0823, FUNCTION, "XamCodeCoverageFileLseek")
+    LOAD_IMPORT(Xam, 0x0824, FUNCTION, "XamCodeCoverageFileRead")
+    LOAD_IMPORT(Xam, 0x0825, FUNCTION, "XamCodeCoverageFileWrite")
+    LOAD_IMPORT(Xam, 0x0826, FUNCTION, "Refresh")
+    LOAD_IMPORT(Xam, 0x0827, FUNCTION, "XampHeapGetInfo")
+    LOAD_IMPORT(Xam, 0x0828, FUNCTION, "XampHeapGetCount")
+    LOAD_IMPORT(Xam, 0x0829, FUNCTION, "XamShowPamUI")
+    LOAD_IMPORT(Xam, 0x082A, FUNCTION, "XuiElementLayoutTree")
+    LOAD_IMPORT(Xam, 0x082B, FUNCTION, "XamRegisterScreenSaverCallback")
+    LOAD_IMPORT(Xam, 0x082C, FUNCTION, "XUIElementPropVal_SetInt")
+    LOAD_IMPORT(Xam, 0x082D, FUNCTION, "XUIElementPropVal_SetFloat")
+    LOAD_IMPORT(Xam, 0x082E, FUNCTION, "XuiObjectGetPropertyDef")
+    LOAD_IMPORT(Xam, 0x082F, FUNCTION, "XuiRenderGetDevice")
+    LOAD_IMPORT(Xam, 0x0830, FUNCTION, "XuiRenderRestoreState")
+    LOAD_IMPORT(Xam, 0x0831, FUNCTION, "XuiElementGetFullXForm")
+    LOAD_IMPORT(Xam, 0x0832, FUNCTION, "XuiRenderGetViewTransform")
+    LOAD_IMPORT(Xam, 0x0833, FUNCTION, "XuiRenderGetColorSpace")
+    LOAD_IMPORT(Xam, 0x0834, FUNCTION, "XamPngEncode")
+    LOAD_IMPORT(Xam, 0x0835, FUNCTION, "XamPngDecode")
+    LOAD_IMPORT(Xam, 0x0836, FUNCTION, "XamPngEncodeEx")
+    LOAD_IMPORT(Xam, 0x0837, FUNCTION, "XuiTextElementMeasureText")
+    LOAD_IMPORT(Xam, 0x0838, FUNCTION, "XamLoaderShouldConfirmReboot")
+    LOAD_IMPORT(Xam, 0x0839, FUNCTION, "XamLoaderRebootToDash")
+    LOAD_IMPORT(Xam, 0x083A, FUNCTION, "XamNuiHudGetEngagedTrackingID")
+    LOAD_IMPORT(Xam, 0x083B, FUNCTION, "XamLoaderLaunchTitleForReason")
+    LOAD_IMPORT(Xam, 0x083C, FUNCTION, "XamNuiHudSetEngagedTrackingID")
+    LOAD_IMPORT(Xam, 0x083E, FUNCTION, "XamSetupTexture")
+    LOAD_IMPORT(Xam, 0x0841, FUNCTION, "XamSetupCameraPreviewStuff")
+    LOAD_IMPORT(Xam, 0x0842, FUNCTION, "XamReleaseCameraPreviewStuff")
+    LOAD_IMPORT(Xam, 0x0843, FUNCTION, "XamRenderCameraPreviewStuff")
+    LOAD_IMPORT(Xam, 0x0848, FUNCTION, "XamAccountRecoveryGetSetTitleSyncTime")
+    LOAD_IMPORT(Xam, 0x0849, FUNCTION, "XamReadBiometricData")
+    LOAD_IMPORT(Xam, 0x084A, FUNCTION, "XamWriteBiometricData")
+    LOAD_IMPORT(Xam, 0x084B, FUNCTION, "XamD3DResourceDescriptorCreate")
+    LOAD_IMPORT(Xam, 0x084C, FUNCTION, "XamD3DResourceDescriptorAddRef")
+    LOAD_IMPORT(Xam, 0x084D, FUNCTION, "XamD3DResourceDescriptorRelease")
+    LOAD_IMPORT(Xam, 0x084E, FUNCTION, "XamD3DResourceAddRef")
+    LOAD_IMPORT(Xam, 0x084F, FUNCTION, "XamD3DResourceSet")
+    LOAD_IMPORT(Xam, 0x0850, FUNCTION, "XamD3DResourceIsBusy")
+    LOAD_IMPORT(Xam, 0x0851, FUNCTION, "XamD3DResourceRelease")
+    LOAD_IMPORT(Xam, 0x085E, FUNCTION, "XamNuiEnableChatMic")
+    LOAD_IMPORT(Xam, 0x085F, FUNCTION, "XamNuiIsChatMicEnabled")
+    LOAD_IMPORT(Xam, 0x0860, FUNCTION, "XamNuiGetDepthCalibration")
+    LOAD_IMPORT(Xam, 0x0861, FUNCTION, "XamNuiStoreDepthCalibration")
+    LOAD_IMPORT(Xam, 0x0862, FUNCTION, "XamUserNuiIsBiometricEnabled")
+    LOAD_IMPORT(Xam, 0x0863, FUNCTION, "XamUserNuiEnableBiometric")
+    LOAD_IMPORT(Xam, 0x0864, FUNCTION, "XamNuiCameraSetFlags")
+    LOAD_IMPORT(Xam, 0x0865, FUNCTION, "XamNuiCameraRememberFloor")
+    LOAD_IMPORT(Xam, 0x0866, FUNCTION, "XamUserNuiGetUserIndexForBind")
+    LOAD_IMPORT(Xam, 0x0867, FUNCTION, "XamUserNuiGetUserIndexForSignin")
+    LOAD_IMPORT(Xam, 0x0868, FUNCTION, "XamUserNuiBind")
+    LOAD_IMPORT(Xam, 0x0869, FUNCTION, "XamUserNuiGetUserIndex")
+    LOAD_IMPORT(Xam, 0x086A, FUNCTION, "XamUserNuiGetEnrollmentIndex")
+    LOAD_IMPORT(Xam, 0x086B, FUNCTION, "XamUserNuiUnbind")
+    LOAD_IMPORT(Xam, 0x086C, FUNCTION, "XamNuiIdentityGetQualityFlagsMessage")
+    LOAD_IMPORT(Xam, 0x086D, FUNCTION, "XamNuiCameraTiltSetCallback")
+    LOAD_IMPORT(Xam, 0x086E, FUNCTION, "XamNuiHudIsEnabled")
+    LOAD_IMPORT(Xam, 0x086F, FUNCTION, "XamNuiCameraGetTiltControllerType")
+    LOAD_IMPORT(Xam, 0x0870, FUNCTION, "XamNuiCameraTiltGetStatus")
+    LOAD_IMPORT(Xam, 0x0871, FUNCTION, "XamNuiIdentityGetQualityFlags")
+    LOAD_IMPORT(Xam, 0x0872, FUNCTION, "XamNuiIdentityEnrollForSignIn")
+    LOAD_IMPORT(Xam, 0x0873, FUNCTION, "XamNuiIdentityGetSessionId")
+    LOAD_IMPORT(Xam, 0x0874, FUNCTION, "XamNuiIdentityIdentifyWithBiometric")
+    LOAD_IMPORT(Xam, 0x0875, FUNCTION, "ControlPackGetHandleManager")
+    LOAD_IMPORT(Xam, 0x0876, FUNCTION, "XamEnableNuiAutomation")
+    LOAD_IMPORT(Xam, 0x0877, FUNCTION, "XamNuiGetSystemGestureControl")
+    LOAD_IMPORT(Xam, 0x0878, FUNCTION, "XamGetPasscodeKeyFromVirtualKey")
+    LOAD_IMPORT(Xam, 0x0879, FUNCTION, "XamEnableNatalPlayback")
+    LOAD_IMPORT(Xam, 0x087A, FUNCTION, "XamIsNuiAutomationEnabled")
+    LOAD_IMPORT(Xam, 0x087B, FUNCTION, "XamIsNatalPlaybackEnabled")
+    LOAD_IMPORT(Xam, 0x087C, FUNCTION, "XamNuiHudInterpretFrame")
+    LOAD_IMPORT(Xam, 0x087D, FUNCTION, "XamNuiHudEnableInputFilter")
+    LOAD_IMPORT(Xam, 0x087E, FUNCTION, "ControlpackNuiCursorSetTrackingId")
+    LOAD_IMPORT(Xam, 0x087F, FUNCTION, "XamNuiHudGetInitializeFlags")
+    LOAD_IMPORT(Xam, 0x0880, FUNCTION, "XamNuiCameraElevationSetAngle")
+    LOAD_IMPORT(Xam, 0x0881, FUNCTION, "XamNuiCameraElevationGetAngle")
+    LOAD_IMPORT(Xam, 0x0882, FUNCTION, "XamNuiCameraElevationAutoTilt")
+    LOAD_IMPORT(Xam, 0x0883, FUNCTION, "XamNuiCameraElevationStopMovement")
+    LOAD_IMPORT(Xam, 0x0884, FUNCTION, "XamNuiCameraElevationSetCallback")
+    LOAD_IMPORT(Xam, 0x0885, FUNCTION, "XamNuiGetDeviceStatus")
+    LOAD_IMPORT(Xam, 0x0886, FUNCTION, "XamNuiNatalCameraUpdateStarting")
+    LOAD_IMPORT(Xam, 0x0887, FUNCTION, "XamNuiNatalCameraUpdateComplete")
+    LOAD_IMPORT(Xam, 0x0888, FUNCTION, "XamNuiHudGetVersions")
+    LOAD_IMPORT(Xam, 0x0889, FUNCTION, "XamGetHUDElementByPath")
+    LOAD_IMPORT(Xam, 0x088A, FUNCTION, "XamGetHUDElementByAutoId")
+    LOAD_IMPORT(Xam, 0x088B, FUNCTION, "XuiElementGetScreenPositionCenter")
+    LOAD_IMPORT(Xam, 0x088C, FUNCTION, "XamNuiCameraElevationReverseAutoTilt")
+    LOAD_IMPORT(Xam, 0x088D, FUNCTION, "ControlPackSimpleCursorGetRayFromScreenPosition")
+    LOAD_IMPORT(Xam, 0x088E, FUNCTION, "ControlPackSideNavControlGetNuiHandle")
+    LOAD_IMPORT(Xam, 0x088F, FUNCTION, "XamFindHUDElementByXuiId")
+    LOAD_IMPORT(Xam, 0x0890, FUNCTION, "XamNuiIsDeviceReady")
+    LOAD_IMPORT(Xam, 0x0891, FUNCTION, "XamNuiSetForceDeviceOff")
+    LOAD_IMPORT(Xam, 0x0892, FUNCTION, "XamNuiPlayerEngagementUpdate")
+    LOAD_IMPORT(Xam, 0x0893, FUNCTION, "XamNuiSkeletonGetBestSkeletonIndex")
+    LOAD_IMPORT(Xam, 0x0894, FUNCTION, "XamNuiSkeletonScoreUpdate")
+    LOAD_IMPORT(Xam, 0x0895, FUNCTION, "XamNuiCameraTiltReportStatus")
+    LOAD_IMPORT(Xam, 0x0896, FUNCTION, "XamNuiCameraAdjustTilt")
+    LOAD_IMPORT(Xam, 0x0898, FUNCTION, "D3DDevice_CreateVertexShader")
+    LOAD_IMPORT(Xam, 0x0899, FUNCTION, "D3DDevice_CreatePixelShader")
+    LOAD_IMPORT(Xam, 0x089A, FUNCTION, "D3DDevice_CreateTexture")
+    LOAD_IMPORT(Xam, 0x089B, FUNCTION, "D3DDevice_CreateVertexBuffer")
+    LOAD_IMPORT(Xam, 0x089C, FUNCTION, "D3DDevice_CreateIndexBuffer")
+    LOAD_IMPORT(Xam, 0x089D, FUNCTION, "D3DDevice_CreateVertexDeclaration")
+    LOAD_IMPORT(Xam, 0x089E, FUNCTION, "D3DVertexBuffer_Unlock")
+    LOAD_IMPORT(Xam, 0x089F, FUNCTION, "D3DVertexBuffer_Lock")
+    LOAD_IMPORT(Xam, 0x08A0, FUNCTION, "D3DIndexBuffer_Unlock")
+    LOAD_IMPORT(Xam, 0x08A1, FUNCTION, "D3DIndexBuffer_Lock")
+    LOAD_IMPORT(Xam, 0x08A2, FUNCTION, "D3DTexture_UnlockRect")
+    LOAD_IMPORT(Xam, 0x08A3, FUNCTION, "D3DTexture_LockRect")
+    LOAD_IMPORT(Xam, 0x08A4, FUNCTION, "D3DDevice_Clear")
+    LOAD_IMPORT(Xam, 0x08A5, FUNCTION, "D3DDevice_SetViewport")
+    LOAD_IMPORT(Xam, 0x08A6, FUNCTION, "D3DDevice_GetViewport")
+    LOAD_IMPORT(Xam, 0x08A7, FUNCTION, "D3DVertexShader_Release")
+    LOAD_IMPORT(Xam, 0x08A8, FUNCTION, "D3DPixelShader_Release")
+    LOAD_IMPORT(Xam, 0x08A9, FUNCTION, "D3DVertexDeclaration_Release")
+    LOAD_IMPORT(Xam, 0x08AA, FUNCTION, "D3DResource_Release")
+    LOAD_IMPORT(Xam, 0x08AB, FUNCTION, "D3DDevice_Release")
+    LOAD_IMPORT(Xam, 0x08AC, FUNCTION, "D3DDevice_SetVertexShader")
+    LOAD_IMPORT(Xam, 0x08AD, FUNCTION, "D3DDevice_SetPixelShader")
+    LOAD_IMPORT(Xam, 0x08AE, FUNCTION, "D3DDevice_SetTexture")
+    LOAD_IMPORT(Xam, 0x08AF, FUNCTION, "D3DDevice_SetVertexDeclaration")
+    LOAD_IMPORT(Xam, 0x08B0, FUNCTION, "D3DDevice_SetIndices")
+    LOAD_IMPORT(Xam, 0x08B1, FUNCTION, "D3DDevice_SetStreamSource")
+    LOAD_IMPORT(Xam, 0x08B2, FUNCTION, "D3DDevice_DrawVertices")
+    LOAD_IMPORT(Xam, 0x08B3, FUNCTION, "D3DDevice_DrawVerticesUP")
+    LOAD_IMPORT(Xam, 0x08B4, FUNCTION, "D3DDevice_DrawIndexedVertices")
+    LOAD_IMPORT(Xam, 0x08B5, FUNCTION, "D3DDevice_DrawIndexedVerticesUP")
+    LOAD_IMPORT(Xam, 0x08B6, FUNCTION, "D3DDevice_SetVertexShaderConstantF_ParameterCheck")
+    LOAD_IMPORT(Xam, 0x08B7, FUNCTION, "D3DDevice_SetPixelShaderConstantF_ParameterCheck")
+    LOAD_IMPORT(Xam, 0x08B8, FUNCTION, "D3DDevice_SetSamplerState_ParameterCheck")
+    LOAD_IMPORT(Xam, 0x08B9, FUNCTION, "D3DDevice_SetRenderState_ParameterCheck")
+    LOAD_IMPORT(Xam, 0x08BA, FUNCTION, "D3DDevice_GetRenderState_ParameterCheck")
+    LOAD_IMPORT(Xam, 0x08BB, FUNCTION, "D3DDevice_SetVertexShaderConstantFN")
+    LOAD_IMPORT(Xam, 0x08BC, FUNCTION, "D3DDevice_SetPixelShaderConstantFN")
+    LOAD_IMPORT(Xam, 0x08BD, FUNCTION, "D3DDevice_GetRenderState_ZEnable")
+    LOAD_IMPORT(Xam, 0x08BE, FUNCTION, "D3DDevice_GetRenderState_CullMode")
+    LOAD_IMPORT(Xam, 0x08BF, FUNCTION, "D3DDevice_GetRenderState_AlphaBlendEnable")
+    LOAD_IMPORT(Xam, 0x08C0, FUNCTION, "D3DDevice_GetRenderState_SrcBlendAlpha")
+    LOAD_IMPORT(Xam, 0x08C1, FUNCTION, "D3DDevice_GetRenderState_DestBlendAlpha")
+    LOAD_IMPORT(Xam, 0x08C2, FUNCTION, "D3DDevice_GetRenderState_BlendOp")
+    LOAD_IMPORT(Xam, 0x08C3, FUNCTION, "D3DDevice_GetRenderState_ViewportEnable")
+    LOAD_IMPORT(Xam, 0x08C4, FUNCTION, "D3DDevice_SetRenderState_ZEnable")
+    LOAD_IMPORT(Xam, 0x08C5, FUNCTION, "D3DDevice_SetRenderState_CullMode")
+    LOAD_IMPORT(Xam, 0x08C6, FUNCTION, "D3DDevice_SetRenderState_AlphaBlendEnable")
+    LOAD_IMPORT(Xam, 0x08C7, FUNCTION, "D3DDevice_SetRenderState_SrcBlendAlpha")
+    LOAD_IMPORT(Xam, 0x08C8, FUNCTION, "D3DDevice_SetRenderState_DestBlendAlpha")
+    LOAD_IMPORT(Xam, 0x08C9, FUNCTION, "D3DDevice_SetRenderState_BlendOp")
+    LOAD_IMPORT(Xam, 0x08CA, FUNCTION, "D3DDevice_SetRenderState_ViewportEnable")
+    LOAD_IMPORT(Xam, 0x08CB, FUNCTION, "D3DDevice_SetSamplerState_MagFilter")
+    LOAD_IMPORT(Xam, 0x08CC, FUNCTION, "D3DDevice_SetSamplerState_MinFilter")
+    LOAD_IMPORT(Xam, 0x08CD, FUNCTION, "D3DDevice_SetSamplerState_AddressU")
+    LOAD_IMPORT(Xam, 0x08CE, FUNCTION, "D3DDevice_SetSamplerState_AddressV")
+    LOAD_IMPORT(Xam, 0x08CF, FUNCTION, "XGSetTextureHeader")
+    LOAD_IMPORT(Xam, 0x08D0, FUNCTION, "XGGetTextureDesc")
+    LOAD_IMPORT(Xam, 0x08D1, FUNCTION, "XGOffsetResourceAddress")
+    LOAD_IMPORT(Xam, 0x08D2, FUNCTION, "D3DResource_AddRef")
+    LOAD_IMPORT(Xam, 0x08D3, FUNCTION, "D3DVertexShader_AddRef")
+    LOAD_IMPORT(Xam, 0x08D4, FUNCTION, "D3DPixelShader_AddRef")
+    LOAD_IMPORT(Xam, 0x08D5, FUNCTION, "D3DVertexDeclaration_AddRef")
+    LOAD_IMPORT(Xam, 0x08D6, FUNCTION, "XGSetTextureHeaderEx")
+    LOAD_IMPORT(Xam, 0x08D7, FUNCTION, "D3DDevice_GetRenderTarget")
+    LOAD_IMPORT(Xam, 0x08D8, FUNCTION, "D3DDevice_SetRenderTarget")
+    LOAD_IMPORT(Xam, 0x08D9, FUNCTION, "D3DDevice_GetDepthStencilSurface")
+    LOAD_IMPORT(Xam, 0x08DA, FUNCTION, "D3DDevice_SetDepthStencilSurface")
+    LOAD_IMPORT(Xam, 0x08DB, FUNCTION, "D3DDevice_Resolve")
+    LOAD_IMPORT(Xam, 0x08DC, FUNCTION, "D3DDevice_SetPixelShaderConstantB")
+    LOAD_IMPORT(Xam, 0x08DD, FUNCTION, "XamNuiGetDeviceSerialNumber")
+    LOAD_IMPORT(Xam, 0x08FC, FUNCTION, "XamXtwManagerGetVariableCount")
+    LOAD_IMPORT(Xam, 0x08FD, FUNCTION, "XamXtwManagerGetId")
+    LOAD_IMPORT(Xam, 0x08FE, FUNCTION, "XamXtwManagerGetValue")
+    LOAD_IMPORT(Xam, 0x08FF, FUNCTION, "XamXtwManagerSetValue")
+    LOAD_IMPORT(Xam, 0x0900, FUNCTION, "XamXtwManagerIncrement")
+    LOAD_IMPORT(Xam, 0x0901, FUNCTION, "XamXtwManagerDecrement")
+    LOAD_IMPORT(Xam, 0x0902, FUNCTION, "XamXtwManagerResetValue")
+    LOAD_IMPORT(Xam, 0x0903, FUNCTION, "XamXtwManagerResetAll")
+    LOAD_IMPORT(Xam, 0x0904, FUNCTION, "XamXtwManagerGetDataFilePath")
+    LOAD_IMPORT(Xam, 0x0905, FUNCTION, "XamXtwManagerDeleteDataFile")
+    LOAD_IMPORT(Xam, 0x0906, FUNCTION, "XamXtwManagerSave")
+    LOAD_IMPORT(Xam, 0x0907, FUNCTION, "XamXtwManagerLoad")
+    LOAD_IMPORT(Xam, 0x0908, FUNCTION, "XamGetXTweakManager")
+    LOAD_IMPORT(Xam, 0x09C4, FUNCTION, "XamBackgroundDownloadSetMode")
+    LOAD_IMPORT(Xam, 0x09C5, FUNCTION, "XamBackgroundDownloadIsEnabled")
+    LOAD_IMPORT(Xam, 0x09C6, FUNCTION, "XamBackgroundDownloadGetActiveItem")
+    LOAD_IMPORT(Xam, 0x09C7, FUNCTION, "XamBackgroundDownloadGetItems")
+    LOAD_IMPORT(Xam, 0x09C8, FUNCTION, "XamBackgroundDownloadClearItems")
+    LOAD_IMPORT(Xam, 0x09C9, FUNCTION, "XamBackgroundDownloadItemAdd")
+    LOAD_IMPORT(Xam, 0x09CA, FUNCTION, "XamBackgroundDownloadItemRemove")
+    LOAD_IMPORT(Xam, 0x09CB, FUNCTION, "XamBackgroundDownloadItemMakeFirst")
+    LOAD_IMPORT(Xam, 0x09CC, FUNCTION, "XamBackgroundDownloadSetForegroundPriority")
+    LOAD_IMPORT(Xam, 0x09CD, FUNCTION, "XamBackgroundDownloadGetForegroundPriority")
+    LOAD_IMPORT(Xam, 0x09CE, FUNCTION, "XamBackgroundDownloadItemToContentData")
+    LOAD_IMPORT(Xam, 0x09CF, FUNCTION, "XamBackgroundDownloadItemGetStatus")
+    LOAD_IMPORT(Xam, 0x09D0, FUNCTION, "XamBackgroundDownloadHistoryGetItem")
+    LOAD_IMPORT(Xam, 0x09D1, FUNCTION, "XamBackgroundDownloadItemGetHistoryStatus")
+    LOAD_IMPORT(Xam, 0x09D2, FUNCTION, "XamBackgroundDownloadItemSetHistoryStatus")
+    LOAD_IMPORT(Xam, 0x09D3, FUNCTION, "XamBackgroundDownloadItemGetStatusAsync")
+    LOAD_IMPORT(Xam, 0x09D4, FUNCTION, "XamBackgroundDownloadItemGetStatusEx")
+    LOAD_IMPORT(Xam, 0x09D5, FUNCTION, "XamBackgroundDownloadItemGetHistoryStatusEx")
+    LOAD_IMPORT(Xam, 0x09D6, FUNCTION, "XamBackgroundDownloadBindItems")
+    LOAD_IMPORT(Xam, 0x09D7, FUNCTION, "XamBackgroundDownloadSetPollingActive")
+    LOAD_IMPORT(Xam, 0x09D8, FUNCTION, "XamBackgroundDownloadGetPollingActive")
+    LOAD_IMPORT(Xam, 0x09D9, FUNCTION, "XamBackgroundDownloadGetMode")
+    LOAD_IMPORT(Xam, 0x09DA, FUNCTION, "XamBackgroundDownloadGetUnexpectedChangeCount")
+    LOAD_IMPORT(Xam, 0x09DB, FUNCTION, "XamBackgroundDownloadIsItemForThisConsole")
+    LOAD_IMPORT(Xam, 0x09DC, FUNCTION, "XamBackgroundDownloadSelectDevice")
+    LOAD_IMPORT(Xam, 0x09DD, FUNCTION, "XamBackgroundDownloadItemModify")
+    LOAD_IMPORT(Xam, 0x09DE, FUNCTION, "XamBackgroundDownloadCacheLegacyMappingInfo")
+    LOAD_IMPORT(Xam, 0x09DF, FUNCTION, "XamBackgroundDownloadGetLegacyMappingInfo")
+    LOAD_IMPORT(Xam, 0x09E0, FUNCTION, "XamBackgroundDownloadGetLegacyId")
+    LOAD_IMPORT(Xam, 0x09E1, FUNCTION, "XamBackgroundDownloadDoFail")
+    LOAD_IMPORT(Xam, 0x0A28, FUNCTION, "XamSwapDisc")
+    LOAD_IMPORT(Xam, 0x0A29, VARIABLE, "XamSwapDiscPatchAddress")
+    LOAD_IMPORT(Xam, 0x0A2A, FUNCTION, "XamSwapCancel")
+    LOAD_IMPORT(Xam, 0x0A32, FUNCTION, "XamRamDriveCreate")
+    LOAD_IMPORT(Xam, 0x0A33, FUNCTION, "XamRamDriveDestroy")
+    LOAD_IMPORT(Xam, 0x0A5A, FUNCTION, "XamPlayTimerGetData")
+    LOAD_IMPORT(Xam, 0x0A5B, FUNCTION, "XamPlayTimerSetData")
+    LOAD_IMPORT(Xam, 0x0A5C, FUNCTION, "XamPlayTimerResume")
+    LOAD_IMPORT(Xam, 0x0A5D, FUNCTION, "XamPlayTimerSuspend")
+    LOAD_IMPORT(Xam, 0x0A5E, FUNCTION, "XamPlayTimerIsRunning")
+    LOAD_IMPORT(Xam, 0x0A5F, FUNCTION, "XamPlayTimerIsEnabled")
+    LOAD_IMPORT(Xam, 0x0A60, FUNCTION, "XamPlayTimerGetNextResetDate")
+    LOAD_IMPORT(Xam, 0x0A61, FUNCTION, "XamPlayTimerFormatDurationString")
+    LOAD_IMPORT(Xam, 0x0A62, FUNCTION, "XamPlayTimerGetTimeRemaining")
+    LOAD_IMPORT(Xam, 0x0A63, FUNCTION, "XamPlayTimerUpdateTimeRemaining")
+    LOAD_IMPORT(Xam, 0x0A64, FUNCTION, "XamPlayTimerForceNotification")
+    LOAD_IMPORT(Xam, 0x0A65, FUNCTION, "XamPlayTimerRefreshResetDate")
+    LOAD_IMPORT(Xam, 0x0A6E, FUNCTION, "UpnpAVServerSearchInitialize")
+    LOAD_IMPORT(Xam, 0x0A6F, FUNCTION, "UpnpAVServerSearchDestroy")
+    LOAD_IMPORT(Xam, 0x0A70, FUNCTION, "UpnpAVServerSearchStart")
+    LOAD_IMPORT(Xam, 0x0A71, FUNCTION, "Destroy")
+    LOAD_IMPORT(Xam, 0x0A72, FUNCTION, "UpnpAVServerSearchDoWork")
+    LOAD_IMPORT(Xam, 0x0A73, FUNCTION, "UpnpAVServerSearchGetNextServer")
+    LOAD_IMPORT(Xam, 0x0A8C, FUNCTION, "XCustomBroadcastGamercardEvent")
+    LOAD_IMPORT(Xam, 0x0A8D, FUNCTION, "XamCustomGetCurrentActions")
+    LOAD_IMPORT(Xam, 0x0AA0, FUNCTION, "XamInstrumentationLogEvent")
+    LOAD_IMPORT(Xam, 0x0AA1, FUNCTION, "XamRegisterSMCNotification")
+    LOAD_IMPORT(Xam, 0x0AAA, FUNCTION, "XamInstrumentationLogEventEx")
+    LOAD_IMPORT(Xam, 0x0AAB, FUNCTION, "XamInstrumentationGetSourceConfig")
+    LOAD_IMPORT(Xam, 0x0AAC, FUNCTION, "XamInstrumentationDebugConfig")
+    LOAD_IMPORT(Xam, 0x0ADC, FUNCTION, "CurlCreateCacheEntry")
+    LOAD_IMPORT(Xam, 0x0ADD, FUNCTION, "CurlOpenCacheEntry")
+    LOAD_IMPORT(Xam, 0x0ADE, FUNCTION, "CurlSetCacheEntryExpireTime")
+    LOAD_IMPORT(Xam, 0x0ADF, FUNCTION, "CurlReadCacheEntryHeaders")
+    LOAD_IMPORT(Xam, 0x0AE0, FUNCTION, "CurlReadCacheEntryContent")
+    LOAD_IMPORT(Xam, 0x0AE1, FUNCTION, "CurlWriteCacheEntryContent")
+    LOAD_IMPORT(Xam, 0x0AE2, FUNCTION, "CurlCloseCacheEntry")
+    LOAD_IMPORT(Xam, 0x0AE3, FUNCTION, "CurlEnumerateCacheEntry")
+    LOAD_IMPORT(Xam, 0x0AE5, FUNCTION, "CurlWipeBackingFiles")
+    LOAD_IMPORT(Xam, 0x0AE7, FUNCTION, "CurlOpenTitleBackingFile")
+    LOAD_IMPORT(Xam, 0x0AF0, FUNCTION, "XamSetSecurityViolationDetected")
+    LOAD_IMPORT(Xam, 0x0AF1, FUNCTION, "XamIsSecurityViolationDetected")
+    LOAD_IMPORT(Xam, 0x0AF2, FUNCTION, "XamIsAnySecurityViolationDetected")
+    LOAD_IMPORT(Xam, 0x0AF3, FUNCTION, "XamGetSecurityViolationsDetected")
+    LOAD_IMPORT(Xam, 0x0AF4, FUNCTION, "XamActivateCounterMeasure")
+    LOAD_IMPORT(Xam, 0x0AF5, FUNCTION, "XamDeactivateCounterMeasure")
+    LOAD_IMPORT(Xam, 0x0AF6, FUNCTION, "XamIsCounterMeasureActivated")
+    LOAD_IMPORT(Xam, 0x0AF7, FUNCTION, "XamGetActiveCounterMeasures")
+    LOAD_IMPORT(Xam, 0x0AFC, FUNCTION, "XamPartyCreate")
+    LOAD_IMPORT(Xam, 0x0AFD, FUNCTION, "XamPartyLeave")
+    LOAD_IMPORT(Xam, 0x0AFE, FUNCTION, "XamPartySendInviteDeprecated")
+    LOAD_IMPORT(Xam, 0x0AFF, FUNCTION, "XamPartyGetUserList")
+    LOAD_IMPORT(Xam, 0x0B00, FUNCTION, "XamPartySendGameInvites")
+    LOAD_IMPORT(Xam, 0x0B01, FUNCTION, "XamPartyJoin")
+    LOAD_IMPORT(Xam, 0x0B02, FUNCTION, "XamPartyKickUser")
+    LOAD_IMPORT(Xam, 0x0B03, FUNCTION, "XamPartyAddLocalUsers")
+    LOAD_IMPORT(Xam, 0x0B04, FUNCTION, "XamConvertEmoticons")
+    LOAD_IMPORT(Xam, 0x0B05, FUNCTION, "XamGetLocaleTimeFormat")
+    LOAD_IMPORT(Xam, 0x0B06, FUNCTION, "XamPartyRemoveLocalUsers")
+    LOAD_IMPORT(Xam, 0x0B07, FUNCTION, "XamPartyGetUserListInternal")
+    LOAD_IMPORT(Xam, 0x0B08, FUNCTION, "XamPartySetJoinable")
+    LOAD_IMPORT(Xam, 0x0B09, FUNCTION, "XamPartyGetJoinable")
+    LOAD_IMPORT(Xam, 0x0B0A, FUNCTION, "XamPartyGetInfo")
+    LOAD_IMPORT(Xam, 0x0B0B, FUNCTION, "XamPartySetCustomData")
+    LOAD_IMPORT(Xam, 0x0B0C, FUNCTION, "XamPartySetConnectivityGraph")
+    LOAD_IMPORT(Xam, 0x0B0D, FUNCTION, "XamPartyGetRoutingTable")
+    LOAD_IMPORT(Xam, 0x0B0E, FUNCTION, "XamPartyAutomationInprocCall")
+    LOAD_IMPORT(Xam, 0x0B0F, FUNCTION, "XamPartyGetState")
+    LOAD_IMPORT(Xam, 0x0B10, FUNCTION, "XamPartyGetBandwidth")
+    LOAD_IMPORT(Xam, 0x0B11, FUNCTION, "XamPartyGetNetworkCounters")
+    LOAD_IMPORT(Xam, 0x0B12, FUNCTION, "XamShowQuickLaunchUI")
+    LOAD_IMPORT(Xam, 0x0B13, FUNCTION, "XamPartyIsCoordinator")
+    LOAD_IMPORT(Xam, 0x0B14, FUNCTION, "XamPartyGetFormation")
+    LOAD_IMPORT(Xam, 0x0B15, FUNCTION, "XamPartySendInvite")
+    LOAD_IMPORT(Xam, 0x0B16, FUNCTION, "XamPartySetTestDelay")
+    LOAD_IMPORT(Xam, 0x0B17, FUNCTION, "XamPartyOverrideNatType")
+    LOAD_IMPORT(Xam, 0x0B18, FUNCTION, "XamPartyGetAccessLevel")
+    LOAD_IMPORT(Xam, 0x0B19, FUNCTION, "XamPartySetTestFlags")
+    LOAD_IMPORT(Xam, 0x0B1A, FUNCTION, "XamIsSystemExperienceTitleId")
+    LOAD_IMPORT(Xam, 0x0B22, FUNCTION, "XamTaskSetCancelSubTasks")
+    LOAD_IMPORT(Xam, 0x0B23, FUNCTION, "XamTaskGetCompletionStatus")
+    LOAD_IMPORT(Xam, 0x0B24, FUNCTION, "XamTaskCancelWaitAndCloseWaitTask")
+    LOAD_IMPORT(Xam, 0x0B2C, FUNCTION, "XamWebInstrumentationCreateReport")
+    LOAD_IMPORT(Xam, 0x0B2D, FUNCTION, "XamWebInstrumentationSetUserVar")
+    LOAD_IMPORT(Xam, 0x0B2E, FUNCTION, "XamWebInstrumentationSetUserVarNoEscape")
+    LOAD_IMPORT(Xam, 0x0B2F, FUNCTION, "XamWebInstrumentationGetURL")
+    LOAD_IMPORT(Xam, 0x0B30, FUNCTION, "XamWebInstrumentationSendReport")
+    LOAD_IMPORT(Xam, 0x0B31, FUNCTION, "XamWebInstrumentationDestroyReport")
+    LOAD_IMPORT(Xam, 0x0B32, FUNCTION, "XamWebInstrumentationCreateSampledReport")
+    LOAD_IMPORT(Xam, 0x0B33, FUNCTION, "XampSetSamplingRandomValue")
+    LOAD_IMPORT(Xam, 0x0B34, FUNCTION, "XampWebInstrumentationSetProfileCounts")
+    LOAD_IMPORT(Xam, 0x0B35, FUNCTION, "XamWebInstrumentationGetURLEx")
+    LOAD_IMPORT(Xam, 0x0B36, FUNCTION, "XampSetOmnitureCallbackFunction")
+    LOAD_IMPORT(Xam, 0x0B37, FUNCTION, "XamShowQuickChatUIp")
+    LOAD_IMPORT(Xam, 0x0B4A, FUNCTION, "XamVerifyXSignerSignature")
 
 
     //
     // XboxKrnl
     //
 
-    LOAD_IMPORT(XboxKrnl, 0x0001, FUNCTION, "DbgBreakPoint");
-    LOAD_IMPORT(XboxKrnl, 0x0002, FUNCTION, "DbgBreakPointWithStatus");
-    LOAD_IMPORT(XboxKrnl, 0x0003, FUNCTION, "DbgPrint");
-    LOAD_IMPORT(XboxKrnl, 0x0004, FUNCTION, "DbgPrompt");
-    LOAD_IMPORT(XboxKrnl, 0x0005, FUNCTION, "DumpGetRawDumpInfo");
-    LOAD_IMPORT(XboxKrnl, 0x0006, FUNCTION, "DumpWriteDump");
-    LOAD_IMPORT(XboxKrnl, 0x0007, FUNCTION, "ExAcquireReadWriteLockExclusive");
-    LOAD_IMPORT(XboxKrnl, 0x0008, FUNCTION, "ExAcquireReadWriteLockShared");
-    LOAD_IMPORT(XboxKrnl, 0x0009, FUNCTION, "ExAllocatePool");
-    LOAD_IMPORT(XboxKrnl, 0x000A, FUNCTION, "ExAllocatePoolWithTag");
-    LOAD_IMPORT(XboxKrnl, 0x000B, FUNCTION, "ExAllocatePoolTypeWithTag");
-    LOAD_IMPORT(XboxKrnl, 0x000C, VARIABLE, "ExConsoleGameRegion");
-    LOAD_IMPORT(XboxKrnl, 0x000D, FUNCTION, "ExCreateThread");
-    LOAD_IMPORT(XboxKrnl, 0x000E, FUNCTION, "ExEventObjectType");
-    LOAD_IMPORT(XboxKrnl, 0x000F, FUNCTION, "ExFreePool");
-    LOAD_IMPORT(XboxKrnl, 0x0010, FUNCTION, "ExGetXConfigSetting");
-    LOAD_IMPORT(XboxKrnl, 0x0011, FUNCTION, "ExInitializeReadWriteLock");
-    LOAD_IMPORT(XboxKrnl, 0x0012, FUNCTION, "ExMutantObjectType");
-    LOAD_IMPORT(XboxKrnl, 0x0013, FUNCTION, "ExQueryPoolBlockSize");
-    LOAD_IMPORT(XboxKrnl, 0x0014, FUNCTION, "ExRegisterThreadNotification");
-    LOAD_IMPORT(XboxKrnl, 0x0015, FUNCTION, "ExRegisterTitleTerminateNotification");
-    LOAD_IMPORT(XboxKrnl, 0x0016, FUNCTION, "ExReleaseReadWriteLock");
-    LOAD_IMPORT(XboxKrnl, 0x0017, FUNCTION, "ExSemaphoreObjectType");
-    LOAD_IMPORT(XboxKrnl, 0x0018, FUNCTION, "ExSetXConfigSetting");
-    LOAD_IMPORT(XboxKrnl, 0x0019, FUNCTION, "ExTerminateThread");
-    LOAD_IMPORT(XboxKrnl, 0x001A, FUNCTION, "ExTerminateTitleProcess");
-    LOAD_IMPORT(XboxKrnl, 0x001B, FUNCTION, "ExThreadObjectType");
-    LOAD_IMPORT(XboxKrnl, 0x001C, FUNCTION, "ExTimerObjectType");
-    LOAD_IMPORT(XboxKrnl, 0x001D, FUNCTION, "MmDoubleMapMemory");
-    LOAD_IMPORT(XboxKrnl, 0x001E, FUNCTION, "MmUnmapMemory");
-    LOAD_IMPORT(XboxKrnl, 0x001F, FUNCTION, "XeKeysGetConsoleCertificate");
-    LOAD_IMPORT(XboxKrnl, 0x0020, FUNCTION, "FscGetCacheElementCount");
-    LOAD_IMPORT(XboxKrnl, 0x0021, FUNCTION, "FscSetCacheElementCount");
-    LOAD_IMPORT(XboxKrnl, 0x0022, FUNCTION, "HalGetCurrentAVPack");
-    LOAD_IMPORT(XboxKrnl, 0x0023, FUNCTION, "HalGpioControl");
-    LOAD_IMPORT(XboxKrnl, 0x0024, FUNCTION, "HalOpenCloseODDTray");
-    LOAD_IMPORT(XboxKrnl, 0x0025, FUNCTION, "HalReadWritePCISpace");
-    LOAD_IMPORT(XboxKrnl, 0x0026, FUNCTION, "HalRegisterPowerDownNotification");
-    LOAD_IMPORT(XboxKrnl, 0x0027, FUNCTION, "HalRegisterSMCNotification");
-    LOAD_IMPORT(XboxKrnl, 0x0028, FUNCTION, "HalReturnToFirmware");
-    LOAD_IMPORT(XboxKrnl, 0x0029, FUNCTION, "HalSendSMCMessage");
-    LOAD_IMPORT(XboxKrnl, 0x002A, FUNCTION, "HalSetAudioEnable");
-    LOAD_IMPORT(XboxKrnl, 0x002B, FUNCTION, "InterlockedFlushSList");
-    LOAD_IMPORT(XboxKrnl, 0x002C, FUNCTION, "InterlockedPopEntrySList");
-    LOAD_IMPORT(XboxKrnl, 0x002D, FUNCTION, "InterlockedPushEntrySList");
-    LOAD_IMPORT(XboxKrnl, 0x002E, FUNCTION, "IoAcquireDeviceObjectLock");
-    LOAD_IMPORT(XboxKrnl, 0x002F, FUNCTION, "IoAllocateIrp");
-    LOAD_IMPORT(XboxKrnl, 0x0030, FUNCTION, "IoBuildAsynchronousFsdRequest");
-    LOAD_IMPORT(XboxKrnl, 0x0031, FUNCTION, "IoBuildDeviceIoControlRequest");
-    LOAD_IMPORT(XboxKrnl, 0x0032, FUNCTION, "IoBuildSynchronousFsdRequest");
-    LOAD_IMPORT(XboxKrnl, 0x0033, FUNCTION, "IoCallDriver");
-    LOAD_IMPORT(XboxKrnl, 0x0034, FUNCTION, "IoCheckShareAccess");
-    LOAD_IMPORT(XboxKrnl, 0x0035, FUNCTION, "IoCompleteRequest");
-    LOAD_IMPORT(XboxKrnl, 0x0036, FUNCTION, "IoCompletionObjectType");
-    LOAD_IMPORT(XboxKrnl, 0x0037, FUNCTION, "IoCreateDevice");
-    LOAD_IMPORT(XboxKrnl, 0x0038, FUNCTION, "IoCreateFile");
-    LOAD_IMPORT(XboxKrnl, 0x0039, FUNCTION, "IoDeleteDevice");
-    LOAD_IMPORT(XboxKrnl, 0x003A, FUNCTION, "IoDeviceObjectType");
-    LOAD_IMPORT(XboxKrnl, 0x003B, FUNCTION, "IoDismountVolume");
-    LOAD_IMPORT(XboxKrnl, 0x003C, FUNCTION, "IoDismountVolumeByFileHandle");
-    LOAD_IMPORT(XboxKrnl, 0x003D, FUNCTION, "IoDismountVolumeByName");
-    LOAD_IMPORT(XboxKrnl, 0x003E, FUNCTION, "IoFileObjectType");
-    LOAD_IMPORT(XboxKrnl, 0x003F, FUNCTION, "IoFreeIrp");
-    LOAD_IMPORT(XboxKrnl, 0x0040, FUNCTION, "IoInitializeIrp");
-    LOAD_IMPORT(XboxKrnl, 0x0041, FUNCTION, "IoInvalidDeviceRequest");
-    LOAD_IMPORT(XboxKrnl, 0x0042, FUNCTION, "ExSetBetaFeaturesEnabled");
-    LOAD_IMPORT(XboxKrnl, 0x0043, FUNCTION, "IoQueueThreadIrp");
-    LOAD_IMPORT(XboxKrnl, 0x0044, FUNCTION, "IoReleaseDeviceObjectLock");
-    LOAD_IMPORT(XboxKrnl, 0x0045, FUNCTION, "IoRemoveShareAccess");
-    LOAD_IMPORT(XboxKrnl, 0x0046, FUNCTION, "IoSetIoCompletion");
-    LOAD_IMPORT(XboxKrnl, 0x0047, FUNCTION, "IoSetShareAccess");
-    LOAD_IMPORT(XboxKrnl, 0x0048, FUNCTION, "IoStartNextPacket");
-    LOAD_IMPORT(XboxKrnl, 0x0049, FUNCTION, "IoStartNextPacketByKey");
-    LOAD_IMPORT(XboxKrnl, 0x004A, FUNCTION, "IoStartPacket");
-    LOAD_IMPORT(XboxKrnl, 0x004B, FUNCTION, "IoSynchronousDeviceIoControlRequest");
-    LOAD_IMPORT(XboxKrnl, 0x004C, FUNCTION, "IoSynchronousFsdRequest");
-    LOAD_IMPORT(XboxKrnl, 0x004D, FUNCTION, "KeAcquireSpinLockAtRaisedIrql");
-    LOAD_IMPORT(XboxKrnl, 0x004E, FUNCTION, "KeAlertResumeThread");
-    LOAD_IMPORT(XboxKrnl, 0x004F, FUNCTION, "KeAlertThread");
-    LOAD_IMPORT(XboxKrnl, 0x0050, FUNCTION, "KeBlowFuses");
-    LOAD_IMPORT(XboxKrnl, 0x0051, FUNCTION, "KeBoostPriorityThread");
-    LOAD_IMPORT(XboxKrnl, 0x0052, FUNCTION, "KeBugCheck");
-    LOAD_IMPORT(XboxKrnl, 0x0053, FUNCTION, "KeBugCheckEx");
-    LOAD_IMPORT(XboxKrnl, 0x0054, FUNCTION, "KeCancelTimer");
-    LOAD_IMPORT(XboxKrnl, 0x0055, FUNCTION, "KeConnectInterrupt");
-    LOAD_IMPORT(XboxKrnl, 0x0056, FUNCTION, "KeContextFromKframes");
-    LOAD_IMPORT(XboxKrnl, 0x0057, FUNCTION, "KeContextToKframes");
-    LOAD_IMPORT(XboxKrnl, 0x0058, FUNCTION, "KeCreateUserMode");
-    LOAD_IMPORT(XboxKrnl, 0x0059, VARIABLE, "KeDebugMonitorData");
-    LOAD_IMPORT(XboxKrnl, 0x005A, FUNCTION, "KeDelayExecutionThread");
-    LOAD_IMPORT(XboxKrnl, 0x005B, FUNCTION, "KeDeleteUserMode");
-    LOAD_IMPORT(XboxKrnl, 0x005C, FUNCTION, "KeDisconnectInterrupt");
-    LOAD_IMPORT(XboxKrnl, 0x005D, FUNCTION, "KeEnableFpuExceptions");
-    LOAD_IMPORT(XboxKrnl, 0x005E, FUNCTION, "KeEnablePPUPerformanceMonitor");
-    LOAD_IMPORT(XboxKrnl, 0x005F, FUNCTION, "KeEnterCriticalRegion");
-    LOAD_IMPORT(XboxKrnl, 0x0060, FUNCTION, "KeEnterUserMode");
-    LOAD_IMPORT(XboxKrnl, 0x0061, FUNCTION, "KeFlushCacheRange");
-    LOAD_IMPORT(XboxKrnl, 0x0062, FUNCTION, "KeFlushCurrentEntireTb");
-    LOAD_IMPORT(XboxKrnl, 0x0063, FUNCTION, "KeFlushEntireTb");
-    LOAD_IMPORT(XboxKrnl, 0x0064, FUNCTION, "KeFlushUserModeCurrentTb");
-    LOAD_IMPORT(XboxKrnl, 0x0065, FUNCTION, "KeFlushUserModeTb");
-    LOAD_IMPORT(XboxKrnl, 0x0066, FUNCTION, "KeGetCurrentProcessType");
-    LOAD_IMPORT(XboxKrnl, 0x0067, FUNCTION, "KeGetPMWRegister");
-    LOAD_IMPORT(XboxKrnl, 0x0068, FUNCTION, "KeGetPRVRegister");
-    LOAD_IMPORT(XboxKrnl, 0x0069, FUNCTION, "KeGetSocRegister");
-    LOAD_IMPORT(XboxKrnl, 0x006A, FUNCTION, "KeGetSpecialPurposeRegister");
-    LOAD_IMPORT(XboxKrnl, 0x006B, FUNCTION, "KeLockL2");
-    LOAD_IMPORT(XboxKrnl, 0x006C, FUNCTION, "KeUnlockL2");
-    LOAD_IMPORT(XboxKrnl, 0x006D, FUNCTION, "KeInitializeApc");
-    LOAD_IMPORT(XboxKrnl, 0x006E, FUNCTION, "KeInitializeDeviceQueue");
-    LOAD_IMPORT(XboxKrnl, 0x006F, FUNCTION, "KeInitializeDpc");
-    LOAD_IMPORT(XboxKrnl, 0x0070, FUNCTION, "KeInitializeEvent");
-    LOAD_IMPORT(XboxKrnl, 0x0071, FUNCTION, "KeInitializeInterrupt");
-    LOAD_IMPORT(XboxKrnl, 0x0072, FUNCTION, "KeInitializeMutant");
-    LOAD_IMPORT(XboxKrnl, 0x0073, FUNCTION, "KeInitializeQueue");
-    LOAD_IMPORT(XboxKrnl, 0x0074, FUNCTION, "KeInitializeSemaphore");
-    LOAD_IMPORT(XboxKrnl, 0x0075, FUNCTION, "KeInitializeTimerEx");
-    LOAD_IMPORT(XboxKrnl, 0x0076, FUNCTION, "KeInsertByKeyDeviceQueue");
-    LOAD_IMPORT(XboxKrnl, 0x0077, FUNCTION, "KeInsertDeviceQueue");
-    LOAD_IMPORT(XboxKrnl, 0x0078, FUNCTION, "KeInsertHeadQueue");
-    LOAD_IMPORT(XboxKrnl, 0x0079, FUNCTION, "KeInsertQueue");
-    LOAD_IMPORT(XboxKrnl, 0x007A, FUNCTION, "KeInsertQueueApc");
-    LOAD_IMPORT(XboxKrnl, 0x007B, FUNCTION, "KeInsertQueueDpc");
-    LOAD_IMPORT(XboxKrnl, 0x007C, FUNCTION, "KeIpiGenericCall");
-    LOAD_IMPORT(XboxKrnl, 0x007D, FUNCTION, "KeLeaveCriticalRegion");
-    LOAD_IMPORT(XboxKrnl, 0x007E, FUNCTION, "KeLeaveUserMode");
-    LOAD_IMPORT(XboxKrnl, 0x007F, FUNCTION, "KePulseEvent");
-    LOAD_IMPORT(XboxKrnl, 0x0080, FUNCTION, "KeQueryBackgroundProcessors");
-    LOAD_IMPORT(XboxKrnl, 0x0081, FUNCTION, "KeQueryBasePriorityThread");
-    LOAD_IMPORT(XboxKrnl, 0x0082, FUNCTION, "KeQueryInterruptTime");
-    LOAD_IMPORT(XboxKrnl, 0x0083, FUNCTION, "KeQueryPerformanceFrequency");
-    LOAD_IMPORT(XboxKrnl, 0x0084, FUNCTION, "KeQuerySystemTime");
-    LOAD_IMPORT(XboxKrnl, 0x0085, FUNCTION, "KeRaiseIrqlToDpcLevel");
-    LOAD_IMPORT(XboxKrnl, 0x0086, FUNCTION, "KeRegisterDriverNotification");
-    LOAD_IMPORT(XboxKrnl, 0x0087, FUNCTION, "KeReleaseMutant");
-    LOAD_IMPORT(XboxKrnl, 0x0088, FUNCTION, "KeReleaseSemaphore");
-    LOAD_IMPORT(XboxKrnl, 0x0089, FUNCTION, "KeReleaseSpinLockFromRaisedIrql");
-    LOAD_IMPORT(XboxKrnl, 0x008A, FUNCTION, "KeRemoveByKeyDeviceQueue");
-    LOAD_IMPORT(XboxKrnl, 0x008B, FUNCTION, "KeRemoveDeviceQueue");
-    LOAD_IMPORT(XboxKrnl, 0x008C, FUNCTION, "KeRemoveEntryDeviceQueue");
-    LOAD_IMPORT(XboxKrnl, 0x008D, FUNCTION, "KeRemoveQueue");
-    LOAD_IMPORT(XboxKrnl, 0x008E, FUNCTION, "KeRemoveQueueDpc");
-    LOAD_IMPORT(XboxKrnl, 0x008F, FUNCTION, "KeResetEvent");
-    LOAD_IMPORT(XboxKrnl, 0x0090, FUNCTION, "KeRestoreFloatingPointState");
-    LOAD_IMPORT(XboxKrnl, 0x0091, FUNCTION, "KeRestoreVectorUnitState");
-    LOAD_IMPORT(XboxKrnl, 0x0092, FUNCTION, "KeResumeThread");
-    LOAD_IMPORT(XboxKrnl, 0x0093, FUNCTION, "KeRetireDpcList");
-    LOAD_IMPORT(XboxKrnl, 0x0094, FUNCTION, "KeRundownQueue");
-    LOAD_IMPORT(XboxKrnl, 0x0095, FUNCTION, "KeSaveFloatingPointState");
-    LOAD_IMPORT(XboxKrnl, 0x0096, FUNCTION, "KeSaveVectorUnitState");
-    LOAD_IMPORT(XboxKrnl, 0x0097, FUNCTION, "KeSetAffinityThread");
-    LOAD_IMPORT(XboxKrnl, 0x0098, FUNCTION, "KeSetBackgroundProcessors");
-    LOAD_IMPORT(XboxKrnl, 0x0099, FUNCTION, "KeSetBasePriorityThread");
-    LOAD_IMPORT(XboxKrnl, 0x009A, FUNCTION, "KeSetCurrentProcessType");
-    LOAD_IMPORT(XboxKrnl, 0x009B, FUNCTION, "KeSetCurrentStackPointers");
-    LOAD_IMPORT(XboxKrnl, 0x009C, FUNCTION, "KeSetDisableBoostThread");
-    LOAD_IMPORT(XboxKrnl, 0x009D, FUNCTION, "KeSetEvent");
-    LOAD_IMPORT(XboxKrnl, 0x009E, FUNCTION, "KeSetEventBoostPriority");
-    LOAD_IMPORT(XboxKrnl, 0x009F, FUNCTION, "KeSetPMWRegister");
-    LOAD_IMPORT(XboxKrnl, 0x00A0, FUNCTION, "KeSetPowerMode");
-    LOAD_IMPORT(XboxKrnl, 0x00A1, FUNCTION, "KeSetPRVRegister");
-    LOAD_IMPORT(XboxKrnl, 0x00A2, FUNCTION, "KeSetPriorityClassThread");
-    LOAD_IMPORT(XboxKrnl, 0x00A3, FUNCTION, "KeSetPriorityThread");
-    LOAD_IMPORT(XboxKrnl, 0x00A4, FUNCTION, "KeSetSocRegister");
-    LOAD_IMPORT(XboxKrnl, 0x00A5, FUNCTION, "KeSetSpecialPurposeRegister");
-    LOAD_IMPORT(XboxKrnl, 0x00A6, FUNCTION, "KeSetTimer");
-    LOAD_IMPORT(XboxKrnl, 0x00A7, FUNCTION, "KeSetTimerEx");
-    LOAD_IMPORT(XboxKrnl, 0x00A8, FUNCTION, "KeStallExecutionProcessor");
-    LOAD_IMPORT(XboxKrnl, 0x00A9, FUNCTION, "KeSuspendThread");
-    LOAD_IMPORT(XboxKrnl, 0x00AA, FUNCTION, "KeSweepDcacheRange");
-    LOAD_IMPORT(XboxKrnl, 0x00AB, FUNCTION, "KeSweepIcacheRange");
-    LOAD_IMPORT(XboxKrnl, 0x00AC, FUNCTION, "KeTestAlertThread");
-    LOAD_IMPORT(XboxKrnl, 0x00AD, VARIABLE, "KeTimeStampBundle");
-    LOAD_IMPORT(XboxKrnl, 0x00AE, FUNCTION, "KeTryToAcquireSpinLockAtRaisedIrql");
-    LOAD_IMPORT(XboxKrnl, 0x00AF, FUNCTION, "KeWaitForMultipleObjects");
-    LOAD_IMPORT(XboxKrnl, 0x00B0, FUNCTION, "KeWaitForSingleObject");
-    LOAD_IMPORT(XboxKrnl, 0x00B1, FUNCTION, "KfAcquireSpinLock");
-    LOAD_IMPORT(XboxKrnl, 0x00B2, FUNCTION, "KfRaiseIrql");
-    LOAD_IMPORT(XboxKrnl, 0x00B3, FUNCTION, "KfLowerIrql");
-    LOAD_IMPORT(XboxKrnl, 0x00B4, FUNCTION, "KfReleaseSpinLock");
-    LOAD_IMPORT(XboxKrnl, 0x00B5, VARIABLE, "KiBugCheckData");
-    LOAD_IMPORT(XboxKrnl, 0x00B6, FUNCTION, "LDICreateDecompression");
-    LOAD_IMPORT(XboxKrnl, 0x00B7, FUNCTION, "LDIDecompress");
-    LOAD_IMPORT(XboxKrnl, 0x00B8, FUNCTION, "LDIDestroyDecompression");
-    LOAD_IMPORT(XboxKrnl, 0x00B9, FUNCTION, "MmAllocatePhysicalMemory");
-    LOAD_IMPORT(XboxKrnl, 0x00BA, FUNCTION, "MmAllocatePhysicalMemoryEx");
-    LOAD_IMPORT(XboxKrnl, 0x00BB, FUNCTION, "MmCreateKernelStack");
-    LOAD_IMPORT(XboxKrnl, 0x00BC, FUNCTION, "MmDeleteKernelStack");
-    LOAD_IMPORT(XboxKrnl, 0x00BD, FUNCTION, "MmFreePhysicalMemory");
-    LOAD_IMPORT(XboxKrnl, 0x00BE, FUNCTION, "MmGetPhysicalAddress");
-    LOAD_IMPORT(XboxKrnl, 0x00BF, FUNCTION, "MmIsAddressValid");
-    LOAD_IMPORT(XboxKrnl, 0x00C0, FUNCTION, "MmLockAndMapSegmentArray");
-    LOAD_IMPORT(XboxKrnl, 0x00C1, FUNCTION, "MmLockUnlockBufferPages");
-    LOAD_IMPORT(XboxKrnl, 0x00C2, FUNCTION, "MmMapIoSpace");
-    LOAD_IMPORT(XboxKrnl, 0x00C3, FUNCTION, "MmPersistPhysicalMemoryAllocation");
-    LOAD_IMPORT(XboxKrnl, 0x00C4, FUNCTION, "MmQueryAddressProtect");
-    LOAD_IMPORT(XboxKrnl, 0x00C5, FUNCTION, "MmQueryAllocationSize");
-    LOAD_IMPORT(XboxKrnl, 0x00C6, FUNCTION, "MmQueryStatistics");
-    LOAD_IMPORT(XboxKrnl, 0x00C7, FUNCTION, "MmSetAddressProtect");
-    LOAD_IMPORT(XboxKrnl, 0x00C8, FUNCTION, "MmSplitPhysicalMemoryAllocation");
-    LOAD_IMPORT(XboxKrnl, 0x00C9, FUNCTION, "MmUnlockAndUnmapSegmentArray");
-    LOAD_IMPORT(XboxKrnl, 0x00CA, FUNCTION, "MmUnmapIoSpace");
-    LOAD_IMPORT(XboxKrnl, 0x00CB, VARIABLE, "Nls844UnicodeCaseTable");
-    LOAD_IMPORT(XboxKrnl, 0x00CC, FUNCTION, "NtAllocateVirtualMemory");
-    LOAD_IMPORT(XboxKrnl, 0x00CD, FUNCTION, "NtCancelTimer");
-    LOAD_IMPORT(XboxKrnl, 0x00CE, FUNCTION, "NtClearEvent");
-    LOAD_IMPORT(XboxKrnl, 0x00CF, FUNCTION, "NtClose");
-    LOAD_IMPORT(XboxKrnl, 0x00D0, FUNCTION, "NtCreateDirectoryObject");
-    LOAD_IMPORT(XboxKrnl, 0x00D1, FUNCTION, "NtCreateEvent");
-    LOAD_IMPORT(XboxKrnl, 0x00D2, FUNCTION, "NtCreateFile");
-    LOAD_IMPORT(XboxKrnl, 0x00D3, FUNCTION, "NtCreateIoCompletion");
-    LOAD_IMPORT(XboxKrnl, 0x00D4, FUNCTION, "NtCreateMutant");
-    LOAD_IMPORT(XboxKrnl, 0x00D5, FUNCTION, "NtCreateSemaphore");
-    LOAD_IMPORT(XboxKrnl, 0x00D6, FUNCTION, "NtCreateSymbolicLinkObject");
-    LOAD_IMPORT(XboxKrnl, 0x00D7, FUNCTION, "NtCreateTimer");
-    LOAD_IMPORT(XboxKrnl, 0x00D8, FUNCTION, "NtDeleteFile");
-    LOAD_IMPORT(XboxKrnl, 0x00D9, FUNCTION, "NtDeviceIoControlFile");
-    LOAD_IMPORT(XboxKrnl, 0x00DA, FUNCTION, "NtDuplicateObject");
-    LOAD_IMPORT(XboxKrnl, 0x00DB, FUNCTION, "NtFlushBuffersFile");
-    LOAD_IMPORT(XboxKrnl, 0x00DC, FUNCTION, "NtFreeVirtualMemory");
-    LOAD_IMPORT(XboxKrnl, 0x00DD, FUNCTION, "NtMakeTemporaryObject");
-    LOAD_IMPORT(XboxKrnl, 0x00DE, FUNCTION, "NtOpenDirectoryObject");
-    LOAD_IMPORT(XboxKrnl, 0x00DF, FUNCTION, "NtOpenFile");
-    LOAD_IMPORT(XboxKrnl, 0x00E0, FUNCTION, "NtOpenSymbolicLinkObject");
-    LOAD_IMPORT(XboxKrnl, 0x00E1, FUNCTION, "NtProtectVirtualMemory");
-    LOAD_IMPORT(XboxKrnl, 0x00E2, FUNCTION, "NtPulseEvent");
-    LOAD_IMPORT(XboxKrnl, 0x00E3, FUNCTION, "NtQueueApcThread");
-    LOAD_IMPORT(XboxKrnl, 0x00E4, FUNCTION, "NtQueryDirectoryFile");
-    LOAD_IMPORT(XboxKrnl, 0x00E5, FUNCTION, "NtQueryDirectoryObject");
-    LOAD_IMPORT(XboxKrnl, 0x00E6, FUNCTION, "NtQueryEvent");
-    LOAD_IMPORT(XboxKrnl, 0x00E7, FUNCTION, "NtQueryFullAttributesFile");
-    LOAD_IMPORT(XboxKrnl, 0x00E8, FUNCTION, "NtQueryInformationFile");
-    LOAD_IMPORT(XboxKrnl, 0x00E9, FUNCTION, "NtQueryIoCompletion");
-    LOAD_IMPORT(XboxKrnl, 0x00EA, FUNCTION, "NtQueryMutant");
-    LOAD_IMPORT(XboxKrnl, 0x00EB, FUNCTION, "NtQuerySemaphore");
-    LOAD_IMPORT(XboxKrnl, 0x00EC, FUNCTION, "NtQuerySymbolicLinkObject");
-    LOAD_IMPORT(XboxKrnl, 0x00ED, FUNCTION, "NtQueryTimer");
-    LOAD_IMPORT(XboxKrnl, 0x00EE, FUNCTION, "NtQueryVirtualMemory");
-    LOAD_IMPORT(XboxKrnl, 0x00EF, FUNCTION, "NtQueryVolumeInformationFile");
-    LOAD_IMPORT(XboxKrnl, 0x00F0, FUNCTION, "NtReadFile");
-    LOAD_IMPORT(XboxKrnl, 0x00F1, FUNCTION, "NtReadFileScatter");
-    LOAD_IMPORT(XboxKrnl, 0x00F2, FUNCTION, "NtReleaseMutant");
-    LOAD_IMPORT(XboxKrnl, 0x00F3, FUNCTION, "NtReleaseSemaphore");
-    LOAD_IMPORT(XboxKrnl, 0x00F4, FUNCTION, "NtRemoveIoCompletion");
-    LOAD_IMPORT(XboxKrnl, 0x00F5, FUNCTION, "NtResumeThread");
-    LOAD_IMPORT(XboxKrnl, 0x00F6, FUNCTION, "NtSetEvent");
-    LOAD_IMPORT(XboxKrnl, 0x00F7, FUNCTION, "NtSetInformationFile");
-    LOAD_IMPORT(XboxKrnl, 0x00F8, FUNCTION, "NtSetIoCompletion");
-    LOAD_IMPORT(XboxKrnl, 0x00F9, FUNCTION, "NtSetSystemTime");
-    LOAD_IMPORT(XboxKrnl, 0x00FA, FUNCTION, "NtSetTimerEx");
-    LOAD_IMPORT(XboxKrnl, 0x00FB, FUNCTION, "NtSignalAndWaitForSingleObjectEx");
-    LOAD_IMPORT(XboxKrnl, 0x00FC, FUNCTION, "NtSuspendThread");
-    LOAD_IMPORT(XboxKrnl, 0x00FD, FUNCTION, "NtWaitForSingleObjectEx");
-    LOAD_IMPORT(XboxKrnl, 0x00FE, FUNCTION, "NtWaitForMultipleObjectsEx");
-    LOAD_IMPORT(XboxKrnl, 0x00FF, FUNCTION, "NtWriteFile");
-    LOAD_IMPORT(XboxKrnl, 0x0100, FUNCTION, "NtWriteFileGather");
-    LOAD_IMPORT(XboxKrnl, 0x0101, FUNCTION, "NtYieldExecution");
-    LOAD_IMPORT(XboxKrnl, 0x0102, FUNCTION, "ObCreateObject");
-    LOAD_IMPORT(XboxKrnl, 0x0103, FUNCTION, "ObCreateSymbolicLink");
-    LOAD_IMPORT(XboxKrnl, 0x0104, FUNCTION, "ObDeleteSymbolicLink");
-    LOAD_IMPORT(XboxKrnl, 0x0105, FUNCTION, "ObDereferenceObject");
-    LOAD_IMPORT(XboxKrnl, 0x0106, FUNCTION, "ObDirectoryObjectType");
-    LOAD_IMPORT(XboxKrnl, 0x0107, FUNCTION, "ObGetWaitableObject");
-    LOAD_IMPORT(XboxKrnl, 0x0108, FUNCTION, "ObInsertObject");
-    LOAD_IMPORT(XboxKrnl, 0x0109, FUNCTION, "ObIsTitleObject");
-    LOAD_IMPORT(XboxKrnl, 0x010A, FUNCTION, "ObLookupAnyThreadByThreadId");
-    LOAD_IMPORT(XboxKrnl, 0x010B, FUNCTION, "ObLookupThreadByThreadId");
-    LOAD_IMPORT(XboxKrnl, 0x010C, FUNCTION, "ObMakeTemporaryObject");
-    LOAD_IMPORT(XboxKrnl, 0x010D, FUNCTION, "ObOpenObjectByName");
-    LOAD_IMPORT(XboxKrnl, 0x010E, FUNCTION, "ObOpenObjectByPointer");
-    LOAD_IMPORT(XboxKrnl, 0x010F, FUNCTION, "ObReferenceObject");
-    LOAD_IMPORT(XboxKrnl, 0x0110, FUNCTION, "ObReferenceObjectByHandle");
-    LOAD_IMPORT(XboxKrnl, 0x0111, FUNCTION, "ObReferenceObjectByName");
-    LOAD_IMPORT(XboxKrnl, 0x0112, FUNCTION, "ObSymbolicLinkObjectType");
-    LOAD_IMPORT(XboxKrnl, 0x0113, FUNCTION, "ObTranslateSymbolicLink");
-    LOAD_IMPORT(XboxKrnl, 0x0114, FUNCTION, "RtlAnsiStringToUnicodeString");
-    LOAD_IMPORT(XboxKrnl, 0x0115, FUNCTION, "RtlAppendStringToString");
-    LOAD_IMPORT(XboxKrnl, 0x0116, FUNCTION, "RtlAppendUnicodeStringToString");
-    LOAD_IMPORT(XboxKrnl, 0x0117, FUNCTION, "RtlAppendUnicodeToString");
-    LOAD_IMPORT(XboxKrnl, 0x0118, FUNCTION, "RtlAssert");
-    LOAD_IMPORT(XboxKrnl, 0x0119, FUNCTION, "RtlCaptureContext");
-    LOAD_IMPORT(XboxKrnl, 0x011A, FUNCTION, "RtlCompareMemory");
-    LOAD_IMPORT(XboxKrnl, 0x011B, FUNCTION, "RtlCompareMemoryUlong");
-    LOAD_IMPORT(XboxKrnl, 0x011C, FUNCTION, "RtlCompareString");
-    LOAD_IMPORT(XboxKrnl, 0x011D, FUNCTION, "RtlCompareStringN");
-    LOAD_IMPORT(XboxKrnl, 0x011E, FUNCTION, "RtlCompareUnicodeString");
-    LOAD_IMPORT(XboxKrnl, 0x011F, FUNCTION, "RtlCompareUnicodeStringN");
-    LOAD_IMPORT(XboxKrnl, 0x0120, FUNCTION, "RtlCompareUtf8ToUnicode");
-    LOAD_IMPORT(XboxKrnl, 0x0121, FUNCTION, "RtlCopyString");
-    LOAD_IMPORT(XboxKrnl, 0x0122, FUNCTION, "RtlCopyUnicodeString");
-    LOAD_IMPORT(XboxKrnl, 0x0123, FUNCTION, "RtlCreateUnicodeString");
-    LOAD_IMPORT(XboxKrnl, 0x0124, FUNCTION, "RtlDowncaseUnicodeChar");
-    LOAD_IMPORT(XboxKrnl, 0x0125, FUNCTION, "RtlEnterCriticalSection");
-    LOAD_IMPORT(XboxKrnl, 0x0126, FUNCTION, "RtlFillMemoryUlong");
-    LOAD_IMPORT(XboxKrnl, 0x0127, FUNCTION, "RtlFreeAnsiString");
-    LOAD_IMPORT(XboxKrnl, 0x0128, FUNCTION, "RtlFreeAnsiString");
-    LOAD_IMPORT(XboxKrnl, 0x0129, FUNCTION, "RtlGetCallersAddress");
-    LOAD_IMPORT(XboxKrnl, 0x012A, FUNCTION, "RtlGetStackLimits");
-    LOAD_IMPORT(XboxKrnl, 0x012B, FUNCTION, "RtlImageXexHeaderField");
-    LOAD_IMPORT(XboxKrnl, 0x012C, FUNCTION, "RtlInitAnsiString");
-    LOAD_IMPORT(XboxKrnl, 0x012D, FUNCTION, "RtlInitUnicodeString");
-    LOAD_IMPORT(XboxKrnl, 0x012E, FUNCTION, "RtlInitializeCriticalSection");
-    LOAD_IMPORT(XboxKrnl, 0x012F, FUNCTION, "RtlInitializeCriticalSectionAndSpinCount");
-    LOAD_IMPORT(XboxKrnl, 0x0130, FUNCTION, "RtlLeaveCriticalSection");
-    LOAD_IMPORT(XboxKrnl, 0x0131, FUNCTION, "RtlLookupFunctionEntry");
-    LOAD_IMPORT(XboxKrnl, 0x0132, FUNCTION, "RtlLowerChar");
-    LOAD_IMPORT(XboxKrnl, 0x0133, FUNCTION, "RtlMultiByteToUnicodeN");
-    LOAD_IMPORT(XboxKrnl, 0x0134, FUNCTION, "RtlMultiByteToUnicodeSize");
-    LOAD_IMPORT(XboxKrnl, 0x0135, FUNCTION, "RtlNtStatusToDosError");
-    LOAD_IMPORT(XboxKrnl, 0x0136, FUNCTION, "RtlRaiseException");
-    LOAD_IMPORT(XboxKrnl, 0x0137, FUNCTION, "RtlRaiseStatus");
-    LOAD_IMPORT(XboxKrnl, 0x0138, FUNCTION, "RtlRip");
-    LOAD_IMPORT(XboxKrnl, 0x0139, FUNCTION, "_scprintf");
-    LOAD_IMPORT(XboxKrnl, 0x013A, FUNCTION, "_snprintf");
-    LOAD_IMPORT(XboxKrnl, 0x013B, FUNCTION, "sprintf");
-    LOAD_IMPORT(XboxKrnl, 0x013C, FUNCTION, "_scwprintf");
-    LOAD_IMPORT(XboxKrnl, 0x013D, FUNCTION, "_snwprintf");
-    LOAD_IMPORT(XboxKrnl, 0x013E, FUNCTION, "_swprintf");
-    LOAD_IMPORT(XboxKrnl, 0x013F, FUNCTION, "RtlTimeFieldsToTime");
-    LOAD_IMPORT(XboxKrnl, 0x0140, FUNCTION, "RtlTimeToTimeFields");
-    LOAD_IMPORT(XboxKrnl, 0x0141, FUNCTION, "RtlTryEnterCriticalSection");
-    LOAD_IMPORT(XboxKrnl, 0x0142, FUNCTION, "RtlUnicodeStringToAnsiString");
-    LOAD_IMPORT(XboxKrnl, 0x0143, FUNCTION, "RtlUnicodeToMultiByteN");
-    LOAD_IMPORT(XboxKrnl, 0x0144, FUNCTION, "RtlUnicodeToMultiByteSize");
-    LOAD_IMPORT(XboxKrnl, 0x0145, FUNCTION, "RtlUnicodeToUtf8");
-    LOAD_IMPORT(XboxKrnl, 0x0146, FUNCTION, "RtlUnicodeToUtf8Size");
-    LOAD_IMPORT(XboxKrnl, 0x0147, FUNCTION, "RtlUnwind");
-    LOAD_IMPORT(XboxKrnl, 0x0148, FUNCTION, "RtlUnwind2");
-    LOAD_IMPORT(XboxKrnl, 0x0149, FUNCTION, "RtlUpcaseUnicodeChar");
-    LOAD_IMPORT(XboxKrnl, 0x014A, FUNCTION, "RtlUpperChar");
-    LOAD_IMPORT(XboxKrnl, 0x014B, FUNCTION, "RtlVirtualUnwind");
-    LOAD_IMPORT(XboxKrnl, 0x014C, FUNCTION, "_vscprintf");
-    LOAD_IMPORT(XboxKrnl, 0x014D, FUNCTION, "_vsnprintf");
-    LOAD_IMPORT(XboxKrnl, 0x014E, FUNCTION, "vsprintf");
-    LOAD_IMPORT(XboxKrnl, 0x014F, FUNCTION, "_vscwprintf");
-    LOAD_IMPORT(XboxKrnl, 0x0150, FUNCTION, "_vsnwprintf");
-    LOAD_IMPORT(XboxKrnl, 0x0151, FUNCTION, "_vswprintf");
-    LOAD_IMPORT(XboxKrnl, 0x0152, FUNCTION, "KeTlsAlloc");
-    LOAD_IMPORT(XboxKrnl, 0x0153, FUNCTION, "KeTlsFree");
-    LOAD_IMPORT(XboxKrnl, 0x0154, FUNCTION, "KeTlsGetValue");
-    LOAD_IMPORT(XboxKrnl, 0x0155, FUNCTION, "KeTlsSetValue");
-    LOAD_IMPORT(XboxKrnl, 0x0156, VARIABLE, "XboxHardwareInfo");
-    LOAD_IMPORT(XboxKrnl, 0x0157, VARIABLE, "XboxKrnlBaseVersion");
-    LOAD_IMPORT(XboxKrnl, 0x0158, VARIABLE, "XboxKrnlVersion");
-    LOAD_IMPORT(XboxKrnl, 0x0159, FUNCTION, "XeCryptAesKey");
-    LOAD_IMPORT(XboxKrnl, 0x015A, FUNCTION, "XeCryptAesEcb");
-    LOAD_IMPORT(XboxKrnl, 0x015B, FUNCTION, "XeCryptAesCbc");
-    LOAD_IMPORT(XboxKrnl, 0x015C, FUNCTION, "XeCryptBnDwLeDhEqualBase");
-    LOAD_IMPORT(XboxKrnl, 0x015D, FUNCTION, "XeCryptBnDwLeDhInvalBase");
-    LOAD_IMPORT(XboxKrnl, 0x015E, FUNCTION, "XeCryptBnDwLeDhModExp");
-    LOAD_IMPORT(XboxKrnl, 0x015F, FUNCTION, "XeCryptBnDw_Copy");
-    LOAD_IMPORT(XboxKrnl, 0x0160, FUNCTION, "XeCryptBnDw_SwapLeBe");
-    LOAD_IMPORT(XboxKrnl, 0x0161, FUNCTION, "XeCryptBnDw_Zero");
-    LOAD_IMPORT(XboxKrnl, 0x0162, FUNCTION, "XeCryptBnDwLePkcs1Format");
-    LOAD_IMPORT(XboxKrnl, 0x0163, FUNCTION, "XeCryptBnDwLePkcs1Verify");
-    LOAD_IMPORT(XboxKrnl, 0x0164, FUNCTION, "XeCryptBnQwBeSigCreate");
-    LOAD_IMPORT(XboxKrnl, 0x0165, FUNCTION, "XeCryptBnQwBeSigFormat");
-    LOAD_IMPORT(XboxKrnl, 0x0166, FUNCTION, "XeCryptBnQwBeSigVerify");
-    LOAD_IMPORT(XboxKrnl, 0x0167, FUNCTION, "XeCryptBnQwNeModExp");
-    LOAD_IMPORT(XboxKrnl, 0x0168, FUNCTION, "XeCryptBnQwNeModExpRoot");
-    LOAD_IMPORT(XboxKrnl, 0x0169, FUNCTION, "XeCryptBnQwNeModInv");
-    LOAD_IMPORT(XboxKrnl, 0x016A, FUNCTION, "XeCryptBnQwNeModMul");
-    LOAD_IMPORT(XboxKrnl, 0x016B, FUNCTION, "XeCryptBnQwNeRsaKeyGen");
-    LOAD_IMPORT(XboxKrnl, 0x016C, FUNCTION, "XeCryptBnQwNeRsaPrvCrypt");
-    LOAD_IMPORT(XboxKrnl, 0x016D, FUNCTION, "XeCryptBnQwNeRsaPubCrypt");
-    LOAD_IMPORT(XboxKrnl, 0x016E, FUNCTION, "XeCryptBnQw_Copy");
-    LOAD_IMPORT(XboxKrnl, 0x016F, FUNCTION, "XeCryptBnQw_SwapDwQw");
-    LOAD_IMPORT(XboxKrnl, 0x0170, FUNCTION, "XeCryptBnQw_SwapDwQwLeBe");
-    LOAD_IMPORT(XboxKrnl, 0x0171, FUNCTION, "XeCryptBnQw_SwapLeBe");
-    LOAD_IMPORT(XboxKrnl, 0x0172, FUNCTION, "XeCryptBnQw_Zero");
-    LOAD_IMPORT(XboxKrnl, 0x0173, FUNCTION, "XeCryptChainAndSumMac");
-    LOAD_IMPORT(XboxKrnl, 0x0174, FUNCTION, "XeCryptDesParity");
-    LOAD_IMPORT(XboxKrnl, 0x0175, FUNCTION, "XeCryptDesKey");
-    LOAD_IMPORT(XboxKrnl, 0x0176, FUNCTION, "XeCryptDesEcb");
-    LOAD_IMPORT(XboxKrnl, 0x0177, FUNCTION, "XeCryptDesCbc");
-    LOAD_IMPORT(XboxKrnl, 0x0178, FUNCTION, "XeCryptDes3Key");
-    LOAD_IMPORT(XboxKrnl, 0x0179, FUNCTION, "XeCryptDes3Ecb");
-    LOAD_IMPORT(XboxKrnl, 0x017A, FUNCTION, "XeCryptDes3Cbc");
-    LOAD_IMPORT(XboxKrnl, 0x017B, FUNCTION, "XeCryptHmacMd5Init");
-    LOAD_IMPORT(XboxKrnl, 0x017C, FUNCTION, "XeCryptHmacMd5Update");
-    LOAD_IMPORT(XboxKrnl, 0x017D, FUNCTION, "XeCryptHmacMd5Final");
-    LOAD_IMPORT(XboxKrnl, 0x017E, FUNCTION, "XeCryptHmacMd5");
-    LOAD_IMPORT(XboxKrnl, 0x017F, FUNCTION, "XeCryptHmacShaInit");
-    LOAD_IMPORT(XboxKrnl, 0x0180, FUNCTION, "XeCryptHmacShaUpdate");
-    LOAD_IMPORT(XboxKrnl, 0x0181, FUNCTION, "XeCryptHmacShaFinal");
-    LOAD_IMPORT(XboxKrnl, 0x0182, FUNCTION, "XeCryptHmacSha");
-    LOAD_IMPORT(XboxKrnl, 0x0183, FUNCTION, "XeCryptHmacShaVerify");
-    LOAD_IMPORT(XboxKrnl, 0x0184, FUNCTION, "XeCryptMd5Init");
-    LOAD_IMPORT(XboxKrnl, 0x0185, FUNCTION, "XeCryptMd5Update");
-    LOAD_IMPORT(XboxKrnl, 0x0186, FUNCTION, "XeCryptMd5Final");
-    LOAD_IMPORT(XboxKrnl, 0x0187, FUNCTION, "XeCryptMd5");
-    LOAD_IMPORT(XboxKrnl, 0x0188, FUNCTION, "XeCryptParveEcb");
-    LOAD_IMPORT(XboxKrnl, 0x0189, FUNCTION, "XeCryptParveCbcMac");
-    LOAD_IMPORT(XboxKrnl, 0x018A, FUNCTION, "XeCryptRandom");
-    LOAD_IMPORT(XboxKrnl, 0x018B, FUNCTION, "XeCryptRc4Key");
-    LOAD_IMPORT(XboxKrnl, 0x018C, FUNCTION, "XeCryptRc4Ecb");
-    LOAD_IMPORT(XboxKrnl, 0x018D, FUNCTION, "XeCryptRc4");
-    LOAD_IMPORT(XboxKrnl, 0x018E, FUNCTION, "XeCryptRotSumSha");
-    LOAD_IMPORT(XboxKrnl, 0x018F, FUNCTION, "XeCryptShaInit");
-    LOAD_IMPORT(XboxKrnl, 0x0190, FUNCTION, "XeCryptShaUpdate");
-    LOAD_IMPORT(XboxKrnl, 0x0191, FUNCTION, "XeCryptShaFinal");
-    LOAD_IMPORT(XboxKrnl, 0x0192, FUNCTION, "XeCryptSha");
-    LOAD_IMPORT(XboxKrnl, 0x0193, VARIABLE, "XexExecutableModuleHandle");
-    LOAD_IMPORT(XboxKrnl, 0x0194, FUNCTION, "XexCheckExecutablePrivilege");
-    LOAD_IMPORT(XboxKrnl, 0x0195, FUNCTION, "XexGetModuleHandle");
-    LOAD_IMPORT(XboxKrnl, 0x0196, FUNCTION, "XexGetModuleSection");
-    LOAD_IMPORT(XboxKrnl, 0x0197, FUNCTION, "XexGetProcedureAddress");
-    LOAD_IMPORT(XboxKrnl, 0x0198, FUNCTION, "XexLoadExecutable");
-    LOAD_IMPORT(XboxKrnl, 0x0199, FUNCTION, "XexLoadImage");
-    LOAD_IMPORT(XboxKrnl, 0x019A, FUNCTION, "XexLoadImageFromMemory");
-    LOAD_IMPORT(XboxKrnl, 0x019B, FUNCTION, "XexLoadImageHeaders");
-    LOAD_IMPORT(XboxKrnl, 0x019C, FUNCTION, "XexPcToFileHeader");
-    LOAD_IMPORT(XboxKrnl, 0x019D, FUNCTION, "KiApcNormalRoutineNop");
-    LOAD_IMPORT(XboxKrnl, 0x019E, FUNCTION, "XexRegisterPatchDescriptor");
-    LOAD_IMPORT(XboxKrnl, 0x019F, FUNCTION, "XexSendDeferredNotifications");
-    LOAD_IMPORT(XboxKrnl, 0x01A0, FUNCTION, "XexStartExecutable");
-    LOAD_IMPORT(XboxKrnl, 0x01A1, FUNCTION, "XexUnloadImage");
-    LOAD_IMPORT(XboxKrnl, 0x01A2, FUNCTION, "XexUnloadImageAndExitThread");
-    LOAD_IMPORT(XboxKrnl, 0x01A3, FUNCTION, "XexUnloadTitleModules");
-    LOAD_IMPORT(XboxKrnl, 0x01A4, FUNCTION, "XexVerifyImageHeaders");
-    LOAD_IMPORT(XboxKrnl, 0x01A5, FUNCTION, "__C_specific_handler");
-    LOAD_IMPORT(XboxKrnl, 0x01A6, FUNCTION, "DbgLoadImageSymbols");
-    LOAD_IMPORT(XboxKrnl, 0x01A7, FUNCTION, "DbgUnLoadImageSymbols");
-    LOAD_IMPORT(XboxKrnl, 0x01A8, FUNCTION, "RtlImageDirectoryEntryToData");
-    LOAD_IMPORT(XboxKrnl, 0x01A9, FUNCTION, "RtlImageNtHeader");
-    LOAD_IMPORT(XboxKrnl, 0x01AA, FUNCTION, "ExDebugMonitorService");
-    LOAD_IMPORT(XboxKrnl, 0x01AB, FUNCTION, "MmDbgReadCheck");
-    LOAD_IMPORT(XboxKrnl, 0x01AC, FUNCTION, "MmDbgReleaseAddress");
-    LOAD_IMPORT(XboxKrnl, 0x01AD, FUNCTION, "MmDbgWriteCheck");
-    LOAD_IMPORT(XboxKrnl, 0x01AE, VARIABLE, "ExLoadedCommandLine");
-    LOAD_IMPORT(XboxKrnl, 0x01AF, VARIABLE, "ExLoadedImageName");
-    LOAD_IMPORT(XboxKrnl, 0x01B0, FUNCTION, "VdBlockUntilGUIIdle");
-    LOAD_IMPORT(XboxKrnl, 0x01B1, FUNCTION, "VdCallGraphicsNotificationRoutines");
-    LOAD_IMPORT(XboxKrnl, 0x01B2, FUNCTION, "VdDisplayFatalError");
-    LOAD_IMPORT(XboxKrnl, 0x01B3, FUNCTION, "VdEnableClosedCaption");
-    LOAD_IMPORT(XboxKrnl, 0x01B4, FUNCTION, "VdEnableDisableClockGating");
-    LOAD_IMPORT(XboxKrnl, 0x01B5, FUNCTION, "VdEnableDisablePowerSavingMode");
-    LOAD_IMPORT(XboxKrnl, 0x01B6, FUNCTION, "VdEnableRingBufferRPtrWriteBack");
-    LOAD_IMPORT(XboxKrnl, 0x01B7, FUNCTION, "VdGenerateGPUCSCCoefficients");
-    LOAD_IMPORT(XboxKrnl, 0x01B8, FUNCTION, "VdGetClosedCaptionReadyStatus");
-    LOAD_IMPORT(XboxKrnl, 0x01B9, FUNCTION, "VdGetCurrentDisplayGamma");
-    LOAD_IMPORT(XboxKrnl, 0x01BA, FUNCTION, "VdGetCurrentDisplayInformation");
-    LOAD_IMPORT(XboxKrnl, 0x01BB, FUNCTION, "VdGetDisplayModeOverride");
-    LOAD_IMPORT(XboxKrnl, 0x01BC, FUNCTION, "VdGetGraphicsAsicID");
-    LOAD_IMPORT(XboxKrnl, 0x01BD, FUNCTION, "VdGetSystemCommandBuffer");
-    LOAD_IMPORT(XboxKrnl, 0x01BE, VARIABLE, "VdGlobalDevice");
-    LOAD_IMPORT(XboxKrnl, 0x01BF, VARIABLE, "VdGlobalXamDevice");
-    LOAD_IMPORT(XboxKrnl, 0x01C0, VARIABLE, "VdGpuClockInMHz");
-    LOAD_IMPORT(XboxKrnl, 0x01C1, VARIABLE, "VdHSIOCalibrationLock");
-    LOAD_IMPORT(XboxKrnl, 0x01C2, FUNCTION, "VdInitializeEngines");
-    LOAD_IMPORT(XboxKrnl, 0x01C3, FUNCTION, "VdInitializeRingBuffer");
-    LOAD_IMPORT(XboxKrnl, 0x01C4, FUNCTION, "VdInitializeScaler");
-    LOAD_IMPORT(XboxKrnl, 0x01C5, FUNCTION, "VdInitializeScalerCommandBuffer");
-    LOAD_IMPORT(XboxKrnl, 0x01C6, FUNCTION, "VdIsHSIOTrainingSucceeded");
-    LOAD_IMPORT(XboxKrnl, 0x01C7, FUNCTION, "VdPersistDisplay");
-    LOAD_IMPORT(XboxKrnl, 0x01C8, FUNCTION, "VdQuerySystemCommandBuffer");
-    LOAD_IMPORT(XboxKrnl, 0x01C9, FUNCTION, "VdQueryVideoFlags");
-    LOAD_IMPORT(XboxKrnl, 0x01CA, FUNCTION, "VdQueryVideoMode");
-    LOAD_IMPORT(XboxKrnl, 0x01CB, FUNCTION, "VdReadDVERegisterUlong");
-    LOAD_IMPORT(XboxKrnl, 0x01CC, FUNCTION, "VdReadWriteHSIOCalibrationFlag");
-    LOAD_IMPORT(XboxKrnl, 0x01CD, FUNCTION, "VdRegisterGraphicsNotification");
-    LOAD_IMPORT(XboxKrnl, 0x01CE, FUNCTION, "VdRegisterXamGraphicsNotification");
-    LOAD_IMPORT(XboxKrnl, 0x01CF, FUNCTION, "VdSendClosedCaptionData");
-    LOAD_IMPORT(XboxKrnl, 0x01D0, FUNCTION, "VdSetCGMSOption");
-    LOAD_IMPORT(XboxKrnl, 0x01D1, FUNCTION, "VdSetColorProfileAdjustment");
-    LOAD_IMPORT(XboxKrnl, 0x01D2, FUNCTION, "VdSetCscMatricesOverride");
-    LOAD_IMPORT(XboxKrnl, 0x01D3, FUNCTION, "VdSetDisplayMode");
-    LOAD_IMPORT(XboxKrnl, 0x01D4, FUNCTION, "VdSetDisplayModeOverride");
-    LOAD_IMPORT(XboxKrnl, 0x01D5, FUNCTION, "VdSetGraphicsInterruptCallback");
-    LOAD_IMPORT(XboxKrnl, 0x01D6, FUNCTION, "VdSetHDCPOption");
-    LOAD_IMPORT(XboxKrnl, 0x01D7, FUNCTION, "VdSetMacrovisionOption");
-    LOAD_IMPORT(XboxKrnl, 0x01D8, FUNCTION, "VdSetSystemCommandBuffer");
-    LOAD_IMPORT(XboxKrnl, 0x01D9, FUNCTION, "VdSetSystemCommandBufferGpuIdentifierAddress");
-    LOAD_IMPORT(XboxKrnl, 0x01DA, FUNCTION, "VdSetWSSData");
-    LOAD_IMPORT(XboxKrnl, 0x01DB, FUNCTION, "VdSetWSSOption");
-    LOAD_IMPORT(XboxKrnl, 0x01DC, FUNCTION, "VdShutdownEngines");
-    LOAD_IMPORT(XboxKrnl, 0x01DD, FUNCTION, "VdTurnDisplayOff");
-    LOAD_IMPORT(XboxKrnl, 0x01DE, FUNCTION, "VdTurnDisplayOn");
-    LOAD_IMPORT(XboxKrnl, 0x01DF, FUNCTION, "KiApcNormalRoutineNop");
-    LOAD_IMPORT(XboxKrnl, 0x01E0, FUNCTION, "VdWriteDVERegisterUlong");
-    LOAD_IMPORT(XboxKrnl, 0x01E1, FUNCTION, "XVoicedHeadsetPresent");
-    LOAD_IMPORT(XboxKrnl, 0x01E2, FUNCTION, "XVoicedSubmitPacket");
-    LOAD_IMPORT(XboxKrnl, 0x01E3, FUNCTION, "XVoicedClose");
-    LOAD_IMPORT(XboxKrnl, 0x01E4, FUNCTION, "XVoicedActivate");
-    LOAD_IMPORT(XboxKrnl, 0x01E5, FUNCTION, "XInputdGetCapabilities");
-    LOAD_IMPORT(XboxKrnl, 0x01E6, FUNCTION, "XInputdReadState");
-    LOAD_IMPORT(XboxKrnl, 0x01E7, FUNCTION, "XInputdWriteState");
-    LOAD_IMPORT(XboxKrnl, 0x01E8, FUNCTION, "XInputdNotify");
-    LOAD_IMPORT(XboxKrnl, 0x01E9, FUNCTION, "XInputdRawState");
-    LOAD_IMPORT(XboxKrnl, 0x01EA, FUNCTION, "HidGetCapabilities");
-    LOAD_IMPORT(XboxKrnl, 0x01EB, FUNCTION, "HidReadKeys");
-    LOAD_IMPORT(XboxKrnl, 0x01EC, FUNCTION, "XInputdGetDeviceStats");
-    LOAD_IMPORT(XboxKrnl, 0x01ED, FUNCTION, "XInputdResetDevice");
-    LOAD_IMPORT(XboxKrnl, 0x01EE, FUNCTION, "XInputdSetRingOfLight");
-    LOAD_IMPORT(XboxKrnl, 0x01EF, FUNCTION, "XInputdSetRFPowerMode");
-    LOAD_IMPORT(XboxKrnl, 0x01F0, FUNCTION, "XInputdSetRadioFrequency");
-    LOAD_IMPORT(XboxKrnl, 0x01F1, FUNCTION, "HidGetLastInputTime");
-    LOAD_IMPORT(XboxKrnl, 0x01F2, FUNCTION, "XAudioRenderDriverInitialize");
-    LOAD_IMPORT(XboxKrnl, 0x01F3, FUNCTION, "XAudioRegisterRenderDriverClient");
-    LOAD_IMPORT(XboxKrnl, 0x01F4, FUNCTION, "XAudioUnregisterRenderDriverClient");
-    LOAD_IMPORT(XboxKrnl, 0x01F5, FUNCTION, "XAudioSubmitRenderDriverFrame");
-    LOAD_IMPORT(XboxKrnl, 0x01F6, FUNCTION, "XAudioRenderDriverLock");
-    LOAD_IMPORT(XboxKrnl, 0x01F7, FUNCTION, "XAudioGetVoiceCategoryVolumeChangeMask");
-    LOAD_IMPORT(XboxKrnl, 0x01F8, FUNCTION, "XAudioGetVoiceCategoryVolume");
-    LOAD_IMPORT(XboxKrnl, 0x01F9, FUNCTION, "XAudioSetVoiceCategoryVolume");
-    LOAD_IMPORT(XboxKrnl, 0x01FA, FUNCTION, "XAudioBeginDigitalBypassMode");
-    LOAD_IMPORT(XboxKrnl, 0x01FB, FUNCTION, "XAudioEndDigitalBypassMode");
-    LOAD_IMPORT(XboxKrnl, 0x01FC, FUNCTION, "XAudioSubmitDigitalPacket");
-    LOAD_IMPORT(XboxKrnl, 0x01FD, FUNCTION, "XAudioQueryDriverPerformance");
-    LOAD_IMPORT(XboxKrnl, 0x01FE, FUNCTION, "XAudioGetRenderDriverThread");
-    LOAD_IMPORT(XboxKrnl, 0x01FF, FUNCTION, "XAudioGetSpeakerConfig");
-    LOAD_IMPORT(XboxKrnl, 0x0200, FUNCTION, "XAudioSetSpeakerConfig");
-    LOAD_IMPORT(XboxKrnl, 0x0201, FUNCTION, "NicSetUnicastAddress");
-    LOAD_IMPORT(XboxKrnl, 0x0202, FUNCTION, "NicAttach");
-    LOAD_IMPORT(XboxKrnl, 0x0203, FUNCTION, "NicDetach");
-    LOAD_IMPORT(XboxKrnl, 0x0204, FUNCTION, "NicXmit");
-    LOAD_IMPORT(XboxKrnl, 0x0205, FUNCTION, "NicUpdateMcastMembership");
-    LOAD_IMPORT(XboxKrnl, 0x0206, FUNCTION, "NicFlushXmitQueue");
-    LOAD_IMPORT(XboxKrnl, 0x0207, FUNCTION, "NicShutdown");
-    LOAD_IMPORT(XboxKrnl, 0x0208, FUNCTION, "NicGetLinkState");
-    LOAD_IMPORT(XboxKrnl, 0x0209, FUNCTION, "NicGetStats");
-    LOAD_IMPORT(XboxKrnl, 0x020A, FUNCTION, "NicGetOpt");
-    LOAD_IMPORT(XboxKrnl, 0x020B, FUNCTION, "NicSetOpt");
-    LOAD_IMPORT(XboxKrnl, 0x020C, FUNCTION, "DrvSetSysReqCallback");
-    LOAD_IMPORT(XboxKrnl, 0x020D, FUNCTION, "DrvSetUserBindingCallback");
-    LOAD_IMPORT(XboxKrnl, 0x020E, FUNCTION, "DrvSetContentStorageCallback");
-    LOAD_IMPORT(XboxKrnl, 0x020F, FUNCTION, "DrvSetAutobind");
-    LOAD_IMPORT(XboxKrnl, 0x0210, FUNCTION, "DrvGetContentStorageNotification");
-    LOAD_IMPORT(XboxKrnl, 0x0211, FUNCTION, "MtpdBeginTransaction");
-    LOAD_IMPORT(XboxKrnl, 0x0212, FUNCTION, "MtpdCancelTransaction");
-    LOAD_IMPORT(XboxKrnl, 0x0213, FUNCTION, "MtpdEndTransaction");
-    LOAD_IMPORT(XboxKrnl, 0x0214, FUNCTION, "MtpdGetCurrentDevices");
-    LOAD_IMPORT(XboxKrnl, 0x0215, FUNCTION, "MtpdReadData");
-    LOAD_IMPORT(XboxKrnl, 0x0216, FUNCTION, "MtpdReadEvent");
-    LOAD_IMPORT(XboxKrnl, 0x0217, FUNCTION, "MtpdResetDevice");
-    LOAD_IMPORT(XboxKrnl, 0x0218, FUNCTION, "MtpdSendData");
-    LOAD_IMPORT(XboxKrnl, 0x0219, FUNCTION, "MtpdVerifyProximity");
-    LOAD_IMPORT(XboxKrnl, 0x021A, FUNCTION, "XUsbcamSetCaptureMode");
-    LOAD_IMPORT(XboxKrnl, 0x021B, FUNCTION, "XUsbcamGetConfig");
-    LOAD_IMPORT(XboxKrnl, 0x021C, FUNCTION, "XUsbcamSetConfig");
-    LOAD_IMPORT(XboxKrnl, 0x021D, FUNCTION, "XUsbcamGetState");
-    LOAD_IMPORT(XboxKrnl, 0x021E, FUNCTION, "XUsbcamReadFrame");
-    LOAD_IMPORT(XboxKrnl, 0x021F, FUNCTION, "XUsbcamSnapshot");
-    LOAD_IMPORT(XboxKrnl, 0x0220, FUNCTION, "XUsbcamSetView");
-    LOAD_IMPORT(XboxKrnl, 0x0221, FUNCTION, "XUsbcamGetView");
-    LOAD_IMPORT(XboxKrnl, 0x0222, FUNCTION, "XUsbcamCreate");
-    LOAD_IMPORT(XboxKrnl, 0x0223, FUNCTION, "XUsbcamDestroy");
-    LOAD_IMPORT(XboxKrnl, 0x0224, FUNCTION, "XMACreateContext");
-    LOAD_IMPORT(XboxKrnl, 0x0225, FUNCTION, "XMAInitializeContext");
-    LOAD_IMPORT(XboxKrnl, 0x0226, FUNCTION, "XMAReleaseContext");
-    LOAD_IMPORT(XboxKrnl, 0x0227, FUNCTION, "XMAEnableContext");
-    LOAD_IMPORT(XboxKrnl, 0x0228, FUNCTION, "XMADisableContext");
-    LOAD_IMPORT(XboxKrnl, 0x0229, FUNCTION, "XMAGetOutputBufferWriteOffset");
-    LOAD_IMPORT(XboxKrnl, 0x022A, FUNCTION, "XMASetOutputBufferReadOffset");
-    LOAD_IMPORT(XboxKrnl, 0x022B, FUNCTION, "XMAGetOutputBufferReadOffset");
-    LOAD_IMPORT(XboxKrnl, 0x022C, FUNCTION, "XMASetOutputBufferValid");
-    LOAD_IMPORT(XboxKrnl, 0x022D, FUNCTION, "XMAIsOutputBufferValid");
-    LOAD_IMPORT(XboxKrnl, 0x022E, FUNCTION, "XMASetInputBuffer0Valid");
-    LOAD_IMPORT(XboxKrnl, 0x022F, FUNCTION, "XMAIsInputBuffer0Valid");
-    LOAD_IMPORT(XboxKrnl, 0x0230, FUNCTION, "XMASetInputBuffer1Valid");
-    LOAD_IMPORT(XboxKrnl, 0x0231, FUNCTION, "XMAIsInputBuffer1Valid");
-    LOAD_IMPORT(XboxKrnl, 0x0232, FUNCTION, "XMASetInputBuffer0");
-    LOAD_IMPORT(XboxKrnl, 0x0233, FUNCTION, "XMASetInputBuffer1");
-    LOAD_IMPORT(XboxKrnl, 0x0234, FUNCTION, "XMAGetPacketMetadata");
-    LOAD_IMPORT(XboxKrnl, 0x0235, FUNCTION, "XMABlockWhileInUse");
-    LOAD_IMPORT(XboxKrnl, 0x0236, FUNCTION, "XMASetLoopData");
-    LOAD_IMPORT(XboxKrnl, 0x0237, FUNCTION, "XMASetInputBufferReadOffset");
-    LOAD_IMPORT(XboxKrnl, 0x0238, FUNCTION, "XMAGetInputBufferReadOffset");
-    LOAD_IMPORT(XboxKrnl, 0x0239, FUNCTION, "ExIsBetaFeatureEnabled");
-    LOAD_IMPORT(XboxKrnl, 0x023A, FUNCTION, "XeKeysGetFactoryChallenge");
-    LOAD_IMPORT(XboxKrnl, 0x023B, FUNCTION, "XeKeysSetFactoryResponse");
-    LOAD_IMPORT(XboxKrnl, 0x023C, FUNCTION, "XeKeysInitializeFuses");
-    LOAD_IMPORT(XboxKrnl, 0x023D, FUNCTION, "XeKeysSaveBootLoader");
-    LOAD_IMPORT(XboxKrnl, 0x023E, FUNCTION, "XeKeysSaveKeyVault");
-    LOAD_IMPORT(XboxKrnl, 0x023F, FUNCTION, "XeKeysGetStatus");
-    LOAD_IMPORT(XboxKrnl, 0x0240, FUNCTION, "XeKeysGeneratePrivateKey");
-    LOAD_IMPORT(XboxKrnl, 0x0241, FUNCTION, "XeKeysGetKeyProperties");
-    LOAD_IMPORT(XboxKrnl, 0x0242, FUNCTION, "XeKeysSetKey");
-    LOAD_IMPORT(XboxKrnl, 0x0243, FUNCTION, "XeKeysGenerateRandomKey");
-    LOAD_IMPORT(XboxKrnl, 0x0244, FUNCTION, "XeKeysGetKey");
-    LOAD_IMPORT(XboxKrnl, 0x0245, FUNCTION, "XeKeysGetDigest");
-    LOAD_IMPORT(XboxKrnl, 0x0246, FUNCTION, "XeKeysGetConsoleID");
-    LOAD_IMPORT(XboxKrnl, 0x0247, FUNCTION, "XeKeysGetConsoleType");
-    LOAD_IMPORT(XboxKrnl, 0x0248, FUNCTION, "XeKeysQwNeRsaPrvCrypt");
-    LOAD_IMPORT(XboxKrnl, 0x0249, FUNCTION, "XeKeysHmacSha");
-    LOAD_IMPORT(XboxKrnl, 0x024A, FUNCTION, "XInputdPassThroughRFCommand");
-    LOAD_IMPORT(XboxKrnl, 0x024B, FUNCTION, "XeKeysAesCbc");
-    LOAD_IMPORT(XboxKrnl, 0x024C, FUNCTION, "XeKeysDes2Cbc");
-    LOAD_IMPORT(XboxKrnl, 0x024D, FUNCTION, "XeKeysDesCbc");
-    LOAD_IMPORT(XboxKrnl, 0x024E, FUNCTION, "XeKeysObscureKey");
-    LOAD_IMPORT(XboxKrnl, 0x024F, FUNCTION, "XeKeysHmacShaUsingKey");
-    LOAD_IMPORT(XboxKrnl, 0x0250, FUNCTION, "XeKeysSaveBootLoaderEx");
-    LOAD_IMPORT(XboxKrnl, 0x0251, FUNCTION, "XeKeysAesCbcUsingKey");
-    LOAD_IMPORT(XboxKrnl, 0x0252, FUNCTION, "XeKeysDes2CbcUsingKey");
-    LOAD_IMPORT(XboxKrnl, 0x0253, FUNCTION, "XeKeysDesCbcUsingKey");
-    LOAD_IMPORT(XboxKrnl, 0x0254, FUNCTION, "XeKeysObfuscate");
-    LOAD_IMPORT(XboxKrnl, 0x0255, FUNCTION, "XeKeysUnObfuscate");
-    LOAD_IMPORT(XboxKrnl, 0x0256, FUNCTION, "XeKeysConsolePrivateKeySign");
-    LOAD_IMPORT(XboxKrnl, 0x0257, FUNCTION, "XeKeysConsoleSignatureVerification");
-    LOAD_IMPORT(XboxKrnl, 0x0258, FUNCTION, "XeKeysVerifyRSASignature");
-    LOAD_IMPORT(XboxKrnl, 0x0259, FUNCTION, "StfsCreateDevice");
-    LOAD_IMPORT(XboxKrnl, 0x025A, FUNCTION, "StfsControlDevice");
-    LOAD_IMPORT(XboxKrnl, 0x025B, FUNCTION, "VdSwap");
-    LOAD_IMPORT(XboxKrnl, 0x025C, VARIABLE, "HalFsbInterruptCount");
-    LOAD_IMPORT(XboxKrnl, 0x025D, FUNCTION, "XeKeysSaveSystemUpdate");
-    LOAD_IMPORT(XboxKrnl, 0x025E, FUNCTION, "XeKeysLockSystemUpdate");
-    LOAD_IMPORT(XboxKrnl, 0x025F, FUNCTION, "XeKeysExecute");
-    LOAD_IMPORT(XboxKrnl, 0x0260, FUNCTION, "XeKeysGetVersions");
-    LOAD_IMPORT(XboxKrnl, 0x0261, FUNCTION, "XInputdPowerDownDevice");
-    LOAD_IMPORT(XboxKrnl, 0x0262, FUNCTION, "AniBlockOnAnimation");
-    LOAD_IMPORT(XboxKrnl, 0x0263, FUNCTION, "AniTerminateAnimation");
-    LOAD_IMPORT(XboxKrnl, 0x0264, FUNCTION, "XUsbcamReset");
-    LOAD_IMPORT(XboxKrnl, 0x0265, FUNCTION, "AniSetLogo");
-    LOAD_IMPORT(XboxKrnl, 0x0266, VARIABLE, "KeCertMonitorData");
-    LOAD_IMPORT(XboxKrnl, 0x0267, FUNCTION, "HalIsExecutingPowerDownDpc");
-    LOAD_IMPORT(XboxKrnl, 0x0268, FUNCTION, "VdInitializeEDRAM");
-    LOAD_IMPORT(XboxKrnl, 0x0269, FUNCTION, "VdRetrainEDRAM");
-    LOAD_IMPORT(XboxKrnl, 0x026A, FUNCTION, "VdRetrainEDRAMWorker");
-    LOAD_IMPORT(XboxKrnl, 0x026B, VARIABLE, "VdHSIOTrainCount");
-    LOAD_IMPORT(XboxKrnl, 0x026C, FUNCTION, "HalGetPowerUpCause");
-    LOAD_IMPORT(XboxKrnl, 0x026D, VARIABLE, "VdHSIOTrainingStatus");
-    LOAD_IMPORT(XboxKrnl, 0x026E, VARIABLE, "RgcBindInfo");
-    LOAD_IMPORT(XboxKrnl, 0x026F, FUNCTION, "VdReadEEDIDBlock");
-    LOAD_IMPORT(XboxKrnl, 0x0270, FUNCTION, "VdEnumerateVideoModes");
-    LOAD_IMPORT(XboxKrnl, 0x0271, FUNCTION, "VdEnableHDCP");
-    LOAD_IMPORT(XboxKrnl, 0x0272, FUNCTION, "VdRegisterHDCPNotification");
-    LOAD_IMPORT(XboxKrnl, 0x0273, FUNCTION, "HidReadMouseChanges");
-    LOAD_IMPORT(XboxKrnl, 0x0274, FUNCTION, "DumpSetCollectionFacility");
-    LOAD_IMPORT(XboxKrnl, 0x0275, FUNCTION, "XexTransformImageKey");
-    LOAD_IMPORT(XboxKrnl, 0x0276, FUNCTION, "XAudioOverrideSpeakerConfig");
-    LOAD_IMPORT(XboxKrnl, 0x0277, FUNCTION, "XInputdReadTextKeystroke");
-    LOAD_IMPORT(XboxKrnl, 0x0278, FUNCTION, "DrvXenonButtonPressed");
-    LOAD_IMPORT(XboxKrnl, 0x0279, FUNCTION, "DrvBindToUser");
-    LOAD_IMPORT(XboxKrnl, 0x027A, FUNCTION, "XexGetModuleImportVersions");
-    LOAD_IMPORT(XboxKrnl, 0x027B, FUNCTION, "RtlComputeCrc32");
-    LOAD_IMPORT(XboxKrnl, 0x027C, FUNCTION, "XeKeysSetRevocationList");
-    LOAD_IMPORT(XboxKrnl, 0x027D, FUNCTION, "HalRegisterPowerDownCallback");
-    LOAD_IMPORT(XboxKrnl, 0x027E, FUNCTION, "VdGetDisplayDiscoveryData");
-    LOAD_IMPORT(XboxKrnl, 0x027F, FUNCTION, "XInputdSendStayAliveRequest");
-    LOAD_IMPORT(XboxKrnl, 0x0280, FUNCTION, "XVoicedSendVPort");
-    LOAD_IMPORT(XboxKrnl, 0x0281, FUNCTION, "XVoicedGetBatteryStatus");
-    LOAD_IMPORT(XboxKrnl, 0x0282, FUNCTION, "XInputdFFGetDeviceInfo");
-    LOAD_IMPORT(XboxKrnl, 0x0283, FUNCTION, "XInputdFFSetEffect");
-    LOAD_IMPORT(XboxKrnl, 0x0284, FUNCTION, "XInputdFFUpdateEffect");
-    LOAD_IMPORT(XboxKrnl, 0x0285, FUNCTION, "XInputdFFEffectOperation");
-    LOAD_IMPORT(XboxKrnl, 0x0286, FUNCTION, "XInputdFFDeviceControl");
-    LOAD_IMPORT(XboxKrnl, 0x0287, FUNCTION, "XInputdFFSetDeviceGain");
-    LOAD_IMPORT(XboxKrnl, 0x0288, FUNCTION, "XInputdFFCancelIo");
-    LOAD_IMPORT(XboxKrnl, 0x0289, FUNCTION, "XInputdFFSetRumble");
-    LOAD_IMPORT(XboxKrnl, 0x028A, FUNCTION, "NtAllocateEncryptedMemory");
-    LOAD_IMPORT(XboxKrnl, 0x028B, FUNCTION, "NtFreeEncryptedMemory");
-    LOAD_IMPORT(XboxKrnl, 0x028C, FUNCTION, "XeKeysExSaveKeyVault");
-    LOAD_IMPORT(XboxKrnl, 0x028D, FUNCTION, "XeKeysExSetKey");
-    LOAD_IMPORT(XboxKrnl, 0x028E, FUNCTION, "XeKeysExGetKey");
-    LOAD_IMPORT(XboxKrnl, 0x028F, FUNCTION, "DrvSetDeviceConfigChangeCallback");
-    LOAD_IMPORT(XboxKrnl, 0x0290, FUNCTION, "DrvDeviceConfigChange");
-    LOAD_IMPORT(XboxKrnl, 0x0291, FUNCTION, "HalRegisterHdDvdRomNotification");
-    LOAD_IMPORT(XboxKrnl, 0x0292, FUNCTION, "XeKeysSecurityInitialize");
-    LOAD_IMPORT(XboxKrnl, 0x0293, FUNCTION, "XeKeysSecurityLoadSettings");
-    LOAD_IMPORT(XboxKrnl, 0x0294, FUNCTION, "XeKeysSecuritySaveSettings");
-    LOAD_IMPORT(XboxKrnl, 0x0295, FUNCTION, "XeKeysSecuritySetDetected");
-    LOAD_IMPORT(XboxKrnl, 0x0296, FUNCTION, "XeKeysSecurityGetDetected");
-    LOAD_IMPORT(XboxKrnl, 0x0297, FUNCTION, "XeKeysSecuritySetActivated");
-    LOAD_IMPORT(XboxKrnl, 0x0298, FUNCTION, "XeKeysSecurityGetActivated");
-    LOAD_IMPORT(XboxKrnl, 0x0299, FUNCTION, "XeKeysDvdAuthAP25InstallTable");
-    LOAD_IMPORT(XboxKrnl, 0x029A, FUNCTION, "XeKeysDvdAuthAP25GetTableVersion");
-    LOAD_IMPORT(XboxKrnl, 0x029B, FUNCTION, "XeKeysGetProtectedFlag");
-    LOAD_IMPORT(XboxKrnl, 0x029C, FUNCTION, "XeKeysSetProtectedFlag");
-    LOAD_IMPORT(XboxKrnl, 0x029D, FUNCTION, "KeEnablePFMInterrupt");
-    LOAD_IMPORT(XboxKrnl, 0x029E, FUNCTION, "KeDisablePFMInterrupt");
-    LOAD_IMPORT(XboxKrnl, 0x029F, FUNCTION, "KeSetProfilerISR");
-    LOAD_IMPORT(XboxKrnl, 0x02A0, FUNCTION, "VdStartDisplayDiscovery");
-    LOAD_IMPORT(XboxKrnl, 0x02A1, FUNCTION, "VdSetHDCPRevocationList");
-    LOAD_IMPORT(XboxKrnl, 0x02A2, FUNCTION, "XeKeysGetUpdateSequence");
-    LOAD_IMPORT(XboxKrnl, 0x02A3, FUNCTION, "XeKeysDvdAuthExActivate");
-    LOAD_IMPORT(XboxKrnl, 0x02A4, FUNCTION, "KeGetImagePageTableEntry");
-    LOAD_IMPORT(XboxKrnl, 0x02A5, FUNCTION, "HalRegisterBackgroundModeTransitionCallback");
-    LOAD_IMPORT(XboxKrnl, 0x02A6, FUNCTION, "AniStartBootAnimation");
-    LOAD_IMPORT(XboxKrnl, 0x02A7, FUNCTION, "HalClampUnclampOutputDACs");
-    LOAD_IMPORT(XboxKrnl, 0x02A8, FUNCTION, "HalPowerDownToBackgroundMode");
-    LOAD_IMPORT(XboxKrnl, 0x02A9, FUNCTION, "HalNotifyAddRemoveBackgroundTask");
-    LOAD_IMPORT(XboxKrnl, 0x02AA, FUNCTION, "HalCallBackgroundModeNotificationRoutines");
-    LOAD_IMPORT(XboxKrnl, 0x02AB, VARIABLE, "HalFsbResetCount");
-    LOAD_IMPORT(XboxKrnl, 0x02AC, FUNCTION, "HalGetMemoryInformation");
-    LOAD_IMPORT(XboxKrnl, 0x02AD, FUNCTION, "XInputdGetLastTextInputTime");
-    LOAD_IMPORT(XboxKrnl, 0x02AE, FUNCTION, "VdEnableWMAProOverHDMI");
-    LOAD_IMPORT(XboxKrnl, 0x02AF, FUNCTION, "XeKeysRevokeSaveSettings");
-    LOAD_IMPORT(XboxKrnl, 0x02B0, FUNCTION, "XInputdSetTextMessengerIndicator");
-    LOAD_IMPORT(XboxKrnl, 0x02B1, FUNCTION, "MicDeviceRequest");
-    LOAD_IMPORT(XboxKrnl, 0x02B2, FUNCTION, "XeKeysGetMediaID");
-    LOAD_IMPORT(XboxKrnl, 0x02B3, FUNCTION, "XeKeysLoadKeyVault");
-    LOAD_IMPORT(XboxKrnl, 0x02B4, FUNCTION, "KeGetVidInfo");
-    LOAD_IMPORT(XboxKrnl, 0x02B5, FUNCTION, "HalNotifyBackgroundModeTransitionComplete");
-    LOAD_IMPORT(XboxKrnl, 0x02B6, FUNCTION, "IoAcquireCancelSpinLock");
-    LOAD_IMPORT(XboxKrnl, 0x02B7, FUNCTION, "IoReleaseCancelSpinLock");
-    LOAD_IMPORT(XboxKrnl, 0x02B8, FUNCTION, "NtCancelIoFile");
-    LOAD_IMPORT(XboxKrnl, 0x02B9, FUNCTION, "NtCancelIoFileEx");
-    LOAD_IMPORT(XboxKrnl, 0x02BA, FUNCTION, "HalFinalizePowerLossRecovery");
-    LOAD_IMPORT(XboxKrnl, 0x02BB, FUNCTION, "HalSetPowerLossRecovery");
-    LOAD_IMPORT(XboxKrnl, 0x02BC, FUNCTION, "ExReadModifyWriteXConfigSettingUlong");
-    LOAD_IMPORT(XboxKrnl, 0x02BD, FUNCTION, "HalRegisterXamPowerDownCallback");
-    LOAD_IMPORT(XboxKrnl, 0x02BE, FUNCTION, "ExCancelAlarm");
-    LOAD_IMPORT(XboxKrnl, 0x02BF, FUNCTION, "ExInitializeAlarm");
-    LOAD_IMPORT(XboxKrnl, 0x02C0, FUNCTION, "ExSetAlarm");
-    LOAD_IMPORT(XboxKrnl, 0x02C1, FUNCTION, "XexActivationGetNonce");
-    LOAD_IMPORT(XboxKrnl, 0x02C2, FUNCTION, "XexActivationSetLicense");
-    LOAD_IMPORT(XboxKrnl, 0x02C3, FUNCTION, "IptvSetBoundaryKey");
-    LOAD_IMPORT(XboxKrnl, 0x02C4, FUNCTION, "IptvSetSessionKey");
-    LOAD_IMPORT(XboxKrnl, 0x02C5, FUNCTION, "IptvVerifyOmac1Signature");
-    LOAD_IMPORT(XboxKrnl, 0x02C6, FUNCTION, "IptvGetAesCtrTransform");
-    LOAD_IMPORT(XboxKrnl, 0x02C7, FUNCTION, "SataCdRomRecordReset");
-    LOAD_IMPORT(XboxKrnl, 0x02C8, FUNCTION, "XInputdSetTextDeviceKeyLocks");
-    LOAD_IMPORT(XboxKrnl, 0x02C9, FUNCTION, "XInputdGetTextDeviceKeyLocks");
-    LOAD_IMPORT(XboxKrnl, 0x02CA, FUNCTION, "XexActivationVerifyOwnership");
-    LOAD_IMPORT(XboxKrnl, 0x02CB, FUNCTION, "XexDisableVerboseDbgPrint");
-    LOAD_IMPORT(XboxKrnl, 0x02CC, FUNCTION, "SvodCreateDevice");
-    LOAD_IMPORT(XboxKrnl, 0x02CD, FUNCTION, "RtlCaptureStackBackTrace");
-    LOAD_IMPORT(XboxKrnl, 0x02CE, FUNCTION, "XeKeysRevokeUpdateDynamic");
-    LOAD_IMPORT(XboxKrnl, 0x02CF, FUNCTION, "XexImportTraceEnable");
-    LOAD_IMPORT(XboxKrnl, 0x02D0, FUNCTION, "ExRegisterXConfigNotification");
-    LOAD_IMPORT(XboxKrnl, 0x02D1, FUNCTION, "XeKeysSecuritySetStat");
-    LOAD_IMPORT(XboxKrnl, 0x02D2, FUNCTION, "VdQueryRealVideoMode");
-    LOAD_IMPORT(XboxKrnl, 0x02D3, FUNCTION, "XexSetExecutablePrivilege");
-    LOAD_IMPORT(XboxKrnl, 0x02D4, FUNCTION, "XAudioSuspendRenderDriverClients");
-    LOAD_IMPORT(XboxKrnl, 0x02D5, FUNCTION, "IptvGetSessionKeyHash");
-    LOAD_IMPORT(XboxKrnl, 0x02D6, FUNCTION, "VdSetCGMSState");
-    LOAD_IMPORT(XboxKrnl, 0x02D7, FUNCTION, "VdSetSCMSState");
-    LOAD_IMPORT(XboxKrnl, 0x02D8, FUNCTION, "KeFlushMultipleTb");
-    LOAD_IMPORT(XboxKrnl, 0x02D9, FUNCTION, "VdGetOption");
-    LOAD_IMPORT(XboxKrnl, 0x02DA, FUNCTION, "VdSetOption");
-    LOAD_IMPORT(XboxKrnl, 0x02DB, VARIABLE, "UsbdBootEnumerationDoneEvent");
-    LOAD_IMPORT(XboxKrnl, 0x02DC, VARIABLE, "StfsDeviceErrorEvent");
-    LOAD_IMPORT(XboxKrnl, 0x02DD, FUNCTION, "ExTryToAcquireReadWriteLockExclusive");
-    LOAD_IMPORT(XboxKrnl, 0x02DE, FUNCTION, "ExTryToAcquireReadWriteLockShared");
-    LOAD_IMPORT(XboxKrnl, 0x02DF, FUNCTION, "XexSetLastKdcTime");
-    LOAD_IMPORT(XboxKrnl, 0x02E0, FUNCTION, "XInputdControl");
-    LOAD_IMPORT(XboxKrnl, 0x02E1, FUNCTION, "RmcDeviceRequest");
-    LOAD_IMPORT(XboxKrnl, 0x02E2, FUNCTION, "LDIResetDecompression");
-    LOAD_IMPORT(XboxKrnl, 0x02E3, FUNCTION, "NicRegisterDevice");
-    LOAD_IMPORT(XboxKrnl, 0x02E4, FUNCTION, "UsbdAddDeviceComplete");
-    LOAD_IMPORT(XboxKrnl, 0x02E5, FUNCTION, "UsbdCancelAsyncTransfer");
-    LOAD_IMPORT(XboxKrnl, 0x02E6, FUNCTION, "UsbdGetDeviceSpeed");
-    LOAD_IMPORT(XboxKrnl, 0x02E7, FUNCTION, "UsbdGetDeviceTopology");
-    LOAD_IMPORT(XboxKrnl, 0x02E8, FUNCTION, "UsbdGetEndpointDescriptor");
-    LOAD_IMPORT(XboxKrnl, 0x02E9, FUNCTION, "UsbdIsDeviceAuthenticated");
-    LOAD_IMPORT(XboxKrnl, 0x02EA, FUNCTION, "UsbdOpenDefaultEndpoint");
-    LOAD_IMPORT(XboxKrnl, 0x02EB, FUNCTION, "UsbdOpenEndpoint");
-    LOAD_IMPORT(XboxKrnl, 0x02EC, FUNCTION, "UsbdQueueAsyncTransfer");
-    LOAD_IMPORT(XboxKrnl, 0x02ED, FUNCTION, "UsbdQueueCloseDefaultEndpoint");
-    LOAD_IMPORT(XboxKrnl, 0x02EE, FUNCTION, "UsbdQueueCloseEndpoint");
-    LOAD_IMPORT(XboxKrnl, 0x02EF, FUNCTION, "UsbdRemoveDeviceComplete");
-    LOAD_IMPORT(XboxKrnl, 0x02F0, FUNCTION, "KeRemoveQueueApc");
-    LOAD_IMPORT(XboxKrnl, 0x02F1, VARIABLE, "UsbdDriverLoadRequiredEvent");
-    LOAD_IMPORT(XboxKrnl, 0x02F2, FUNCTION, "UsbdGetRequiredDrivers");
-    LOAD_IMPORT(XboxKrnl, 0x02F3, FUNCTION, "UsbdRegisterDriverObject");
-    LOAD_IMPORT(XboxKrnl, 0x02F4, FUNCTION, "UsbdUnregisterDriverObject");
-    LOAD_IMPORT(XboxKrnl, 0x02F5, FUNCTION, "UsbdCallAndBlockOnDpcRoutine");
-    LOAD_IMPORT(XboxKrnl, 0x02F6, FUNCTION, "UsbdResetDevice");
-    LOAD_IMPORT(XboxKrnl, 0x02F7, FUNCTION, "UsbdGetDeviceDescriptor");
-    LOAD_IMPORT(XboxKrnl, 0x02F8, FUNCTION, "NomnilGetExtension");
-    LOAD_IMPORT(XboxKrnl, 0x02F9, FUNCTION, "NomnilStartCloseDevice");
-    LOAD_IMPORT(XboxKrnl, 0x02FA, FUNCTION, "WifiBeginAuthentication");
-    LOAD_IMPORT(XboxKrnl, 0x02FB, FUNCTION, "WifiCheckCounterMeasures");
-    LOAD_IMPORT(XboxKrnl, 0x02FC, FUNCTION, "WifiChooseAuthenCipherSetFromBSSID");
-    LOAD_IMPORT(XboxKrnl, 0x02FD, FUNCTION, "WifiCompleteAuthentication");
-    LOAD_IMPORT(XboxKrnl, 0x02FE, FUNCTION, "WifiGetAssociationIE");
-    LOAD_IMPORT(XboxKrnl, 0x02FF, FUNCTION, "WifiOnMICError");
-    LOAD_IMPORT(XboxKrnl, 0x0300, FUNCTION, "WifiPrepareAuthenticationContext");
-    LOAD_IMPORT(XboxKrnl, 0x0301, FUNCTION, "WifiRecvEAPOLPacket");
-    LOAD_IMPORT(XboxKrnl, 0x0302, FUNCTION, "WifiDeduceNetworkType");
-    LOAD_IMPORT(XboxKrnl, 0x0303, FUNCTION, "NicUnregisterDevice");
-    LOAD_IMPORT(XboxKrnl, 0x0304, FUNCTION, "DumpXitThread");
-    LOAD_IMPORT(XboxKrnl, 0x0305, FUNCTION, "XInputdSetWifiChannel");
-    LOAD_IMPORT(XboxKrnl, 0x0306, FUNCTION, "NomnilSetLed");
-    LOAD_IMPORT(XboxKrnl, 0x0307, FUNCTION, "WifiCalculateRegulatoryDomain");
-    LOAD_IMPORT(XboxKrnl, 0x0308, FUNCTION, "WifiSelectAdHocChannel");
-    LOAD_IMPORT(XboxKrnl, 0x0309, FUNCTION, "WifiChannelToFrequency");
-    LOAD_IMPORT(XboxKrnl, 0x030A, FUNCTION, "MmGetPoolPagesType");
-    LOAD_IMPORT(XboxKrnl, 0x030B, FUNCTION, "ExExpansionInstall");
-    LOAD_IMPORT(XboxKrnl, 0x030C, FUNCTION, "ExExpansionCall");
-    LOAD_IMPORT(XboxKrnl, 0x030D, FUNCTION, "PsCamDeviceRequest");
-    LOAD_IMPORT(XboxKrnl, 0x030E, FUNCTION, "McaDeviceRequest");
-    LOAD_IMPORT(XboxKrnl, 0x030F, FUNCTION, "DetroitDeviceRequest");
-    LOAD_IMPORT(XboxKrnl, 0x0310, FUNCTION, "XeCryptSha256Init");
-    LOAD_IMPORT(XboxKrnl, 0x0311, FUNCTION, "XeCryptSha256Update");
-    LOAD_IMPORT(XboxKrnl, 0x0312, FUNCTION, "XeCryptSha256Final");
-    LOAD_IMPORT(XboxKrnl, 0x0313, FUNCTION, "XeCryptSha256");
-    LOAD_IMPORT(XboxKrnl, 0x0314, FUNCTION, "XeCryptSha384Init");
-    LOAD_IMPORT(XboxKrnl, 0x0315, FUNCTION, "XeCryptSha384Update");
-    LOAD_IMPORT(XboxKrnl, 0x0316, FUNCTION, "XInputdGetDevicePid");
-    LOAD_IMPORT(XboxKrnl, 0x0317, FUNCTION, "HalGetNotedArgonErrors");
-    LOAD_IMPORT(XboxKrnl, 0x0318, FUNCTION, "XeCryptSha384Final");
-    LOAD_IMPORT(XboxKrnl, 0x0319, FUNCTION, "HalReadArgonEeprom");
-    LOAD_IMPORT(XboxKrnl, 0x031A, FUNCTION, "HalWriteArgonEeprom");
-    LOAD_IMPORT(XboxKrnl, 0x031B, FUNCTION, "XeKeysFcrtLoad");
-    LOAD_IMPORT(XboxKrnl, 0x031C, FUNCTION, "XeKeysFcrtSave");
-    LOAD_IMPORT(XboxKrnl, 0x031D, FUNCTION, "XeKeysFcrtSet");
-    LOAD_IMPORT(XboxKrnl, 0x031E, FUNCTION, "XeCryptSha384");
-    LOAD_IMPORT(XboxKrnl, 0x031F, FUNCTION, "XeCryptSha512Init");
-    LOAD_IMPORT(XboxKrnl, 0x0320, FUNCTION, "XAudioRegisterRenderDriverMECClient");
-    LOAD_IMPORT(XboxKrnl, 0x0321, FUNCTION, "XAudioUnregisterRenderDriverMECClient");
-    LOAD_IMPORT(XboxKrnl, 0x0322, FUNCTION, "XAudioCaptureRenderDriverFrame");
-    LOAD_IMPORT(XboxKrnl, 0x0323, FUNCTION, "XeCryptSha512Update");
-    LOAD_IMPORT(XboxKrnl, 0x0324, FUNCTION, "XeCryptSha512Final");
-    LOAD_IMPORT(XboxKrnl, 0x0325, FUNCTION, "XeCryptSha512");
-    LOAD_IMPORT(XboxKrnl, 0x0326, FUNCTION, "XeCryptBnQwNeCompare");
-    LOAD_IMPORT(XboxKrnl, 0x0327, FUNCTION, "XVoicedGetDirectionalData");
-    LOAD_IMPORT(XboxKrnl, 0x0328, FUNCTION, "DrvSetMicArrayStartCallback");
-    LOAD_IMPORT(XboxKrnl, 0x0329, FUNCTION, "DevAuthGetStatistics");
-    LOAD_IMPORT(XboxKrnl, 0x032A, FUNCTION, "NullCableRequest");
-    LOAD_IMPORT(XboxKrnl, 0x032B, FUNCTION, "XeKeysRevokeIsDeviceRevoked");
-    LOAD_IMPORT(XboxKrnl, 0x032C, FUNCTION, "DumpUpdateDumpSettings");
-    LOAD_IMPORT(XboxKrnl, 0x032D, FUNCTION, "EtxConsumerDisableEventType");
-    LOAD_IMPORT(XboxKrnl, 0x032E, FUNCTION, "EtxConsumerEnableEventType");
-    LOAD_IMPORT(XboxKrnl, 0x032F, FUNCTION, "EtxConsumerProcessLogs");
-    LOAD_IMPORT(XboxKrnl, 0x0330, FUNCTION, "EtxConsumerRegister");
-    LOAD_IMPORT(XboxKrnl, 0x0331, FUNCTION, "EtxConsumerUnregister");
-    LOAD_IMPORT(XboxKrnl, 0x0332, FUNCTION, "EtxProducerLog");
-    LOAD_IMPORT(XboxKrnl, 0x0333, FUNCTION, "EtxProducerLogV");
-    LOAD_IMPORT(XboxKrnl, 0x0334, FUNCTION, "EtxProducerRegister");
-    LOAD_IMPORT(XboxKrnl, 0x0335, FUNCTION, "EtxProducerUnregister");
-    LOAD_IMPORT(XboxKrnl, 0x0336, FUNCTION, "EtxConsumerFlushBuffers");
-    LOAD_IMPORT(XboxKrnl, 0x0337, FUNCTION, "EtxProducerLogXwpp");
-    LOAD_IMPORT(XboxKrnl, 0x0338, FUNCTION, "EtxProducerLogXwppV");
-    LOAD_IMPORT(XboxKrnl, 0x0339, FUNCTION, "UsbdEnableDisableRootHubPort");
-    LOAD_IMPORT(XboxKrnl, 0x033A, FUNCTION, "EtxBufferRegister");
-    LOAD_IMPORT(XboxKrnl, 0x033B, FUNCTION, "EtxBufferUnregister");
-    LOAD_IMPORT(XboxKrnl, 0x033C, FUNCTION, "DumpRegisterDedicatedDataBlock");
-    LOAD_IMPORT(XboxKrnl, 0x033D, FUNCTION, "XeKeysDvdAuthExSave");
-    LOAD_IMPORT(XboxKrnl, 0x033E, FUNCTION, "XeKeysDvdAuthExInstall");
-    LOAD_IMPORT(XboxKrnl, 0x033F, FUNCTION, "XexShimDisable");
-    LOAD_IMPORT(XboxKrnl, 0x0340, FUNCTION, "XexShimEnable");
-    LOAD_IMPORT(XboxKrnl, 0x0341, FUNCTION, "XexShimEntryDisable");
-    LOAD_IMPORT(XboxKrnl, 0x0342, FUNCTION, "XexShimEntryEnable");
-    LOAD_IMPORT(XboxKrnl, 0x0343, FUNCTION, "XexShimEntryRegister");
-    LOAD_IMPORT(XboxKrnl, 0x0344, FUNCTION, "XexShimLock");
-    LOAD_IMPORT(XboxKrnl, 0x0345, VARIABLE, "XboxKrnlVersion4Digit");
-    LOAD_IMPORT(XboxKrnl, 0x0346, FUNCTION, "XeKeysObfuscateEx");
-    LOAD_IMPORT(XboxKrnl, 0x0347, FUNCTION, "XeKeysUnObfuscateEx");
-    LOAD_IMPORT(XboxKrnl, 0x0348, FUNCTION, "XexTitleHash");
-    LOAD_IMPORT(XboxKrnl, 0x0349, FUNCTION, "XexTitleHashClose");
-    LOAD_IMPORT(XboxKrnl, 0x034A, FUNCTION, "XexTitleHashContinue");
-    LOAD_IMPORT(XboxKrnl, 0x034B, FUNCTION, "XexTitleHashOpen");
-    LOAD_IMPORT(XboxKrnl, 0x034C, FUNCTION, "XAudioGetRenderDriverTic");
-    LOAD_IMPORT(XboxKrnl, 0x034D, FUNCTION, "XAudioEnableDucker");
-    LOAD_IMPORT(XboxKrnl, 0x034E, FUNCTION, "XAudioSetDuckerLevel");
-    LOAD_IMPORT(XboxKrnl, 0x034F, FUNCTION, "XAudioIsDuckerEnabled");
-    LOAD_IMPORT(XboxKrnl, 0x0350, FUNCTION, "XAudioGetDuckerLevel");
-    LOAD_IMPORT(XboxKrnl, 0x0351, FUNCTION, "XAudioGetDuckerThreshold");
-    LOAD_IMPORT(XboxKrnl, 0x0352, FUNCTION, "XAudioSetDuckerThreshold");
-    LOAD_IMPORT(XboxKrnl, 0x0353, FUNCTION, "XAudioGetDuckerAttackTime");
-    LOAD_IMPORT(XboxKrnl, 0x0354, FUNCTION, "XAudioSetDuckerAttackTime");
-    LOAD_IMPORT(XboxKrnl, 0x0355, FUNCTION, "XAudioGetDuckerReleaseTime");
-    LOAD_IMPORT(XboxKrnl, 0x0356, FUNCTION, "XAudioSetDuckerReleaseTime");
-    LOAD_IMPORT(XboxKrnl, 0x0357, FUNCTION, "XAudioGetDuckerHoldTime");
-    LOAD_IMPORT(XboxKrnl, 0x0358, FUNCTION, "XAudioSetDuckerHoldTime");
-    LOAD_IMPORT(XboxKrnl, 0x0359, FUNCTION, "DevAuthShouldAlwaysEnforce");
-    LOAD_IMPORT(XboxKrnl, 0x035A, FUNCTION, "XAudioGetUnderrunCount");
-    LOAD_IMPORT(XboxKrnl, 0x035C, FUNCTION, "XVoicedIsActiveProcess");
+    LOAD_IMPORT(XboxKrnl, 0x0001, FUNCTION, "DbgBreakPoint")
+    LOAD_IMPORT(XboxKrnl, 0x0002, FUNCTION, "DbgBreakPointWithStatus")
+    LOAD_IMPORT(XboxKrnl, 0x0003, FUNCTION, "DbgPrint")
+    LOAD_IMPORT(XboxKrnl, 0x0004, FUNCTION, "DbgPrompt")
+    LOAD_IMPORT(XboxKrnl, 0x0005, FUNCTION, "DumpGetRawDumpInfo")
+    LOAD_IMPORT(XboxKrnl, 0x0006, FUNCTION, "DumpWriteDump")
+    LOAD_IMPORT(XboxKrnl, 0x0007, FUNCTION, "ExAcquireReadWriteLockExclusive")
+    LOAD_IMPORT(XboxKrnl, 0x0008, FUNCTION, "ExAcquireReadWriteLockShared")
+    LOAD_IMPORT(XboxKrnl, 0x0009, FUNCTION, "ExAllocatePool")
+    LOAD_IMPORT(XboxKrnl, 0x000A, FUNCTION, "ExAllocatePoolWithTag")
+    LOAD_IMPORT(XboxKrnl, 0x000B, FUNCTION, "ExAllocatePoolTypeWithTag")
+    LOAD_IMPORT(XboxKrnl, 0x000C, VARIABLE, "ExConsoleGameRegion")
+    LOAD_IMPORT(XboxKrnl, 0x000D, FUNCTION, "ExCreateThread")
+    LOAD_IMPORT(XboxKrnl, 0x000E, FUNCTION, "ExEventObjectType")
+    LOAD_IMPORT(XboxKrnl, 0x000F, FUNCTION, "ExFreePool")
+    LOAD_IMPORT(XboxKrnl, 0x0010, FUNCTION, "ExGetXConfigSetting")
+    LOAD_IMPORT(XboxKrnl, 0x0011, FUNCTION, "ExInitializeReadWriteLock")
+    LOAD_IMPORT(XboxKrnl, 0x0012, FUNCTION, "ExMutantObjectType")
+    LOAD_IMPORT(XboxKrnl, 0x0013, FUNCTION, "ExQueryPoolBlockSize")
+    LOAD_IMPORT(XboxKrnl, 0x0014, FUNCTION, "ExRegisterThreadNotification")
+    LOAD_IMPORT(XboxKrnl, 0x0015, FUNCTION, "ExRegisterTitleTerminateNotification")
+    LOAD_IMPORT(XboxKrnl, 0x0016, FUNCTION, "ExReleaseReadWriteLock")
+    LOAD_IMPORT(XboxKrnl, 0x0017, FUNCTION, "ExSemaphoreObjectType")
+    LOAD_IMPORT(XboxKrnl, 0x0018, FUNCTION, "ExSetXConfigSetting")
+    LOAD_IMPORT(XboxKrnl, 0x0019, FUNCTION, "ExTerminateThread")
+    LOAD_IMPORT(XboxKrnl, 0x001A, FUNCTION, "ExTerminateTitleProcess")
+    LOAD_IMPORT(XboxKrnl, 0x001B, FUNCTION, "ExThreadObjectType")
+    LOAD_IMPORT(XboxKrnl, 0x001C, FUNCTION, "ExTimerObjectType")
+    LOAD_IMPORT(XboxKrnl, 0x001D, FUNCTION, "MmDoubleMapMemory")
+    LOAD_IMPORT(XboxKrnl, 0x001E, FUNCTION, "MmUnmapMemory")
+    LOAD_IMPORT(XboxKrnl, 0x001F, FUNCTION, "XeKeysGetConsoleCertificate")
+    LOAD_IMPORT(XboxKrnl, 0x0020, FUNCTION, "FscGetCacheElementCount")
+    LOAD_IMPORT(XboxKrnl, 0x0021, FUNCTION, "FscSetCacheElementCount")
+    LOAD_IMPORT(XboxKrnl, 0x0022, FUNCTION, "HalGetCurrentAVPack")
+    LOAD_IMPORT(XboxKrnl, 0x0023, FUNCTION, "HalGpioControl")
+    LOAD_IMPORT(XboxKrnl, 0x0024, FUNCTION, "HalOpenCloseODDTray")
+    LOAD_IMPORT(XboxKrnl, 0x0025, FUNCTION, "HalReadWritePCISpace")
+    LOAD_IMPORT(XboxKrnl, 0x0026, FUNCTION, "HalRegisterPowerDownNotification")
+    LOAD_IMPORT(XboxKrnl, 0x0027, FUNCTION, "HalRegisterSMCNotification")
+    LOAD_IMPORT(XboxKrnl, 0x0028, FUNCTION, "HalReturnToFirmware")
+    LOAD_IMPORT(XboxKrnl, 0x0029, FUNCTION, "HalSendSMCMessage")
+    LOAD_IMPORT(XboxKrnl, 0x002A, FUNCTION, "HalSetAudioEnable")
+    LOAD_IMPORT(XboxKrnl, 0x002B, FUNCTION, "InterlockedFlushSList")
+    LOAD_IMPORT(XboxKrnl, 0x002C, FUNCTION, "InterlockedPopEntrySList")
+    LOAD_IMPORT(XboxKrnl, 0x002D, FUNCTION, "InterlockedPushEntrySList")
+    LOAD_IMPORT(XboxKrnl, 0x002E, FUNCTION, "IoAcquireDeviceObjectLock")
+    LOAD_IMPORT(XboxKrnl, 0x002F, FUNCTION, "IoAllocateIrp")
+    LOAD_IMPORT(XboxKrnl, 0x0030, FUNCTION, "IoBuildAsynchronousFsdRequest")
+    LOAD_IMPORT(XboxKrnl, 0x0031, FUNCTION, "IoBuildDeviceIoControlRequest")
+    LOAD_IMPORT(XboxKrnl, 0x0032, FUNCTION, "IoBuildSynchronousFsdRequest")
+    LOAD_IMPORT(XboxKrnl, 0x0033, FUNCTION, "IoCallDriver")
+    LOAD_IMPORT(XboxKrnl, 0x0034, FUNCTION, "IoCheckShareAccess")
+    LOAD_IMPORT(XboxKrnl, 0x0035, FUNCTION, "IoCompleteRequest")
+    LOAD_IMPORT(XboxKrnl, 0x0036, FUNCTION, "IoCompletionObjectType")
+    LOAD_IMPORT(XboxKrnl, 0x0037, FUNCTION, "IoCreateDevice")
+    LOAD_IMPORT(XboxKrnl, 0x0038, FUNCTION, "IoCreateFile")
+    LOAD_IMPORT(XboxKrnl, 0x0039, FUNCTION, "IoDeleteDevice")
+    LOAD_IMPORT(XboxKrnl, 0x003A, FUNCTION, "IoDeviceObjectType")
+    LOAD_IMPORT(XboxKrnl, 0x003B, FUNCTION, "IoDismountVolume")
+    LOAD_IMPORT(XboxKrnl, 0x003C, FUNCTION, "IoDismountVolumeByFileHandle")
+    LOAD_IMPORT(XboxKrnl, 0x003D, FUNCTION, "IoDismountVolumeByName")
+    LOAD_IMPORT(XboxKrnl, 0x003E, FUNCTION, "IoFileObjectType")
+    LOAD_IMPORT(XboxKrnl, 0x003F, FUNCTION, "IoFreeIrp")
+    LOAD_IMPORT(XboxKrnl, 0x0040, FUNCTION, "IoInitializeIrp")
+    LOAD_IMPORT(XboxKrnl, 0x0041, FUNCTION, "IoInvalidDeviceRequest")
+    LOAD_IMPORT(XboxKrnl, 0x0042, FUNCTION, "ExSetBetaFeaturesEnabled")
+    LOAD_IMPORT(XboxKrnl, 0x0043, FUNCTION, "IoQueueThreadIrp")
+    LOAD_IMPORT(XboxKrnl, 0x0044, FUNCTION, "IoReleaseDeviceObjectLock")
+    LOAD_IMPORT(XboxKrnl, 0x0045, FUNCTION, "IoRemoveShareAccess")
+    LOAD_IMPORT(XboxKrnl, 0x0046, FUNCTION, "IoSetIoCompletion")
+    LOAD_IMPORT(XboxKrnl, 0x0047, FUNCTION, "IoSetShareAccess")
+    LOAD_IMPORT(XboxKrnl, 0x0048, FUNCTION, "IoStartNextPacket")
+    LOAD_IMPORT(XboxKrnl, 0x0049, FUNCTION, "IoStartNextPacketByKey")
+    LOAD_IMPORT(XboxKrnl, 0x004A, FUNCTION, "IoStartPacket")
+    LOAD_IMPORT(XboxKrnl, 0x004B, FUNCTION, "IoSynchronousDeviceIoControlRequest")
+    LOAD_IMPORT(XboxKrnl, 0x004C, FUNCTION, "IoSynchronousFsdRequest")
+    LOAD_IMPORT(XboxKrnl, 0x004D, FUNCTION, "KeAcquireSpinLockAtRaisedIrql")
+    LOAD_IMPORT(XboxKrnl, 0x004E, FUNCTION, "KeAlertResumeThread")
+    LOAD_IMPORT(XboxKrnl, 0x004F, FUNCTION, "KeAlertThread")
+    LOAD_IMPORT(XboxKrnl, 0x0050, FUNCTION, "KeBlowFuses")
+    LOAD_IMPORT(XboxKrnl, 0x0051, FUNCTION, "KeBoostPriorityThread")
+    LOAD_IMPORT(XboxKrnl, 0x0052, FUNCTION, "KeBugCheck")
+    LOAD_IMPORT(XboxKrnl, 0x0053, FUNCTION, "KeBugCheckEx")
+    LOAD_IMPORT(XboxKrnl, 0x0054, FUNCTION, "KeCancelTimer")
+    LOAD_IMPORT(XboxKrnl, 0x0055, FUNCTION, "KeConnectInterrupt")
+    LOAD_IMPORT(XboxKrnl, 0x0056, FUNCTION, "KeContextFromKframes")
+    LOAD_IMPORT(XboxKrnl, 0x0057, FUNCTION, "KeContextToKframes")
+    LOAD_IMPORT(XboxKrnl, 0x0058, FUNCTION, "KeCreateUserMode")
+    LOAD_IMPORT(XboxKrnl, 0x0059, VARIABLE, "KeDebugMonitorData")
+    LOAD_IMPORT(XboxKrnl, 0x005A, FUNCTION, "KeDelayExecutionThread")
+    LOAD_IMPORT(XboxKrnl, 0x005B, FUNCTION, "KeDeleteUserMode")
+    LOAD_IMPORT(XboxKrnl, 0x005C, FUNCTION, "KeDisconnectInterrupt")
+    LOAD_IMPORT(XboxKrnl, 0x005D, FUNCTION, "KeEnableFpuExceptions")
+    LOAD_IMPORT(XboxKrnl, 0x005E, FUNCTION, "KeEnablePPUPerformanceMonitor")
+    LOAD_IMPORT(XboxKrnl, 0x005F, FUNCTION, "KeEnterCriticalRegion")
+    LOAD_IMPORT(XboxKrnl, 0x0060, FUNCTION, "KeEnterUserMode")
+    LOAD_IMPORT(XboxKrnl, 0x0061, FUNCTION, "KeFlushCacheRange")
+    LOAD_IMPORT(XboxKrnl, 0x0062, FUNCTION, "KeFlushCurrentEntireTb")
+    LOAD_IMPORT(XboxKrnl, 0x0063, FUNCTION, "KeFlushEntireTb")
+    LOAD_IMPORT(XboxKrnl, 0x0064, FUNCTION, "KeFlushUserModeCurrentTb")
+    LOAD_IMPORT(XboxKrnl, 0x0065, FUNCTION, "KeFlushUserModeTb")
+    LOAD_IMPORT(XboxKrnl, 0x0066, FUNCTION, "KeGetCurrentProcessType")
+    LOAD_IMPORT(XboxKrnl, 0x0067, FUNCTION, "KeGetPMWRegister")
+    LOAD_IMPORT(XboxKrnl, 0x0068, FUNCTION, "KeGetPRVRegister")
+    LOAD_IMPORT(XboxKrnl, 0x0069, FUNCTION, "KeGetSocRegister")
+    LOAD_IMPORT(XboxKrnl, 0x006A, FUNCTION, "KeGetSpecialPurposeRegister")
+    LOAD_IMPORT(XboxKrnl, 0x006B, FUNCTION, "KeLockL2")
+    LOAD_IMPORT(XboxKrnl, 0x006C, FUNCTION, "KeUnlockL2")
+    LOAD_IMPORT(XboxKrnl, 0x006D, FUNCTION, "KeInitializeApc")
+    LOAD_IMPORT(XboxKrnl, 0x006E, FUNCTION, "KeInitializeDeviceQueue")
+    LOAD_IMPORT(XboxKrnl, 0x006F, FUNCTION, "KeInitializeDpc")
+    LOAD_IMPORT(XboxKrnl, 0x0070, FUNCTION, "KeInitializeEvent")
+    LOAD_IMPORT(XboxKrnl, 0x0071, FUNCTION, "KeInitializeInterrupt")
+    LOAD_IMPORT(XboxKrnl, 0x0072, FUNCTION, "KeInitializeMutant")
+    LOAD_IMPORT(XboxKrnl, 0x0073, FUNCTION, "KeInitializeQueue")
+    LOAD_IMPORT(XboxKrnl, 0x0074, FUNCTION, "KeInitializeSemaphore")
+    LOAD_IMPORT(XboxKrnl, 0x0075, FUNCTION, "KeInitializeTimerEx")
+    LOAD_IMPORT(XboxKrnl, 0x0076, FUNCTION, "KeInsertByKeyDeviceQueue")
+    LOAD_IMPORT(XboxKrnl, 0x0077, FUNCTION, "KeInsertDeviceQueue")
+    LOAD_IMPORT(XboxKrnl, 0x0078, FUNCTION, "KeInsertHeadQueue")
+    LOAD_IMPORT(XboxKrnl, 0x0079, FUNCTION, "KeInsertQueue")
+    LOAD_IMPORT(XboxKrnl, 0x007A, FUNCTION, "KeInsertQueueApc")
+    LOAD_IMPORT(XboxKrnl, 0x007B, FUNCTION, "KeInsertQueueDpc")
+    LOAD_IMPORT(XboxKrnl, 0x007C, FUNCTION, "KeIpiGenericCall")
+    LOAD_IMPORT(XboxKrnl, 0x007D, FUNCTION, "KeLeaveCriticalRegion")
+    LOAD_IMPORT(XboxKrnl, 0x007E, FUNCTION, "KeLeaveUserMode")
+    LOAD_IMPORT(XboxKrnl, 0x007F, FUNCTION, "KePulseEvent")
+    LOAD_IMPORT(XboxKrnl, 0x0080, FUNCTION, "KeQueryBackgroundProcessors")
+    LOAD_IMPORT(XboxKrnl, 0x0081, FUNCTION, "KeQueryBasePriorityThread")
+    LOAD_IMPORT(XboxKrnl, 0x0082, FUNCTION, "KeQueryInterruptTime")
+    LOAD_IMPORT(XboxKrnl, 0x0083, FUNCTION, "KeQueryPerformanceFrequency")
+    LOAD_IMPORT(XboxKrnl, 0x0084, FUNCTION, "KeQuerySystemTime")
+    LOAD_IMPORT(XboxKrnl, 0x0085, FUNCTION, "KeRaiseIrqlToDpcLevel")
+    LOAD_IMPORT(XboxKrnl, 0x0086, FUNCTION, "KeRegisterDriverNotification")
+    LOAD_IMPORT(XboxKrnl, 0x0087, FUNCTION, "KeReleaseMutant")
+    LOAD_IMPORT(XboxKrnl, 0x0088, FUNCTION, "KeReleaseSemaphore")
+    LOAD_IMPORT(XboxKrnl, 0x0089, FUNCTION, "KeReleaseSpinLockFromRaisedIrql")
+    LOAD_IMPORT(XboxKrnl, 0x008A, FUNCTION, "KeRemoveByKeyDeviceQueue")
+    LOAD_IMPORT(XboxKrnl, 0x008B, FUNCTION, "KeRemoveDeviceQueue")
+    LOAD_IMPORT(XboxKrnl, 0x008C, FUNCTION, "KeRemoveEntryDeviceQueue")
+    LOAD_IMPORT(XboxKrnl, 0x008D, FUNCTION, "KeRemoveQueue")
+    LOAD_IMPORT(XboxKrnl, 0x008E, FUNCTION, "KeRemoveQueueDpc")
+    LOAD_IMPORT(XboxKrnl, 0x008F, FUNCTION, "KeResetEvent")
+    LOAD_IMPORT(XboxKrnl, 0x0090, FUNCTION, "KeRestoreFloatingPointState")
+    LOAD_IMPORT(XboxKrnl, 0x0091, FUNCTION, "KeRestoreVectorUnitState")
+    LOAD_IMPORT(XboxKrnl, 0x0092, FUNCTION, "KeResumeThread")
+    LOAD_IMPORT(XboxKrnl, 0x0093, FUNCTION, "KeRetireDpcList")
+    LOAD_IMPORT(XboxKrnl, 0x0094, FUNCTION, "KeRundownQueue")
+    LOAD_IMPORT(XboxKrnl, 0x0095, FUNCTION, "KeSaveFloatingPointState")
+    LOAD_IMPORT(XboxKrnl, 0x0096, FUNCTION, "KeSaveVectorUnitState")
+    LOAD_IMPORT(XboxKrnl, 0x0097, FUNCTION, "KeSetAffinityThread")
+    LOAD_IMPORT(XboxKrnl, 0x0098, FUNCTION, "KeSetBackgroundProcessors")
+    LOAD_IMPORT(XboxKrnl, 0x0099, FUNCTION, "KeSetBasePriorityThread")
+    LOAD_IMPORT(XboxKrnl, 0x009A, FUNCTION, "KeSetCurrentProcessType")
+    LOAD_IMPORT(XboxKrnl, 0x009B, FUNCTION, "KeSetCurrentStackPointers")
+    LOAD_IMPORT(XboxKrnl, 0x009C, FUNCTION, "KeSetDisableBoostThread")
+    LOAD_IMPORT(XboxKrnl, 0x009D, FUNCTION, "KeSetEvent")
+    LOAD_IMPORT(XboxKrnl, 0x009E, FUNCTION, "KeSetEventBoostPriority")
+    LOAD_IMPORT(XboxKrnl, 0x009F, FUNCTION, "KeSetPMWRegister")
+    LOAD_IMPORT(XboxKrnl, 0x00A0, FUNCTION, "KeSetPowerMode")
+    LOAD_IMPORT(XboxKrnl, 0x00A1, FUNCTION, "KeSetPRVRegister")
+    LOAD_IMPORT(XboxKrnl, 0x00A2, FUNCTION, "KeSetPriorityClassThread")
+    LOAD_IMPORT(XboxKrnl, 0x00A3, FUNCTION, "KeSetPriorityThread")
+    LOAD_IMPORT(XboxKrnl, 0x00A4, FUNCTION, "KeSetSocRegister")
+    LOAD_IMPORT(XboxKrnl, 0x00A5, FUNCTION, "KeSetSpecialPurposeRegister")
+    LOAD_IMPORT(XboxKrnl, 0x00A6, FUNCTION, "KeSetTimer")
+    LOAD_IMPORT(XboxKrnl, 0x00A7, FUNCTION, "KeSetTimerEx")
+    LOAD_IMPORT(XboxKrnl, 0x00A8, FUNCTION, "KeStallExecutionProcessor")
+    LOAD_IMPORT(XboxKrnl, 0x00A9, FUNCTION, "KeSuspendThread")
+    LOAD_IMPORT(XboxKrnl, 0x00AA, FUNCTION, "KeSweepDcacheRange")
+    LOAD_IMPORT(XboxKrnl, 0x00AB, FUNCTION, "KeSweepIcacheRange")
+    LOAD_IMPORT(XboxKrnl, 0x00AC, FUNCTION, "KeTestAlertThread")
+    LOAD_IMPORT(XboxKrnl, 0x00AD, VARIABLE, "KeTimeStampBundle")
+    LOAD_IMPORT(XboxKrnl, 0x00AE, FUNCTION, "KeTryToAcquireSpinLockAtRaisedIrql")
+    LOAD_IMPORT(XboxKrnl, 0x00AF, FUNCTION, "KeWaitForMultipleObjects")
+    LOAD_IMPORT(XboxKrnl, 0x00B0, FUNCTION, "KeWaitForSingleObject")
+    LOAD_IMPORT(XboxKrnl, 0x00B1, FUNCTION, "KfAcquireSpinLock")
+    LOAD_IMPORT(XboxKrnl, 0x00B2, FUNCTION, "KfRaiseIrql")
+    LOAD_IMPORT(XboxKrnl, 0x00B3, FUNCTION, "KfLowerIrql")
+    LOAD_IMPORT(XboxKrnl, 0x00B4, FUNCTION, "KfReleaseSpinLock")
+    LOAD_IMPORT(XboxKrnl, 0x00B5, VARIABLE, "KiBugCheckData")
+    LOAD_IMPORT(XboxKrnl, 0x00B6, FUNCTION, "LDICreateDecompression")
+    LOAD_IMPORT(XboxKrnl, 0x00B7, FUNCTION, "LDIDecompress")
+    LOAD_IMPORT(XboxKrnl, 0x00B8, FUNCTION, "LDIDestroyDecompression")
+    LOAD_IMPORT(XboxKrnl, 0x00B9, FUNCTION, "MmAllocatePhysicalMemory")
+    LOAD_IMPORT(XboxKrnl, 0x00BA, FUNCTION, "MmAllocatePhysicalMemoryEx")
+    LOAD_IMPORT(XboxKrnl, 0x00BB, FUNCTION, "MmCreateKernelStack")
+    LOAD_IMPORT(XboxKrnl, 0x00BC, FUNCTION, "MmDeleteKernelStack")
+    LOAD_IMPORT(XboxKrnl, 0x00BD, FUNCTION, "MmFreePhysicalMemory")
+    LOAD_IMPORT(XboxKrnl, 0x00BE, FUNCTION, "MmGetPhysicalAddress")
+    LOAD_IMPORT(XboxKrnl, 0x00BF, FUNCTION, "MmIsAddressValid")
+    LOAD_IMPORT(XboxKrnl, 0x00C0, FUNCTION, "MmLockAndMapSegmentArray")
+    LOAD_IMPORT(XboxKrnl, 0x00C1, FUNCTION, "MmLockUnlockBufferPages")
+    LOAD_IMPORT(XboxKrnl, 0x00C2, FUNCTION, "MmMapIoSpace")
+    LOAD_IMPORT(XboxKrnl, 0x00C3, FUNCTION, "MmPersistPhysicalMemoryAllocation")
+    LOAD_IMPORT(XboxKrnl, 0x00C4, FUNCTION, "MmQueryAddressProtect")
+    LOAD_IMPORT(XboxKrnl, 0x00C5, FUNCTION, "MmQueryAllocationSize")
+    LOAD_IMPORT(XboxKrnl, 0x00C6, FUNCTION, "MmQueryStatistics")
+    LOAD_IMPORT(XboxKrnl, 0x00C7, FUNCTION, "MmSetAddressProtect")
+    LOAD_IMPORT(XboxKrnl, 0x00C8, FUNCTION, "MmSplitPhysicalMemoryAllocation")
+    LOAD_IMPORT(XboxKrnl, 0x00C9, FUNCTION, "MmUnlockAndUnmapSegmentArray")
+    LOAD_IMPORT(XboxKrnl, 0x00CA, FUNCTION, "MmUnmapIoSpace")
+    LOAD_IMPORT(XboxKrnl, 0x00CB, VARIABLE, "Nls844UnicodeCaseTable")
+    LOAD_IMPORT(XboxKrnl, 0x00CC, FUNCTION, "NtAllocateVirtualMemory")
+    LOAD_IMPORT(XboxKrnl, 0x00CD, FUNCTION, "NtCancelTimer")
+    LOAD_IMPORT(XboxKrnl, 0x00CE, FUNCTION, "NtClearEvent")
+    LOAD_IMPORT(XboxKrnl, 0x00CF, FUNCTION, "NtClose")
+    LOAD_IMPORT(XboxKrnl, 0x00D0, FUNCTION, "NtCreateDirectoryObject")
+    LOAD_IMPORT(XboxKrnl, 0x00D1, FUNCTION, "NtCreateEvent")
+    LOAD_IMPORT(XboxKrnl, 0x00D2, FUNCTION, "NtCreateFile")
+    LOAD_IMPORT(XboxKrnl, 0x00D3, FUNCTION, "NtCreateIoCompletion")
+    LOAD_IMPORT(XboxKrnl, 0x00D4, FUNCTION, "NtCreateMutant")
+    LOAD_IMPORT(XboxKrnl, 0x00D5, FUNCTION, "NtCreateSemaphore")
+    LOAD_IMPORT(XboxKrnl, 0x00D6, FUNCTION, "NtCreateSymbolicLinkObject")
+    LOAD_IMPORT(XboxKrnl, 0x00D7, FUNCTION, "NtCreateTimer")
+    LOAD_IMPORT(XboxKrnl, 0x00D8, FUNCTION, "NtDeleteFile")
+    LOAD_IMPORT(XboxKrnl, 0x00D9, FUNCTION, "NtDeviceIoControlFile")
+    LOAD_IMPORT(XboxKrnl, 0x00DA, FUNCTION, "NtDuplicateObject")
+    LOAD_IMPORT(XboxKrnl, 0x00DB, FUNCTION, "NtFlushBuffersFile")
+    LOAD_IMPORT(XboxKrnl, 0x00DC, FUNCTION, "NtFreeVirtualMemory")
+    LOAD_IMPORT(XboxKrnl, 0x00DD, FUNCTION, "NtMakeTemporaryObject")
+    LOAD_IMPORT(XboxKrnl, 0x00DE, FUNCTION, "NtOpenDirectoryObject")
+    LOAD_IMPORT(XboxKrnl, 0x00DF, FUNCTION, "NtOpenFile")
+    LOAD_IMPORT(XboxKrnl, 0x00E0, FUNCTION, "NtOpenSymbolicLinkObject")
+    LOAD_IMPORT(XboxKrnl, 0x00E1, FUNCTION, "NtProtectVirtualMemory")
+    LOAD_IMPORT(XboxKrnl, 0x00E2, FUNCTION, "NtPulseEvent")
+    LOAD_IMPORT(XboxKrnl, 0x00E3, FUNCTION, "NtQueueApcThread")
+    LOAD_IMPORT(XboxKrnl, 0x00E4, FUNCTION, "NtQueryDirectoryFile")
+    LOAD_IMPORT(XboxKrnl, 0x00E5, FUNCTION, "NtQueryDirectoryObject")
+    LOAD_IMPORT(XboxKrnl, 0x00E6, FUNCTION, "NtQueryEvent")
+    LOAD_IMPORT(XboxKrnl, 0x00E7, FUNCTION, "NtQueryFullAttributesFile")
+    LOAD_IMPORT(XboxKrnl, 0x00E8, FUNCTION, "NtQueryInformationFile")
+    LOAD_IMPORT(XboxKrnl, 0x00E9, FUNCTION, "NtQueryIoCompletion")
+    LOAD_IMPORT(XboxKrnl, 0x00EA, FUNCTION, "NtQueryMutant")
+    LOAD_IMPORT(XboxKrnl, 0x00EB, FUNCTION, "NtQuerySemaphore")
+    LOAD_IMPORT(XboxKrnl, 0x00EC, FUNCTION, "NtQuerySymbolicLinkObject")
+    LOAD_IMPORT(XboxKrnl, 0x00ED, FUNCTION, "NtQueryTimer")
+    LOAD_IMPORT(XboxKrnl, 0x00EE, FUNCTION, "NtQueryVirtualMemory")
+    LOAD_IMPORT(XboxKrnl, 0x00EF, FUNCTION, "NtQueryVolumeInformationFile")
+    LOAD_IMPORT(XboxKrnl, 0x00F0, FUNCTION, "NtReadFile")
+    LOAD_IMPORT(XboxKrnl, 0x00F1, FUNCTION, "NtReadFileScatter")
+    LOAD_IMPORT(XboxKrnl, 0x00F2, FUNCTION, "NtReleaseMutant")
+    LOAD_IMPORT(XboxKrnl, 0x00F3, FUNCTION, "NtReleaseSemaphore")
+    LOAD_IMPORT(XboxKrnl, 0x00F4, FUNCTION, "NtRemoveIoCompletion")
+    LOAD_IMPORT(XboxKrnl, 0x00F5, FUNCTION, "NtResumeThread")
+    LOAD_IMPORT(XboxKrnl, 0x00F6, FUNCTION, "NtSetEvent")
+    LOAD_IMPORT(XboxKrnl, 0x00F7, FUNCTION, "NtSetInformationFile")
+    LOAD_IMPORT(XboxKrnl, 0x00F8, FUNCTION, "NtSetIoCompletion")
+    LOAD_IMPORT(XboxKrnl, 0x00F9, FUNCTION, "NtSetSystemTime")
+    LOAD_IMPORT(XboxKrnl, 0x00FA, FUNCTION, "NtSetTimerEx")
+    LOAD_IMPORT(XboxKrnl, 0x00FB, FUNCTION, "NtSignalAndWaitForSingleObjectEx")
+    LOAD_IMPORT(XboxKrnl, 0x00FC, FUNCTION, "NtSuspendThread")
+    LOAD_IMPORT(XboxKrnl, 0x00FD, FUNCTION, "NtWaitForSingleObjectEx")
+    LOAD_IMPORT(XboxKrnl, 0x00FE, FUNCTION, "NtWaitForMultipleObjectsEx")
+    LOAD_IMPORT(XboxKrnl, 0x00FF, FUNCTION, "NtWriteFile")
+    LOAD_IMPORT(XboxKrnl, 0x0100, FUNCTION, "NtWriteFileGather")
+    LOAD_IMPORT(XboxKrnl, 0x0101, FUNCTION, "NtYieldExecution")
+    LOAD_IMPORT(XboxKrnl, 0x0102, FUNCTION, "ObCreateObject")
+    LOAD_IMPORT(XboxKrnl, 0x0103, FUNCTION, "ObCreateSymbolicLink")
+    LOAD_IMPORT(XboxKrnl, 0x0104, FUNCTION, "ObDeleteSymbolicLink")
+    LOAD_IMPORT(XboxKrnl, 0x0105, FUNCTION, "ObDereferenceObject")
+    LOAD_IMPORT(XboxKrnl, 0x0106, FUNCTION, "ObDirectoryObjectType")
+    LOAD_IMPORT(XboxKrnl, 0x0107, FUNCTION, "ObGetWaitableObject")
+    LOAD_IMPORT(XboxKrnl, 0x0108, FUNCTION, "ObInsertObject")
+    LOAD_IMPORT(XboxKrnl, 0x0109, FUNCTION, "ObIsTitleObject")
+    LOAD_IMPORT(XboxKrnl, 0x010A, FUNCTION, "ObLookupAnyThreadByThreadId")
+    LOAD_IMPORT(XboxKrnl, 0x010B, FUNCTION, "ObLookupThreadByThreadId")
+    LOAD_IMPORT(XboxKrnl, 0x010C, FUNCTION, "ObMakeTemporaryObject")
+    LOAD_IMPORT(XboxKrnl, 0x010D, FUNCTION, "ObOpenObjectByName")
+    LOAD_IMPORT(XboxKrnl, 0x010E, FUNCTION, "ObOpenObjectByPointer")
+    LOAD_IMPORT(XboxKrnl, 0x010F, FUNCTION, "ObReferenceObject")
+    LOAD_IMPORT(XboxKrnl, 0x0110, FUNCTION, "ObReferenceObjectByHandle")
+    LOAD_IMPORT(XboxKrnl, 0x0111, FUNCTION, "ObReferenceObjectByName")
+    LOAD_IMPORT(XboxKrnl, 0x0112, FUNCTION, "ObSymbolicLinkObjectType")
+    LOAD_IMPORT(XboxKrnl, 0x0113, FUNCTION, "ObTranslateSymbolicLink")
+    LOAD_IMPORT(XboxKrnl, 0x0114, FUNCTION, "RtlAnsiStringToUnicodeString")
+    LOAD_IMPORT(XboxKrnl, 0x0115, FUNCTION, "RtlAppendStringToString")
+    LOAD_IMPORT(XboxKrnl, 0x0116, FUNCTION, "RtlAppendUnicodeStringToString")
+    LOAD_IMPORT(XboxKrnl, 0x0117, FUNCTION, "RtlAppendUnicodeToString")
+    LOAD_IMPORT(XboxKrnl, 0x0118, FUNCTION, "RtlAssert")
+    LOAD_IMPORT(XboxKrnl, 0x0119, FUNCTION, "RtlCaptureContext")
+    LOAD_IMPORT(XboxKrnl, 0x011A, FUNCTION, "RtlCompareMemory")
+    LOAD_IMPORT(XboxKrnl, 0x011B, FUNCTION, "RtlCompareMemoryUlong")
+    LOAD_IMPORT(XboxKrnl, 0x011C, FUNCTION, "RtlCompareString")
+    LOAD_IMPORT(XboxKrnl, 0x011D, FUNCTION, "RtlCompareStringN")
+    LOAD_IMPORT(XboxKrnl, 0x011E, FUNCTION, "RtlCompareUnicodeString")
+    LOAD_IMPORT(XboxKrnl, 0x011F, FUNCTION, "RtlCompareUnicodeStringN")
+    LOAD_IMPORT(XboxKrnl, 0x0120, FUNCTION, "RtlCompareUtf8ToUnicode")
+    LOAD_IMPORT(XboxKrnl, 0x0121, FUNCTION, "RtlCopyString")
+    LOAD_IMPORT(XboxKrnl, 0x0122, FUNCTION, "RtlCopyUnicodeString")
+    LOAD_IMPORT(XboxKrnl, 0x0123, FUNCTION, "RtlCreateUnicodeString")
+    LOAD_IMPORT(XboxKrnl, 0x0124, FUNCTION, "RtlDowncaseUnicodeChar")
+    LOAD_IMPORT(XboxKrnl, 0x0125, FUNCTION, "RtlEnterCriticalSection")
+    LOAD_IMPORT(XboxKrnl, 0x0126, FUNCTION, "RtlFillMemoryUlong")
+    LOAD_IMPORT(XboxKrnl, 0x0127, FUNCTION, "RtlFreeAnsiString")
+    LOAD_IMPORT(XboxKrnl, 0x0128, FUNCTION, "RtlFreeAnsiString")
+    LOAD_IMPORT(XboxKrnl, 0x0129, FUNCTION, "RtlGetCallersAddress")
+    LOAD_IMPORT(XboxKrnl, 0x012A, FUNCTION, "RtlGetStackLimits")
+    LOAD_IMPORT(XboxKrnl, 0x012B, FUNCTION, "RtlImageXexHeaderField")
+    LOAD_IMPORT(XboxKrnl, 0x012C, FUNCTION, "RtlInitAnsiString")
+    LOAD_IMPORT(XboxKrnl, 0x012D, FUNCTION, "RtlInitUnicodeString")
+    LOAD_IMPORT(XboxKrnl, 0x012E, FUNCTION, "RtlInitializeCriticalSection")
+    LOAD_IMPORT(XboxKrnl, 0x012F, FUNCTION, "RtlInitializeCriticalSectionAndSpinCount")
+    LOAD_IMPORT(XboxKrnl, 0x0130, FUNCTION, "RtlLeaveCriticalSection")
+    LOAD_IMPORT(XboxKrnl, 0x0131, FUNCTION, "RtlLookupFunctionEntry")
+    LOAD_IMPORT(XboxKrnl, 0x0132, FUNCTION, "RtlLowerChar")
+    LOAD_IMPORT(XboxKrnl, 0x0133, FUNCTION, "RtlMultiByteToUnicodeN")
+    LOAD_IMPORT(XboxKrnl, 0x0134, FUNCTION, "RtlMultiByteToUnicodeSize")
+    LOAD_IMPORT(XboxKrnl, 0x0135, FUNCTION, "RtlNtStatusToDosError")
+    LOAD_IMPORT(XboxKrnl, 0x0136, FUNCTION, "RtlRaiseException")
+    LOAD_IMPORT(XboxKrnl, 0x0137, FUNCTION, "RtlRaiseStatus")
+    LOAD_IMPORT(XboxKrnl, 0x0138, FUNCTION, "RtlRip")
+    LOAD_IMPORT(XboxKrnl, 0x0139, FUNCTION, "_scprintf")
+    LOAD_IMPORT(XboxKrnl, 0x013A, FUNCTION, "_snprintf")
+    LOAD_IMPORT(XboxKrnl, 0x013B, FUNCTION, "sprintf")
+    LOAD_IMPORT(XboxKrnl, 0x013C, FUNCTION, "_scwprintf")
+    LOAD_IMPORT(XboxKrnl, 0x013D, FUNCTION, "_snwprintf")
+    LOAD_IMPORT(XboxKrnl, 0x013E, FUNCTION, "_swprintf")
+    LOAD_IMPORT(XboxKrnl, 0x013F, FUNCTION, "RtlTimeFieldsToTime")
+    LOAD_IMPORT(XboxKrnl, 0x0140, FUNCTION, "RtlTimeToTimeFields")
+    LOAD_IMPORT(XboxKrnl, 0x0141, FUNCTION, "RtlTryEnterCriticalSection")
+    LOAD_IMPORT(XboxKrnl, 0x0142, FUNCTION, "RtlUnicodeStringToAnsiString")
+    LOAD_IMPORT(XboxKrnl, 0x0143, FUNCTION, "RtlUnicodeToMultiByteN")
+    LOAD_IMPORT(XboxKrnl, 0x0144, FUNCTION, "RtlUnicodeToMultiByteSize")
+    LOAD_IMPORT(XboxKrnl, 0x0145, FUNCTION, "RtlUnicodeToUtf8")
+    LOAD_IMPORT(XboxKrnl, 0x0146, FUNCTION, "RtlUnicodeToUtf8Size")
+    LOAD_IMPORT(XboxKrnl, 0x0147, FUNCTION, "RtlUnwind")
+    LOAD_IMPORT(XboxKrnl, 0x0148, FUNCTION, "RtlUnwind2")
+    LOAD_IMPORT(XboxKrnl, 0x0149, FUNCTION, "RtlUpcaseUnicodeChar")
+    LOAD_IMPORT(XboxKrnl, 0x014A, FUNCTION, "RtlUpperChar")
+    LOAD_IMPORT(XboxKrnl, 0x014B, FUNCTION, "RtlVirtualUnwind")
+    LOAD_IMPORT(XboxKrnl, 0x014C, FUNCTION, "_vscprintf")
+    LOAD_IMPORT(XboxKrnl, 0x014D, FUNCTION, "_vsnprintf")
+    LOAD_IMPORT(XboxKrnl, 0x014E, FUNCTION, "vsprintf")
+    LOAD_IMPORT(XboxKrnl, 0x014F, FUNCTION, "_vscwprintf")
+    LOAD_IMPORT(XboxKrnl, 0x0150, FUNCTION, "_vsnwprintf")
+    LOAD_IMPORT(XboxKrnl, 0x0151, FUNCTION, "_vswprintf")
+    LOAD_IMPORT(XboxKrnl, 0x0152, FUNCTION, "KeTlsAlloc")
+    LOAD_IMPORT(XboxKrnl, 0x0153, FUNCTION, "KeTlsFree")
+    LOAD_IMPORT(XboxKrnl, 0x0154, FUNCTION, "KeTlsGetValue")
+    LOAD_IMPORT(XboxKrnl, 0x0155, FUNCTION, "KeTlsSetValue")
+    LOAD_IMPORT(XboxKrnl, 0x0156, VARIABLE, "XboxHardwareInfo")
+    LOAD_IMPORT(XboxKrnl, 0x0157, VARIABLE, "XboxKrnlBaseVersion")
+    LOAD_IMPORT(XboxKrnl, 0x0158, VARIABLE, "XboxKrnlVersion")
+    LOAD_IMPORT(XboxKrnl, 0x0159, FUNCTION, "XeCryptAesKey")
+    LOAD_IMPORT(XboxKrnl, 0x015A, FUNCTION, "XeCryptAesEcb")
+    LOAD_IMPORT(XboxKrnl, 0x015B, FUNCTION, "XeCryptAesCbc")
+    LOAD_IMPORT(XboxKrnl, 0x015C, FUNCTION, "XeCryptBnDwLeDhEqualBase")
+    LOAD_IMPORT(XboxKrnl, 0x015D, FUNCTION, "XeCryptBnDwLeDhInvalBase")
+    LOAD_IMPORT(XboxKrnl, 0x015E, FUNCTION, "XeCryptBnDwLeDhModExp")
+    LOAD_IMPORT(XboxKrnl, 0x015F, FUNCTION, "XeCryptBnDw_Copy")
+    LOAD_IMPORT(XboxKrnl, 0x0160, FUNCTION, "XeCryptBnDw_SwapLeBe")
+    LOAD_IMPORT(XboxKrnl, 0x0161, FUNCTION, "XeCryptBnDw_Zero")
+    LOAD_IMPORT(XboxKrnl, 0x0162, FUNCTION, "XeCryptBnDwLePkcs1Format")
+    LOAD_IMPORT(XboxKrnl, 0x0163, FUNCTION, "XeCryptBnDwLePkcs1Verify")
+    LOAD_IMPORT(XboxKrnl, 0x0164, FUNCTION, "XeCryptBnQwBeSigCreate")
+    LOAD_IMPORT(XboxKrnl, 0x0165, FUNCTION, "XeCryptBnQwBeSigFormat")
+    LOAD_IMPORT(XboxKrnl, 0x0166, FUNCTION, "XeCryptBnQwBeSigVerify")
+    LOAD_IMPORT(XboxKrnl, 0x0167, FUNCTION, "XeCryptBnQwNeModExp")
+    LOAD_IMPORT(XboxKrnl, 0x0168, FUNCTION, "XeCryptBnQwNeModExpRoot")
+    LOAD_IMPORT(XboxKrnl, 0x0169, FUNCTION, "XeCryptBnQwNeModInv")
+    LOAD_IMPORT(XboxKrnl, 0x016A, FUNCTION, "XeCryptBnQwNeModMul")
+    LOAD_IMPORT(XboxKrnl, 0x016B, FUNCTION, "XeCryptBnQwNeRsaKeyGen")
+    LOAD_IMPORT(XboxKrnl, 0x016C, FUNCTION, "XeCryptBnQwNeRsaPrvCrypt")
+    LOAD_IMPORT(XboxKrnl, 0x016D, FUNCTION, "XeCryptBnQwNeRsaPubCrypt")
+    LOAD_IMPORT(XboxKrnl, 0x016E, FUNCTION, "XeCryptBnQw_Copy")
+    LOAD_IMPORT(XboxKrnl, 0x016F, FUNCTION, "XeCryptBnQw_SwapDwQw")
+    LOAD_IMPORT(XboxKrnl, 0x0170, FUNCTION, "XeCryptBnQw_SwapDwQwLeBe")
+    LOAD_IMPORT(XboxKrnl, 0x0171, FUNCTION, "XeCryptBnQw_SwapLeBe")
+    LOAD_IMPORT(XboxKrnl, 0x0172, FUNCTION, "XeCryptBnQw_Zero")
+    LOAD_IMPORT(XboxKrnl, 0x0173, FUNCTION, "XeCryptChainAndSumMac")
+    LOAD_IMPORT(XboxKrnl, 0x0174, FUNCTION, "XeCryptDesParity")
+    LOAD_IMPORT(XboxKrnl, 0x0175, FUNCTION, "XeCryptDesKey")
+    LOAD_IMPORT(XboxKrnl, 0x0176, FUNCTION, "XeCryptDesEcb")
+    LOAD_IMPORT(XboxKrnl, 0x0177, FUNCTION, "XeCryptDesCbc")
+    LOAD_IMPORT(XboxKrnl, 0x0178, FUNCTION, "XeCryptDes3Key")
+    LOAD_IMPORT(XboxKrnl, 0x0179, FUNCTION, "XeCryptDes3Ecb")
+    LOAD_IMPORT(XboxKrnl, 0x017A, FUNCTION, "XeCryptDes3Cbc")
+    LOAD_IMPORT(XboxKrnl, 0x017B, FUNCTION, "XeCryptHmacMd5Init")
+    LOAD_IMPORT(XboxKrnl, 0x017C, FUNCTION, "XeCryptHmacMd5Update")
+    LOAD_IMPORT(XboxKrnl, 0x017D, FUNCTION, "XeCryptHmacMd5Final")
+    LOAD_IMPORT(XboxKrnl, 0x017E, FUNCTION, "XeCryptHmacMd5")
+    LOAD_IMPORT(XboxKrnl, 0x017F, FUNCTION, "XeCryptHmacShaInit")
+    LOAD_IMPORT(XboxKrnl, 0x0180, FUNCTION, "XeCryptHmacShaUpdate")
+    LOAD_IMPORT(XboxKrnl, 0x0181, FUNCTION, "XeCryptHmacShaFinal")
+    LOAD_IMPORT(XboxKrnl, 0x0182, FUNCTION, "XeCryptHmacSha")
+    LOAD_IMPORT(XboxKrnl, 0x0183, FUNCTION, "XeCryptHmacShaVerify")
+    LOAD_IMPORT(XboxKrnl, 0x0184, FUNCTION, "XeCryptMd5Init")
+    LOAD_IMPORT(XboxKrnl, 0x0185, FUNCTION, "XeCryptMd5Update")
+    LOAD_IMPORT(XboxKrnl, 0x0186, FUNCTION, "XeCryptMd5Final")
+    LOAD_IMPORT(XboxKrnl, 0x0187, FUNCTION, "XeCryptMd5")
+    LOAD_IMPORT(XboxKrnl, 0x0188, FUNCTION, "XeCryptParveEcb")
+    LOAD_IMPORT(XboxKrnl, 0x0189, FUNCTION, "XeCryptParveCbcMac")
+    LOAD_IMPORT(XboxKrnl, 0x018A, FUNCTION, "XeCryptRandom")
+    LOAD_IMPORT(XboxKrnl, 0x018B, FUNCTION, "XeCryptRc4Key")
+    LOAD_IMPORT(XboxKrnl, 0x018C, FUNCTION, "XeCryptRc4Ecb")
+    LOAD_IMPORT(XboxKrnl, 0x018D, FUNCTION, "XeCryptRc4")
+    LOAD_IMPORT(XboxKrnl, 0x018E, FUNCTION, "XeCryptRotSumSha")
+    LOAD_IMPORT(XboxKrnl, 0x018F, FUNCTION, "XeCryptShaInit")
+    LOAD_IMPORT(XboxKrnl, 0x0190, FUNCTION, "XeCryptShaUpdate")
+    LOAD_IMPORT(XboxKrnl, 0x0191, FUNCTION, "XeCryptShaFinal")
+    LOAD_IMPORT(XboxKrnl, 0x0192, FUNCTION, "XeCryptSha")
+    LOAD_IMPORT(XboxKrnl, 0x0193, VARIABLE, "XexExecutableModuleHandle")
+    LOAD_IMPORT(XboxKrnl, 0x0194, FUNCTION, "XexCheckExecutablePrivilege")
+    LOAD_IMPORT(XboxKrnl, 0x0195, FUNCTION, "XexGetModuleHandle")
+    LOAD_IMPORT(XboxKrnl, 0x0196, FUNCTION, "XexGetModuleSection")
+    LOAD_IMPORT(XboxKrnl, 0x0197, FUNCTION, "XexGetProcedureAddress")
+    LOAD_IMPORT(XboxKrnl, 0x0198, FUNCTION, "XexLoadExecutable")
+    LOAD_IMPORT(XboxKrnl, 0x0199, FUNCTION, "XexLoadImage")
+    LOAD_IMPORT(XboxKrnl, 0x019A, FUNCTION, "XexLoadImageFromMemory")
+    LOAD_IMPORT(XboxKrnl, 0x019B, FUNCTION, "XexLoadImageHeaders")
+    LOAD_IMPORT(XboxKrnl, 0x019C, FUNCTION, "XexPcToFileHeader")
+    LOAD_IMPORT(XboxKrnl, 0x019D, FUNCTION, "KiApcNormalRoutineNop")
+    LOAD_IMPORT(XboxKrnl, 0x019E, FUNCTION, "XexRegisterPatchDescriptor")
+    LOAD_IMPORT(XboxKrnl, 0x019F, FUNCTION, "XexSendDeferredNotifications")
+    LOAD_IMPORT(XboxKrnl, 0x01A0, FUNCTION, "XexStartExecutable")
+    LOAD_IMPORT(XboxKrnl, 0x01A1, FUNCTION, "XexUnloadImage")
+    LOAD_IMPORT(XboxKrnl, 0x01A2, FUNCTION, "XexUnloadImageAndExitThread")
+    LOAD_IMPORT(XboxKrnl, 0x01A3, FUNCTION, "XexUnloadTitleModules")
+    LOAD_IMPORT(XboxKrnl, 0x01A4, FUNCTION, "XexVerifyImageHeaders")
+    LOAD_IMPORT(XboxKrnl, 0x01A5, FUNCTION, "__C_specific_handler")
+    LOAD_IMPORT(XboxKrnl, 0x01A6, FUNCTION, "DbgLoadImageSymbols")
+    LOAD_IMPORT(XboxKrnl, 0x01A7, FUNCTION, "DbgUnLoadImageSymbols")
+    LOAD_IMPORT(XboxKrnl, 0x01A8, FUNCTION, "RtlImageDirectoryEntryToData")
+    LOAD_IMPORT(XboxKrnl, 0x01A9, FUNCTION, "RtlImageNtHeader")
+    LOAD_IMPORT(XboxKrnl, 0x01AA, FUNCTION, "ExDebugMonitorService")
+    LOAD_IMPORT(XboxKrnl, 0x01AB, FUNCTION, "MmDbgReadCheck")
+    LOAD_IMPORT(XboxKrnl, 0x01AC, FUNCTION, "MmDbgReleaseAddress")
+    LOAD_IMPORT(XboxKrnl, 0x01AD, FUNCTION, "MmDbgWriteCheck")
+    LOAD_IMPORT(XboxKrnl, 0x01AE, VARIABLE, "ExLoadedCommandLine")
+    LOAD_IMPORT(XboxKrnl, 0x01AF, VARIABLE, "ExLoadedImageName")
+    LOAD_IMPORT(XboxKrnl, 0x01B0, FUNCTION, "VdBlockUntilGUIIdle")
+    LOAD_IMPORT(XboxKrnl, 0x01B1, FUNCTION, "VdCallGraphicsNotificationRoutines")
+    LOAD_IMPORT(XboxKrnl, 0x01B2, FUNCTION, "VdDisplayFatalError")
+    LOAD_IMPORT(XboxKrnl, 0x01B3, FUNCTION, "VdEnableClosedCaption")
+    LOAD_IMPORT(XboxKrnl, 0x01B4, FUNCTION, "VdEnableDisableClockGating")
+    LOAD_IMPORT(XboxKrnl, 0x01B5, FUNCTION, "VdEnableDisablePowerSavingMode")
+    LOAD_IMPORT(XboxKrnl, 0x01B6, FUNCTION, "VdEnableRingBufferRPtrWriteBack")
+    LOAD_IMPORT(XboxKrnl, 0x01B7, FUNCTION, "VdGenerateGPUCSCCoefficients")
+    LOAD_IMPORT(XboxKrnl, 0x01B8, FUNCTION, "VdGetClosedCaptionReadyStatus")
+    LOAD_IMPORT(XboxKrnl, 0x01B9, FUNCTION, "VdGetCurrentDisplayGamma")
+    LOAD_IMPORT(XboxKrnl, 0x01BA, FUNCTION, "VdGetCurrentDisplayInformation")
+    LOAD_IMPORT(XboxKrnl, 0x01BB, FUNCTION, "VdGetDisplayModeOverride")
+    LOAD_IMPORT(XboxKrnl, 0x01BC, FUNCTION, "VdGetGraphicsAsicID")
+    LOAD_IMPORT(XboxKrnl, 0x01BD, FUNCTION, "VdGetSystemCommandBuffer")
+    LOAD_IMPORT(XboxKrnl, 0x01BE, VARIABLE, "VdGlobalDevice")
+    LOAD_IMPORT(XboxKrnl, 0x01BF, VARIABLE, "VdGlobalXamDevice")
+    LOAD_IMPORT(XboxKrnl, 0x01C0, VARIABLE, "VdGpuClockInMHz")
+    LOAD_IMPORT(XboxKrnl, 0x01C1, VARIABLE, "VdHSIOCalibrationLock")
+    LOAD_IMPORT(XboxKrnl, 0x01C2, FUNCTION, "VdInitializeEngines")
+    LOAD_IMPORT(XboxKrnl, 0x01C3, FUNCTION, "VdInitializeRingBuffer")
+    LOAD_IMPORT(XboxKrnl, 0x01C4, FUNCTION, "VdInitializeScaler")
+    LOAD_IMPORT(XboxKrnl, 0x01C5, FUNCTION, "VdInitializeScalerCommandBuffer")
+    LOAD_IMPORT(XboxKrnl, 0x01C6, FUNCTION, "VdIsHSIOTrainingSucceeded")
+    LOAD_IMPORT(XboxKrnl, 0x01C7, FUNCTION, "VdPersistDisplay")
+    LOAD_IMPORT(XboxKrnl, 0x01C8, FUNCTION, "VdQuerySystemCommandBuffer")
+    LOAD_IMPORT(XboxKrnl, 0x01C9, FUNCTION, "VdQueryVideoFlags")
+    LOAD_IMPORT(XboxKrnl, 0x01CA, FUNCTION, "VdQueryVideoMode")
+    LOAD_IMPORT(XboxKrnl, 0x01CB, FUNCTION, "VdReadDVERegisterUlong")
+    LOAD_IMPORT(XboxKrnl, 0x01CC, FUNCTION, "VdReadWriteHSIOCalibrationFlag")
+    LOAD_IMPORT(XboxKrnl, 0x01CD, FUNCTION, "VdRegisterGraphicsNotification")
+    LOAD_IMPORT(XboxKrnl, 0x01CE, FUNCTION, "VdRegisterXamGraphicsNotification")
+    LOAD_IMPORT(XboxKrnl, 0x01CF, FUNCTION, "VdSendClosedCaptionData")
+    LOAD_IMPORT(XboxKrnl, 0x01D0, FUNCTION, "VdSetCGMSOption")
+    LOAD_IMPORT(XboxKrnl, 0x01D1, FUNCTION, "VdSetColorProfileAdjustment")
+    LOAD_IMPORT(XboxKrnl, 0x01D2, FUNCTION, "VdSetCscMatricesOverride")
+    LOAD_IMPORT(XboxKrnl, 0x01D3, FUNCTION, "VdSetDisplayMode")
+    LOAD_IMPORT(XboxKrnl, 0x01D4, FUNCTION, "VdSetDisplayModeOverride")
+    LOAD_IMPORT(XboxKrnl, 0x01D5, FUNCTION, "VdSetGraphicsInterruptCallback")
+    LOAD_IMPORT(XboxKrnl, 0x01D6, FUNCTION, "VdSetHDCPOption")
+    LOAD_IMPORT(XboxKrnl, 0x01D7, FUNCTION, "VdSetMacrovisionOption")
+    LOAD_IMPORT(XboxKrnl, 0x01D8, FUNCTION, "VdSetSystemCommandBuffer")
+    LOAD_IMPORT(XboxKrnl, 0x01D9, FUNCTION, "VdSetSystemCommandBufferGpuIdentifierAddress")
+    LOAD_IMPORT(XboxKrnl, 0x01DA, FUNCTION, "VdSetWSSData")
+    LOAD_IMPORT(XboxKrnl, 0x01DB, FUNCTION, "VdSetWSSOption")
+    LOAD_IMPORT(XboxKrnl, 0x01DC, FUNCTION, "VdShutdownEngines")
+    LOAD_IMPORT(XboxKrnl, 0x01DD, FUNCTION, "VdTurnDisplayOff")
+    LOAD_IMPORT(XboxKrnl, 0x01DE, FUNCTION, "VdTurnDisplayOn")
+    LOAD_IMPORT(XboxKrnl, 0x01DF, FUNCTION, "KiApcNormalRoutineNop")
+    LOAD_IMPORT(XboxKrnl, 0x01E0, FUNCTION, "VdWriteDVERegisterUlong")
+    LOAD_IMPORT(XboxKrnl, 0x01E1, FUNCTION, "XVoicedHeadsetPresent")
+    LOAD_IMPORT(XboxKrnl, 0x01E2, FUNCTION, "XVoicedSubmitPacket")
+    LOAD_IMPORT(XboxKrnl, 0x01E3, FUNCTION, "XVoicedClose")
+    LOAD_IMPORT(XboxKrnl, 0x01E4, FUNCTION, "XVoicedActivate")
+    LOAD_IMPORT(XboxKrnl, 0x01E5, FUNCTION, "XInputdGetCapabilities")
+    LOAD_IMPORT(XboxKrnl, 0x01E6, FUNCTION, "XInputdReadState")
+    LOAD_IMPORT(XboxKrnl, 0x01E7, FUNCTION, "XInputdWriteState")
+    LOAD_IMPORT(XboxKrnl, 0x01E8, FUNCTION, "XInputdNotify")
+    LOAD_IMPORT(XboxKrnl, 0x01E9, FUNCTION, "XInputdRawState")
+    LOAD_IMPORT(XboxKrnl, 0x01EA, FUNCTION, "HidGetCapabilities")
+    LOAD_IMPORT(XboxKrnl, 0x01EB, FUNCTION, "HidReadKeys")
+    LOAD_IMPORT(XboxKrnl, 0x01EC, FUNCTION, "XInputdGetDeviceStats")
+    LOAD_IMPORT(XboxKrnl, 0x01ED, FUNCTION, "XInputdResetDevice")
+    LOAD_IMPORT(XboxKrnl, 0x01EE, FUNCTION, "XInputdSetRingOfLight")
+    LOAD_IMPORT(XboxKrnl, 0x01EF, FUNCTION, "XInputdSetRFPowerMode")
+    LOAD_IMPORT(XboxKrnl, 0x01F0, FUNCTION, "XInputdSetRadioFrequency")
+    LOAD_IMPORT(XboxKrnl, 0x01F1, FUNCTION, "HidGetLastInputTime")
+    LOAD_IMPORT(XboxKrnl, 0x01F2, FUNCTION, "XAudioRenderDriverInitialize")
+    LOAD_IMPORT(XboxKrnl, 0x01F3, FUNCTION, "XAudioRegisterRenderDriverClient")
+    LOAD_IMPORT(XboxKrnl, 0x01F4, FUNCTION, "XAudioUnregisterRenderDriverClient")
+    LOAD_IMPORT(XboxKrnl, 0x01F5, FUNCTION, "XAudioSubmitRenderDriverFrame")
+    LOAD_IMPORT(XboxKrnl, 0x01F6, FUNCTION, "XAudioRenderDriverLock")
+    LOAD_IMPORT(XboxKrnl, 0x01F7, FUNCTION, "XAudioGetVoiceCategoryVolumeChangeMask")
+    LOAD_IMPORT(XboxKrnl, 0x01F8, FUNCTION, "XAudioGetVoiceCategoryVolume")
+    LOAD_IMPORT(XboxKrnl, 0x01F9, FUNCTION, "XAudioSetVoiceCategoryVolume")
+    LOAD_IMPORT(XboxKrnl, 0x01FA, FUNCTION, "XAudioBeginDigitalBypassMode")
+    LOAD_IMPORT(XboxKrnl, 0x01FB, FUNCTION, "XAudioEndDigitalBypassMode")
+    LOAD_IMPORT(XboxKrnl, 0x01FC, FUNCTION, "XAudioSubmitDigitalPacket")
+    LOAD_IMPORT(XboxKrnl, 0x01FD, FUNCTION, "XAudioQueryDriverPerformance")
+    LOAD_IMPORT(XboxKrnl, 0x01FE, FUNCTION, "XAudioGetRenderDriverThread")
+    LOAD_IMPORT(XboxKrnl, 0x01FF, FUNCTION, "XAudioGetSpeakerConfig")
+    LOAD_IMPORT(XboxKrnl, 0x0200, FUNCTION, "XAudioSetSpeakerConfig")
+    LOAD_IMPORT(XboxKrnl, 0x0201, FUNCTION, "NicSetUnicastAddress")
+    LOAD_IMPORT(XboxKrnl, 0x0202, FUNCTION, "NicAttach")
+    LOAD_IMPORT(XboxKrnl, 0x0203, FUNCTION, "NicDetach")
+    LOAD_IMPORT(XboxKrnl, 0x0204, FUNCTION, "NicXmit")
+    LOAD_IMPORT(XboxKrnl, 0x0205, FUNCTION, "NicUpdateMcastMembership")
+    LOAD_IMPORT(XboxKrnl, 0x0206, FUNCTION, "NicFlushXmitQueue")
+    LOAD_IMPORT(XboxKrnl, 0x0207, FUNCTION, "NicShutdown")
+    LOAD_IMPORT(XboxKrnl, 0x0208, FUNCTION, "NicGetLinkState")
+    LOAD_IMPORT(XboxKrnl, 0x0209, FUNCTION, "NicGetStats")
+    LOAD_IMPORT(XboxKrnl, 0x020A, FUNCTION, "NicGetOpt")
+    LOAD_IMPORT(XboxKrnl, 0x020B, FUNCTION, "NicSetOpt")
+    LOAD_IMPORT(XboxKrnl, 0x020C, FUNCTION, "DrvSetSysReqCallback")
+    LOAD_IMPORT(XboxKrnl, 0x020D, FUNCTION, "DrvSetUserBindingCallback")
+    LOAD_IMPORT(XboxKrnl, 0x020E, FUNCTION, "DrvSetContentStorageCallback")
+    LOAD_IMPORT(XboxKrnl, 0x020F, FUNCTION, "DrvSetAutobind")
+    LOAD_IMPORT(XboxKrnl, 0x0210, FUNCTION, "DrvGetContentStorageNotification")
+    LOAD_IMPORT(XboxKrnl, 0x0211, FUNCTION, "MtpdBeginTransaction")
+    LOAD_IMPORT(XboxKrnl, 0x0212, FUNCTION, "MtpdCancelTransaction")
+    LOAD_IMPORT(XboxKrnl, 0x0213, FUNCTION, "MtpdEndTransaction")
+    LOAD_IMPORT(XboxKrnl, 0x0214, FUNCTION, "MtpdGetCurrentDevices")
+    LOAD_IMPORT(XboxKrnl, 0x0215, FUNCTION, "MtpdReadData")
+    LOAD_IMPORT(XboxKrnl, 0x0216, FUNCTION, "MtpdReadEvent")
+    LOAD_IMPORT(XboxKrnl, 0x0217, FUNCTION, "MtpdResetDevice")
+    LOAD_IMPORT(XboxKrnl, 0x0218, FUNCTION, "MtpdSendData")
+    LOAD_IMPORT(XboxKrnl, 0x0219, FUNCTION, "MtpdVerifyProximity")
+    LOAD_IMPORT(XboxKrnl, 0x021A, FUNCTION, "XUsbcamSetCaptureMode")
+    LOAD_IMPORT(XboxKrnl, 0x021B, FUNCTION, "XUsbcamGetConfig")
+    LOAD_IMPORT(XboxKrnl, 0x021C, FUNCTION, "XUsbcamSetConfig")
+    LOAD_IMPORT(XboxKrnl, 0x021D, FUNCTION, "XUsbcamGetState")
+    LOAD_IMPORT(XboxKrnl, 0x021E, FUNCTION, "XUsbcamReadFrame")
+    LOAD_IMPORT(XboxKrnl, 0x021F, FUNCTION, "XUsbcamSnapshot")
+    LOAD_IMPORT(XboxKrnl, 0x0220, FUNCTION, "XUsbcamSetView")
+    LOAD_IMPORT(XboxKrnl, 0x0221, FUNCTION, "XUsbcamGetView")
+    LOAD_IMPORT(XboxKrnl, 0x0222, FUNCTION, "XUsbcamCreate")
+    LOAD_IMPORT(XboxKrnl, 0x0223, FUNCTION, "XUsbcamDestroy")
+    LOAD_IMPORT(XboxKrnl, 0x0224, FUNCTION, "XMACreateContext")
+    LOAD_IMPORT(XboxKrnl, 0x0225, FUNCTION, "XMAInitializeContext")
+    LOAD_IMPORT(XboxKrnl, 0x0226, FUNCTION, "XMAReleaseContext")
+    LOAD_IMPORT(XboxKrnl, 0x0227, FUNCTION, "XMAEnableContext")
+    LOAD_IMPORT(XboxKrnl, 0x0228, FUNCTION, "XMADisableContext")
+    LOAD_IMPORT(XboxKrnl, 0x0229, FUNCTION, "XMAGetOutputBufferWriteOffset")
+    LOAD_IMPORT(XboxKrnl, 0x022A, FUNCTION, "XMASetOutputBufferReadOffset")
+    LOAD_IMPORT(XboxKrnl, 0x022B, FUNCTION, "XMAGetOutputBufferReadOffset")
+    LOAD_IMPORT(XboxKrnl, 0x022C, FUNCTION, "XMASetOutputBufferValid")
+    LOAD_IMPORT(XboxKrnl, 0x022D, FUNCTION, "XMAIsOutputBufferValid")
+    LOAD_IMPORT(XboxKrnl, 0x022E, FUNCTION, "XMASetInputBuffer0Valid")
+    LOAD_IMPORT(XboxKrnl, 0x022F, FUNCTION, "XMAIsInputBuffer0Valid")
+    LOAD_IMPORT(XboxKrnl, 0x0230, FUNCTION, "XMASetInputBuffer1Valid")
+    LOAD_IMPORT(XboxKrnl, 0x0231, FUNCTION, "XMAIsInputBuffer1Valid")
+    LOAD_IMPORT(XboxKrnl, 0x0232, FUNCTION, "XMASetInputBuffer0")
+    LOAD_IMPORT(XboxKrnl, 0x0233, FUNCTION, "XMASetInputBuffer1")
+    LOAD_IMPORT(XboxKrnl, 0x0234, FUNCTION, "XMAGetPacketMetadata")
+    LOAD_IMPORT(XboxKrnl, 0x0235, FUNCTION, "XMABlockWhileInUse")
+    LOAD_IMPORT(XboxKrnl, 0x0236, FUNCTION, "XMASetLoopData")
+    LOAD_IMPORT(XboxKrnl, 0x0237, FUNCTION, "XMASetInputBufferReadOffset")
+    LOAD_IMPORT(XboxKrnl, 0x0238, FUNCTION, "XMAGetInputBufferReadOffset")
+    LOAD_IMPORT(XboxKrnl, 0x0239, FUNCTION, "ExIsBetaFeatureEnabled")
+    LOAD_IMPORT(XboxKrnl, 0x023A, FUNCTION, "XeKeysGetFactoryChallenge")
+    LOAD_IMPORT(XboxKrnl, 0x023B, FUNCTION, "XeKeysSetFactoryResponse")
+    LOAD_IMPORT(XboxKrnl, 0x023C, FUNCTION, "XeKeysInitializeFuses")
+    LOAD_IMPORT(XboxKrnl, 0x023D, FUNCTION, "XeKeysSaveBootLoader")
+    LOAD_IMPORT(XboxKrnl, 0x023E, FUNCTION, "XeKeysSaveKeyVault")
+    LOAD_IMPORT(XboxKrnl, 0x023F, FUNCTION, "XeKeysGetStatus")
+    LOAD_IMPORT(XboxKrnl, 0x0240, FUNCTION, "XeKeysGeneratePrivateKey")
+    LOAD_IMPORT(XboxKrnl, 0x0241, FUNCTION, "XeKeysGetKeyProperties")
+    LOAD_IMPORT(XboxKrnl, 0x0242, FUNCTION, "XeKeysSetKey")
+    LOAD_IMPORT(XboxKrnl, 0x0243, FUNCTION, "XeKeysGenerateRandomKey")
+    LOAD_IMPORT(XboxKrnl, 0x0244, FUNCTION, "XeKeysGetKey")
+    LOAD_IMPORT(XboxKrnl, 0x0245, FUNCTION, "XeKeysGetDigest")
+    LOAD_IMPORT(XboxKrnl, 0x0246, FUNCTION, "XeKeysGetConsoleID")
+    LOAD_IMPORT(XboxKrnl, 0x0247, FUNCTION, "XeKeysGetConsoleType")
+    LOAD_IMPORT(XboxKrnl, 0x0248, FUNCTION, "XeKeysQwNeRsaPrvCrypt")
+    LOAD_IMPORT(XboxKrnl, 0x0249, FUNCTION, "XeKeysHmacSha")
+    LOAD_IMPORT(XboxKrnl, 0x024A, FUNCTION, "XInputdPassThroughRFCommand")
+    LOAD_IMPORT(XboxKrnl, 0x024B, FUNCTION, "XeKeysAesCbc")
+    LOAD_IMPORT(XboxKrnl, 0x024C, FUNCTION, "XeKeysDes2Cbc")
+    LOAD_IMPORT(XboxKrnl, 0x024D, FUNCTION, "XeKeysDesCbc")
+    LOAD_IMPORT(XboxKrnl, 0x024E, FUNCTION, "XeKeysObscureKey")
+    LOAD_IMPORT(XboxKrnl, 0x024F, FUNCTION, "XeKeysHmacShaUsingKey")
+    LOAD_IMPORT(XboxKrnl, 0x0250, FUNCTION, "XeKeysSaveBootLoaderEx")
+    LOAD_IMPORT(XboxKrnl, 0x0251, FUNCTION, "XeKeysAesCbcUsingKey")
+    LOAD_IMPORT(XboxKrnl, 0x0252, FUNCTION, "XeKeysDes2CbcUsingKey")
+    LOAD_IMPORT(XboxKrnl, 0x0253, FUNCTION, "XeKeysDesCbcUsingKey")
+    LOAD_IMPORT(XboxKrnl, 0x0254, FUNCTION, "XeKeysObfuscate")
+    LOAD_IMPORT(XboxKrnl, 0x0255, FUNCTION, "XeKeysUnObfuscate")
+    LOAD_IMPORT(XboxKrnl, 0x0256, FUNCTION, "XeKeysConsolePrivateKeySign")
+    LOAD_IMPORT(XboxKrnl, 0x0257, FUNCTION, "XeKeysConsoleSignatureVerification")
+    LOAD_IMPORT(XboxKrnl, 0x0258, FUNCTION, "XeKeysVerifyRSASignature")
+    LOAD_IMPORT(XboxKrnl, 0x0259, FUNCTION, "StfsCreateDevice")
+    LOAD_IMPORT(XboxKrnl, 0x025A, FUNCTION, "StfsControlDevice")
+    LOAD_IMPORT(XboxKrnl, 0x025B, FUNCTION, "VdSwap")
+    LOAD_IMPORT(XboxKrnl, 0x025C, VARIABLE, "HalFsbInterruptCount")
+    LOAD_IMPORT(XboxKrnl, 0x025D, FUNCTION, "XeKeysSaveSystemUpdate")
+    LOAD_IMPORT(XboxKrnl, 0x025E, FUNCTION, "XeKeysLockSystemUpdate")
+    LOAD_IMPORT(XboxKrnl, 0x025F, FUNCTION, "XeKeysExecute")
+    LOAD_IMPORT(XboxKrnl, 0x0260, FUNCTION, "XeKeysGetVersions")
+    LOAD_IMPORT(XboxKrnl, 0x0261, FUNCTION, "XInputdPowerDownDevice")
+    LOAD_IMPORT(XboxKrnl, 0x0262, FUNCTION, "AniBlockOnAnimation")
+    LOAD_IMPORT(XboxKrnl, 0x0263, FUNCTION, "AniTerminateAnimation")
+    LOAD_IMPORT(XboxKrnl, 0x0264, FUNCTION, "XUsbcamReset")
+    LOAD_IMPORT(XboxKrnl, 0x0265, FUNCTION, "AniSetLogo")
+    LOAD_IMPORT(XboxKrnl, 0x0266, VARIABLE, "KeCertMonitorData")
+    LOAD_IMPORT(XboxKrnl, 0x0267, FUNCTION, "HalIsExecutingPowerDownDpc")
+    LOAD_IMPORT(XboxKrnl, 0x0268, FUNCTION, "VdInitializeEDRAM")
+    LOAD_IMPORT(XboxKrnl, 0x0269, FUNCTION, "VdRetrainEDRAM")
+    LOAD_IMPORT(XboxKrnl, 0x026A, FUNCTION, "VdRetrainEDRAMWorker")
+    LOAD_IMPORT(XboxKrnl, 0x026B, VARIABLE, "VdHSIOTrainCount")
+    LOAD_IMPORT(XboxKrnl, 0x026C, FUNCTION, "HalGetPowerUpCause")
+    LOAD_IMPORT(XboxKrnl, 0x026D, VARIABLE, "VdHSIOTrainingStatus")
+    LOAD_IMPORT(XboxKrnl, 0x026E, VARIABLE, "RgcBindInfo")
+    LOAD_IMPORT(XboxKrnl, 0x026F, FUNCTION, "VdReadEEDIDBlock")
+    LOAD_IMPORT(XboxKrnl, 0x0270, FUNCTION, "VdEnumerateVideoModes")
+    LOAD_IMPORT(XboxKrnl, 0x0271, FUNCTION, "VdEnableHDCP")
+    LOAD_IMPORT(XboxKrnl, 0x0272, FUNCTION, "VdRegisterHDCPNotification")
+    LOAD_IMPORT(XboxKrnl, 0x0273, FUNCTION, "HidReadMouseChanges")
+    LOAD_IMPORT(XboxKrnl, 0x0274, FUNCTION, "DumpSetCollectionFacility")
+    LOAD_IMPORT(XboxKrnl, 0x0275, FUNCTION, "XexTransformImageKey")
+    LOAD_IMPORT(XboxKrnl, 0x0276, FUNCTION, "XAudioOverrideSpeakerConfig")
+    LOAD_IMPORT(XboxKrnl, 0x0277, FUNCTION, "XInputdReadTextKeystroke")
+    LOAD_IMPORT(XboxKrnl, 0x0278, FUNCTION, "DrvXenonButtonPressed")
+    LOAD_IMPORT(XboxKrnl, 0x0279, FUNCTION, "DrvBindToUser")
+    LOAD_IMPORT(XboxKrnl, 0x027A, FUNCTION, "XexGetModuleImportVersions")
+    LOAD_IMPORT(XboxKrnl, 0x027B, FUNCTION, "RtlComputeCrc32")
+    LOAD_IMPORT(XboxKrnl, 0x027C, FUNCTION, "XeKeysSetRevocationList")
+    LOAD_IMPORT(XboxKrnl, 0x027D, FUNCTION, "HalRegisterPowerDownCallback")
+    LOAD_IMPORT(XboxKrnl, 0x027E, FUNCTION, "VdGetDisplayDiscoveryData")
+    LOAD_IMPORT(XboxKrnl, 0x027F, FUNCTION, "XInputdSendStayAliveRequest")
+    LOAD_IMPORT(XboxKrnl, 0x0280, FUNCTION, "XVoicedSendVPort")
+    LOAD_IMPORT(XboxKrnl, 0x0281, FUNCTION, "XVoicedGetBatteryStatus")
+    LOAD_IMPORT(XboxKrnl, 0x0282, FUNCTION, "XInputdFFGetDeviceInfo")
+    LOAD_IMPORT(XboxKrnl, 0x0283, FUNCTION, "XInputdFFSetEffect")
+    LOAD_IMPORT(XboxKrnl, 0x0284, FUNCTION, "XInputdFFUpdateEffect")
+    LOAD_IMPORT(XboxKrnl, 0x0285, FUNCTION, "XInputdFFEffectOperation")
+    LOAD_IMPORT(XboxKrnl, 0x0286, FUNCTION, "XInputdFFDeviceControl")
+    LOAD_IMPORT(XboxKrnl, 0x0287, FUNCTION, "XInputdFFSetDeviceGain")
+    LOAD_IMPORT(XboxKrnl, 0x0288, FUNCTION, "XInputdFFCancelIo")
+    LOAD_IMPORT(XboxKrnl, 0x0289, FUNCTION, "XInputdFFSetRumble")
+    LOAD_IMPORT(XboxKrnl, 0x028A, FUNCTION, "NtAllocateEncryptedMemory")
+    LOAD_IMPORT(XboxKrnl, 0x028B, FUNCTION, "NtFreeEncryptedMemory")
+    LOAD_IMPORT(XboxKrnl, 0x028C, FUNCTION, "XeKeysExSaveKeyVault")
+    LOAD_IMPORT(XboxKrnl, 0x028D, FUNCTION, "XeKeysExSetKey")
+    LOAD_IMPORT(XboxKrnl, 0x028E, FUNCTION, "XeKeysExGetKey")
+    LOAD_IMPORT(XboxKrnl, 0x028F, FUNCTION, "DrvSetDeviceConfigChangeCallback")
+    LOAD_IMPORT(XboxKrnl, 0x0290, FUNCTION, "DrvDeviceConfigChange")
+    LOAD_IMPORT(XboxKrnl, 0x0291, FUNCTION, "HalRegisterHdDvdRomNotification")
+    LOAD_IMPORT(XboxKrnl, 0x0292, FUNCTION, "XeKeysSecurityInitialize")
+    LOAD_IMPORT(XboxKrnl, 0x0293, FUNCTION, "XeKeysSecurityLoadSettings")
+    LOAD_IMPORT(XboxKrnl, 0x0294, FUNCTION, "XeKeysSecuritySaveSettings")
+    LOAD_IMPORT(XboxKrnl, 0x0295, FUNCTION, "XeKeysSecuritySetDetected")
+    LOAD_IMPORT(XboxKrnl, 0x0296, FUNCTION, "XeKeysSecurityGetDetected")
+    LOAD_IMPORT(XboxKrnl, 0x0297, FUNCTION, "XeKeysSecuritySetActivated")
+    LOAD_IMPORT(XboxKrnl, 0x0298, FUNCTION, "XeKeysSecurityGetActivated")
+    LOAD_IMPORT(XboxKrnl, 0x0299, FUNCTION, "XeKeysDvdAuthAP25InstallTable")
+    LOAD_IMPORT(XboxKrnl, 0x029A, FUNCTION, "XeKeysDvdAuthAP25GetTableVersion")
+    LOAD_IMPORT(XboxKrnl, 0x029B, FUNCTION, "XeKeysGetProtectedFlag")
+    LOAD_IMPORT(XboxKrnl, 0x029C, FUNCTION, "XeKeysSetProtectedFlag")
+    LOAD_IMPORT(XboxKrnl, 0x029D, FUNCTION, "KeEnablePFMInterrupt")
+    LOAD_IMPORT(XboxKrnl, 0x029E, FUNCTION, "KeDisablePFMInterrupt")
+    LOAD_IMPORT(XboxKrnl, 0x029F, FUNCTION, "KeSetProfilerISR")
+    LOAD_IMPORT(XboxKrnl, 0x02A0, FUNCTION, "VdStartDisplayDiscovery")
+    LOAD_IMPORT(XboxKrnl, 0x02A1, FUNCTION, "VdSetHDCPRevocationList")
+    LOAD_IMPORT(XboxKrnl, 0x02A2, FUNCTION, "XeKeysGetUpdateSequence")
+    LOAD_IMPORT(XboxKrnl, 0x02A3, FUNCTION, "XeKeysDvdAuthExActivate")
+    LOAD_IMPORT(XboxKrnl, 0x02A4, FUNCTION, "KeGetImagePageTableEntry")
+    LOAD_IMPORT(XboxKrnl, 0x02A5, FUNCTION, "HalRegisterBackgroundModeTransitionCallback")
+    LOAD_IMPORT(XboxKrnl, 0x02A6, FUNCTION, "AniStartBootAnimation")
+    LOAD_IMPORT(XboxKrnl, 0x02A7, FUNCTION, "HalClampUnclampOutputDACs")
+    LOAD_IMPORT(XboxKrnl, 0x02A8, FUNCTION, "HalPowerDownToBackgroundMode")
+    LOAD_IMPORT(XboxKrnl, 0x02A9, FUNCTION, "HalNotifyAddRemoveBackgroundTask")
+    LOAD_IMPORT(XboxKrnl, 0x02AA, FUNCTION, "HalCallBackgroundModeNotificationRoutines")
+    LOAD_IMPORT(XboxKrnl, 0x02AB, VARIABLE, "HalFsbResetCount")
+    LOAD_IMPORT(XboxKrnl, 0x02AC, FUNCTION, "HalGetMemoryInformation")
+    LOAD_IMPORT(XboxKrnl, 0x02AD, FUNCTION, "XInputdGetLastTextInputTime")
+    LOAD_IMPORT(XboxKrnl, 0x02AE, FUNCTION, "VdEnableWMAProOverHDMI")
+    LOAD_IMPORT(XboxKrnl, 0x02AF, FUNCTION, "XeKeysRevokeSaveSettings")
+    LOAD_IMPORT(XboxKrnl, 0x02B0, FUNCTION, "XInputdSetTextMessengerIndicator")
+    LOAD_IMPORT(XboxKrnl, 0x02B1, FUNCTION, "MicDeviceRequest")
+    LOAD_IMPORT(XboxKrnl, 0x02B2, FUNCTION, "XeKeysGetMediaID")
+    LOAD_IMPORT(XboxKrnl, 0x02B3, FUNCTION, "XeKeysLoadKeyVault")
+    LOAD_IMPORT(XboxKrnl, 0x02B4, FUNCTION, "KeGetVidInfo")
+    LOAD_IMPORT(XboxKrnl, 0x02B5, FUNCTION, "HalNotifyBackgroundModeTransitionComplete")
+    LOAD_IMPORT(XboxKrnl, 0x02B6, FUNCTION, "IoAcquireCancelSpinLock")
+    LOAD_IMPORT(XboxKrnl, 0x02B7, FUNCTION, "IoReleaseCancelSpinLock")
+    LOAD_IMPORT(XboxKrnl, 0x02B8, FUNCTION, "NtCancelIoFile")
+    LOAD_IMPORT(XboxKrnl, 0x02B9, FUNCTION, "NtCancelIoFileEx")
+    LOAD_IMPORT(XboxKrnl, 0x02BA, FUNCTION, "HalFinalizePowerLossRecovery")
+    LOAD_IMPORT(XboxKrnl, 0x02BB, FUNCTION, "HalSetPowerLossRecovery")
+    LOAD_IMPORT(XboxKrnl, 0x02BC, FUNCTION, "ExReadModifyWriteXConfigSettingUlong")
+    LOAD_IMPORT(XboxKrnl, 0x02BD, FUNCTION, "HalRegisterXamPowerDownCallback")
+    LOAD_IMPORT(XboxKrnl, 0x02BE, FUNCTION, "ExCancelAlarm")
+    LOAD_IMPORT(XboxKrnl, 0x02BF, FUNCTION, "ExInitializeAlarm")
+    LOAD_IMPORT(XboxKrnl, 0x02C0, FUNCTION, "ExSetAlarm")
+    LOAD_IMPORT(XboxKrnl, 0x02C1, FUNCTION, "XexActivationGetNonce")
+    LOAD_IMPORT(XboxKrnl, 0x02C2, FUNCTION, "XexActivationSetLicense")
+    LOAD_IMPORT(XboxKrnl, 0x02C3, FUNCTION, "IptvSetBoundaryKey")
+    LOAD_IMPORT(XboxKrnl, 0x02C4, FUNCTION, "IptvSetSessionKey")
+    LOAD_IMPORT(XboxKrnl, 0x02C5, FUNCTION, "IptvVerifyOmac1Signature")
+    LOAD_IMPORT(XboxKrnl, 0x02C6, FUNCTION, "IptvGetAesCtrTransform")
+    LOAD_IMPORT(XboxKrnl, 0x02C7, FUNCTION, "SataCdRomRecordReset")
+    LOAD_IMPORT(XboxKrnl, 0x02C8, FUNCTION, "XInputdSetTextDeviceKeyLocks")
+    LOAD_IMPORT(XboxKrnl, 0x02C9, FUNCTION, "XInputdGetTextDeviceKeyLocks")
+    LOAD_IMPORT(XboxKrnl, 0x02CA, FUNCTION, "XexActivationVerifyOwnership")
+    LOAD_IMPORT(XboxKrnl, 0x02CB, FUNCTION, "XexDisableVerboseDbgPrint")
+    LOAD_IMPORT(XboxKrnl, 0x02CC, FUNCTION, "SvodCreateDevice")
+    LOAD_IMPORT(XboxKrnl, 0x02CD, FUNCTION, "RtlCaptureStackBackTrace")
+    LOAD_IMPORT(XboxKrnl, 0x02CE, FUNCTION, "XeKeysRevokeUpdateDynamic")
+    LOAD_IMPORT(XboxKrnl, 0x02CF, FUNCTION, "XexImportTraceEnable")
+    LOAD_IMPORT(XboxKrnl, 0x02D0, FUNCTION, "ExRegisterXConfigNotification")
+    LOAD_IMPORT(XboxKrnl, 0x02D1, FUNCTION, "XeKeysSecuritySetStat")
+    LOAD_IMPORT(XboxKrnl, 0x02D2, FUNCTION, "VdQueryRealVideoMode")
+    LOAD_IMPORT(XboxKrnl, 0x02D3, FUNCTION, "XexSetExecutablePrivilege")
+    LOAD_IMPORT(XboxKrnl, 0x02D4, FUNCTION, "XAudioSuspendRenderDriverClients")
+    LOAD_IMPORT(XboxKrnl, 0x02D5, FUNCTION, "IptvGetSessionKeyHash")
+    LOAD_IMPORT(XboxKrnl, 0x02D6, FUNCTION, "VdSetCGMSState")
+    LOAD_IMPORT(XboxKrnl, 0x02D7, FUNCTION, "VdSetSCMSState")
+    LOAD_IMPORT(XboxKrnl, 0x02D8, FUNCTION, "KeFlushMultipleTb")
+    LOAD_IMPORT(XboxKrnl, 0x02D9, FUNCTION, "VdGetOption")
+    LOAD_IMPORT(XboxKrnl, 0x02DA, FUNCTION, "VdSetOption")
+    LOAD_IMPORT(XboxKrnl, 0x02DB, VARIABLE, "UsbdBootEnumerationDoneEvent")
+    LOAD_IMPORT(XboxKrnl, 0x02DC, VARIABLE, "StfsDeviceErrorEvent")
+    LOAD_IMPORT(XboxKrnl, 0x02DD, FUNCTION, "ExTryToAcquireReadWriteLockExclusive")
+    LOAD_IMPORT(XboxKrnl, 0x02DE, FUNCTION, "ExTryToAcquireReadWriteLockShared")
+    LOAD_IMPORT(XboxKrnl, 0x02DF, FUNCTION, "XexSetLastKdcTime")
+    LOAD_IMPORT(XboxKrnl, 0x02E0, FUNCTION, "XInputdControl")
+    LOAD_IMPORT(XboxKrnl, 0x02E1, FUNCTION, "RmcDeviceRequest")
+    LOAD_IMPORT(XboxKrnl, 0x02E2, FUNCTION, "LDIResetDecompression")
+    LOAD_IMPORT(XboxKrnl, 0x02E3, FUNCTION, "NicRegisterDevice")
+    LOAD_IMPORT(XboxKrnl, 0x02E4, FUNCTION, "UsbdAddDeviceComplete")
+    LOAD_IMPORT(XboxKrnl, 0x02E5, FUNCTION, "UsbdCancelAsyncTransfer")
+    LOAD_IMPORT(XboxKrnl, 0x02E6, FUNCTION, "UsbdGetDeviceSpeed")
+    LOAD_IMPORT(XboxKrnl, 0x02E7, FUNCTION, "UsbdGetDeviceTopology")
+    LOAD_IMPORT(XboxKrnl, 0x02E8, FUNCTION, "UsbdGetEndpointDescriptor")
+    LOAD_IMPORT(XboxKrnl, 0x02E9, FUNCTION, "UsbdIsDeviceAuthenticated")
+    LOAD_IMPORT(XboxKrnl, 0x02EA, FUNCTION, "UsbdOpenDefaultEndpoint")
+    LOAD_IMPORT(XboxKrnl, 0x02EB, FUNCTION, "UsbdOpenEndpoint")
+    LOAD_IMPORT(XboxKrnl, 0x02EC, FUNCTION, "UsbdQueueAsyncTransfer")
+    LOAD_IMPORT(XboxKrnl, 0x02ED, FUNCTION, "UsbdQueueCloseDefaultEndpoint")
+    LOAD_IMPORT(XboxKrnl, 0x02EE, FUNCTION, "UsbdQueueCloseEndpoint")
+    LOAD_IMPORT(XboxKrnl, 0x02EF, FUNCTION, "UsbdRemoveDeviceComplete")
+    LOAD_IMPORT(XboxKrnl, 0x02F0, FUNCTION, "KeRemoveQueueApc")
+    LOAD_IMPORT(XboxKrnl, 0x02F1, VARIABLE, "UsbdDriverLoadRequiredEvent")
+    LOAD_IMPORT(XboxKrnl, 0x02F2, FUNCTION, "UsbdGetRequiredDrivers")
+    LOAD_IMPORT(XboxKrnl, 0x02F3, FUNCTION, "UsbdRegisterDriverObject")
+    LOAD_IMPORT(XboxKrnl, 0x02F4, FUNCTION, "UsbdUnregisterDriverObject")
+    LOAD_IMPORT(XboxKrnl, 0x02F5, FUNCTION, "UsbdCallAndBlockOnDpcRoutine")
+    LOAD_IMPORT(XboxKrnl, 0x02F6, FUNCTION, "UsbdResetDevice")
+    LOAD_IMPORT(XboxKrnl, 0x02F7, FUNCTION, "UsbdGetDeviceDescriptor")
+    LOAD_IMPORT(XboxKrnl, 0x02F8, FUNCTION, "NomnilGetExtension")
+    LOAD_IMPORT(XboxKrnl, 0x02F9, FUNCTION, "NomnilStartCloseDevice")
+    LOAD_IMPORT(XboxKrnl, 0x02FA, FUNCTION, "WifiBeginAuthentication")
+    LOAD_IMPORT(XboxKrnl, 0x02FB, FUNCTION, "WifiCheckCounterMeasures")
+    LOAD_IMPORT(XboxKrnl, 0x02FC, FUNCTION, "WifiChooseAuthenCipherSetFromBSSID")
+    LOAD_IMPORT(XboxKrnl, 0x02FD, FUNCTION, "WifiCompleteAuthentication")
+    LOAD_IMPORT(XboxKrnl, 0x02FE, FUNCTION, "WifiGetAssociationIE")
+    LOAD_IMPORT(XboxKrnl, 0x02FF, FUNCTION, "WifiOnMICError")
+    LOAD_IMPORT(XboxKrnl, 0x0300, FUNCTION, "WifiPrepareAuthenticationContext")
+    LOAD_IMPORT(XboxKrnl, 0x0301, FUNCTION, "WifiRecvEAPOLPacket")
+    LOAD_IMPORT(XboxKrnl, 0x0302, FUNCTION, "WifiDeduceNetworkType")
+    LOAD_IMPORT(XboxKrnl, 0x0303, FUNCTION, "NicUnregisterDevice")
+    LOAD_IMPORT(XboxKrnl, 0x0304, FUNCTION, "DumpXitThread")
+    LOAD_IMPORT(XboxKrnl, 0x0305, FUNCTION, "XInputdSetWifiChannel")
+    LOAD_IMPORT(XboxKrnl, 0x0306, FUNCTION, "NomnilSetLed")
+    LOAD_IMPORT(XboxKrnl, 0x0307, FUNCTION, "WifiCalculateRegulatoryDomain")
+    LOAD_IMPORT(XboxKrnl, 0x0308, FUNCTION, "WifiSelectAdHocChannel")
+    LOAD_IMPORT(XboxKrnl, 0x0309, FUNCTION, "WifiChannelToFrequency")
+    LOAD_IMPORT(XboxKrnl, 0x030A, FUNCTION, "MmGetPoolPagesType")
+    LOAD_IMPORT(XboxKrnl, 0x030B, FUNCTION, "ExExpansionInstall")
+    LOAD_IMPORT(XboxKrnl, 0x030C, FUNCTION, "ExExpansionCall")
+    LOAD_IMPORT(XboxKrnl, 0x030D, FUNCTION, "PsCamDeviceRequest")
+    LOAD_IMPORT(XboxKrnl, 0x030E, FUNCTION, "McaDeviceRequest")
+    LOAD_IMPORT(XboxKrnl, 0x030F, FUNCTION, "DetroitDeviceRequest")
+    LOAD_IMPORT(XboxKrnl, 0x0310, FUNCTION, "XeCryptSha256Init")
+    LOAD_IMPORT(XboxKrnl, 0x0311, FUNCTION, "XeCryptSha256Update")
+    LOAD_IMPORT(XboxKrnl, 0x0312, FUNCTION, "XeCryptSha256Final")
+    LOAD_IMPORT(XboxKrnl, 0x0313, FUNCTION, "XeCryptSha256")
+    LOAD_IMPORT(XboxKrnl, 0x0314, FUNCTION, "XeCryptSha384Init")
+    LOAD_IMPORT(XboxKrnl, 0x0315, FUNCTION, "XeCryptSha384Update")
+    LOAD_IMPORT(XboxKrnl, 0x0316, FUNCTION, "XInputdGetDevicePid")
+    LOAD_IMPORT(XboxKrnl, 0x0317, FUNCTION, "HalGetNotedArgonErrors")
+    LOAD_IMPORT(XboxKrnl, 0x0318, FUNCTION, "XeCryptSha384Final")
+    LOAD_IMPORT(XboxKrnl, 0x0319, FUNCTION, "HalReadArgonEeprom")
+    LOAD_IMPORT(XboxKrnl, 0x031A, FUNCTION, "HalWriteArgonEeprom")
+    LOAD_IMPORT(XboxKrnl, 0x031B, FUNCTION, "XeKeysFcrtLoad")
+    LOAD_IMPORT(XboxKrnl, 0x031C, FUNCTION, "XeKeysFcrtSave")
+    LOAD_IMPORT(XboxKrnl, 0x031D, FUNCTION, "XeKeysFcrtSet")
+    LOAD_IMPORT(XboxKrnl, 0x031E, FUNCTION, "XeCryptSha384")
+    LOAD_IMPORT(XboxKrnl, 0x031F, FUNCTION, "XeCryptSha512Init")
+    LOAD_IMPORT(XboxKrnl, 0x0320, FUNCTION, "XAudioRegisterRenderDriverMECClient")
+    LOAD_IMPORT(XboxKrnl, 0x0321, FUNCTION, "XAudioUnregisterRenderDriverMECClient")
+    LOAD_IMPORT(XboxKrnl, 0x0322, FUNCTION, "XAudioCaptureRenderDriverFrame")
+    LOAD_IMPORT(XboxKrnl, 0x0323, FUNCTION, "XeCryptSha512Update")
+    LOAD_IMPORT(XboxKrnl, 0x0324, FUNCTION, "XeCryptSha512Final")
+    LOAD_IMPORT(XboxKrnl, 0x0325, FUNCTION, "XeCryptSha512")
+    LOAD_IMPORT(XboxKrnl, 0x0326, FUNCTION, "XeCryptBnQwNeCompare")
+    LOAD_IMPORT(XboxKrnl, 0x0327, FUNCTION, "XVoicedGetDirectionalData")
+    LOAD_IMPORT(XboxKrnl, 0x0328, FUNCTION, "DrvSetMicArrayStartCallback")
+    LOAD_IMPORT(XboxKrnl, 0x0329, FUNCTION, "DevAuthGetStatistics")
+    LOAD_IMPORT(XboxKrnl, 0x032A, FUNCTION, "NullCableRequest")
+    LOAD_IMPORT(XboxKrnl, 0x032B, FUNCTION, "XeKeysRevokeIsDeviceRevoked")
+    LOAD_IMPORT(XboxKrnl, 0x032C, FUNCTION, "DumpUpdateDumpSettings")
+    LOAD_IMPORT(XboxKrnl, 0x032D, FUNCTION, "EtxConsumerDisableEventType")
+    LOAD_IMPORT(XboxKrnl, 0x032E, FUNCTION, "EtxConsumerEnableEventType")
+    LOAD_IMPORT(XboxKrnl, 0x032F, FUNCTION, "EtxConsumerProcessLogs")
+    LOAD_IMPORT(XboxKrnl, 0x0330, FUNCTION, "EtxConsumerRegister")
+    LOAD_IMPORT(XboxKrnl, 0x0331, FUNCTION, "EtxConsumerUnregister")
+    LOAD_IMPORT(XboxKrnl, 0x0332, FUNCTION, "EtxProducerLog")
+    LOAD_IMPORT(XboxKrnl, 0x0333, FUNCTION, "EtxProducerLogV")
+    LOAD_IMPORT(XboxKrnl, 0x0334, FUNCTION, "EtxProducerRegister")
+    LOAD_IMPORT(XboxKrnl, 0x0335, FUNCTION, "EtxProducerUnregister")
+    LOAD_IMPORT(XboxKrnl, 0x0336, FUNCTION, "EtxConsumerFlushBuffers")
+    LOAD_IMPORT(XboxKrnl, 0x0337, FUNCTION, "EtxProducerLogXwpp")
+    LOAD_IMPORT(XboxKrnl, 0x0338, FUNCTION, "EtxProducerLogXwppV")
+    LOAD_IMPORT(XboxKrnl, 0x0339, FUNCTION, "UsbdEnableDisableRootHubPort")
+    LOAD_IMPORT(XboxKrnl, 0x033A, FUNCTION, "EtxBufferRegister")
+    LOAD_IMPORT(XboxKrnl, 0x033B, FUNCTION, "EtxBufferUnregister")
+    LOAD_IMPORT(XboxKrnl, 0x033C, FUNCTION, "DumpRegisterDedicatedDataBlock")
+    LOAD_IMPORT(XboxKrnl, 0x033D, FUNCTION, "XeKeysDvdAuthExSave")
+    LOAD_IMPORT(XboxKrnl, 0x033E, FUNCTION, "XeKeysDvdAuthExInstall")
+    LOAD_IMPORT(XboxKrnl, 0x033F, FUNCTION, "XexShimDisable")
+    LOAD_IMPORT(XboxKrnl, 0x0340, FUNCTION, "XexShimEnable")
+    LOAD_IMPORT(XboxKrnl, 0x0341, FUNCTION, "XexShimEntryDisable")
+    LOAD_IMPORT(XboxKrnl, 0x0342, FUNCTION, "XexShimEntryEnable")
+    LOAD_IMPORT(XboxKrnl, 0x0343, FUNCTION, "XexShimEntryRegister")
+    LOAD_IMPORT(XboxKrnl, 0x0344, FUNCTION, "XexShimLock")
+    LOAD_IMPORT(XboxKrnl, 0x0345, VARIABLE, "XboxKrnlVersion4Digit")
+    LOAD_IMPORT(XboxKrnl, 0x0346, FUNCTION, "XeKeysObfuscateEx")
+    LOAD_IMPORT(XboxKrnl, 0x0347, FUNCTION, "XeKeysUnObfuscateEx")
+    LOAD_IMPORT(XboxKrnl, 0x0348, FUNCTION, "XexTitleHash")
+    LOAD_IMPORT(XboxKrnl, 0x0349, FUNCTION, "XexTitleHashClose")
+    LOAD_IMPORT(XboxKrnl, 0x034A, FUNCTION, "XexTitleHashContinue")
+    LOAD_IMPORT(XboxKrnl, 0x034B, FUNCTION, "XexTitleHashOpen")
+    LOAD_IMPORT(XboxKrnl, 0x034C, FUNCTION, "XAudioGetRenderDriverTic")
+    LOAD_IMPORT(XboxKrnl, 0x034D, FUNCTION, "XAudioEnableDucker")
+    LOAD_IMPORT(XboxKrnl, 0x034E, FUNCTION, "XAudioSetDuckerLevel")
+    LOAD_IMPORT(XboxKrnl, 0x034F, FUNCTION, "XAudioIsDuckerEnabled")
+    LOAD_IMPORT(XboxKrnl, 0x0350, FUNCTION, "XAudioGetDuckerLevel")
+    LOAD_IMPORT(XboxKrnl, 0x0351, FUNCTION, "XAudioGetDuckerThreshold")
+    LOAD_IMPORT(XboxKrnl, 0x0352, FUNCTION, "XAudioSetDuckerThreshold")
+    LOAD_IMPORT(XboxKrnl, 0x0353, FUNCTION, "XAudioGetDuckerAttackTime")
+    LOAD_IMPORT(XboxKrnl, 0x0354, FUNCTION, "XAudioSetDuckerAttackTime")
+    LOAD_IMPORT(XboxKrnl, 0x0355, FUNCTION, "XAudioGetDuckerReleaseTime")
+    LOAD_IMPORT(XboxKrnl, 0x0356, FUNCTION, "XAudioSetDuckerReleaseTime")
+    LOAD_IMPORT(XboxKrnl, 0x0357, FUNCTION, "XAudioGetDuckerHoldTime")
+    LOAD_IMPORT(XboxKrnl, 0x0358, FUNCTION, "XAudioSetDuckerHoldTime")
+    LOAD_IMPORT(XboxKrnl, 0x0359, FUNCTION, "DevAuthShouldAlwaysEnforce")
+    LOAD_IMPORT(XboxKrnl, 0x035A, FUNCTION, "XAudioGetUnderrunCount")
+    LOAD_IMPORT(XboxKrnl, 0x035C, FUNCTION, "XVoicedIsActiveProcess")
 
 
 
     // xbmd
 
-    LOAD_IMPORT(xbdm, 0x0001, FUNCTION, "DmAllocatePool");
-    LOAD_IMPORT(xbdm, 0x0002, FUNCTION, "DmAllocatePoolWithTag");
-    LOAD_IMPORT(xbdm, 0x0003, FUNCTION, "DmCloseCounters");
-    LOAD_IMPORT(xbdm, 0x0004, FUNCTION, "DmCloseModuleSections");
-    LOAD_IMPORT(xbdm, 0x0005, FUNCTION, "DmCloseModuleSections");
-    LOAD_IMPORT(xbdm, 0x0006, FUNCTION, "DmCloseNotificationSession");
-    LOAD_IMPORT(xbdm, 0x0007, FUNCTION, "DmClosePerformanceCounter");
-    LOAD_IMPORT(xbdm, 0x0008, FUNCTION, "DmContinueThread");
-    LOAD_IMPORT(xbdm, 0x0009, FUNCTION, "DmFreePool");
-    LOAD_IMPORT(xbdm, 0x000A, FUNCTION, "DmGetMemory");
-    LOAD_IMPORT(xbdm, 0x000B, FUNCTION, "DmGetModuleLongName");
-    LOAD_IMPORT(xbdm, 0x000C, FUNCTION, "DmGetProcAddress");
-    LOAD_IMPORT(xbdm, 0x000D, FUNCTION, "DmGetThreadContext");
-    LOAD_IMPORT(xbdm, 0x000F, FUNCTION, "DmGetThreadList");
-    LOAD_IMPORT(xbdm, 0x0010, FUNCTION, "DmGetXbeInfo");
-    LOAD_IMPORT(xbdm, 0x0011, FUNCTION, "DmGetXboxName");
-    LOAD_IMPORT(xbdm, 0x0013, FUNCTION, "DmGo");
-    LOAD_IMPORT(xbdm, 0x0014, FUNCTION, "DmHaltThread");
-    LOAD_IMPORT(xbdm, 0x0015, FUNCTION, "DmIsDebuggerPresent");
-    LOAD_IMPORT(xbdm, 0x0016, FUNCTION, "DmIsThreadStopped");
-    LOAD_IMPORT(xbdm, 0x0017, FUNCTION, "DmLoadExtension");
-    LOAD_IMPORT(xbdm, 0x0018, FUNCTION, "DmNotify");
-    LOAD_IMPORT(xbdm, 0x0019, FUNCTION, "DmOpenNotificationSession");
-    LOAD_IMPORT(xbdm, 0x001A, FUNCTION, "DmOpenPerformanceCounter");
-    LOAD_IMPORT(xbdm, 0x001B, FUNCTION, "DmQueryPerformanceCounterHandle");
-    LOAD_IMPORT(xbdm, 0x001C, FUNCTION, "DmReboot");
-    LOAD_IMPORT(xbdm, 0x001E, FUNCTION, "DmRegisterCommandProcessor");
-    LOAD_IMPORT(xbdm, 0x0020, FUNCTION, "DmRegisterNotificationProcessor");
-    LOAD_IMPORT(xbdm, 0x0021, FUNCTION, "DmRegisterPerformanceCounter");
-    LOAD_IMPORT(xbdm, 0x0022, FUNCTION, "DmRemoveBreakpoint");
-    LOAD_IMPORT(xbdm, 0x0023, FUNCTION, "DmResumeThread");
-    LOAD_IMPORT(xbdm, 0x0024, FUNCTION, "DmSendNotificationString");
-    LOAD_IMPORT(xbdm, 0x0025, FUNCTION, "DmSetBreakpoint");
-    LOAD_IMPORT(xbdm, 0x0026, FUNCTION, "DmSetDataBreakpoint");
-    LOAD_IMPORT(xbdm, 0x0027, FUNCTION, "DmSetInitialBreakpoint");
-    LOAD_IMPORT(xbdm, 0x0028, FUNCTION, "DmSetMemory");
-    LOAD_IMPORT(xbdm, 0x0029, FUNCTION, "DmSetThreadContext");
-    LOAD_IMPORT(xbdm, 0x002A, FUNCTION, "DmSetTitle");
-    LOAD_IMPORT(xbdm, 0x002B, FUNCTION, "DmSetXboxName");
-    LOAD_IMPORT(xbdm, 0x002D, FUNCTION, "DmStop");
-    LOAD_IMPORT(xbdm, 0x002E, FUNCTION, "DmStopOn");
-    LOAD_IMPORT(xbdm, 0x0030, FUNCTION, "DmSuspendThread");
-    LOAD_IMPORT(xbdm, 0x0031, FUNCTION, "DmThreadUserData");
-    LOAD_IMPORT(xbdm, 0x0032, FUNCTION, "DmUnloadExtension");
-    LOAD_IMPORT(xbdm, 0x0033, FUNCTION, "DmWalkLoadedModules");
-    LOAD_IMPORT(xbdm, 0x0034, FUNCTION, "DmWalkModuleSections");
-    LOAD_IMPORT(xbdm, 0x0035, FUNCTION, "DmWalkPerformanceCounters");
-    LOAD_IMPORT(xbdm, 0x0037, FUNCTION, "DmCloseCounters");
-    LOAD_IMPORT(xbdm, 0x0038, FUNCTION, "DmIsBreakpoint");
-    LOAD_IMPORT(xbdm, 0x0039, FUNCTION, "DmCloseCounters");
-    LOAD_IMPORT(xbdm, 0x003A, FUNCTION, "DmSetUserAccess");
-    LOAD_IMPORT(xbdm, 0x003B, FUNCTION, "DmGetUserAccess");
-    LOAD_IMPORT(xbdm, 0x003C, FUNCTION, "DmWalkUserList");
-    LOAD_IMPORT(xbdm, 0x003D, FUNCTION, "DmAddUser");
-    LOAD_IMPORT(xbdm, 0x003E, FUNCTION, "DmEnableSecurity");
-    LOAD_IMPORT(xbdm, 0x003F, FUNCTION, "DmIsSecurityEnabled");
-    LOAD_IMPORT(xbdm, 0x0040, FUNCTION, "DmRemoveUser");
-    LOAD_IMPORT(xbdm, 0x0041, FUNCTION, "__CAP_Start_Profiling");
-    LOAD_IMPORT(xbdm, 0x0042, FUNCTION, "__CAP_End_Profiling");
-    LOAD_IMPORT(xbdm, 0x0046, FUNCTION, "__CAP_Enter_Function");
-    LOAD_IMPORT(xbdm, 0x0047, FUNCTION, "__CAP_Exit_Function");
-    LOAD_IMPORT(xbdm, 0x0048, FUNCTION, "DmRegisterCommandProcessorEx");
-    LOAD_IMPORT(xbdm, 0x0049, FUNCTION, "DmStartProfiling");
-    LOAD_IMPORT(xbdm, 0x004A, FUNCTION, "DmStopProfiling");
-    LOAD_IMPORT(xbdm, 0x004B, FUNCTION, "DmQueryMemoryStatistics");
-    LOAD_IMPORT(xbdm, 0x004C, FUNCTION, "DmEnableStackTrace");
-    LOAD_IMPORT(xbdm, 0x004D, FUNCTION, "DmQueryAllocationTypeName");
-    LOAD_IMPORT(xbdm, 0x004E, FUNCTION, "DmRegisterAllocationType");
-    LOAD_IMPORT(xbdm, 0x004F, FUNCTION, "DmInsertAllocationEntry");
-    LOAD_IMPORT(xbdm, 0x0050, FUNCTION, "DmRemoveAllocationEntry");
-    LOAD_IMPORT(xbdm, 0x0051, FUNCTION, "DmSetTitleEx");
-    LOAD_IMPORT(xbdm, 0x0052, FUNCTION, "DmCaptureStackBackTrace");
-    LOAD_IMPORT(xbdm, 0x0053, FUNCTION, "DmCrashDump");
-    LOAD_IMPORT(xbdm, 0x0054, FUNCTION, "DmIsFastCAPEnabled");
-    LOAD_IMPORT(xbdm, 0x0055, FUNCTION, "DmGetFileAccessCount");
-    LOAD_IMPORT(xbdm, 0x0058, FUNCTION, "DmGetUtilityDriveInfo");
-    LOAD_IMPORT(xbdm, 0x0059, FUNCTION, "DmGetThreadInfoEx");
-    LOAD_IMPORT(xbdm, 0x005A, FUNCTION, "DmSetProfilingOptions");
-    LOAD_IMPORT(xbdm, 0x005B, FUNCTION, "DmQuerySystemSettings");
-    LOAD_IMPORT(xbdm, 0x005C, FUNCTION, "DmSaveSystemSettings");
-    LOAD_IMPORT(xbdm, 0x006A, FUNCTION, "DmpGetPgoModuleHandleForBaseAddress");
-    LOAD_IMPORT(xbdm, 0x006B, FUNCTION, "DmpOnPgoModuleLoad");
-    LOAD_IMPORT(xbdm, 0x006C, FUNCTION, "DmPgoStartDataCollection");
-    LOAD_IMPORT(xbdm, 0x006D, FUNCTION, "DmPgoStopDataCollection");
-    LOAD_IMPORT(xbdm, 0x006E, FUNCTION, "DmPgoSaveSnapshot");
-    LOAD_IMPORT(xbdm, 0x006F, FUNCTION, "IrtClientAbort");
-    LOAD_IMPORT(xbdm, 0x0070, FUNCTION, "IrtPogoInit");
-    LOAD_IMPORT(xbdm, 0x0071, FUNCTION, "IrtSetStaticInfo");
-    LOAD_IMPORT(xbdm, 0x0072, FUNCTION, "IrtAutoSweepW");
-    LOAD_IMPORT(xbdm, 0x0073, FUNCTION, "IrtAutoSweepA");
-    LOAD_IMPORT(xbdm, 0x0075, FUNCTION, "DmGetDumpMode");
-    LOAD_IMPORT(xbdm, 0x0076, FUNCTION, "DmSetDumpMode");
-    LOAD_IMPORT(xbdm, 0x0077, FUNCTION, "DmGetDumpSettings");
-    LOAD_IMPORT(xbdm, 0x0078, FUNCTION, "DmSetDumpSettings");
-    LOAD_IMPORT(xbdm, 0x0079, FUNCTION, "DmGetEventDeferFlags");
-    LOAD_IMPORT(xbdm, 0x007A, FUNCTION, "DmSetEventDeferFlags");
-    LOAD_IMPORT(xbdm, 0x007B, FUNCTION, "DmWalkCommittedMemory");
-    LOAD_IMPORT(xbdm, 0x007C, FUNCTION, "DmCloseCounters");
-    LOAD_IMPORT(xbdm, 0x007D, FUNCTION, "DmRebootEx");
-    LOAD_IMPORT(xbdm, 0x0082, FUNCTION, "DmMountFdfxVolume");
-    LOAD_IMPORT(xbdm, 0x0083, FUNCTION, "DmCapGetFileHeader");
-    LOAD_IMPORT(xbdm, 0x0084, FUNCTION, "DmCapFreeFileHeader");
-    LOAD_IMPORT(xbdm, 0x0085, FUNCTION, "DmTraceStartRecording");
-    LOAD_IMPORT(xbdm, 0x0086, FUNCTION, "DmTraceStartRecordingFunction");
-    LOAD_IMPORT(xbdm, 0x0087, FUNCTION, "DmTraceSetBufferSize");
-    LOAD_IMPORT(xbdm, 0x0088, FUNCTION, "DmTraceStopRecording");
-    LOAD_IMPORT(xbdm, 0x0089, FUNCTION, "DmTraceSaveBuffer");
-    LOAD_IMPORT(xbdm, 0x008C, FUNCTION, "DmGetConsoleType");
-    LOAD_IMPORT(xbdm, 0x008D, FUNCTION, "DmMapDevkitDrive");
-    LOAD_IMPORT(xbdm, 0x008E, FUNCTION, "DmWalkLoadedModulesEx");
-    LOAD_IMPORT(xbdm, 0x008F, FUNCTION, "DmGetXexHeaderField");
-    LOAD_IMPORT(xbdm, 0x0090, FUNCTION, "DmGetMouseChanges");
-    LOAD_IMPORT(xbdm, 0x0091, FUNCTION, "DmFindPdbSignature");
-    LOAD_IMPORT(xbdm, 0x0092, FUNCTION, "DmGetProfilingStatus");
-    LOAD_IMPORT(xbdm, 0x0093, FUNCTION, "DmOpticalDiscLogStart");
-    LOAD_IMPORT(xbdm, 0x0094, FUNCTION, "DmOpticalDiscLogStop");
-    LOAD_IMPORT(xbdm, 0x0095, FUNCTION, "DmStartSamplingProfiler");
-    LOAD_IMPORT(xbdm, 0x0096, FUNCTION, "DmStopSamplingProfiler");
-    LOAD_IMPORT(xbdm, 0x0097, FUNCTION, "DmGetSamplingProfilerInfo");
-    LOAD_IMPORT(xbdm, 0x0098, FUNCTION, "DmStartFileEventCapture");
-    LOAD_IMPORT(xbdm, 0x0099, FUNCTION, "DmStopFileEventCapture");
-    LOAD_IMPORT(xbdm, 0x009A, FUNCTION, "DmSetFileEventMarker");
-    LOAD_IMPORT(xbdm, 0x009B, FUNCTION, "DmMarkPseudoCreateBegin");
-    LOAD_IMPORT(xbdm, 0x009C, FUNCTION, "DmMarkPseudoCreateEnd");
-    LOAD_IMPORT(xbdm, 0x009D, FUNCTION, "DmMarkPseudoEventBegin");
-    LOAD_IMPORT(xbdm, 0x009E, FUNCTION, "DmMarkPseudoEventEnd");
-    LOAD_IMPORT(xbdm, 0x009F, FUNCTION, "DmMarkFileEventWorkerThreadBegin");
-    LOAD_IMPORT(xbdm, 0x00A0, FUNCTION, "DmMarkFileEventWorkerThreadEnd");
-    LOAD_IMPORT(xbdm, 0x00A1, FUNCTION, "DmGetSystemInfo");
-    LOAD_IMPORT(xbdm, 0x00A2, FUNCTION, "DmAbortProfiling");
-    LOAD_IMPORT(xbdm, 0x00A3, FUNCTION, "DmNetCaptureStart");
-    LOAD_IMPORT(xbdm, 0x00A4, FUNCTION, "DmNetCaptureStop");
-    LOAD_IMPORT(xbdm, 0x00A5, FUNCTION, "DmQueryTitleMemoryStatistics");
-    LOAD_IMPORT(xbdm, 0x00A6, FUNCTION, "DmAutomationGetInputProcess");
-    LOAD_IMPORT(xbdm, 0x00A7, FUNCTION, "DmAutomationBindController");
-    LOAD_IMPORT(xbdm, 0x00A8, FUNCTION, "DmAutomationUnbindController");
-    LOAD_IMPORT(xbdm, 0x00A9, FUNCTION, "DmAutomationConnectController");
-    LOAD_IMPORT(xbdm, 0x00AA, FUNCTION, "DmAutomationDisconnectController");
-    LOAD_IMPORT(xbdm, 0x00AB, FUNCTION, "DmAutomationSetGamepadState");
-    LOAD_IMPORT(xbdm, 0x00AC, FUNCTION, "DmAutomationQueueGamepadState");
-    LOAD_IMPORT(xbdm, 0x00AD, FUNCTION, "DmAutomationClearGamepadQueue");
-    LOAD_IMPORT(xbdm, 0x00AE, FUNCTION, "DmAutomationQueryGamepadQueue");
-    LOAD_IMPORT(xbdm, 0x00AF, FUNCTION, "DmAutomationGetUserDefaultProfile");
-    LOAD_IMPORT(xbdm, 0x00B0, FUNCTION, "DmAutomationSetUserDefaultProfile");
-    LOAD_IMPORT(xbdm, 0x00B1, FUNCTION, "DmTraceIsRecording");
-    LOAD_IMPORT(xbdm, 0x00B2, FUNCTION, "DmLoadDebuggerExtension");
-    LOAD_IMPORT(xbdm, 0x00B3, FUNCTION, "DmUnloadDebuggerExtension");
-    LOAD_IMPORT(xbdm, 0x00B4, FUNCTION, "DmCreateSystemThread");
-    LOAD_IMPORT(xbdm, 0x00B5, FUNCTION, "PEPLELookup");
-    LOAD_IMPORT(xbdm, 0x00B6, FUNCTION, "PEPLELookupCompact");
-    LOAD_IMPORT(xbdm, 0x00B7, FUNCTION, "PVPLELookup");
-    LOAD_IMPORT(xbdm, 0x00B8, FUNCTION, "PVPLELookupCompact");
-    LOAD_IMPORT(xbdm, 0x00B9, FUNCTION, "PVPLELookupCompactMDS");
-    LOAD_IMPORT(xbdm, 0x00BA, FUNCTION, "PVPLEFilteredLookup");
-    LOAD_IMPORT(xbdm, 0x00BB, FUNCTION, "PVPLEFilteredLookupCompact");
-    LOAD_IMPORT(xbdm, 0x00BC, FUNCTION, "PVPLEFilteredLookupCompactMDS");
-    LOAD_IMPORT(xbdm, 0x00BD, FUNCTION, "PVPLETemplatedLookup");
-    LOAD_IMPORT(xbdm, 0x00BE, FUNCTION, "PVPLETemplatedLookupCompact");
-    LOAD_IMPORT(xbdm, 0x00BF, FUNCTION, "PVPLETemplatedLookupCompactMDS");
-    LOAD_IMPORT(xbdm, 0x00C0, FUNCTION, "DmpPgoCounterOverflow");
-    LOAD_IMPORT(xbdm, 0x00C1, FUNCTION, "UpdateMDSProbeState");
-    LOAD_IMPORT(xbdm, 0x00C2, FUNCTION, "DmGetHttpRegistration");
-    LOAD_IMPORT(xbdm, 0x00C3, FUNCTION, "DmTraceSetIOThread");
-    LOAD_IMPORT(xbdm, 0x00C4, FUNCTION, "DmPMCInstallAndStart");
-    LOAD_IMPORT(xbdm, 0x00C5, FUNCTION, "DmPMCStopAndReport");
-    LOAD_IMPORT(xbdm, 0x00C6, FUNCTION, "DmPMCInstallSetup");
-    LOAD_IMPORT(xbdm, 0x00C7, FUNCTION, "DmPMCUnInstallSetup");
-    LOAD_IMPORT(xbdm, 0x00C8, FUNCTION, "DmPMCResetCounters");
-    LOAD_IMPORT(xbdm, 0x00C9, FUNCTION, "DmPMCSetTriggerProcessor");
-    LOAD_IMPORT(xbdm, 0x00CA, FUNCTION, "DmPMCStart");
-    LOAD_IMPORT(xbdm, 0x00CB, FUNCTION, "DmPMCStop");
-    LOAD_IMPORT(xbdm, 0x00CC, FUNCTION, "DmPMCGetCounter");
-    LOAD_IMPORT(xbdm, 0x00CD, FUNCTION, "DmPMCGetCounters");
-    LOAD_IMPORT(xbdm, 0x00CE, FUNCTION, "DmPMCGetCounterName");
-    LOAD_IMPORT(xbdm, 0x00CF, FUNCTION, "DmPMCDumpCounters");
-    LOAD_IMPORT(xbdm, 0x00D0, FUNCTION, "DmPMCDumpCountersVerbose");
-    LOAD_IMPORT(xbdm, 0x00D1, FUNCTION, "DmPMCGetCounterCostEstimate");
-    LOAD_IMPORT(xbdm, 0x00D2, FUNCTION, "DmPMCGetCounterSource");
-    LOAD_IMPORT(xbdm, 0x00D3, FUNCTION, "DmPMCComputeFrequency");
-    LOAD_IMPORT(xbdm, 0x00D4, FUNCTION, "DmGetAdditionalTitleMemorySetting");
-    LOAD_IMPORT(xbdm, 0x00D5, FUNCTION, "DmGetDebugMemorySize");
-    LOAD_IMPORT(xbdm, 0x00D6, FUNCTION, "DmGetConsoleDebugMemoryStatus");
-    LOAD_IMPORT(xbdm, 0x00D7, FUNCTION, "DmNetSimSetLinkStatusHidden");
-    LOAD_IMPORT(xbdm, 0x00D8, FUNCTION, "DmNetSimInsertQueue");
-    LOAD_IMPORT(xbdm, 0x00D9, FUNCTION, "DmNetSimRemoveQueue");
-    LOAD_IMPORT(xbdm, 0x00DA, FUNCTION, "DmNetSimRemoveAllQueues");
-    LOAD_IMPORT(xbdm, 0x00DB, FUNCTION, "DmNetSimModifyQueueSettings");
-    LOAD_IMPORT(xbdm, 0x00DC, FUNCTION, "DmGetConsoleFeatures");
-    LOAD_IMPORT(xbdm, 0x00DD, FUNCTION, "DmNetSimGetQueueStats");
-    LOAD_IMPORT(xbdm, 0x00DE, FUNCTION, "DmNetSimGetQueueSettings");
-    LOAD_IMPORT(xbdm, 0x00DF, FUNCTION, "DmNetSimGetNumQueues");
-    LOAD_IMPORT(xbdm, 0x00E0, FUNCTION, "DmNetSimInsertIpv4Redirect");
-    LOAD_IMPORT(xbdm, 0x00E1, FUNCTION, "DmNetSimRemoveIpv4Redirect");
-    LOAD_IMPORT(xbdm, 0x00E2, FUNCTION, "DmNetSimGetNumIpv4Redirects");
-    LOAD_IMPORT(xbdm, 0x012C, FUNCTION, "XLFAllocate");
-    LOAD_IMPORT(xbdm, 0x012D, FUNCTION, "XLFFree");
-    LOAD_IMPORT(xbdm, 0x012E, FUNCTION, "XLFQueueAdd");
-    LOAD_IMPORT(xbdm, 0x012F, FUNCTION, "XLFQueueAllocated");
-    LOAD_IMPORT(xbdm, 0x0130, FUNCTION, "XLFQueueCreate");
-    LOAD_IMPORT(xbdm, 0x0131, FUNCTION, "XLFQueueDestroy");
-    LOAD_IMPORT(xbdm, 0x0132, FUNCTION, "XLFQueueGetEntryCount");
-    LOAD_IMPORT(xbdm, 0x0133, FUNCTION, "XLFQueueIsEmpty");
-    LOAD_IMPORT(xbdm, 0x0134, FUNCTION, "XLFQueueRemove");
-    LOAD_IMPORT(xbdm, 0x0135, FUNCTION, "XLFQueueUnsafeDump");
-    LOAD_IMPORT(xbdm, 0x0136, FUNCTION, "XLFStackAllocated");
-    LOAD_IMPORT(xbdm, 0x0137, FUNCTION, "XLFStackCreate");
-    LOAD_IMPORT(xbdm, 0x0138, FUNCTION, "XLFStackDestroy");
-    LOAD_IMPORT(xbdm, 0x0139, FUNCTION, "XLFStackGetEntryCount");
-    LOAD_IMPORT(xbdm, 0x013A, FUNCTION, "XLFStackIsEmpty");
-    LOAD_IMPORT(xbdm, 0x013B, FUNCTION, "XLFStackPop");
-    LOAD_IMPORT(xbdm, 0x013C, FUNCTION, "XLFStackPush");
-    LOAD_IMPORT(xbdm, 0x013D, FUNCTION, "XLFStackUnsafeDump");
-    LOAD_IMPORT(xbdm, 0x0140, FUNCTION, "XLFPriorityQueueAdd");
-    LOAD_IMPORT(xbdm, 0x0141, FUNCTION, "XLFPriorityQueueAllocated");
-    LOAD_IMPORT(xbdm, 0x0142, FUNCTION, "XLFPriorityQueueCreate");
-    LOAD_IMPORT(xbdm, 0x0143, FUNCTION, "XLFPriorityQueueDestroy");
-    LOAD_IMPORT(xbdm, 0x0144, FUNCTION, "XLFPriorityQueueGetEntryCount");
-    LOAD_IMPORT(xbdm, 0x0145, FUNCTION, "XLFPriorityQueueIsEmpty");
-    LOAD_IMPORT(xbdm, 0x0146, FUNCTION, "XLFPriorityQueueRemoveFirst");
-    LOAD_IMPORT(xbdm, 0x0147, FUNCTION, "XLFPriorityQueueRemove");
-    LOAD_IMPORT(xbdm, 0x0148, FUNCTION, "XLFPriorityQueueUnsafeDump");
-    LOAD_IMPORT(xbdm, 0x014A, FUNCTION, "XLFHashTableAdd");
-    LOAD_IMPORT(xbdm, 0x014B, FUNCTION, "XLFHashTableAllocated");
-    LOAD_IMPORT(xbdm, 0x014C, FUNCTION, "XLFHashTableCreate");
-    LOAD_IMPORT(xbdm, 0x014D, FUNCTION, "XLFHashTableDestroy");
-    LOAD_IMPORT(xbdm, 0x014E, FUNCTION, "XLFHashTableGetEntryCount");
-    LOAD_IMPORT(xbdm, 0x014F, FUNCTION, "XLFHashTableIsEmpty");
-    LOAD_IMPORT(xbdm, 0x0150, FUNCTION, "XLFHashTableRemoveFirst");
-    LOAD_IMPORT(xbdm, 0x0151, FUNCTION, "XLFHashTableRemove");
-    LOAD_IMPORT(xbdm, 0x0152, FUNCTION, "XLFHashTableUnsafeDump");
-    LOAD_IMPORT(xbdm, 0x0154, FUNCTION, "XLFPoolAcquireLock");
-    LOAD_IMPORT(xbdm, 0x0155, FUNCTION, "XLFPoolAllocated");
-    LOAD_IMPORT(xbdm, 0x0156, FUNCTION, "XLFPoolCreate");
-    LOAD_IMPORT(xbdm, 0x0157, FUNCTION, "XLFPoolCreateLock");
-    LOAD_IMPORT(xbdm, 0x0158, FUNCTION, "XLFPoolDestroy");
-    LOAD_IMPORT(xbdm, 0x0159, FUNCTION, "XLFPoolDestroyLock");
-    LOAD_IMPORT(xbdm, 0x015A, FUNCTION, "XLFPoolIncreaseEvents");
-    LOAD_IMPORT(xbdm, 0x015B, FUNCTION, "XLFPoolIncreaseLocks");
-    LOAD_IMPORT(xbdm, 0x015C, FUNCTION, "XLFPoolInitializeLock");
-    LOAD_IMPORT(xbdm, 0x015D, FUNCTION, "XLFPoolNumberOfEvents");
-    LOAD_IMPORT(xbdm, 0x015E, FUNCTION, "XLFPoolNumberOfLocks");
-    LOAD_IMPORT(xbdm, 0x015F, FUNCTION, "XLFPoolReleaseLock");
-    LOAD_IMPORT(xbdm, 0x0163, FUNCTION, "XLFStartLog");
-    LOAD_IMPORT(xbdm, 0x0164, FUNCTION, "XLFStartUserLog");
-    LOAD_IMPORT(xbdm, 0x0165, FUNCTION, "XLFInitializeLog");
-    LOAD_IMPORT(xbdm, 0x0166, FUNCTION, "XLFInitializeUserLog");
-    LOAD_IMPORT(xbdm, 0x0168, FUNCTION, "XLFEndLog");
-    LOAD_IMPORT(xbdm, 0x0169, FUNCTION, "XLFLogPrint");
-    LOAD_IMPORT(xbdm, 0x016A, FUNCTION, "XLFLogPrintV");
-    LOAD_IMPORT(xbdm, 0x016B, FUNCTION, "XLFLogBuffer");
-    LOAD_IMPORT(xbdm, 0x016C, FUNCTION, "XLFLogMessageStats");
-    LOAD_IMPORT(xbdm, 0x0172, FUNCTION, "XLockFreeGetErrorHandler");
-    LOAD_IMPORT(xbdm, 0x0173, FUNCTION, "XLockFreeSetErrorHandler");
-}
\ No newline at end of file
+    LOAD_IMPORT(xbdm, 0x0001, FUNCTION, "DmAllocatePool")
+    LOAD_IMPORT(xbdm, 0x0002, FUNCTION, "DmAllocatePoolWithTag")
+    LOAD_IMPORT(xbdm, 0x0003, FUNCTION, "DmCloseCounters")
+    LOAD_IMPORT(xbdm, 0x0004, FUNCTION, "DmCloseModuleSections")
+    LOAD_IMPORT(xbdm, 0x0005, FUNCTION, "DmCloseModuleSections")
+    LOAD_IMPORT(xbdm, 0x0006, FUNCTION, "DmCloseNotificationSession")
+    LOAD_IMPORT(xbdm, 0x0007, FUNCTION, "DmClosePerformanceCounter")
+    LOAD_IMPORT(xbdm, 0x0008, FUNCTION, "DmContinueThread")
+    LOAD_IMPORT(xbdm, 0x0009, FUNCTION, "DmFreePool")
+    LOAD_IMPORT(xbdm, 0x000A, FUNCTION, "DmGetMemory")
+    LOAD_IMPORT(xbdm, 0x000B, FUNCTION, "DmGetModuleLongName")
+    LOAD_IMPORT(xbdm, 0x000C, FUNCTION, "DmGetProcAddress")
+    LOAD_IMPORT(xbdm, 0x000D, FUNCTION, "DmGetThreadContext")
+    LOAD_IMPORT(xbdm, 0x000F, FUNCTION, "DmGetThreadList")
+    LOAD_IMPORT(xbdm, 0x0010, FUNCTION, "DmGetXbeInfo")
+    LOAD_IMPORT(xbdm, 0x0011, FUNCTION, "DmGetXboxName")
+    LOAD_IMPORT(xbdm, 0x0013, FUNCTION, "DmGo")
+    LOAD_IMPORT(xbdm, 0x0014, FUNCTION, "DmHaltThread")
+    LOAD_IMPORT(xbdm, 0x0015, FUNCTION, "DmIsDebuggerPresent")
+    LOAD_IMPORT(xbdm, 0x0016, FUNCTION, "DmIsThreadStopped")
+    LOAD_IMPORT(xbdm, 0x0017, FUNCTION, "DmLoadExtension")
+    LOAD_IMPORT(xbdm, 0x0018, FUNCTION, "DmNotify")
+    LOAD_IMPORT(xbdm, 0x0019, FUNCTION, "DmOpenNotificationSession")
+    LOAD_IMPORT(xbdm, 0x001A, FUNCTION, "DmOpenPerformanceCounter")
+    LOAD_IMPORT(xbdm, 0x001B, FUNCTION, "DmQueryPerformanceCounterHandle")
+    LOAD_IMPORT(xbdm, 0x001C, FUNCTION, "DmReboot")
+    LOAD_IMPORT(xbdm, 0x001E, FUNCTION, "DmRegisterCommandProcessor")
+    LOAD_IMPORT(xbdm, 0x0020, FUNCTION, "DmRegisterNotificationProcessor")
+    LOAD_IMPORT(xbdm, 0x0021, FUNCTION, "DmRegisterPerformanceCounter")
+    LOAD_IMPORT(xbdm, 0x0022, FUNCTION, "DmRemoveBreakpoint")
+    LOAD_IMPORT(xbdm, 0x0023, FUNCTION, "DmResumeThread")
+    LOAD_IMPORT(xbdm, 0x0024, FUNCTION, "DmSendNotificationString")
+    LOAD_IMPORT(xbdm, 0x0025, FUNCTION, "DmSetBreakpoint")
+    LOAD_IMPORT(xbdm, 0x0026, FUNCTION, "DmSetDataBreakpoint")
+    LOAD_IMPORT(xbdm, 0x0027, FUNCTION, "DmSetInitialBreakpoint")
+    LOAD_IMPORT(xbdm, 0x0028, FUNCTION, "DmSetMemory")
+    LOAD_IMPORT(xbdm, 0x0029, FUNCTION, "DmSetThreadContext")
+    LOAD_IMPORT(xbdm, 0x002A, FUNCTION, "DmSetTitle")
+    LOAD_IMPORT(xbdm, 0x002B, FUNCTION, "DmSetXboxName")
+    LOAD_IMPORT(xbdm, 0x002D, FUNCTION, "DmStop")
+    LOAD_IMPORT(xbdm, 0x002E, FUNCTION, "DmStopOn")
+    LOAD_IMPORT(xbdm, 0x0030, FUNCTION, "DmSuspendThread")
+    LOAD_IMPORT(xbdm, 0x0031, FUNCTION, "DmThreadUserData")
+    LOAD_IMPORT(xbdm, 0x0032, FUNCTION, "DmUnloadExtension")
+    LOAD_IMPORT(xbdm, 0x0033, FUNCTION, "DmWalkLoadedModules")
+    LOAD_IMPORT(xbdm, 0x0034, FUNCTION, "DmWalkModuleSections")
+    LOAD_IMPORT(xbdm, 0x0035, FUNCTION, "DmWalkPerformanceCounters")
+    LOAD_IMPORT(xbdm, 0x0037, FUNCTION, "DmCloseCounters")
+    LOAD_IMPORT(xbdm, 0x0038, FUNCTION, "DmIsBreakpoint")
+    LOAD_IMPORT(xbdm, 0x0039, FUNCTION, "DmCloseCounters")
+    LOAD_IMPORT(xbdm, 0x003A, FUNCTION, "DmSetUserAccess")
+    LOAD_IMPORT(xbdm, 0x003B, FUNCTION, "DmGetUserAccess")
+    LOAD_IMPORT(xbdm, 0x003C, FUNCTION, "DmWalkUserList")
+    LOAD_IMPORT(xbdm, 0x003D, FUNCTION, "DmAddUser")
+    LOAD_IMPORT(xbdm, 0x003E, FUNCTION, "DmEnableSecurity")
+    LOAD_IMPORT(xbdm, 0x003F, FUNCTION, "DmIsSecurityEnabled")
+    LOAD_IMPORT(xbdm, 0x0040, FUNCTION, "DmRemoveUser")
+    LOAD_IMPORT(xbdm, 0x0041, FUNCTION, "__CAP_Start_Profiling")
+    LOAD_IMPORT(xbdm, 0x0042, FUNCTION, "__CAP_End_Profiling")
+    LOAD_IMPORT(xbdm, 0x0046, FUNCTION, "__CAP_Enter_Function")
+    LOAD_IMPORT(xbdm, 0x0047, FUNCTION, "__CAP_Exit_Function")
+    LOAD_IMPORT(xbdm, 0x0048, FUNCTION, "DmRegisterCommandProcessorEx")
+    LOAD_IMPORT(xbdm, 0x0049, FUNCTION, "DmStartProfiling")
+    LOAD_IMPORT(xbdm, 0x004A, FUNCTION, "DmStopProfiling")
+    LOAD_IMPORT(xbdm, 0x004B, FUNCTION, "DmQueryMemoryStatistics")
+    LOAD_IMPORT(xbdm, 0x004C, FUNCTION, "DmEnableStackTrace")
+    LOAD_IMPORT(xbdm, 0x004D, FUNCTION, "DmQueryAllocationTypeName")
+    LOAD_IMPORT(xbdm, 0x004E, FUNCTION, "DmRegisterAllocationType")
+    LOAD_IMPORT(xbdm, 0x004F, FUNCTION, "DmInsertAllocationEntry")
+    LOAD_IMPORT(xbdm, 0x0050, FUNCTION, "DmRemoveAllocationEntry")
+    LOAD_IMPORT(xbdm, 0x0051, FUNCTION, "DmSetTitleEx")
+    LOAD_IMPORT(xbdm, 0x0052, FUNCTION, "DmCaptureStackBackTrace")
+    LOAD_IMPORT(xbdm, 0x0053, FUNCTION, "DmCrashDump")
+    LOAD_IMPORT(xbdm, 0x0054, FUNCTION, "DmIsFastCAPEnabled")
+    LOAD_IMPORT(xbdm, 0x0055, FUNCTION, "DmGetFileAccessCount")
+    LOAD_IMPORT(xbdm, 0x0058, FUNCTION, "DmGetUtilityDriveInfo")
+    LOAD_IMPORT(xbdm, 0x0059, FUNCTION, "DmGetThreadInfoEx")
+    LOAD_IMPORT(xbdm, 0x005A, FUNCTION, "DmSetProfilingOptions")
+    LOAD_IMPORT(xbdm, 0x005B, FUNCTION, "DmQuerySystemSettings")
+    LOAD_IMPORT(xbdm, 0x005C, FUNCTION, "DmSaveSystemSettings")
+    LOAD_IMPORT(xbdm, 0x006A, FUNCTION, "DmpGetPgoModuleHandleForBaseAddress")
+    LOAD_IMPORT(xbdm, 0x006B, FUNCTION, "DmpOnPgoModuleLoad")
+    LOAD_IMPORT(xbdm, 0x006C, FUNCTION, "DmPgoStartDataCollection")
+    LOAD_IMPORT(xbdm, 0x006D, FUNCTION, "DmPgoStopDataCollection")
+    LOAD_IMPORT(xbdm, 0x006E, FUNCTION, "DmPgoSaveSnapshot")
+    LOAD_IMPORT(xbdm, 0x006F, FUNCTION, "IrtClientAbort")
+    LOAD_IMPORT(xbdm, 0x0070, FUNCTION, "IrtPogoInit")
+    LOAD_IMPORT(xbdm, 0x0071, FUNCTION, "IrtSetStaticInfo")
+    LOAD_IMPORT(xbdm, 0x0072, FUNCTION, "IrtAutoSweepW")
+    LOAD_IMPORT(xbdm, 0x0073, FUNCTION, "IrtAutoSweepA")
+    LOAD_IMPORT(xbdm, 0x0075, FUNCTION, "DmGetDumpMode")
+    LOAD_IMPORT(xbdm, 0x0076, FUNCTION, "DmSetDumpMode")
+    LOAD_IMPORT(xbdm, 0x0077, FUNCTION, "DmGetDumpSettings")
+    LOAD_IMPORT(xbdm, 0x0078, FUNCTION, "DmSetDumpSettings")
+    LOAD_IMPORT(xbdm, 0x0079, FUNCTION, "DmGetEventDeferFlags")
+    LOAD_IMPORT(xbdm, 0x007A, FUNCTION, "DmSetEventDeferFlags")
+    LOAD_IMPORT(xbdm, 0x007B, FUNCTION, "DmWalkCommittedMemory")
+    LOAD_IMPORT(xbdm, 0x007C, FUNCTION, "DmCloseCounters")
+    LOAD_IMPORT(xbdm, 0x007D, FUNCTION, "DmRebootEx")
+    LOAD_IMPORT(xbdm, 0x0082, FUNCTION, "DmMountFdfxVolume")
+    LOAD_IMPORT(xbdm, 0x0083, FUNCTION, "DmCapGetFileHeader")
+    LOAD_IMPORT(xbdm, 0x0084, FUNCTION, "DmCapFreeFileHeader")
+    LOAD_IMPORT(xbdm, 0x0085, FUNCTION, "DmTraceStartRecording")
+    LOAD_IMPORT(xbdm, 0x0086, FUNCTION, "DmTraceStartRecordingFunction")
+    LOAD_IMPORT(xbdm, 0x0087, FUNCTION, "DmTraceSetBufferSize")
+    LOAD_IMPORT(xbdm, 0x0088, FUNCTION, "DmTraceStopRecording")
+    LOAD_IMPORT(xbdm, 0x0089, FUNCTION, "DmTraceSaveBuffer")
+    LOAD_IMPORT(xbdm, 0x008C, FUNCTION, "DmGetConsoleType")
+    LOAD_IMPORT(xbdm, 0x008D, FUNCTION, "DmMapDevkitDrive")
+    LOAD_IMPORT(xbdm, 0x008E, FUNCTION, "DmWalkLoadedModulesEx")
+    LOAD_IMPORT(xbdm, 0x008F, FUNCTION, "DmGetXexHeaderField")
+    LOAD_IMPORT(xbdm, 0x0090, FUNCTION, "DmGetMouseChanges")
+    LOAD_IMPORT(xbdm, 0x0091, FUNCTION, "DmFindPdbSignature")
+    LOAD_IMPORT(xbdm, 0x0092, FUNCTION, "DmGetProfilingStatus")
+    LOAD_IMPORT(xbdm, 0x0093, FUNCTION, "DmOpticalDiscLogStart")
+    LOAD_IMPORT(xbdm, 0x0094, FUNCTION, "DmOpticalDiscLogStop")
+    LOAD_IMPORT(xbdm, 0x0095, FUNCTION, "DmStartSamplingProfiler")
+    LOAD_IMPORT(xbdm, 0x0096, FUNCTION, "DmStopSamplingProfiler")
+    LOAD_IMPORT(xbdm, 0x0097, FUNCTION, "DmGetSamplingProfilerInfo")
+    LOAD_IMPORT(xbdm, 0x0098, FUNCTION, "DmStartFileEventCapture")
+    LOAD_IMPORT(xbdm, 0x0099, FUNCTION, "DmStopFileEventCapture")
+    LOAD_IMPORT(xbdm, 0x009A, FUNCTION, "DmSetFileEventMarker")
+    LOAD_IMPORT(xbdm, 0x009B, FUNCTION, "DmMarkPseudoCreateBegin")
+    LOAD_IMPORT(xbdm, 0x009C, FUNCTION, "DmMarkPseudoCreateEnd")
+    LOAD_IMPORT(xbdm, 0x009D, FUNCTION, "DmMarkPseudoEventBegin")
+    LOAD_IMPORT(xbdm, 0x009E, FUNCTION, "DmMarkPseudoEventEnd")
+    LOAD_IMPORT(xbdm, 0x009F, FUNCTION, "DmMarkFileEventWorkerThreadBegin")
+    LOAD_IMPORT(xbdm, 0x00A0, FUNCTION, "DmMarkFileEventWorkerThreadEnd")
+    LOAD_IMPORT(xbdm, 0x00A1, FUNCTION, "DmGetSystemInfo")
+    LOAD_IMPORT(xbdm, 0x00A2, FUNCTION, "DmAbortProfiling")
+    LOAD_IMPORT(xbdm, 0x00A3, FUNCTION, "DmNetCaptureStart")
+    LOAD_IMPORT(xbdm, 0x00A4, FUNCTION, "DmNetCaptureStop")
+    LOAD_IMPORT(xbdm, 0x00A5, FUNCTION, "DmQueryTitleMemoryStatistics")
+    LOAD_IMPORT(xbdm, 0x00A6, FUNCTION, "DmAutomationGetInputProcess")
+    LOAD_IMPORT(xbdm, 0x00A7, FUNCTION, "DmAutomationBindController")
+    LOAD_IMPORT(xbdm, 0x00A8, FUNCTION, "DmAutomationUnbindController")
+    LOAD_IMPORT(xbdm, 0x00A9, FUNCTION, "DmAutomationConnectController")
+    LOAD_IMPORT(xbdm, 0x00AA, FUNCTION, "DmAutomationDisconnectController")
+    LOAD_IMPORT(xbdm, 0x00AB, FUNCTION, "DmAutomationSetGamepadState")
+    LOAD_IMPORT(xbdm, 0x00AC, FUNCTION, "DmAutomationQueueGamepadState")
+    LOAD_IMPORT(xbdm, 0x00AD, FUNCTION, "DmAutomationClearGamepadQueue")
+    LOAD_IMPORT(xbdm, 0x00AE, FUNCTION, "DmAutomationQueryGamepadQueue")
+    LOAD_IMPORT(xbdm, 0x00AF, FUNCTION, "DmAutomationGetUserDefaultProfile")
+    LOAD_IMPORT(xbdm, 0x00B0, FUNCTION, "DmAutomationSetUserDefaultProfile")
+    LOAD_IMPORT(xbdm, 0x00B1, FUNCTION, "DmTraceIsRecording")
+    LOAD_IMPORT(xbdm, 0x00B2, FUNCTION, "DmLoadDebuggerExtension")
+    LOAD_IMPORT(xbdm, 0x00B3, FUNCTION, "DmUnloadDebuggerExtension")
+    LOAD_IMPORT(xbdm, 0x00B4, FUNCTION, "DmCreateSystemThread")
+    LOAD_IMPORT(xbdm, 0x00B5, FUNCTION, "PEPLELookup")
+    LOAD_IMPORT(xbdm, 0x00B6, FUNCTION, "PEPLELookupCompact")
+    LOAD_IMPORT(xbdm, 0x00B7, FUNCTION, "PVPLELookup")
+    LOAD_IMPORT(xbdm, 0x00B8, FUNCTION, "PVPLELookupCompact")
+    LOAD_IMPORT(xbdm, 0x00B9, FUNCTION, "PVPLELookupCompactMDS")
+    LOAD_IMPORT(xbdm, 0x00BA, FUNCTION, "PVPLEFilteredLookup")
+    LOAD_IMPORT(xbdm, 0x00BB, FUNCTION, "PVPLEFilteredLookupCompact")
+    LOAD_IMPORT(xbdm, 0x00BC, FUNCTION, "PVPLEFilteredLookupCompactMDS")
+    LOAD_IMPORT(xbdm, 0x00BD, FUNCTION, "PVPLETemplatedLookup")
+    LOAD_IMPORT(xbdm, 0x00BE, FUNCTION, "PVPLETemplatedLookupCompact")
+    LOAD_IMPORT(xbdm, 0x00BF, FUNCTION, "PVPLETemplatedLookupCompactMDS")
+    LOAD_IMPORT(xbdm, 0x00C0, FUNCTION, "DmpPgoCounterOverflow")
+    LOAD_IMPORT(xbdm, 0x00C1, FUNCTION, "UpdateMDSProbeState")
+    LOAD_IMPORT(xbdm, 0x00C2, FUNCTION, "DmGetHttpRegistration")
+    LOAD_IMPORT(xbdm, 0x00C3, FUNCTION, "DmTraceSetIOThread")
+    LOAD_IMPORT(xbdm, 0x00C4, FUNCTION, "DmPMCInstallAndStart")
+    LOAD_IMPORT(xbdm, 0x00C5, FUNCTION, "DmPMCStopAndReport")
+    LOAD_IMPORT(xbdm, 0x00C6, FUNCTION, "DmPMCInstallSetup")
+    LOAD_IMPORT(xbdm, 0x00C7, FUNCTION, "DmPMCUnInstallSetup")
+    LOAD_IMPORT(xbdm, 0x00C8, FUNCTION, "DmPMCResetCounters")
+    LOAD_IMPORT(xbdm, 0x00C9, FUNCTION, "DmPMCSetTriggerProcessor")
+    LOAD_IMPORT(xbdm, 0x00CA, FUNCTION, "DmPMCStart")
+    LOAD_IMPORT(xbdm, 0x00CB, FUNCTION, "DmPMCStop")
+    LOAD_IMPORT(xbdm, 0x00CC, FUNCTION, "DmPMCGetCounter")
+    LOAD_IMPORT(xbdm, 0x00CD, FUNCTION, "DmPMCGetCounters")
+    LOAD_IMPORT(xbdm, 0x00CE, FUNCTION, "DmPMCGetCounterName")
+    LOAD_IMPORT(xbdm, 0x00CF, FUNCTION, "DmPMCDumpCounters")
+    LOAD_IMPORT(xbdm, 0x00D0, FUNCTION, "DmPMCDumpCountersVerbose")
+    LOAD_IMPORT(xbdm, 0x00D1, FUNCTION, "DmPMCGetCounterCostEstimate")
+    LOAD_IMPORT(xbdm, 0x00D2, FUNCTION, "DmPMCGetCounterSource")
+    LOAD_IMPORT(xbdm, 0x00D3, FUNCTION, "DmPMCComputeFrequency")
+    LOAD_IMPORT(xbdm, 0x00D4, FUNCTION, "DmGetAdditionalTitleMemorySetting")
+    LOAD_IMPORT(xbdm, 0x00D5, FUNCTION, "DmGetDebugMemorySize")
+    LOAD_IMPORT(xbdm, 0x00D6, FUNCTION, "DmGetConsoleDebugMemoryStatus")
+    LOAD_IMPORT(xbdm, 0x00D7, FUNCTION, "DmNetSimSetLinkStatusHidden")
+    LOAD_IMPORT(xbdm, 0x00D8, FUNCTION, "DmNetSimInsertQueue")
+    LOAD_IMPORT(xbdm, 0x00D9, FUNCTION, "DmNetSimRemoveQueue")
+    LOAD_IMPORT(xbdm, 0x00DA, FUNCTION, "DmNetSimRemoveAllQueues")
+    LOAD_IMPORT(xbdm, 0x00DB, FUNCTION, "DmNetSimModifyQueueSettings")
+    LOAD_IMPORT(xbdm, 0x00DC, FUNCTION, "DmGetConsoleFeatures")
+    LOAD_IMPORT(xbdm, 0x00DD, FUNCTION, "DmNetSimGetQueueStats")
+    LOAD_IMPORT(xbdm, 0x00DE, FUNCTION, "DmNetSimGetQueueSettings")
+    LOAD_IMPORT(xbdm, 0x00DF, FUNCTION, "DmNetSimGetNumQueues")
+    LOAD_IMPORT(xbdm, 0x00E0, FUNCTION, "DmNetSimInsertIpv4Redirect")
+    LOAD_IMPORT(xbdm, 0x00E1, FUNCTION, "DmNetSimRemoveIpv4Redirect")
+    LOAD_IMPORT(xbdm, 0x00E2, FUNCTION, "DmNetSimGetNumIpv4Redirects")
+    LOAD_IMPORT(xbdm, 0x012C, FUNCTION, "XLFAllocate")
+    LOAD_IMPORT(xbdm, 0x012D, FUNCTION, "XLFFree")
+    LOAD_IMPORT(xbdm, 0x012E, FUNCTION, "XLFQueueAdd")
+    LOAD_IMPORT(xbdm, 0x012F, FUNCTION, "XLFQueueAllocated")
+    LOAD_IMPORT(xbdm, 0x0130, FUNCTION, "XLFQueueCreate")
+    LOAD_IMPORT(xbdm, 0x0131, FUNCTION, "XLFQueueDestroy")
+    LOAD_IMPORT(xbdm, 0x0132, FUNCTION, "XLFQueueGetEntryCount")
+    LOAD_IMPORT(xbdm, 0x0133, FUNCTION, "XLFQueueIsEmpty")
+    LOAD_IMPORT(xbdm, 0x0134, FUNCTION, "XLFQueueRemove")
+    LOAD_IMPORT(xbdm, 0x0135, FUNCTION, "XLFQueueUnsafeDump")
+    LOAD_IMPORT(xbdm, 0x0136, FUNCTION, "XLFStackAllocated")
+    LOAD_IMPORT(xbdm, 0x0137, FUNCTION, "XLFStackCreate")
+    LOAD_IMPORT(xbdm, 0x0138, FUNCTION, "XLFStackDestroy")
+    LOAD_IMPORT(xbdm, 0x0139, FUNCTION, "XLFStackGetEntryCount")
+    LOAD_IMPORT(xbdm, 0x013A, FUNCTION, "XLFStackIsEmpty")
+    LOAD_IMPORT(xbdm, 0x013B, FUNCTION, "XLFStackPop")
+    LOAD_IMPORT(xbdm, 0x013C, FUNCTION, "XLFStackPush")
+    LOAD_IMPORT(xbdm, 0x013D, FUNCTION, "XLFStackUnsafeDump")
+    LOAD_IMPORT(xbdm, 0x0140, FUNCTION, "XLFPriorityQueueAdd")
+    LOAD_IMPORT(xbdm, 0x0141, FUNCTION, "XLFPriorityQueueAllocated")
+    LOAD_IMPORT(xbdm, 0x0142, FUNCTION, "XLFPriorityQueueCreate")
+    LOAD_IMPORT(xbdm, 0x0143, FUNCTION, "XLFPriorityQueueDestroy")
+    LOAD_IMPORT(xbdm, 0x0144, FUNCTION, "XLFPriorityQueueGetEntryCount")
+    LOAD_IMPORT(xbdm, 0x0145, FUNCTION, "XLFPriorityQueueIsEmpty")
+    LOAD_IMPORT(xbdm, 0x0146, FUNCTION, "XLFPriorityQueueRemoveFirst")
+    LOAD_IMPORT(xbdm, 0x0147, FUNCTION, "XLFPriorityQueueRemove")
+    LOAD_IMPORT(xbdm, 0x0148, FUNCTION, "XLFPriorityQueueUnsafeDump")
+    LOAD_IMPORT(xbdm, 0x014A, FUNCTION, "XLFHashTableAdd")
+    LOAD_IMPORT(xbdm, 0x014B, FUNCTION, "XLFHashTableAllocated")
+    LOAD_IMPORT(xbdm, 0x014C, FUNCTION, "XLFHashTableCreate")
+    LOAD_IMPORT(xbdm, 0x014D, FUNCTION, "XLFHashTableDestroy")
+    LOAD_IMPORT(xbdm, 0x014E, FUNCTION, "XLFHashTableGetEntryCount")
+    LOAD_IMPORT(xbdm, 0x014F, FUNCTION, "XLFHashTableIsEmpty")
+    LOAD_IMPORT(xbdm, 0x0150, FUNCTION, "XLFHashTableRemoveFirst")
+    LOAD_IMPORT(xbdm, 0x0151, FUNCTION, "XLFHashTableRemove")
+    LOAD_IMPORT(xbdm, 0x0152, FUNCTION, "XLFHashTableUnsafeDump")
+    LOAD_IMPORT(xbdm, 0x0154, FUNCTION, "XLFPoolAcquireLock")
+    LOAD_IMPORT(xbdm, 0x0155, FUNCTION, "XLFPoolAllocated")
+    LOAD_IMPORT(xbdm, 0x0156, FUNCTION, "XLFPoolCreate")
+    LOAD_IMPORT(xbdm, 0x0157, FUNCTION, "XLFPoolCreateLock")
+    LOAD_IMPORT(xbdm, 0x0158, FUNCTION, "XLFPoolDestroy")
+    LOAD_IMPORT(xbdm, 0x0159, FUNCTION, "XLFPoolDestroyLock")
+    LOAD_IMPORT(xbdm, 0x015A, FUNCTION, "XLFPoolIncreaseEvents")
+    LOAD_IMPORT(xbdm, 0x015B, FUNCTION, "XLFPoolIncreaseLocks")
+    LOAD_IMPORT(xbdm, 0x015C, FUNCTION, "XLFPoolInitializeLock")
+    LOAD_IMPORT(xbdm, 0x015D, FUNCTION, "XLFPoolNumberOfEvents")
+    LOAD_IMPORT(xbdm, 0x015E, FUNCTION, "XLFPoolNumberOfLocks")
+    LOAD_IMPORT(xbdm, 0x015F, FUNCTION, "XLFPoolReleaseLock")
+    LOAD_IMPORT(xbdm, 0x0163, FUNCTION, "XLFStartLog")
+    LOAD_IMPORT(xbdm, 0x0164, FUNCTION, "XLFStartUserLog")
+    LOAD_IMPORT(xbdm, 0x0165, FUNCTION, "XLFInitializeLog")
+    LOAD_IMPORT(xbdm, 0x0166, FUNCTION, "XLFInitializeUserLog")
+    LOAD_IMPORT(xbdm, 0x0168, FUNCTION, "XLFEndLog")
+    LOAD_IMPORT(xbdm, 0x0169, FUNCTION, "XLFLogPrint")
+    LOAD_IMPORT(xbdm, 0x016A, FUNCTION, "XLFLogPrintV")
+    LOAD_IMPORT(xbdm, 0x016B, FUNCTION, "XLFLogBuffer")
+    LOAD_IMPORT(xbdm, 0x016C, FUNCTION, "XLFLogMessageStats")
+    LOAD_IMPORT(xbdm, 0x0172, FUNCTION, "XLockFreeGetErrorHandler")
+    LOAD_IMPORT(xbdm, 0x0173, FUNCTION, "XLockFreeSetErrorHandler")
+};
+
+#undef LOAD_IMPORT
+
+static constexpr uint32_t s_knownImportCount = sizeof(s_knownImports) / sizeof(s_knownImports[0]);
+static_assert(s_knownImportCount < 0xFFFF, "ordinal index slots are 16 bit");
+
+static constexpr uint32_t maxKnownOrdinal(XboxLibrary lib)
+{
+    uint32_t maxOrdinal = 0;
+    for (uint32_t i = 0; i < s_knownImportCount; i++)
+    {
+        if (s_knownImports[i].lib == lib && s_knownImports[i].ordinal > maxOrdinal)
+            maxOrdinal = s_knownImports[i].ordinal;
+    }
+    return maxOrdinal;
+}
+
+// ordinal -> index + 1 into s_knownImports, 0 for ordinals without a known name
+template <XboxLibrary Lib>
+struct OrdinalIndex
+{
+    static constexpr uint32_t size = maxKnownOrdinal(Lib) + 1;
+    std::array<uint16_t, size> slots{};
+
+    constexpr OrdinalIndex()
+    {
+        for (uint32_t i = 0; i < s_knownImportCount; i++)
+        {
+            if (s_knownImports[i].lib == Lib)
+                slots[s_knownImports[i].ordinal] = (uint16_t)(i + 1);
+        }
+    }
+
+    inline const KnownImport* find(uint32_t ordinal) const
+    {
+        if (ordinal >= size || slots[ordinal] == 0)
+            return nullptr;
+        return &s_knownImports[slots[ordinal] - 1];
+    }
+};
+
+static constexpr OrdinalIndex<XboxKrnl> s_xboxKrnlOrdinals;
+static constexpr OrdinalIndex<Xam> s_xamOrdinals;
+static constexpr OrdinalIndex<xbdm> s_xbdmOrdinals;
+
+// maps an import library name from the XEX header, false if it is not one we know
+static inline bool findImportLibrary(const std::string& libName, XboxLibrary& lib)
+{
+    if (strcmp(libName.c_str(), "xboxkrnl.exe") == 0)
+        lib = XboxKrnl;
+    else if (strcmp(libName.c_str(), "xam.xex") == 0)
+        lib = Xam;
+    else if (strcmp(libName.c_str(), "xbdm.xex") == 0)
+        lib = xbdm;
+    else
+        return false;
+    return true;
+}
+
+static inline const KnownImport* findImport_FromLib(XboxLibrary lib, uint32_t ordinal)
+{
+    switch (lib)
+    {
+    case XboxKrnl: return s_xboxKrnlOrdinals.find(ordinal);
+    case Xam: return s_xamOrdinals.find(ordinal);
+    case xbdm: return s_xbdmOrdinals.find(ordinal);
+    default: return nullptr;
+    }
+}
@@ -0,0 +1,548 @@
+#include "LZX.h"
+#include <stdio.h>
+#include <cstring>
+
+// format constants
+#define LZX_MIN_MATCH 2
+#define LZX_NUM_CHARS 256
+#define LZX_NUM_PRIMARY_LENGTHS 7
+#define LZX_NUM_SECONDARY_LENGTHS 249
+#define LZX_PRETREE_SYMBOLS 20
+#define LZX_ALIGNED_SYMBOLS 8
+#define LZX_FRAME_SIZE 32768
+
+#define LZX_BLOCKTYPE_VERBATIM 1
+#define LZX_BLOCKTYPE_ALIGNED 2
+#define LZX_BLOCKTYPE_UNCOMPRESSED 3
+
+// lookup bits per tree
+#define LZX_PRETREE_TABLEBITS 6
+#define LZX_MAINTREE_TABLEBITS 12
+#define LZX_LENGTH_TABLEBITS 12
+#define LZX_ALIGNED_TABLEBITS 7
+
+// how many zero words can be read past the end of the input before we call it corrupt
+#define LZX_MAX_PAD_WORDS 16
+
+// position slots per window size, windows are 2^15 to 2^21
+static const uint32_t s_positionSlots[] = {30, 32, 34, 36, 38, 42, 50};
+
+struct LzxSlotTables {
+  uint8_t extraBits[51];
+  uint32_t positionBase[51];
+
+  LzxSlotTables() {
+    for (uint32_t i = 0, j = 0; i < 50; i += 2) {
+      extraBits[i] = (uint8_t)j; // 0,0,0,0,1,1,2,2,3,3...
+      extraBits[i + 1] = (uint8_t)j;
+      if (i != 0 && j < 17)
+        j++;
+    }
+    extraBits[50] = 17;
+    for (uint32_t i = 0, j = 0; i < 51; i++) {
+      positionBase[i] = j; // 0,1,2,3,4,6,8,12,16,24,32...
+      j += 1u << extraBits[i];
+    }
+  }
+};
+static const LzxSlotTables s_slots;
+
+//
+// LzxInputStream
+//
+
+void LzxInputStream::Publish(size_t totalBytes) {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_available.store(totalBytes < m_capacity ? totalBytes : m_capacity, std::memory_order_release);
+  }
+  m_cond.notify_all();
+}
+
+void LzxInputStream::Finish() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_finished.store(true, std::memory_order_release);
+  }
+  m_cond.notify_all();
+}
+
+void LzxInputStream::Abort() {
+  m_aborted.store(true, std::memory_order_relaxed);
+}
+
+size_t LzxInputStream::WaitFor(size_t needed) {
+  size_t available = m_available.load(std::memory_order_acquire);
+  if (available >= needed || m_finished.load(std::memory_order_acquire))
+    return available;
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_cond.wait(lock, [&] {
+    return m_available.load(std::memory_order_acquire) >= needed || m_finished.load(std::memory_order_acquire);
+  });
+  return m_available.load(std::memory_order_acquire);
+}
+
+//
+// LzxDecoder
+//
+
+LzxDecoder::LzxDecoder(uint32_t windowBits) {
+  if (windowBits < 15)
+    windowBits = 15;
+  if (windowBits > 21)
+    windowBits = 21;
+  m_windowSize = 1u << windowBits;
+  m_numOffsets = s_positionSlots[windowBits - 15] << 3;
+}
+
+void LzxDecoder::Refill() {
+  while (m_bitsLeft <= 48) {
+    if (m_inPos + 2 > m_inLimit) {
+      m_inLimit = m_input->WaitFor(m_inPos + 2);
+      if (m_inPos + 2 > m_inLimit) {
+        // out of input, feed zeros and let the caller notice the overrun
+        m_padWords++;
+        m_bitsLeft += 16;
+        continue;
+      }
+    }
+    const uint64_t word = (uint64_t)m_in[m_inPos] | ((uint64_t)m_in[m_inPos + 1] << 8);
+    m_bitBuf |= word << (48 - m_bitsLeft);
+    m_bitsLeft += 16;
+    m_inPos += 2;
+  }
+}
+
+bool LzxDecoder::ReadByte(uint8_t &value) {
+  if (m_inPos + 1 > m_inLimit) {
+    m_inLimit = m_input->WaitFor(m_inPos + 1);
+    if (m_inPos + 1 > m_inLimit)
+      return false;
+  }
+  value = m_in[m_inPos++];
+  return true;
+}
+
+// drop the buffered bits and move the byte position to the next 16 bit boundary,
+// uncompressed blocks always skip 1-16 bits, frame ends only skip to the boundary
+void LzxDecoder::AlignToWord(bool forceSkip) {
+  if (forceSkip) {
+    const size_t consumedBits = m_inPos * 8 + (size_t)m_padWords * 16 - m_bitsLeft;
+    size_t alignedPos = (consumedBits / 16 + 1) * 2;
+    alignedPos = alignedPos > (size_t)m_padWords * 2 ? alignedPos - (size_t)m_padWords * 2 : 0;
+    m_inPos = alignedPos;
+    m_bitBuf = 0;
+    m_bitsLeft = 0;
+    m_padWords = 0;
+  } else if (m_bitsLeft & 15) {
+    RemoveBits(m_bitsLeft & 15);
+  }
+}
+
+bool LzxDecoder::BuildTable(HuffTable &table, const uint8_t *lengths, uint32_t numSymbols, uint32_t tableBits) {
+  table.tableBits = tableBits;
+  table.numSymbols = numSymbols;
+
+  memset(table.count, 0, sizeof(table.count));
+  for (uint32_t s = 0; s < numSymbols; s++)
+    table.count[lengths[s]]++;
+  table.count[0] = 0;
+
+  // all zero lengths is allowed, decoding from it is an error
+  table.empty = true;
+  for (uint32_t l = 1; l <= HuffTable::MAX_BITS; l++) {
+    if (table.count[l])
+      table.empty = false;
+  }
+  memset(table.fast, 0, sizeof(uint16_t) << tableBits);
+  if (table.empty)
+    return true;
+
+  // canonical codes, shorter codes first then by symbol
+  uint32_t code = 0;
+  uint32_t index = 0;
+  for (uint32_t l = 1; l <= HuffTable::MAX_BITS; l++) {
+    code = (code + (l > 1 ? table.count[l - 1] : 0)) << (l > 1 ? 1 : 0);
+    table.firstCode[l] = code;
+    table.offset[l] = index;
+    index += table.count[l];
+    if (code + table.count[l] > (1u << l)) {
+      printf("LZX: Oversubscribed huffman table\n");
+      return false;
+    }
+  }
+
+  uint32_t next[HuffTable::MAX_BITS + 1];
+  memcpy(next, table.offset, sizeof(next));
+  for (uint32_t s = 0; s < numSymbols; s++) {
+    if (lengths[s])
+      table.sorted[next[lengths[s]]++] = (uint16_t)s;
+  }
+
+  // direct lookup for codes that fit in tableBits
+  for (uint32_t l = 1; l <= tableBits; l++) {
+    for (uint32_t i = 0; i < table.count[l]; i++) {
+      const uint32_t symbol = table.sorted[table.offset[l] + i];
+      const uint32_t first = (table.firstCode[l] + i) << (tableBits - l);
+      const uint16_t entry = (uint16_t)((symbol << 4) | l);
+      for (uint32_t j = 0; j < (1u << (tableBits - l)); j++)
+        table.fast[first + j] = entry;
+    }
+  }
+  return true;
+}
+
+bool LzxDecoder::DecodeSymbol(const HuffTable &table, uint32_t &symbol) {
+  const uint32_t bits = PeekBits(HuffTable::MAX_BITS);
+  const uint16_t entry = table.fast[bits >> (HuffTable::MAX_BITS - table.tableBits)];
+  if (entry != 0) {
+    symbol = entry >> 4;
+    RemoveBits(entry & 15);
+    return true;
+  }
+
+  if (table.empty) {
+    printf("LZX: Decoding from an empty huffman table\n");
+    return false;
+  }
+
+  // longer codes, walk the canonical ranges
+  for (uint32_t l = table.tableBits + 1; l <= HuffTable::MAX_BITS; l++) {
+    const uint32_t code = bits >> (HuffTable::MAX_BITS - l);
+    if (code - table.firstCode[l] < table.count[l]) {
+      symbol = table.sorted[table.offset[l] + code - table.firstCode[l]];
+      RemoveBits(l);
+      return true;
+    }
+  }
+
+  printf("LZX: Invalid huffman code\n");
+  return false;
+}
+
+// lengths are sent as deltas against the previous block through the pretree
+bool LzxDecoder::ReadLengths(uint8_t *lengths, uint32_t first, uint32_t last) {
+  uint8_t pretreeLengths[LZX_PRETREE_SYMBOLS];
+  for (uint32_t i = 0; i < LZX_PRETREE_SYMBOLS; i++)
+    pretreeLengths[i] = (uint8_t)ReadBits(4);
+  if (!BuildTable(m_pretree, pretreeLengths, LZX_PRETREE_SYMBOLS, LZX_PRETREE_TABLEBITS))
+    return false;
+
+  for (uint32_t x = first; x < last;) {
+    uint32_t z;
+    if (!DecodeSymbol(m_pretree, z))
+      return false;
+
+    if (z == 17 || z == 18) {
+      // run of zeros
+      uint32_t run = z == 17 ? ReadBits(4) + 4 : ReadBits(5) + 20;
+      if (x + run > last)
+        return false;
+      while (run--)
+        lengths[x++] = 0;
+    } else if (z == 19) {
+      // run of the same delta
+      uint32_t run = ReadBits(1) + 4;
+      if (!DecodeSymbol(m_pretree, z) || z > 16 || x + run > last)
+        return false;
+      const int value = ((int)lengths[x] - (int)z + 17) % 17;
+      while (run--)
+        lengths[x++] = (uint8_t)value;
+    } else {
+      lengths[x] = (uint8_t)(((int)lengths[x] - (int)z + 17) % 17);
+      x++;
+    }
+  }
+  return true;
+}
+
+bool LzxDecoder::ReadBlockHeader() {
+  // uncompressed blocks are padded to an even size
+  if (m_blockType == LZX_BLOCKTYPE_UNCOMPRESSED && (m_blockLength & 1)) {
+    uint8_t pad;
+    if (!ReadByte(pad))
+      return false;
+  }
+
+  m_blockType = ReadBits(3);
+  const uint32_t hi = ReadBits(16);
+  const uint32_t lo = ReadBits(8);
+  m_blockRemaining = m_blockLength = (hi << 8) | lo;
+
+  switch (m_blockType) {
+  case LZX_BLOCKTYPE_ALIGNED: {
+    uint8_t alignedLengths[LZX_ALIGNED_SYMBOLS];
+    for (uint32_t i = 0; i < LZX_ALIGNED_SYMBOLS; i++)
+      alignedLengths[i] = (uint8_t)ReadBits(3);
+    if (!BuildTable(m_alignedTree, alignedLengths, LZX_ALIGNED_SYMBOLS, LZX_ALIGNED_TABLEBITS))
+      return false;
+  }
+    // rest of the header is the same as verbatim
+    [[fallthrough]];
+  case LZX_BLOCKTYPE_VERBATIM: {
+    if (!ReadLengths(m_mainLengths, 0, LZX_NUM_CHARS))
+      return false;
+    if (!ReadLengths(m_mainLengths, LZX_NUM_CHARS, LZX_NUM_CHARS + m_numOffsets))
+      return false;
+    if (!BuildTable(m_mainTree, m_mainLengths, LZX_NUM_CHARS + m_numOffsets, LZX_MAINTREE_TABLEBITS))
+      return false;
+    if (m_mainLengths[0xE8] != 0)
+      m_intelStarted = true;
+
+    if (!ReadLengths(m_lengthLengths, 0, LZX_NUM_SECONDARY_LENGTHS))
+      return false;
+    if (!BuildTable(m_lengthTree, m_lengthLengths, LZX_NUM_SECONDARY_LENGTHS, LZX_LENGTH_TABLEBITS))
+      return false;
+    return true;
+  }
+
+  case LZX_BLOCKTYPE_UNCOMPRESSED: {
+    m_intelStarted = true;
+    AlignToWord(true);
+
+    // stored repeated offsets
+    uint8_t r[12];
+    for (uint32_t i = 0; i < 12; i++) {
+      if (!ReadByte(r[i]))
+        return false;
+    }
+    m_r0 = r[0] | (r[1] << 8) | (r[2] << 16) | ((uint32_t)r[3] << 24);
+    m_r1 = r[4] | (r[5] << 8) | (r[6] << 16) | ((uint32_t)r[7] << 24);
+    m_r2 = r[8] | (r[9] << 8) | (r[10] << 16) | ((uint32_t)r[11] << 24);
+    return true;
+  }
+  }
+
+  printf("LZX: Invalid block type %u\n", m_blockType);
+  return false;
+}
+
+bool LzxDecoder::DecodeCompressed(uint32_t wanted, uint32_t &produced) {
+  const bool aligned = m_blockType == LZX_BLOCKTYPE_ALIGNED;
+  const uint32_t start = m_pos;
+
+  while (m_pos - start < wanted) {
+    uint32_t mainElement;
+    if (!DecodeSymbol(m_mainTree, mainElement))
+      return false;
+
+    // literal
+    if (mainElement < LZX_NUM_CHARS) {
+      if (m_pos >= m_outSize)
+        return false;
+      m_out[m_pos++] = (uint8_t)mainElement;
+      continue;
+    }
+
+    // match: (slot << 3) | length header
+    mainElement -= LZX_NUM_CHARS;
+    uint32_t matchLength = mainElement & LZX_NUM_PRIMARY_LENGTHS;
+    if (matchLength == LZX_NUM_PRIMARY_LENGTHS) {
+      uint32_t lengthFooter;
+      if (!DecodeSymbol(m_lengthTree, lengthFooter))
+        return false;
+      matchLength += lengthFooter;
+    }
+    matchLength += LZX_MIN_MATCH;
+
+    uint32_t matchOffset = mainElement >> 3;
+    switch (matchOffset) {
+    case 0:
+      matchOffset = m_r0;
+      break;
+    case 1:
+      matchOffset = m_r1;
+      m_r1 = m_r0;
+      m_r0 = matchOffset;
+      break;
+    case 2:
+      matchOffset = m_r2;
+      m_r2 = m_r0;
+      m_r0 = matchOffset;
+      break;
+    case 3:
+      matchOffset = 1;
+      m_r2 = m_r1;
+      m_r1 = m_r0;
+      m_r0 = matchOffset;
+      break;
+    default: {
+      uint32_t extra = s_slots.extraBits[matchOffset];
+      matchOffset = s_slots.positionBase[matchOffset] - 2;
+      if (!aligned) {
+        matchOffset += ReadBits(extra);
+      } else if (extra >= 3) {
+        // verbatim high bits, aligned tree for the low 3
+        matchOffset += ReadBits(extra - 3) << 3;
+        uint32_t alignedBits;
+        if (!DecodeSymbol(m_alignedTree, alignedBits))
+          return false;
+        matchOffset += alignedBits;
+      } else if (extra > 0) {
+        matchOffset += ReadBits(extra);
+      } else {
+        // not defined by the spec, same as the reference decoder
+        matchOffset = 1;
+      }
+      m_r2 = m_r1;
+      m_r1 = m_r0;
+      m_r0 = matchOffset;
+    }
+    }
+
+    // the output is the window, so matches can't reach before its start
+    if (matchOffset == 0 || matchOffset > m_pos || matchOffset > m_windowSize) {
+      printf("LZX: Match offset %u out of range at %u\n", matchOffset, m_pos);
+      return false;
+    }
+    if (matchLength > m_outSize - m_pos) {
+      printf("LZX: Match runs past the end of the output\n");
+      return false;
+    }
+
+    uint8_t *dest = m_out + m_pos;
+    const uint8_t *src = dest - matchOffset;
+    if (matchOffset >= matchLength) {
+      memcpy(dest, src, matchLength);
+    } else {
+      // overlapping, byte by byte repeats the pattern
+      for (uint32_t i = 0; i < matchLength; i++)
+        dest[i] = src[i];
+    }
+    m_pos += matchLength;
+  }
+
+  produced = m_pos - start;
+  return m_padWords <= LZX_MAX_PAD_WORDS;
+}
+
+bool LzxDecoder::DecodeUncompressed(uint32_t wanted) {
+  while (wanted > 0) {
+    if (m_inPos >= m_inLimit) {
+      m_inLimit = m_input->WaitFor(m_inPos + 1);
+      if (m_inPos >= m_inLimit)
+        return false;
+    }
+    size_t run = m_inLimit - m_inPos;
+    if (run > wanted)
+      run = wanted;
+    memcpy(m_out + m_pos, m_in + m_inPos, run);
+    m_pos += (uint32_t)run;
+    m_inPos += run;
+    wanted -= (uint32_t)run;
+  }
+  return true;
+}
+
+// x86 call translation, the output is kept untranslated while decoding since it is also
+// the window, so every frame is translated at the end
+void LzxDecoder::TranslateE8(uint32_t firstFrame) {
+  for (uint32_t frameStart = firstFrame * LZX_FRAME_SIZE; frameStart < m_outSize; frameStart += LZX_FRAME_SIZE) {
+    if (frameStart / LZX_FRAME_SIZE >= 32768)
+      break;
+    const uint32_t frameSize = (m_outSize - frameStart) < LZX_FRAME_SIZE ? (m_outSize - frameStart) : LZX_FRAME_SIZE;
+    if (frameSize <= 10)
+      continue;
+
+    uint8_t *data = m_out + frameStart;
+    uint8_t *dataEnd = data + frameSize - 10;
+    int32_t curpos = (int32_t)frameStart;
+    const int32_t fileSize = (int32_t)m_intelFileSize;
+    while (data < dataEnd) {
+      if (*data++ != 0xE8) {
+        curpos++;
+        continue;
+      }
+      const int32_t absOff = (int32_t)(data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32_t)data[3] << 24));
+      if (absOff >= -curpos && absOff < fileSize) {
+        const int32_t relOff = (absOff >= 0) ? absOff - curpos : absOff + fileSize;
+        data[0] = (uint8_t)relOff;
+        data[1] = (uint8_t)(relOff >> 8);
+        data[2] = (uint8_t)(relOff >> 16);
+        data[3] = (uint8_t)(relOff >> 24);
+      }
+      data += 4;
+      curpos += 5;
+    }
+  }
+}
+
+bool LzxDecoder::Decompress(LzxInputStream &input, uint8_t *output, uint32_t outputSize) {
+  m_input = &input;
+  m_in = input.GetData();
+  m_inPos = 0;
+  m_inLimit = 0;
+  m_padWords = 0;
+  m_bitBuf = 0;
+  m_bitsLeft = 0;
+  m_out = output;
+  m_outSize = outputSize;
+  m_pos = 0;
+  m_blockType = 0;
+  m_blockLength = 0;
+  m_blockRemaining = 0;
+  m_r0 = m_r1 = m_r2 = 1;
+  m_intelStarted = false;
+  memset(m_mainLengths, 0, sizeof(m_mainLengths));
+  memset(m_lengthLengths, 0, sizeof(m_lengthLengths));
+
+  // stream header, x86 call translation file size
+  m_intelFileSize = 0;
+  if (ReadBits(1)) {
+    const uint32_t hi = ReadBits(16);
+    const uint32_t lo = ReadBits(16);
+    m_intelFileSize = (hi << 16) | lo;
+  }
+
+  uint32_t frame = 0;
+  uint32_t e8FirstFrame = UINT32_MAX;
+  while (m_pos < m_outSize) {
+    const uint32_t frameSize = (m_outSize - m_pos) < LZX_FRAME_SIZE ? (m_outSize - m_pos) : LZX_FRAME_SIZE;
+    const uint32_t frameEnd = m_pos + frameSize;
+
+    while (m_pos < frameEnd) {
+      if (m_blockRemaining == 0 && !ReadBlockHeader())
+        return false;
+      if (m_blockRemaining == 0)
+        continue;
+
+      uint32_t run = m_blockRemaining;
+      if (run > frameEnd - m_pos)
+        run = frameEnd - m_pos;
+
+      uint32_t produced = run;
+      bool ok;
+      if (m_blockType == LZX_BLOCKTYPE_UNCOMPRESSED)
+        ok = DecodeUncompressed(run);
+      else
+        ok = DecodeCompressed(run, produced);
+      if (!ok) {
+        printf("LZX: Corrupt data at output offset %u\n", m_pos);
+        return false;
+      }
+
+      // the last match can run over the wanted length but not over the block
+      if (produced > m_blockRemaining) {
+        printf("LZX: Match overran the block at output offset %u\n", m_pos);
+        return false;
+      }
+      m_blockRemaining -= produced;
+    }
+
+    // matches don't cross frames
+    if (m_pos != frameEnd) {
+      printf("LZX: Decoded past the frame end (%u != %u)\n", m_pos, frameEnd);
+      return false;
+    }
+
+    AlignToWord(false);
+    if (m_intelStarted && e8FirstFrame == UINT32_MAX)
+      e8FirstFrame = frame;
+    frame++;
+  }
+
+  if (m_intelFileSize != 0 && e8FirstFrame != UINT32_MAX)
+    TranslateE8(e8FirstFrame);
+  return true;
+}
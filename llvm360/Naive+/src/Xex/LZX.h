@@ -0,0 +1,133 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+//
+// Compressed input of the LZX decoder.
+// The producer (block decryption + hash checks) publishes bytes as they become ready and the
+// decoder waits only when it catches up with it, so both stages run at the same time.
+//
+class LzxInputStream {
+public:
+  LzxInputStream(const uint8_t *buffer, size_t capacity)
+    : m_buffer(buffer)
+    , m_capacity(capacity) {
+  }
+
+  // producer side, `totalBytes` is the size of the valid prefix of the buffer
+  void Publish(size_t totalBytes);
+  void Finish();
+
+  // consumer side, blocks until `needed` bytes are there or the producer is done,
+  // returns how many bytes are available
+  size_t WaitFor(size_t needed);
+  // the decoder gave up, the producer can stop early
+  void Abort();
+  inline bool IsAborted() const {
+    return m_aborted.load(std::memory_order_relaxed);
+  }
+
+  inline const uint8_t *GetData() const {
+    return m_buffer;
+  }
+
+private:
+  const uint8_t *m_buffer;
+  size_t m_capacity;
+
+  std::atomic<size_t> m_available{0};
+  std::atomic<bool> m_finished{false};
+  std::atomic<bool> m_aborted{false};
+  std::mutex m_mutex;
+  std::condition_variable m_cond;
+};
+
+//
+// LZX decompressor (the CAB/XEX flavour: 32KB frames, no reset interval).
+// Decodes straight into the caller's output buffer, the output is used as the sliding
+// window so there is no extra window copy.
+//
+class LzxDecoder {
+public:
+  LzxDecoder(uint32_t windowBits);
+
+  bool Decompress(LzxInputStream &input, uint8_t *output, uint32_t outputSize);
+
+private:
+  // canonical huffman table with a direct lookup for the short codes
+  struct HuffTable {
+    static constexpr uint32_t MAX_SYMBOLS = 256 + 50 * 8;
+    static constexpr uint32_t MAX_BITS = 16;
+
+    uint32_t tableBits = 0;
+    uint32_t numSymbols = 0;
+    bool empty = true;
+    uint16_t fast[1 << 12];  // (symbol << 4) | length, 0 = use the slow path
+    uint16_t sorted[MAX_SYMBOLS];
+    uint32_t firstCode[MAX_BITS + 1];
+    uint32_t count[MAX_BITS + 1];
+    uint32_t offset[MAX_BITS + 1];
+  };
+
+  bool BuildTable(HuffTable &table, const uint8_t *lengths, uint32_t numSymbols, uint32_t tableBits);
+  bool ReadLengths(uint8_t *lengths, uint32_t first, uint32_t last);
+  bool ReadBlockHeader();
+  bool DecodeCompressed(uint32_t wanted, uint32_t &produced);
+  bool DecodeUncompressed(uint32_t wanted);
+  void TranslateE8(uint32_t firstFrame);
+
+  // bit reader, 16 bit little endian words consumed MSB first
+  void Refill();
+  inline uint32_t PeekBits(uint32_t n) {
+    if (m_bitsLeft < n)
+      Refill();
+    return (uint32_t)(m_bitBuf >> (64 - n));
+  }
+  inline void RemoveBits(uint32_t n) {
+    m_bitBuf <<= n;
+    m_bitsLeft -= n;
+  }
+  inline uint32_t ReadBits(uint32_t n) {
+    if (n == 0)
+      return 0;
+    const uint32_t v = PeekBits(n);
+    RemoveBits(n);
+    return v;
+  }
+  bool DecodeSymbol(const HuffTable &table, uint32_t &symbol);
+  bool ReadByte(uint8_t &value);
+  void AlignToWord(bool forceSkip);
+
+  uint32_t m_windowSize;
+  uint32_t m_numOffsets;
+
+  LzxInputStream *m_input = nullptr;
+  const uint8_t *m_in = nullptr;
+  size_t m_inPos = 0;
+  size_t m_inLimit = 0;
+  uint32_t m_padWords = 0; // zero words fed after the end of the input
+  uint64_t m_bitBuf = 0;
+  uint32_t m_bitsLeft = 0;
+
+  uint8_t *m_out = nullptr;
+  uint32_t m_outSize = 0;
+  uint32_t m_pos = 0;
+
+  // block state
+  uint32_t m_blockType = 0;
+  uint32_t m_blockLength = 0;
+  uint32_t m_blockRemaining = 0;
+  uint32_t m_r0 = 1, m_r1 = 1, m_r2 = 1;
+  uint32_t m_intelFileSize = 0;
+  bool m_intelStarted = false;
+
+  uint8_t m_mainLengths[HuffTable::MAX_SYMBOLS] = {};
+  uint8_t m_lengthLengths[256] = {};
+  HuffTable m_pretree;
+  HuffTable m_mainTree;
+  HuffTable m_lengthTree;
+  HuffTable m_alignedTree;
+};
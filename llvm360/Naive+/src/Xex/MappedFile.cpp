@@ -0,0 +1,150 @@
+#include "MappedFile.h"
+#include <stdio.h>
+#include <cstdlib>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifndef _WIN32
+static std::string NarrowPath(const wchar_t *path) {
+  std::string ret;
+  const size_t len = std::wcstombs(nullptr, path, 0);
+  if (len == (size_t)-1) {
+    // not representable in the current locale, keep the ascii part
+    for (const wchar_t *c = path; *c; c++)
+      ret.push_back((char)*c);
+    return ret;
+  }
+  ret.resize(len);
+  std::wcstombs(ret.data(), path, len + 1);
+  return ret;
+}
+#endif
+
+MappedFile::~MappedFile() {
+  Close();
+}
+
+bool MappedFile::Open(const wchar_t *path) {
+  Close();
+
+#ifdef _WIN32
+  HANDLE file = CreateFileW(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+    FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    printf("Unable to open file '%ls'\n", path);
+    return false;
+  }
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart == 0 || size.QuadPart > UINT32_MAX) {
+    CloseHandle(file);
+    return ReadFallback(path);
+  }
+
+  HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  const void *view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+  if (view == nullptr) {
+    if (mapping)
+      CloseHandle(mapping);
+    CloseHandle(file);
+    return ReadFallback(path);
+  }
+
+  m_fileHandle = file;
+  m_mappingHandle = mapping;
+  m_data = (const uint8_t *)view;
+  m_size = (uint32_t)size.QuadPart;
+#else
+  const std::string narrowPath = NarrowPath(path);
+  const int fd = open(narrowPath.c_str(), O_RDONLY);
+  if (fd < 0) {
+    printf("Unable to open file '%ls'\n", path);
+    return false;
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size == 0 || (uint64_t)st.st_size > UINT32_MAX) {
+    close(fd);
+    return ReadFallback(path);
+  }
+
+  void *view = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (view == MAP_FAILED) {
+    close(fd);
+    return ReadFallback(path);
+  }
+  // the loader walks the file front to back once
+  madvise(view, (size_t)st.st_size, MADV_SEQUENTIAL);
+
+  m_fd = fd;
+  m_data = (const uint8_t *)view;
+  m_size = (uint32_t)st.st_size;
+#endif
+
+  m_mapped = true;
+  return true;
+}
+
+bool MappedFile::ReadFallback(const wchar_t *path) {
+  FILE *f = nullptr;
+#ifdef _WIN32
+  _wfopen_s(&f, path, L"rb");
+#else
+  f = fopen(NarrowPath(path).c_str(), "rb");
+#endif
+  if (nullptr == f) {
+    printf("Unable to open file '%ls'\n", path);
+    return false;
+  }
+
+  fseek(f, 0, SEEK_END);
+  const uint32_t fileSize = (uint32_t)ftell(f);
+  fseek(f, 0, SEEK_SET);
+
+  uint8_t *data = (uint8_t *)malloc(fileSize ? fileSize : 1);
+  if (data == nullptr || fread(data, 1, fileSize, f) != fileSize) {
+    printf("Unable to read file '%ls'\n", path);
+    free(data);
+    fclose(f);
+    return false;
+  }
+  fclose(f);
+
+  m_data = data;
+  m_size = fileSize;
+  m_mapped = false;
+  return true;
+}
+
+void MappedFile::Close() {
+  if (m_data == nullptr)
+    return;
+
+  if (!m_mapped) {
+    free((void *)m_data);
+  } else {
+#ifdef _WIN32
+    UnmapViewOfFile(m_data);
+    CloseHandle((HANDLE)m_mappingHandle);
+    CloseHandle((HANDLE)m_fileHandle);
+#else
+    munmap((void *)m_data, m_size);
+    close(m_fd);
+#endif
+  }
+
+  m_data = nullptr;
+  m_size = 0;
+  m_mapped = false;
+  m_fileHandle = nullptr;
+  m_mappingHandle = nullptr;
+  m_fd = -1;
+}
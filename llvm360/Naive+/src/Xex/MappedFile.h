@@ -0,0 +1,41 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+//
+// Read only view of a whole file.
+// Maps the file when the OS lets us (MapViewOfFile / mmap) so the loader can parse it in
+// place, if mapping fails it falls back to reading it into a heap buffer.
+//
+class MappedFile {
+public:
+  MappedFile() = default;
+  ~MappedFile();
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  bool Open(const wchar_t *path);
+  void Close();
+
+  inline const uint8_t *GetData() const {
+    return m_data;
+  }
+  inline uint32_t GetSize() const {
+    return m_size;
+  }
+  inline bool IsMapped() const {
+    return m_mapped;
+  }
+
+private:
+  bool ReadFallback(const wchar_t *path);
+
+  const uint8_t *m_data = nullptr;
+  uint32_t m_size = 0;
+  bool m_mapped = false;
+
+  // platform handles
+  void *m_fileHandle = nullptr;
+  void *m_mappingHandle = nullptr;
+  int m_fd = -1;
+};
@@ -1,9 +1,22 @@
 #include "XexLoader.h"
 #include "AES.h"
+#include "AESCBC.h"
+#include "LZX.h"
+#include "misc/SHA1.h"
+#include <chrono>
+#include <thread>
 #include <stdio.h>
 #include <cstdint>
 #include <cassert>
+#ifdef _WIN32
 #include <windows.h>
+#else
+// the PE values the loader checks, winnt.h has them on Windows
+#define IMAGE_SUBSYSTEM_XBOX 14
+#define IMAGE_SCN_MEM_EXECUTE 0x20000000
+#define IMAGE_SCN_MEM_READ 0x40000000
+#define IMAGE_SCN_MEM_WRITE 0x80000000
+#endif
 #include "ImportTable.h"
 
 
@@ -13,75 +26,46 @@ XexImage::XexImage(const wchar_t *path)
 }
 
 bool XexImage::LoadXex() {
-
-
-    // fill import table
-    initImportTable();
-
     // without initializing the xexData debugging in visual studio was messing with the title id (cause random value) ups :3
     m_xexData = {};
 
-  // open the file
-  FILE *f = nullptr;
-  _wfopen_s(&f, m_path.c_str(), L"rb");
-
-  if (nullptr == f) {
-    printf("Unable to open file '%ls'", m_path.c_str());
-    return false; // Return false instead of S_OK
-  }
-
-  // get file size
-  fseek(f, 0, SEEK_END);
-  const uint32_t fileSize = ftell(f);
-  fseek(f, 0, SEEK_SET);
-
-  // load data
-  uint8_t *fileData = new uint8_t[fileSize];
-  {
-    const uint32_t bufferSize = 4096;
-    for (uint32_t i = 0; i < fileSize; i += bufferSize) {
-      const int bufferReadSize = ((fileSize - i) > bufferSize) ? bufferSize : fileSize - i;
-      fread(fileData + i, bufferReadSize, 1, f);
-    }
-    fclose(f);
-  }
+  // map the file, headers and image data are read straight from the mapping
+  if (!m_file.Open(m_path.c_str()))
+    return false;
 
   printf("Parsing headers...\n");
-  ImageByteReaderXEX reader(fileData, fileSize);
+  ImageByteReaderXEX reader(m_file.GetData(), m_file.GetSize());
   if (!LoadHeaders(reader)) {
-    delete[] fileData;
+    m_file.Close();
     return false;
   }
 
   // load, decompress and decrypt image data
   printf("Decompressing image...\n");
   if (!LoadImageData(reader)) {
-    delete[] fileData;
+    m_file.Close();
     return false;
   }
 
   // load the embedded PE image from memory image
   printf("Loading PE image...\n");
-  if (!LoadPEImage(fileData + m_xexData.header.exe_offset,
-        fileSize - m_xexData.header.exe_offset)) {
-    free((void *)m_memoryData);
-    delete[] fileData;
-    m_memoryData = nullptr;
-    m_memorySize = 0;
+  if (!LoadPEImage(m_file.GetData() + m_xexData.header.exe_offset,
+        m_file.GetSize() - m_xexData.header.exe_offset)) {
+    ReleaseMemory();
+    m_file.Close();
     return false;
   }
 
-  // the file data buffer can be freed
-  delete[] fileData;
-
+  // the file can be dropped unless the image is a view into it
+  if (m_ownsMemory)
+    m_file.Close();
 
   // finally, patch the imports
   printf("Patching imports...\n");
   if (!PatchImports())
   {
-      free((void*)m_memoryData);
-      m_memoryData = nullptr;
-      m_memorySize = 0;
+      ReleaseMemory();
+      m_file.Close();
       return false;
   }
 
@@ -94,8 +78,7 @@ bool XexImage::LoadImageData(ImageByteReaderXEX &data) {
   switch (compType) {
   case XEX_COMPRESSION_NONE: {
     printf("XEX: image::Binary is not compressed\n");
-    printf("-------- COMPRESSION UNSUPPORTED ---------\n");
-    // return LoadImageDataUncompressed(log, data);
+    return LoadImageDataUncompressed(data);
   }
 
   case XEX_COMPRESSION_BASIC: {
@@ -104,9 +87,8 @@ bool XexImage::LoadImageData(ImageByteReaderXEX &data) {
   }
 
   case XEX_COMPRESSION_NORMAL: {
-    printf("XEX: image::Binary is using normal compression");
-    printf("-------- COMPRESSION UNSUPPORTED ---------\n");
-    // return LoadImageDataNormal(log, data);
+    printf("XEX: image::Binary is using normal compression (LZX)\n");
+    return LoadImageDataNormal(data);
   }
   }
 
@@ -116,6 +98,49 @@ bool XexImage::LoadImageData(ImageByteReaderXEX &data) {
   return false;
 }
 
+void XexImage::ReleaseMemory() {
+  if (m_ownsMemory)
+    free((void *)m_memoryData);
+  m_memoryData = nullptr;
+  m_memorySize = 0;
+  m_ownsMemory = false;
+}
+
+bool XexImage::LoadImageDataUncompressed(ImageByteReaderXEX &data) {
+  const uint32_t sourceSize = (uint32_t)(data.GetSize() - m_xexData.header.exe_offset);
+  const uint8_t *sourceBuffer = data.GetData() + m_xexData.header.exe_offset;
+
+  // plain image, just point at the file data, no copy
+  if (m_xexData.file_format_info.encryption_type == XEX_ENCRYPTION_NONE) {
+    m_memoryData = sourceBuffer;
+    m_memorySize = sourceSize;
+    m_ownsMemory = false;
+    printf("XEX: Using %d bytes of image data in place\n", sourceSize);
+    return true;
+  }
+
+  uint8_t *memory = (uint8_t *)malloc(sourceSize);
+  if (nullptr == memory) {
+    printf("Failed to allocate image memory (size = 0x%X)\n", sourceSize);
+    return false;
+  }
+
+  const auto decryptStart = std::chrono::high_resolution_clock::now();
+  AesCbcDecryptor aes(m_xexData.session_key);
+  const uint32_t encryptedSize = sourceSize & ~15u;
+  aes.Decrypt(sourceBuffer, memory, encryptedSize);
+  // trailing partial block is not encrypted
+  memcpy(memory + encryptedSize, sourceBuffer + encryptedSize, sourceSize - encryptedSize);
+  printf("XEX: Decrypted %d bytes in %.3f ms (%s)\n", encryptedSize,
+    std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - decryptStart).count(),
+    aes.GetBackendName());
+
+  m_memoryData = memory;
+  m_memorySize = sourceSize;
+  m_ownsMemory = true;
+  return true;
+}
+
 bool XexImage::LoadImageDataBasic(ImageByteReaderXEX &data) {
   // calculate the uncompressed size
   uint32_t memorySize = 0;
@@ -139,6 +164,18 @@ bool XexImage::LoadImageDataBasic(ImageByteReaderXEX &data) {
     return false;
   }
 
+  // unencrypted and no zero fill between the blocks, the image is the file data as is
+  bool contiguous = m_xexData.file_format_info.encryption_type == XEX_ENCRYPTION_NONE;
+  for (uint32_t i = 0; contiguous && i < blockCount; ++i)
+    contiguous = m_xexData.file_format_info.basic_blocks[i].zero_size == 0;
+  if (contiguous && memorySize > 0 && memorySize <= sourceSize) {
+    m_memoryData = sourceBuffer;
+    m_memorySize = memorySize;
+    m_ownsMemory = false;
+    printf("XEX: Using %d bytes of image data in place\n", memorySize);
+    return true;
+  }
+
   // Allocate in-place the XEX memory.
   uint8_t *memory = (uint8_t *)malloc(memorySize);
   if (nullptr == memory) {
@@ -147,9 +184,8 @@ bool XexImage::LoadImageDataBasic(ImageByteReaderXEX &data) {
   }
 
   // The decryption state is global for all blocks
-  uint32_t rk[4 * (MAXNR + 1)];
-  uint8_t ivec[16] = {0};
-  int Nr = rijndaelKeySetupDec(rk, m_xexData.session_key, 128);
+  AesCbcDecryptor aes(m_xexData.session_key);
+  const auto decryptStart = std::chrono::high_resolution_clock::now();
 
   // Destination memory pointers
   uint8_t *destMemory = memory;
@@ -173,20 +209,8 @@ bool XexImage::LoadImageDataBasic(ImageByteReaderXEX &data) {
 
     // AES
     case XEX_ENCRYPTION_NORMAL: {
-      const uint8_t *ct = sourceBuffer;
-      uint8_t *pt = destMemory;
-      for (uint32_t n = 0; n < data_size; n += 16, ct += 16, pt += 16) {
-
-        // Decrypt 16 uint8_ts from input -> output.
-        rijndaelDecrypt(rk, Nr, ct, pt);
-
-        // XOR with previous
-        for (uint32_t i = 0; i < 16; i++) {
-          pt[i] ^= ivec[i];
-          ivec[i] = ct[i];
-        }
-      }
-
+      // blocks are always a multiple of 16
+      aes.Decrypt(sourceBuffer, destMemory, (data_size + 15) & ~15u);
       break;
     }
     }
@@ -227,7 +251,164 @@ bool XexImage::LoadImageDataBasic(ImageByteReaderXEX &data) {
   // loaded
   m_memoryData = memory;
   m_memorySize = memorySize;
-  printf("XEX: Decompressed %d bytes from %d disk bytes\n", memorySize, sourceSize);
+  m_ownsMemory = true;
+  printf("XEX: Decompressed %d bytes from %d disk bytes in %.3f ms", memorySize, sourceSize,
+    std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - decryptStart).count());
+  if (m_xexData.file_format_info.encryption_type == XEX_ENCRYPTION_NORMAL)
+    printf(" (%s)", aes.GetBackendName());
+  printf("\n");
+  return true;
+}
+
+bool XexImage::LoadImageDataNormal(ImageByteReaderXEX &data) {
+  const XEXFileNormalCompressionInfo &normal = m_xexData.file_format_info.normal;
+  if (normal.window_bits < 15 || normal.window_bits > 21) {
+    printf("XEX: Unsupported LZX window size 0x%X\n", normal.window_size);
+    return false;
+  }
+
+  // source data
+  const uint32_t sourceSize = (uint32_t)(data.GetSize() - m_xexData.header.exe_offset);
+  const uint8_t *sourceBuffer = data.GetData() + m_xexData.header.exe_offset;
+
+  // sanity check
+  const uint32_t memorySize = m_xexData.loader_info.image_size;
+  const uint32_t maxImageSize = 128 << 20;
+  if (memorySize == 0 || memorySize >= maxImageSize) {
+    printf("XEX: Invalid image size for normal compression (%X)\n", memorySize);
+    return false;
+  }
+
+  // the compressed stream is the payload of the hashed blocks, never larger than the source
+  const bool encrypted = m_xexData.file_format_info.encryption_type == XEX_ENCRYPTION_NORMAL;
+  uint8_t *decrypted = encrypted ? (uint8_t *)malloc(sourceSize) : nullptr;
+  uint8_t *compressed = (uint8_t *)malloc(sourceSize);
+  uint8_t *memory = (uint8_t *)malloc(memorySize);
+  if ((encrypted && nullptr == decrypted) || nullptr == compressed || nullptr == memory) {
+    printf("Failed to allocate image memory (size = 0x%X)\n", memorySize);
+    free(decrypted);
+    free(compressed);
+    free(memory);
+    return false;
+  }
+
+  const auto decompressStart = std::chrono::high_resolution_clock::now();
+  AesCbcDecryptor aes(m_xexData.session_key);
+  LzxInputStream stream(compressed, sourceSize);
+
+  // Producer: decrypt block by block, check the block hash and publish the payload chunks,
+  // LZX decoding runs on this thread at the same time and only waits when it catches up
+  uint32_t hashMismatches = 0;
+  bool blockError = false;
+  std::thread producer([&] {
+    const uint8_t *blocks = encrypted ? decrypted : sourceBuffer;
+    const uint32_t encryptedSize = sourceSize & ~15u;
+    uint32_t decryptedSize = 0;
+
+    uint32_t blockOffset = 0;
+    uint32_t blockSize = normal.block_size;
+    uint8_t blockHash[20];
+    memcpy(blockHash, normal.block_hash, sizeof(blockHash));
+    size_t compressedSize = 0;
+
+    while (blockSize != 0 && !stream.IsAborted()) {
+      if (blockSize < 24 || blockSize > sourceSize - blockOffset) {
+        printf("XEX: Compressed block at 0x%X has invalid size 0x%X\n", blockOffset, blockSize);
+        blockError = true;
+        break;
+      }
+
+      // decrypt up to the end of this block, the CBC state carries over to the next one
+      if (encrypted && decryptedSize < blockOffset + blockSize) {
+        uint32_t decryptEnd = (blockOffset + blockSize + 15) & ~15u;
+        if (decryptEnd > encryptedSize)
+          decryptEnd = encryptedSize;
+        aes.Decrypt(sourceBuffer + decryptedSize, decrypted + decryptedSize, decryptEnd - decryptedSize);
+        decryptedSize = decryptEnd;
+        if (decryptedSize == encryptedSize) {
+          // trailing partial block is not encrypted
+          memcpy(decrypted + encryptedSize, sourceBuffer + encryptedSize, sourceSize - encryptedSize);
+          decryptedSize = sourceSize;
+        }
+      }
+
+      const uint8_t *block = blocks + blockOffset;
+      uint8_t digest[20];
+      SHA1::Hash(block, blockSize, digest);
+      if (memcmp(digest, blockHash, sizeof(digest)) != 0) {
+        hashMismatches++;
+        // the payload of a corrupt block would decode into garbage code
+        if (!m_ignoreHashMismatch) {
+          printf("XEX: Compressed block at 0x%X failed the hash check\n", blockOffset);
+          break;
+        }
+      }
+
+      // block header: size and hash of the next block
+      const uint32_t nextSize = ((uint32_t)block[0] << 24) | ((uint32_t)block[1] << 16) | ((uint32_t)block[2] << 8) | block[3];
+      memcpy(blockHash, block + 4, sizeof(blockHash));
+
+      // chunks: 16 bit big endian size + payload, zero size ends the block
+      uint32_t pos = 24;
+      while (pos + 2 <= blockSize) {
+        const uint32_t chunkSize = ((uint32_t)block[pos] << 8) | block[pos + 1];
+        pos += 2;
+        if (chunkSize == 0)
+          break;
+        if (chunkSize > blockSize - pos) {
+          printf("XEX: Compressed chunk at 0x%X runs past its block\n", blockOffset + pos);
+          blockError = true;
+          break;
+        }
+        memcpy(compressed + compressedSize, block + pos, chunkSize);
+        compressedSize += chunkSize;
+        pos += chunkSize;
+      }
+      if (blockError)
+        break;
+
+      stream.Publish(compressedSize);
+      blockOffset += blockSize;
+      blockSize = nextSize;
+    }
+
+    stream.Finish();
+  });
+
+  LzxDecoder lzx(normal.window_bits);
+  const bool decoded = lzx.Decompress(stream, memory, memorySize);
+  if (!decoded)
+    stream.Abort();
+  producer.join();
+
+  free(compressed);
+  free(decrypted);
+
+  if (hashMismatches != 0 && !m_ignoreHashMismatch) {
+    printf("XEX: Image data is corrupt (--ignore-hash loads it anyway)\n");
+    free(memory);
+    return false;
+  }
+  if (hashMismatches != 0)
+    printf("XEX: Warning, %u compressed blocks failed the hash check\n", hashMismatches);
+
+  if (!decoded || blockError) {
+    printf("XEX: Failed to decompress the LZX image data\n");
+    free(memory);
+    return false;
+  }
+
+  // loaded
+  m_memoryData = memory;
+  m_memorySize = memorySize;
+  m_ownsMemory = true;
+  printf("XEX: Decompressed %d bytes from %d disk bytes in %.3f ms", memorySize, sourceSize,
+    std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - decompressStart).count());
+  if (encrypted)
+    printf(" (LZX, %s)", aes.GetBackendName());
+  else
+    printf(" (LZX)");
+  printf("\n");
   return true;
 }
 
@@ -719,12 +900,17 @@ bool XexImage::LoadPEImage(const uint8_t *fileData, const uint32_t fileDataSize)
 
     // resize image data
     const uint32_t oldMemorySize = m_memorySize;
-    uint8_t *newMemoryData = new uint8_t[extendedMemorySize];
+    uint8_t *newMemoryData = (uint8_t *)malloc(extendedMemorySize);
+    if (nullptr == newMemoryData) {
+      printf("Failed to allocate image memory (size = 0x%X)\n", extendedMemorySize);
+      return false;
+    }
     memset(newMemoryData, 0, extendedMemorySize);
     memcpy(newMemoryData, m_memoryData, m_memorySize);
-    delete[] m_memoryData;
+    ReleaseMemory();
     m_memorySize = extendedMemorySize;
     m_memoryData = newMemoryData;
+    m_ownsMemory = true;
 
     // copy extra sectiomn
     for (uint32_t i = 0; i < m_sections.size(); ++i) {
@@ -778,6 +964,24 @@ bool XexImage::PatchImports()
     // pointer will yield a value that & 0xFFFF = the import ordinal,
     // >> 16 & 0xFF = import library index, and >> 24 & 0xFF = 0 if a variable
     // (just get address) or 1 if a thunk (needs rewrite).
+
+    // resolve the library names once, records only carry the index
+    std::vector<XboxLibrary> libs(m_libNames.size(), XboxKrnl);
+    std::vector<bool> libKnown(m_libNames.size(), false);
+    for (size_t l = 0; l < m_libNames.size(); ++l)
+    {
+        XboxLibrary lib;
+        if (findImportLibrary(m_libNames[l], lib))
+        {
+            libs[l] = lib;
+            libKnown[l] = true;
+        }
+        else
+        {
+            printf("XEX: Unknown import library '%s'\n", m_libNames[l].c_str());
+        }
+    }
+
     for (uint32_t i = 0; i < m_xexData.import_records.size(); ++i)
     {
         const uint32_t tableAddress = m_xexData.import_records[i];
@@ -807,21 +1011,22 @@ bool XexImage::PatchImports()
                 printf("XEX: invalid import type 0 record lib index (%d, max:%d)\n", libIndex, m_libNames.size());
                 continue;
             }
+            if (!libKnown[libIndex])
+                continue;
 
             // get the export info
             const uint32_t importOrdinal = (value & 0xFFFF);
-            const std::string importLibName = m_libNames[libIndex];
             const uint32_t importAddress = (m_xexData.import_records[i]);
 
             // find the import
-            Import* table_imp = findImport_FromLib(importLibName, importOrdinal);
-            Import* impV = new Import(table_imp->lib, VARIABLE, std::string{ table_imp->name.c_str() }, table_imp->ordinal);
+            const KnownImport* table_imp = findImport_FromLib(libs[libIndex], importOrdinal);
+            Import* impV = new Import(libs[libIndex], VARIABLE, table_imp ? table_imp->name : "", importOrdinal);
 
             // autogenerate import name if not known
             if (impV->name.empty())
             {
                 char autoExportName[256];
-                sprintf_s(autoExportName, 256, "Export%d", importOrdinal);
+                snprintf(autoExportName, sizeof(autoExportName), "Export%d", importOrdinal);
                 impV->name = autoExportName;
             }
 
@@ -840,21 +1045,22 @@ bool XexImage::PatchImports()
                 printf("XEX: invalid import type 1 record lib index (%d, max:%d)\n", libIndex, m_libNames.size());
                 continue;
             }
+            if (!libKnown[libIndex])
+                continue;
 
             // get the export info
             const uint32_t importOrdinal = (value & 0xFFFF);
-            const std::string importLibName = m_libNames[libIndex];
             const uint32_t importAddress = (m_xexData.import_records[i]);
 
             // find the import
-            Import* table_imp = findImport_FromLib(importLibName, importOrdinal);
-            Import* imp = new Import(table_imp->lib, FUNCTION, std::string{ table_imp->name.c_str()}, table_imp->ordinal);
+            const KnownImport* table_imp = findImport_FromLib(libs[libIndex], importOrdinal);
+            Import* imp = new Import(libs[libIndex], FUNCTION, table_imp ? table_imp->name : "", importOrdinal);
 
             // autogenerate import name if not known
             if (imp->name.empty())
             {
                 char autoExportName[256];
-                sprintf_s(autoExportName, 256, "Export%d", importOrdinal);
+                snprintf(autoExportName, sizeof(autoExportName), "Export%d", importOrdinal);
                 imp->name = autoExportName;
             }
 
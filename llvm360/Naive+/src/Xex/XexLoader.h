@@ -1,5 +1,6 @@
 #pragma once
 #include "XEXImage.h"
+#include "MappedFile.h"
 #include <string>
 
 class Section;
@@ -133,7 +134,9 @@ public:
   bool LoadImageData(ImageByteReaderXEX &data);
 
   // Compression
+  bool LoadImageDataUncompressed(ImageByteReaderXEX &data);
   bool LoadImageDataBasic(ImageByteReaderXEX &data);
+  bool LoadImageDataNormal(ImageByteReaderXEX &data);
 
   // PE
   bool LoadPEImage(const uint8_t *fileData, const uint32_t fileDataSize);
@@ -141,6 +144,10 @@ public:
 
   bool PatchImports();
 
+  // keep loading when a compressed block fails its hash check instead of failing the load
+  inline void SetIgnoreHashMismatch(bool ignore) {
+    m_ignoreHashMismatch = ignore;
+  }
 
   inline const std::wstring &GetPath() const {
     return m_path;
@@ -204,9 +211,17 @@ private:
   XEXVersion m_version;
   XEXVersion m_minimalVersion;
 
-  uint32_t m_memorySize;
-  const uint8_t *m_memoryData;
+  // frees the image memory if we own it, it can also be a view into m_file
+  void ReleaseMemory();
+
+  uint32_t m_memorySize = 0;
+  const uint8_t *m_memoryData = nullptr;
+  bool m_ownsMemory = false;
   std::wstring m_path;
+  bool m_ignoreHashMismatch = false;
+
+  // the input file, kept open only while the image memory points into it
+  MappedFile m_file;
 
   uint64_t m_baseAddress;
   uint64_t m_entryAddress;
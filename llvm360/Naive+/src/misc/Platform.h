@@ -0,0 +1,18 @@
+#pragma once
+
+//
+// What the recompiler takes from the Windows headers, so it also builds on POSIX hosts.
+//
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <csignal>
+
+// stops in the debugger, ends the process without one like it does on Windows
+inline void DebugBreak() {
+  raise(SIGTRAP);
+}
+inline void __debugbreak() {
+  raise(SIGTRAP);
+}
+#endif
@@ -0,0 +1,126 @@
+#include "Profiler.h"
+#include <stdio.h>
+#include <fstream>
+#include <algorithm>
+
+Profiler &Profiler::Get() {
+  static Profiler profiler;
+  return profiler;
+}
+
+Profiler::Profiler()
+  : m_origin(std::chrono::steady_clock::now()) {
+}
+
+uint32_t Profiler::threadIndex(std::thread::id id) {
+  auto it = m_threads.find(id);
+  if (it != m_threads.end())
+    return it->second;
+  const uint32_t index = (uint32_t)m_threads.size();
+  m_threads.emplace(id, index);
+  return index;
+}
+
+void Profiler::Record(const char *category, const char *name, uint32_t address,
+                      std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) {
+  Event event;
+  event.category = category;
+  event.name = name;
+  event.address = address;
+  event.startUs = std::chrono::duration_cast<std::chrono::microseconds>(start - m_origin).count();
+  event.durationUs = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  event.thread = threadIndex(std::this_thread::get_id());
+  m_events.push_back(event);
+}
+
+void Profiler::Count(const std::string &counter, uint64_t value) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_counters[counter] += value;
+}
+
+void Profiler::PrintSummary() const {
+  struct Row {
+    const char *category;
+    const char *name;
+    uint64_t calls = 0;
+    int64_t totalUs = 0;
+    int64_t maxUs = 0;
+  };
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::map<std::pair<std::string, std::string>, Row> rows;
+  for (const Event &event : m_events) {
+    Row &row = rows[{event.category, event.name}];
+    row.category = event.category;
+    row.name = event.name;
+    row.calls++;
+    row.totalUs += event.durationUs;
+    row.maxUs = std::max(row.maxUs, event.durationUs);
+  }
+  std::vector<const Row *> sorted;
+  for (const auto &pair : rows)
+    sorted.push_back(&pair.second);
+  std::sort(sorted.begin(), sorted.end(), [](const Row *a, const Row *b) { return a->totalUs > b->totalUs; });
+
+  printf("\n%-10s %-32s %10s %12s %12s %12s\n", "category", "scope", "calls", "total ms", "avg ms", "max ms");
+  for (const Row *row : sorted) {
+    printf("%-10s %-32s %10llu %12.3f %12.3f %12.3f\n", row->category, row->name, (unsigned long long)row->calls,
+           row->totalUs / 1000.0, row->totalUs / 1000.0 / row->calls, row->maxUs / 1000.0);
+  }
+  if (!m_counters.empty()) {
+    printf("\n%-43s %10s\n", "counter", "value");
+    for (const auto &pair : m_counters)
+      printf("%-43s %10llu\n", pair.first.c_str(), (unsigned long long)pair.second);
+  }
+  printf("\n");
+}
+
+// names are identifiers, rule names and literals, only quotes and backslashes need escaping
+static std::string JsonString(const char *text) {
+  std::string out = "\"";
+  for (; *text != 0; text++) {
+    if (*text == '"' || *text == '\\')
+      out += '\\';
+    out += *text;
+  }
+  return out + "\"";
+}
+
+bool Profiler::WriteTrace(const std::string &path) const {
+  std::ofstream out(path, std::ios::trunc);
+  if (!out.is_open()) {
+    printf("Profiler: can't write %s\n", path.c_str());
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  int64_t lastUs = 0;
+  out << "{\"traceEvents\":[\n";
+  bool first = true;
+  for (const Event &event : m_events) {
+    out << (first ? "" : ",\n") << "{\"ph\":\"X\",\"pid\":1,\"tid\":" << event.thread << ",\"ts\":" << event.startUs
+        << ",\"dur\":" << event.durationUs << ",\"cat\":" << JsonString(event.category) << ",\"name\":";
+    if (event.address != PROFILE_NO_ADDRESS) {
+      char name[256];
+      snprintf(name, sizeof(name), "%s %08X", event.name, event.address);
+      out << JsonString(name);
+    } else {
+      out << JsonString(event.name);
+    }
+    out << "}";
+    lastUs = std::max(lastUs, event.startUs + event.durationUs);
+    first = false;
+  }
+  // counters are totals, one sample at the end of the run
+  for (const auto &pair : m_counters) {
+    out << (first ? "" : ",\n") << "{\"ph\":\"C\",\"pid\":1,\"tid\":0,\"ts\":" << lastUs
+        << ",\"name\":" << JsonString(pair.first.c_str()) << ",\"args\":{\"value\":" << pair.second << "}}";
+    first = false;
+  }
+  out << "\n]}\n";
+
+  printf("Profiler: trace written to %s (%zu events)\n", path.c_str(), m_events.size());
+  return out.good();
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <chrono>
+#include <thread>
+
+#define PROFILE_NO_ADDRESS 0xFFFFFFFF
+
+//
+// Pipeline instrumentation: timed scopes (passes, flow rules, emitted functions...) and
+// named counters, printed as a summary table and written as a Chrome trace (chrome://tracing,
+// Perfetto). Off by default, a disabled scope costs one branch.
+// Scopes sharing a name are one row of the summary, the address only shows up in the trace.
+//
+class Profiler {
+public:
+  static Profiler &Get();
+
+  inline void Enable(bool enable) {
+    m_enabled = enable;
+  }
+  inline bool enabled() const {
+    return m_enabled;
+  }
+
+  // thread safe, `category` and `name` must outlive the profiler (string literals, rule names)
+  void Record(const char *category, const char *name, uint32_t address, std::chrono::steady_clock::time_point start,
+              std::chrono::steady_clock::time_point end);
+  void Count(const std::string &counter, uint64_t value);
+
+  void PrintSummary() const;
+  bool WriteTrace(const std::string &path) const;
+
+private:
+  Profiler();
+
+  struct Event {
+    const char *category;
+    const char *name;
+    uint32_t address;
+    uint32_t thread;
+    int64_t startUs;
+    int64_t durationUs;
+  };
+
+  uint32_t threadIndex(std::thread::id id); // m_mutex held
+
+  bool m_enabled = false;
+  std::chrono::steady_clock::time_point m_origin;
+  mutable std::mutex m_mutex;
+  std::vector<Event> m_events;
+  std::map<std::string, uint64_t> m_counters;
+  std::map<std::thread::id, uint32_t> m_threads;
+};
+
+// times its own lifetime
+class ProfileScope {
+public:
+  ProfileScope(const char *category, const char *name, uint32_t address = PROFILE_NO_ADDRESS)
+    : m_category(category)
+    , m_name(name)
+    , m_address(address)
+    , m_active(Profiler::Get().enabled()) {
+    if (m_active)
+      m_start = std::chrono::steady_clock::now();
+  }
+  ~ProfileScope() {
+    if (m_active)
+      Profiler::Get().Record(m_category, m_name, m_address, m_start, std::chrono::steady_clock::now());
+  }
+  ProfileScope(const ProfileScope &) = delete;
+  ProfileScope &operator=(const ProfileScope &) = delete;
+
+private:
+  const char *m_category;
+  const char *m_name;
+  uint32_t m_address;
+  bool m_active;
+  std::chrono::steady_clock::time_point m_start;
+};
+
+// the value is computed whether profiling is on or not, a costly one goes under Profiler::Get().enabled()
+inline void ProfileCount(const char *counter, uint64_t value) {
+  if (Profiler::Get().enabled())
+    Profiler::Get().Count(counter, value);
+}
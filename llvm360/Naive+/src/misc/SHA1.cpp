@@ -0,0 +1,102 @@
+#include "SHA1.h"
+#include <cstring>
+
+static inline uint32_t Rol(uint32_t v, int n) {
+  return (v << n) | (v >> (32 - n));
+}
+
+SHA1::SHA1() {
+  m_state[0] = 0x67452301;
+  m_state[1] = 0xEFCDAB89;
+  m_state[2] = 0x98BADCFE;
+  m_state[3] = 0x10325476;
+  m_state[4] = 0xC3D2E1F0;
+}
+
+void SHA1::Transform(const uint8_t block[64]) {
+  uint32_t w[80];
+  for (int i = 0; i < 16; i++)
+    w[i] = ((uint32_t)block[i * 4] << 24) | ((uint32_t)block[i * 4 + 1] << 16) |
+           ((uint32_t)block[i * 4 + 2] << 8) | block[i * 4 + 3];
+  for (int i = 16; i < 80; i++)
+    w[i] = Rol(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+  uint32_t a = m_state[0], b = m_state[1], c = m_state[2], d = m_state[3], e = m_state[4];
+  for (int i = 0; i < 80; i++) {
+    uint32_t f, k;
+    if (i < 20) {
+      f = (b & c) | (~b & d);
+      k = 0x5A827999;
+    } else if (i < 40) {
+      f = b ^ c ^ d;
+      k = 0x6ED9EBA1;
+    } else if (i < 60) {
+      f = (b & c) | (b & d) | (c & d);
+      k = 0x8F1BBCDC;
+    } else {
+      f = b ^ c ^ d;
+      k = 0xCA62C1D6;
+    }
+    const uint32_t t = Rol(a, 5) + f + e + k + w[i];
+    e = d;
+    d = c;
+    c = Rol(b, 30);
+    b = a;
+    a = t;
+  }
+
+  m_state[0] += a;
+  m_state[1] += b;
+  m_state[2] += c;
+  m_state[3] += d;
+  m_state[4] += e;
+}
+
+void SHA1::Update(const uint8_t *data, size_t size) {
+  m_length += size;
+
+  if (m_bufferSize > 0) {
+    const size_t fill = (64 - m_bufferSize) < size ? (64 - m_bufferSize) : size;
+    memcpy(m_buffer + m_bufferSize, data, fill);
+    m_bufferSize += fill;
+    data += fill;
+    size -= fill;
+    if (m_bufferSize < 64)
+      return;
+    Transform(m_buffer);
+    m_bufferSize = 0;
+  }
+
+  for (; size >= 64; data += 64, size -= 64)
+    Transform(data);
+
+  memcpy(m_buffer, data, size);
+  m_bufferSize = size;
+}
+
+void SHA1::Final(uint8_t digest[20]) {
+  const uint64_t bitLength = m_length * 8;
+  const uint8_t pad = 0x80;
+  const uint8_t zero = 0;
+  Update(&pad, 1);
+  while (m_bufferSize != 56)
+    Update(&zero, 1);
+
+  uint8_t lengthBytes[8];
+  for (int i = 0; i < 8; i++)
+    lengthBytes[i] = (uint8_t)(bitLength >> (56 - i * 8));
+  Update(lengthBytes, 8);
+
+  for (int i = 0; i < 5; i++) {
+    digest[i * 4] = (uint8_t)(m_state[i] >> 24);
+    digest[i * 4 + 1] = (uint8_t)(m_state[i] >> 16);
+    digest[i * 4 + 2] = (uint8_t)(m_state[i] >> 8);
+    digest[i * 4 + 3] = (uint8_t)m_state[i];
+  }
+}
+
+void SHA1::Hash(const uint8_t *data, size_t size, uint8_t digest[20]) {
+  SHA1 sha;
+  sha.Update(data, size);
+  sha.Final(digest);
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+// plain SHA-1, used to check the XEX compressed block hashes
+class SHA1 {
+public:
+  SHA1();
+  void Update(const uint8_t *data, size_t size);
+  void Final(uint8_t digest[20]);
+
+  static void Hash(const uint8_t *data, size_t size, uint8_t digest[20]);
+
+private:
+  void Transform(const uint8_t block[64]);
+
+  uint32_t m_state[5];
+  uint64_t m_length = 0;
+  uint8_t m_buffer[64];
+  size_t m_bufferSize = 0;
+};
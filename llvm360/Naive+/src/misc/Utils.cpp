@@ -1,6 +1,63 @@
 #include "Utils.h"
 
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define HOST_X86 1
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
 uint32_t Swap32(uint32_t val) {
   return ((((val) & 0xff000000) >> 24) | (((val) & 0x00ff0000) >> 8) | (((val) & 0x0000ff00) << 8) |
           (((val) & 0x000000ff) << 24));
 }
+
+#ifdef HOST_X86
+static void CpuId(uint32_t leaf, uint32_t subLeaf, uint32_t regs[4]) {
+#ifdef _MSC_VER
+  __cpuidex((int *)regs, (int)leaf, (int)subLeaf);
+#else
+  __cpuid_count(leaf, subLeaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+// XCR0, tells if the OS saves the YMM state
+static uint64_t ReadXCR0() {
+#ifdef _MSC_VER
+  return _xgetbv(0);
+#else
+  uint32_t eax, edx;
+  __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return ((uint64_t)edx << 32) | eax;
+#endif
+}
+#endif
+
+static CpuFeatures DetectCpuFeatures() {
+  CpuFeatures features;
+#ifdef HOST_X86
+  uint32_t regs[4] = {};
+  CpuId(0, 0, regs);
+  const uint32_t maxLeaf = regs[0];
+
+  CpuId(1, 0, regs);
+  features.sse41 = (regs[2] >> 19) & 1;
+  features.aesni = (regs[2] >> 25) & 1;
+  const bool osxsave = (regs[2] >> 27) & 1;
+  const bool avxState = osxsave && (ReadXCR0() & 6) == 6;
+
+  if (maxLeaf >= 7 && avxState) {
+    CpuId(7, 0, regs);
+    features.avx2 = (regs[1] >> 5) & 1;
+    features.vaes = features.avx2 && features.aesni && ((regs[2] >> 9) & 1);
+  }
+#endif
+  return features;
+}
+
+const CpuFeatures &GetCpuFeatures() {
+  static const CpuFeatures features = DetectCpuFeatures();
+  return features;
+}
@@ -2,3 +2,13 @@
 #include <cstdint>
 
 uint32_t Swap32(uint32_t val);
+
+// host CPU features the SIMD paths pick from, detected once at first use
+struct CpuFeatures {
+  bool sse41 = false;
+  bool avx2 = false;
+  bool aesni = false;
+  bool vaes = false;
+};
+
+const CpuFeatures &GetCpuFeatures();